@@ -39,3 +39,7 @@ AC_MSG_RESULT([yes])
 AX_BOOST_CHECK_HEADERS([boost/operators.hpp],,[
   AC_MSG_ERROR([Boost's Operators library is required but wasn't found])
 ])
+
+AX_BOOST_CHECK_HEADERS([boost/container/small_vector.hpp],,[
+  AC_MSG_ERROR([Boost's Container library is required but wasn't found])
+])
@@ -0,0 +1,36 @@
+dnl
+dnl Check for LZ4
+dnl
+
+AC_ARG_WITH([lz4], AC_HELP_STRING([--without-lz4], [do not build with LZ4 support for the non-standard 'lz4' compression method]),
+            [ with_lz4=${withval} ], [ with_lz4=yes ])
+
+lz4_found=no
+if test "x$with_lz4" != "xno"; then
+  PKG_CHECK_EXISTS([liblz4],[lz4_found=yes],[lz4_found=no])
+  if test x"$lz4_found" = xyes; then
+    PKG_CHECK_MODULES([LZ4],[liblz4],[lz4_found=yes])
+  else
+    AC_MSG_CHECKING(for LZ4)
+    save_LIBS="$LIBS"
+    LIBS="$LIBS -llz4"
+    AC_TRY_LINK(
+      [#include <lz4hc.h>],
+      [LZ4_decompress_safe(0, 0, 0, 0);],
+      [lz4_found=yes; LZ4_LIBS=-llz4])
+    LIBS="$save_LIBS"
+    AC_MSG_RESULT($lz4_found)
+  fi
+fi
+
+if test x"$lz4_found" = xyes; then
+  AC_DEFINE(HAVE_LZ4,,[define if building with LZ4])
+  USE_LZ4=yes
+  opt_features_yes="$opt_features_yes\n   * LZ4 compression (non-standard)"
+else
+  opt_features_no="$opt_features_no\n   * LZ4 compression (non-standard)"
+fi
+
+AC_SUBST(LZ4_CFLAGS)
+AC_SUBST(LZ4_LIBS)
+AC_SUBST(USE_LZ4)
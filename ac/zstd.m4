@@ -0,0 +1,36 @@
+dnl
+dnl Check for zstd
+dnl
+
+AC_ARG_WITH([zstd], AC_HELP_STRING([--without-zstd], [do not build with zstd support for the non-standard 'zstd' compression method]),
+            [ with_zstd=${withval} ], [ with_zstd=yes ])
+
+zstd_found=no
+if test "x$with_zstd" != "xno"; then
+  PKG_CHECK_EXISTS([libzstd],[zstd_found=yes],[zstd_found=no])
+  if test x"$zstd_found" = xyes; then
+    PKG_CHECK_MODULES([ZSTD],[libzstd],[zstd_found=yes])
+  else
+    AC_MSG_CHECKING(for zstd)
+    save_LIBS="$LIBS"
+    LIBS="$LIBS -lzstd"
+    AC_TRY_LINK(
+      [#include <zstd.h>],
+      [ZSTD_decompress(0, 0, 0, 0);],
+      [zstd_found=yes; ZSTD_LIBS=-lzstd])
+    LIBS="$save_LIBS"
+    AC_MSG_RESULT($zstd_found)
+  fi
+fi
+
+if test x"$zstd_found" = xyes; then
+  AC_DEFINE(HAVE_ZSTD,,[define if building with zstd])
+  USE_ZSTD=yes
+  opt_features_yes="$opt_features_yes\n   * zstd compression (non-standard)"
+else
+  opt_features_no="$opt_features_no\n   * zstd compression (non-standard)"
+fi
+
+AC_SUBST(ZSTD_CFLAGS)
+AC_SUBST(ZSTD_LIBS)
+AC_SUBST(USE_ZSTD)
@@ -2346,6 +2346,16 @@ int avi_parse_input_file(avi_t *AVI, int getIndex)
          /* n must be a multiple of 16, but the reading does not
             break if this is not the case */
 
+         AVI->idx1_start = xio_lseek(AVI->fdes,0,SEEK_CUR);
+         AVI->idx1_len   = n;
+
+         /* Callers not wanting the index read it themselves on demand */
+         if(!getIndex)
+         {
+            xio_lseek(AVI->fdes,n,SEEK_CUR);
+            continue;
+         }
+
          AVI->n_idx = AVI->max_idx = n/16;
          AVI->idx = (unsigned  char((*)[16]) ) calloc(1, n);
          if(AVI->idx==0) ERR_EXIT(AVI_ERR_NO_MEM)
@@ -2442,6 +2452,8 @@ int avi_parse_input_file(avi_t *AVI, int getIndex)
 	     return(-1);
 	   }
 
+	   AVI->ttrack[AVI->tptr].audio_strn = num_stream;
+
 	   lasttag = 3;
 	 }
 
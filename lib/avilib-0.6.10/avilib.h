@@ -283,6 +283,8 @@ typedef struct
   uint32_t last_len;   /* Length of last frame written */
   int must_use_index;       /* Flag if frames are duplicated */
   int64_t  movi_start;
+  int64_t  idx1_start;        /* position & size of the idx1 chunk's data; */
+  int64_t  idx1_len;          /* only read into idx if requested */
   int total_frames;         /* total number of frames if dmlh is present */
   
   int anum;            // total number of audio tracks 
@@ -74,7 +74,7 @@ xio_read(int fd,
          size_t count) {
   if ((fd < 0) || (fd >= MAX_INSTANCES) || (instances[fd] == NULL))
     return -1;
-  return instances[fd]->read(buf, count);
+  return instances[fd]->fast_read(buf, count);
 }
 
 ssize_t
@@ -87,8 +87,6 @@ def create_iso15924_script_list_file
 
 namespace mtx::iso15924 {
 
-std::vector<script_t> g_scripts;
-
 struct script_init_t {
   char const *code;
   unsigned int number;
@@ -102,12 +100,19 @@ EOT
   footer = <<EOT
 };
 
-void
-init() {
-  g_scripts.reserve(#{rows.size});
+std::vector<script_t> const &
+scripts() {
+  static auto const s_scripts = []() {
+    std::vector<script_t> all;
+    all.reserve(#{rows.size});
+
+    for (script_init_t const *script = s_scripts_init, *end = script + #{rows.size}; script < end; ++script)
+      all.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
+
+    return all;
+  }();
 
-  for (script_init_t const *script = s_scripts_init, *end = script + #{rows.size}; script < end; ++script)
-    g_scripts.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
+  return s_scripts;
 }
 
 } // namespace mtx::iso15924
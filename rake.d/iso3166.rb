@@ -183,8 +183,6 @@ def create_iso3166_country_list_file
 
 namespace mtx::iso3166 {
 
-std::vector<region_t> g_regions;
-
 struct region_init_t {
   char const *alpha_2_code, *alpha_3_code;
   unsigned int number;
@@ -198,12 +196,19 @@ EOT
   footer = <<EOT
 };
 
-void
-init() {
-  g_regions.reserve(#{rows.size});
+std::vector<region_t> const &
+regions() {
+  static auto const s_regions = []() {
+    std::vector<region_t> all;
+    all.reserve(#{rows.size});
+
+    for (region_init_t const *region = s_regions_init, *end = region + #{rows.size}; region < end; ++region)
+      all.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
+
+    return all;
+  }();
 
-  for (region_init_t const *region = s_regions_init, *end = region + #{rows.size}; region < end; ++region)
-    g_regions.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
+  return s_regions;
 }
 
 } // namespace mtx::iso3166
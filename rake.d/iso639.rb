@@ -161,35 +161,48 @@ def create_iso639_language_list_file
 
 #include "common/iso639_types.h"
 
-using namespace std::string_literals;
-
 namespace mtx::iso639 {
 
-std::vector<language_t> g_languages;
+language_init_t const g_languages_init[] = {
+EOT
+
+  rows = rows.sort
 
-struct language_init_t {
-  char const *english_name, *alpha_3_code, *alpha_2_code, *terminology_abbrev;
-  bool is_part_of_iso639_2, is_deprecated;
+  # Maps each ISO 639-1, ISO 639-2 & terminology code to the first
+  # entry using it just like a linear search would find it.
+  idx_by_code = {}
+
+  rows.each_with_index do |row, idx|
+    row[1..3].
+      reject { |code| code == '""' }.
+      each   { |code| idx_by_code[code] ||= idx }
+  end
+
+  index_rows = idx_by_code.
+    keys.
+    sort.
+    map { |code| [ code, idx_by_code[code].to_s ] }
+
+  middle = <<EOT
 };
 
-static language_init_t const s_languages_init[] = {
+std::size_t const g_num_languages_init = #{rows.size};
+
+// Sorted by code for binary searches; the index refers to g_languages_init.
+code_index_t const g_languages_by_code[] = {
 EOT
 
   footer = <<EOT
 };
 
-void
-init() {
-  g_languages.reserve(#{rows.size});
-
-  for (language_init_t const *lang = s_languages_init, *end = lang + #{rows.size}; lang < end; ++lang)
-    g_languages.emplace_back(lang->english_name, lang->alpha_3_code, lang->alpha_2_code, lang->terminology_abbrev, lang->is_part_of_iso639_2, lang->is_deprecated);
-}
+std::size_t const g_num_languages_by_code = #{index_rows.size};
 
 } // namespace mtx::iso639
 EOT
 
-  content       = header + format_table(rows.sort, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
+  content       = header \
+    + format_table(rows,       :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + middle \
+    + format_table(index_rows, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
   cpp_file_name = "src/common/iso639_language_list.cpp"
 
   runq("write", cpp_file_name) { IO.write("#{$source_dir}/#{cpp_file_name}", content); 0 }
@@ -162,6 +162,8 @@ class Target
       when :intl             then c(:LIBINTL_LIBS)
       when :cmark            then c(:CMARK_LIBS)
       when :dvdread          then c(:DVDREAD_LIBS)
+      when :lz4              then c(:LZ4_LIBS)
+      when :zstd             then c(:ZSTD_LIBS)
       when :pugixml          then c?(:PUGIXML_INTERNAL) ? [ '-Llib/pugixml/src', '-lpugixml' ] : c(:PUGIXML_LIBS)
       when :qt               then c(:QT_LIBS)
       when :qt_non_gui       then c(:QT_LIBS_NON_GUI)
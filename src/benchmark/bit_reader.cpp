@@ -0,0 +1,212 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   benchmarks for the bit reader & the parsers built on it
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/bit_reader.h"
+#include "common/bit_writer.h"
+#include "common/math.h"
+#include "common/mpeg.h"
+
+namespace {
+
+void
+put_unsigned_golomb(mtx::bits::writer_c &w,
+                    uint64_t value) {
+  auto num_bits = mtx::math::int_log2(value + 1) + 1;
+
+  w.put_bits(num_bits - 1, 0);
+  w.put_bits(num_bits,     value + 1);
+}
+
+memory_cptr
+random_payload(std::size_t size) {
+  auto buffer    = memory_c::alloc(size);
+  auto data      = buffer->get_buffer();
+  uint32_t state = 0x12345678;
+
+  for (auto idx = 0u; idx < size; ++idx) {
+    state     = state * 1664525 + 1013904223;
+    data[idx] = state >> 24;
+  }
+
+  return buffer;
+}
+
+memory_cptr
+golomb_payload() {
+  mtx::bits::writer_c w;
+  uint32_t state = 0x12345678;
+
+  // Mostly small values just like in real parameter sets & slice
+  // headers.
+  for (auto idx = 0; idx < 64 * 1024; ++idx) {
+    state = state * 1664525 + 1013904223;
+    put_unsigned_golomb(w, (state >> 24) & ((state & 0x100) ? 0x0f : 0x03ff));
+  }
+
+  return w.get_buffer();
+}
+
+// Slice segment NAL units for a stream with one slice per picture
+// row, each one followed by a bit of slice data containing emulation
+// prevention bytes.
+std::vector<memory_cptr>
+hevc_slice_nalus() {
+  std::vector<memory_cptr> nalus;
+
+  for (auto idx = 0u; idx < 68; ++idx) {
+    mtx::bits::writer_c w;
+
+    w.put_bits(1, 0);                       // forbidden_zero_bit
+    w.put_bits(6, 1);                       // nal_unit_type (TRAIL_R)
+    w.put_bits(6, 0);                       // nuh_layer_id
+    w.put_bits(3, 1);                       // nuh_temporal_id_plus1
+    w.put_bit(idx == 0);                    // first_slice_segment_in_pic_flag
+    put_unsigned_golomb(w, 0);              // slice_pic_parameter_set_id
+    if (idx)
+      w.put_bits(13, idx * 120);            // slice_segment_address
+    put_unsigned_golomb(w, idx % 3);        // slice_type
+    w.put_bits(8, idx);                     // slice_pic_order_cnt_lsb
+    w.put_bit(false);                       // short_term_ref_pic_set_sps_flag
+    put_unsigned_golomb(w, 2);              // num_negative_pics
+    put_unsigned_golomb(w, 0);              // num_positive_pics
+    put_unsigned_golomb(w, 0);              // delta_poc_s0_minus1
+    w.put_bit(true);                        // used_by_curr_pic_s0_flag
+    put_unsigned_golomb(w, 3);              // delta_poc_s0_minus1
+    w.put_bit(true);                        // used_by_curr_pic_s0_flag
+    w.put_bit(true);                        // slice_sao_luma_flag
+    w.put_bit(true);                        // slice_sao_chroma_flag
+    put_unsigned_golomb(w, 1);              // five_minus_max_num_merge_cand
+    put_unsigned_golomb(w, idx % 7 + 1);    // slice_qp_delta (as se(v))
+
+    for (auto byte = 0u; byte < 32; ++byte)
+      w.put_bits(8, (byte % 5) < 2 ? 0 : byte);
+
+    nalus.emplace_back(mtx::mpeg::rbsp_to_nalu(w.get_buffer()));
+  }
+
+  return nalus;
+}
+
+uint64_t
+parse_hevc_slice_header(memory_cptr const &nalu) {
+  mtx::bits::reader_c r{*nalu};
+  r.enable_rbsp_mode();
+
+  uint64_t sum{};
+
+  r.skip_bits(1);                               // forbidden_zero_bit
+  sum += r.get_bits(6);                         // nal_unit_type
+  r.skip_bits(6);                               // nuh_layer_id
+  sum += r.get_bits(3);                         // nuh_temporal_id_plus1
+  auto first_slice_segment_in_pic = r.get_bit();
+  sum += r.get_unsigned_golomb();               // slice_pic_parameter_set_id
+  if (!first_slice_segment_in_pic)
+    sum += r.get_bits(13);                      // slice_segment_address
+  sum += r.get_unsigned_golomb();               // slice_type
+  sum += r.get_bits(8);                         // slice_pic_order_cnt_lsb
+  if (!r.get_bit()) {                           // short_term_ref_pic_set_sps_flag
+    auto num_negative_pics = r.get_unsigned_golomb();
+    auto num_positive_pics = r.get_unsigned_golomb();
+
+    for (auto idx = 0u; idx < (num_negative_pics + num_positive_pics); ++idx) {
+      sum += r.get_unsigned_golomb();           // delta_poc_s0/1_minus1
+      r.skip_bit();                             // used_by_curr_pic_s0/1_flag
+    }
+  }
+  sum += r.get_bits(2);                         // slice_sao_luma/chroma_flag
+  sum += r.get_unsigned_golomb();               // five_minus_max_num_merge_cand
+  sum += r.get_signed_golomb();                 // slice_qp_delta
+  r.byte_align();
+
+  return sum + r.get_bit_position();
+}
+
+void
+BM_GetBits(benchmark::State &state) {
+  auto payload = random_payload(64 * 1024);
+  auto width   = static_cast<std::size_t>(state.range(0));
+  auto count   = payload->get_size() * 8 / width;
+
+  for (auto _ : state) {
+    mtx::bits::reader_c r{*payload};
+    uint64_t sum{};
+
+    for (auto idx = 0u; idx < count; ++idx)
+      sum += r.get_bits(width);
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(state.iterations() * payload->get_size());
+}
+
+void
+BM_GetBitsRBSP(benchmark::State &state) {
+  auto payload = mtx::mpeg::rbsp_to_nalu(random_payload(64 * 1024));
+  auto width   = static_cast<std::size_t>(state.range(0));
+  auto count   = 64 * 1024 * 8 / width;
+
+  for (auto _ : state) {
+    mtx::bits::reader_c r{*payload};
+    r.enable_rbsp_mode();
+    uint64_t sum{};
+
+    for (auto idx = 0u; idx < count; ++idx)
+      sum += r.get_bits(width);
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(state.iterations() * payload->get_size());
+}
+
+void
+BM_GetUnsignedGolomb(benchmark::State &state) {
+  auto payload = golomb_payload();
+
+  for (auto _ : state) {
+    mtx::bits::reader_c r{*payload};
+    uint64_t sum{};
+
+    for (auto idx = 0; idx < 64 * 1024; ++idx)
+      sum += r.get_unsigned_golomb();
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 64 * 1024);
+}
+
+void
+BM_HEVCSliceHeader(benchmark::State &state) {
+  auto nalus = hevc_slice_nalus();
+
+  for (auto _ : state)
+    for (auto const &nalu : nalus)
+      benchmark::DoNotOptimize(parse_hevc_slice_header(nalu));
+
+  state.SetItemsProcessed(state.iterations() * nalus.size());
+}
+
+}
+
+BENCHMARK(BM_GetBits)->Arg(1)->Arg(3)->Arg(8)->Arg(13)->Arg(32);
+BENCHMARK(BM_GetBitsRBSP)->Arg(1)->Arg(8)->Arg(32);
+BENCHMARK(BM_GetUnsignedGolomb);
+BENCHMARK(BM_HEVCSliceHeader);
+
+BENCHMARK_MAIN();
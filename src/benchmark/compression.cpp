@@ -0,0 +1,114 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   benchmarks for the content compression methods
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/compression.h"
+
+namespace {
+
+// Roughly what a text subtitle frame looks like: short, repetitive
+// markup.
+memory_cptr
+subtitle_payload() {
+  std::string text;
+  for (auto idx = 0; idx < 4; ++idx)
+    text += fmt::format("{{\\an8}}<i>Line {0} of a typical subtitle event with some dialog.</i>\\N", idx);
+
+  return memory_c::clone(text);
+}
+
+// Interleaved 16-bit stereo PCM: a low-amplitude sine wave with a
+// bit of deterministic noise so that it isn't trivially compressible.
+memory_cptr
+pcm_payload() {
+  auto const num_samples = 48000 / 25; // one video frame's worth
+  auto buffer            = memory_c::alloc(num_samples * 2 * 2);
+  auto samples           = reinterpret_cast<int16_t *>(buffer->get_buffer());
+  uint32_t noise         = 0x12345678;
+
+  for (auto idx = 0; idx < num_samples; ++idx) {
+    noise                  = noise * 1664525 + 1013904223;
+    auto value             = static_cast<int16_t>(std::sin(idx * 2 * M_PI * 440 / 48000) * 3000 + ((noise >> 24) & 0x0f));
+    samples[idx * 2]       = value;
+    samples[idx * 2 + 1]   = value / 2;
+  }
+
+  return buffer;
+}
+
+compression_parameters_t
+parameters_for(benchmark::State const &state) {
+  compression_parameters_t parameters;
+  if (state.range(1))
+    parameters.m_level = state.range(1);
+
+  return parameters;
+}
+
+void
+run_compression(benchmark::State &state,
+                memory_cptr const &payload) {
+  auto compressor      = compressor_c::create(static_cast<compression_method_e>(state.range(0)), parameters_for(state));
+  std::size_t out_size = 0;
+
+  for (auto _ : state)
+    out_size = compressor->compress(payload)->get_size();
+
+  state.SetBytesProcessed(state.iterations() * payload->get_size());
+  state.counters["ratio"] = out_size * 100.0 / payload->get_size();
+}
+
+void
+run_decompression(benchmark::State &state,
+                  memory_cptr const &payload) {
+  auto compressor = compressor_c::create(static_cast<compression_method_e>(state.range(0)), parameters_for(state));
+  auto compressed = compressor->compress(payload);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(compressor->decompress(compressed));
+
+  state.SetBytesProcessed(state.iterations() * payload->get_size());
+}
+
+void BM_CompressSubtitles(benchmark::State &state)   { run_compression(state,   subtitle_payload()); }
+void BM_DecompressSubtitles(benchmark::State &state) { run_decompression(state, subtitle_payload()); }
+void BM_CompressPCM(benchmark::State &state)         { run_compression(state,   pcm_payload()); }
+void BM_DecompressPCM(benchmark::State &state)       { run_decompression(state, pcm_payload()); }
+
+// Arguments: compression method, level (0 = the method's default)
+void
+methods(benchmark::internal::Benchmark *b) {
+  b->ArgNames({ "method", "level" });
+  b->Args({ COMPRESSION_ZLIB, 0 });
+  b->Args({ COMPRESSION_ZLIB, 6 });
+#if defined(HAVE_ZSTD)
+  b->Args({ COMPRESSION_ZSTD, 0 });
+  b->Args({ COMPRESSION_ZSTD, 19 });
+#endif
+#if defined(HAVE_LZ4)
+  b->Args({ COMPRESSION_LZ4,  1 });
+  b->Args({ COMPRESSION_LZ4,  0 });
+#endif
+}
+
+}
+
+BENCHMARK(BM_CompressSubtitles)->Apply(methods);
+BENCHMARK(BM_DecompressSubtitles)->Apply(methods);
+BENCHMARK(BM_CompressPCM)->Apply(methods);
+BENCHMARK(BM_DecompressPCM)->Apply(methods);
+
+BENCHMARK_MAIN();
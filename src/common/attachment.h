@@ -21,5 +21,14 @@ struct attachment_t {
   bool to_all_files{};
   memory_cptr data;
   int64_t ui_id{};
+
+  // If 'data' isn't set the content is copied from this file when the
+  // attachment is rendered instead of being kept in memory.
+  std::string data_file_name;
+  uint64_t data_position{}, data_size{};
+
+  uint64_t get_size() const {
+    return data ? data->get_size() : data_size;
+  }
 };
 using attachment_cptr = std::shared_ptr<attachment_t>;
@@ -235,13 +235,26 @@ es_parser_c::handle_slice_nalu(memory_cptr const &nalu,
 
 void
 es_parser_c::handle_sps_nalu(memory_cptr const &nalu) {
+  // The NALU is rewritten depending on these settings. The duration is
+  // only used when fixing the bitstream's frame rate.
+  auto duration = duration_for_impl(0, true);
+  auto context  = (static_cast<uint64_t>(m_fix_bitstream_frame_rate ? duration : 0) << 2) | (m_fix_bitstream_frame_rate ? 2 : 0) | (m_keep_ar_info ? 1 : 0);
+
   sps_info_t sps_info;
+  memory_cptr parsed_nalu;
 
-  auto parsed_nalu = parse_sps(mtx::mpeg::nalu_to_rbsp(nalu), sps_info, m_keep_ar_info, m_fix_bitstream_frame_rate, duration_for_impl(0, true));
-  if (!parsed_nalu)
-    return;
+  if (auto cached = m_sps_cache.find(*nalu, context); cached) {
+    sps_info    = cached->m_info;
+    parsed_nalu = cached->m_parsed;
 
-  parsed_nalu = mtx::mpeg::rbsp_to_nalu(parsed_nalu);
+  } else {
+    parsed_nalu = parse_sps(mtx::mpeg::nalu_to_rbsp(nalu), sps_info, m_keep_ar_info, m_fix_bitstream_frame_rate, duration);
+    if (!parsed_nalu)
+      return;
+
+    parsed_nalu = mtx::mpeg::rbsp_to_nalu(parsed_nalu);
+    m_sps_cache.add(*nalu, context, parsed_nalu, sps_info);
+  }
 
   size_t i;
   for (i = 0; m_sps_info_list.size() > i; ++i)
@@ -296,7 +309,13 @@ void
 es_parser_c::handle_pps_nalu(memory_cptr const &nalu) {
   pps_info_t pps_info;
 
-  if (!parse_pps(mtx::mpeg::nalu_to_rbsp(nalu), pps_info))
+  if (auto cached = m_pps_cache.find(*nalu, 0); cached)
+    pps_info = cached->m_info;
+
+  else if (parse_pps(mtx::mpeg::nalu_to_rbsp(nalu), pps_info))
+    m_pps_cache.add(*nalu, 0, {}, pps_info);
+
+  else
     return;
 
   size_t i;
@@ -332,9 +351,10 @@ es_parser_c::handle_sei_nalu(memory_cptr const &nalu) {
   try {
     ++m_stats.num_sei_nalus;
 
-    auto nalu_as_rbsp = mtx::mpeg::nalu_to_rbsp(nalu);
-
-    mtx::bits::reader_c r(nalu_as_rbsp->get_buffer(), nalu_as_rbsp->get_size());
+    // Only the payload types & sizes are needed. Emulation prevention
+    // is undone while reading instead of converting the whole NALU.
+    mtx::bits::reader_c r(nalu->get_buffer(), nalu->get_size());
+    r.enable_rbsp_mode();
 
     r.skip_bits(8);
 
@@ -19,6 +19,7 @@
 #include "common/avc/util.h"
 #include "common/avc_hevc/types.h"
 #include "common/avc_hevc/es_parser.h"
+#include "common/avc_hevc/parameter_set_cache.h"
 #include "common/math_fwd.h"
 
 namespace mtx::avc {
@@ -32,6 +33,9 @@ protected:
   std::vector<sps_info_t> m_sps_info_list;
   std::vector<pps_info_t> m_pps_info_list;
 
+  mtx::avc_hevc::parameter_set_cache_c<sps_info_t> m_sps_cache;
+  mtx::avc_hevc::parameter_set_cache_c<pps_info_t> m_pps_cache;
+
   bool m_all_i_slices_are_key_frames{}, m_have_incomplete_frame{};
 
   debugging_option_c m_debug_sps_pps_changes{"avc_parser|avc_sps_pps_changes"}, m_debug_errors{"avc_parser|avc_errors"};
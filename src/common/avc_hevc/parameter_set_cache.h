@@ -0,0 +1,85 @@
+/** AVC & HEVC parameter set cache
+
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   \author Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include "common/checksums/base_fwd.h"
+
+namespace mtx::avc_hevc {
+
+// Most streams repeat their parameter sets unchanged in front of each
+// GOP. This cache maps the raw NALU of a parameter set to the result
+// of parsing it so that identical repetitions can skip the conversion
+// to RBSP and the parsing.
+//
+// Only results that are a pure function of the NALU's content and the
+// context value given by the caller must be cached. The context must
+// encode all other inputs the parser depends on, e.g. options that
+// modify the parsed NALU. Lookups compare the NALU's bytes, not just
+// its hash, so that changes are always detected.
+template<typename Tinfo>
+class parameter_set_cache_c {
+public:
+  struct entry_t {
+    memory_cptr m_raw, m_parsed;
+    uint64_t m_context{};
+    Tinfo m_info;
+  };
+
+protected:
+  static constexpr std::size_t ms_max_entries = 64;
+
+  std::unordered_map<uint64_t, entry_t> m_entries;
+
+public:
+  entry_t const *
+  find(memory_c const &raw,
+       uint64_t context)
+    const {
+    auto itr = m_entries.find(hash(raw));
+
+    if (   (itr != m_entries.end())
+        && (itr->second.m_context == context)
+        && (*itr->second.m_raw == raw))
+      return &itr->second;
+
+    return nullptr;
+  }
+
+  void
+  add(memory_c const &raw,
+      uint64_t context,
+      memory_cptr const &parsed,
+      Tinfo const &info) {
+    // Streams whose parameter sets keep changing would otherwise let
+    // the cache grow without bounds.
+    if (m_entries.size() >= ms_max_entries)
+      m_entries.clear();
+
+    m_entries[hash(raw)] = entry_t{ raw.clone(), parsed, context, info };
+  }
+
+  void
+  clear() {
+    m_entries.clear();
+  }
+
+protected:
+  static uint64_t
+  hash(memory_c const &raw) {
+    return (mtx::checksum::calculate_as_uint(mtx::checksum::algorithm_e::adler32, raw) << 32) | raw.get_size();
+  }
+};
+
+}
@@ -815,7 +815,7 @@ language_c::find_best_match(std::vector<language_c> const &potential_matches)
 
 language_c &
 language_c::canonicalize_preferred_values() {
-  auto &preferred_values = mtx::iana::language_subtag_registry::g_preferred_values;
+  auto const &preferred_values = mtx::iana::language_subtag_registry::preferred_values();
 
   for (auto const &[match, preferred] : preferred_values) {
     if (!matches(match))
@@ -932,7 +932,7 @@ language_c::should_script_be_suppressed()
     if (!language)
       return false;
 
-    auto const &suppressions = mtx::iana::language_subtag_registry::g_suppress_scripts;
+    auto const &suppressions = mtx::iana::language_subtag_registry::suppress_scripts();
     auto itr                 = suppressions.find(language->alpha_3_code);
 
     if ((itr == suppressions.end()) && !language->alpha_2_code.empty())
@@ -949,6 +949,11 @@ language_c::disable() {
   ms_disabled = true;
 }
 
+void
+language_c::set_disabled(bool disabled) {
+  ms_disabled = disabled;
+}
+
 bool
 language_c::is_disabled() {
   return ms_disabled;
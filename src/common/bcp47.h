@@ -139,6 +139,7 @@ public:
   static language_c parse(std::string const &language, normalization_mode_e normalization_mode = get_normalization_mode());
 
   static void disable();
+  static void set_disabled(bool disabled);
   static bool is_disabled();
 };
 
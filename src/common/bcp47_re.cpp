@@ -105,10 +105,11 @@ init_re() {
   s_bcp47_re      = QRegularExpression{ re_cleaned };
 
 
+  auto const &grandfathered = mtx::iana::language_subtag_registry::grandfathered();
   std::vector<std::string> grandfathered_list;
-  grandfathered_list.reserve(mtx::iana::language_subtag_registry::g_grandfathered.size());
+  grandfathered_list.reserve(grandfathered.size());
 
-  for (auto const &entry : mtx::iana::language_subtag_registry::g_grandfathered)
+  for (auto const &entry : grandfathered)
     grandfathered_list.emplace_back(mtx::string::to_lower_ascii(entry.code));
 
   s_bcp47_grandfathered_re = QRegularExpression{ Q(fmt::format("^(?:{0})$", mtx::string::join(grandfathered_list, "|"))) };
@@ -0,0 +1,258 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   A class for file-like read access on the bit level
+
+   The mtx::bits::reader_c class was originally written by Peter Niemayer
+     <niemayer@isg.de> and modified by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/bit_reader.h"
+
+namespace mtx::bits {
+
+void
+reader_c::enable_rbsp_mode() {
+  if (m_rbsp_mode)
+    return;
+
+  // Bytes already in the cache haven't been checked for emulation
+  // prevention bytes. Read them again.
+  auto position = get_bit_position();
+  m_rbsp_mode   = true;
+
+  reset_to(position);
+}
+
+void
+reader_c::refill() {
+  if (m_cache_bits > 56)
+    return;
+
+  if ((m_end_of_data - m_next_byte) >= 8) {
+    uint64_t word{};
+    for (auto idx = 0; idx < 8; ++idx)
+      word = (word << 8) | m_next_byte[idx];
+
+    // Without any zero byte there cannot be an emulation prevention
+    // sequence, apart from the first byte completing one started by
+    // the bytes already read.
+    auto has_zero_byte = ((word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull) != 0;
+
+    if (!m_rbsp_mode || (!has_zero_byte && (m_num_zero_bytes < 2))) {
+      auto num_bytes    = (64 - m_cache_bits) / 8;
+      auto num_new_bits = num_bytes * 8;
+
+      m_cache          |= (word >> (64 - num_new_bits)) << (64 - m_cache_bits - num_new_bits);
+      m_cache_bits     += num_new_bits;
+      m_next_byte      += num_bytes;
+      m_num_zero_bytes  = 0;
+
+      return;
+    }
+  }
+
+  while ((m_cache_bits <= 56) && (m_next_byte < m_end_of_data)) {
+    auto byte = *m_next_byte++;
+
+    if (m_rbsp_mode) {
+      if ((byte == 0x03) && (m_num_zero_bytes >= 2)) {
+        // An emulation prevention byte at the very end of the data is
+        // left unread so that get_bit_position() counts it once the
+        // bytes before it have been read.
+        if (m_next_byte >= m_end_of_data) {
+          --m_next_byte;
+          break;
+        }
+
+        m_emulation_marks |= uint64_t{1} << (63 - m_cache_bits);
+        m_num_zero_bytes   = 0;
+        byte               = *m_next_byte++;
+      }
+
+      m_num_zero_bytes = byte ? 0 : m_num_zero_bytes + 1;
+    }
+
+    m_cache      |= uint64_t{byte} << (56 - m_cache_bits);
+    m_cache_bits += 8;
+  }
+}
+
+uint64_t
+reader_c::get_bits_refill(std::size_t n) {
+  refill();
+
+  if (n <= m_cache_bits)
+    return get_bits(n);
+
+  // More bits requested than the cache can hold at once?
+  if ((n > 56) && (m_next_byte < m_end_of_data)) {
+    auto high = get_bits(n - 32);
+    return (high << 32) | get_bits(32);
+  }
+
+  consume(m_cache_bits);
+  m_out_of_data = true;
+
+  throw mtx::mm_io::end_of_file_x();
+}
+
+uint64_t
+reader_c::get_unsigned_golomb_slow() {
+  if (m_cache_bits < 32) {
+    refill();
+
+    if (m_cache) {
+      auto n = mtx::math::count_leading_zero_bits(m_cache);
+
+      if ((n * 2 + 1) <= m_cache_bits)
+        return get_unsigned_golomb();
+    }
+  }
+
+  std::size_t n = 0;
+
+  while (get_bit() == 0)
+    if (++n > 63)
+      throw mtx::mm_io::end_of_file_x();
+
+  auto bits = get_bits(n);
+
+  return (uint64_t{1} << n) - 1 + bits;
+}
+
+uint64_t
+reader_c::peek_bits_slow(std::size_t n) {
+  if (!n)
+    return 0;
+
+  // Refilling doesn't change the position.
+  refill();
+
+  if (n <= m_cache_bits)
+    return m_cache >> (64 - n);
+
+  auto copy = *this;
+  return copy.get_bits(n);
+}
+
+void
+reader_c::get_bytes(unsigned char *buf,
+                    std::size_t n) {
+  if (!(m_cache_bits % 8) && !m_rbsp_mode) {
+    get_bytes_byte_aligned(buf, n);
+    return;
+  }
+
+  for (auto idx = 0u; idx < n; ++idx)
+    buf[idx] = get_bits(8);
+}
+
+std::string
+reader_c::get_string(unsigned int byte_length) {
+  std::string str(byte_length, ' ');
+  get_bytes(reinterpret_cast<unsigned char *>(&str[0]), byte_length);
+
+  return str;
+}
+
+void
+reader_c::set_bit_position(std::size_t pos) {
+  auto num_bits = static_cast<std::size_t>(m_end_of_data - m_start_of_data) * 8;
+
+  if (pos > num_bits) {
+    reset_to(num_bits);
+    m_out_of_data = true;
+
+    throw mtx::mm_io::end_of_file_x();
+  }
+
+  reset_to(pos);
+}
+
+void
+reader_c::skip_bits_slow(std::size_t num) {
+  if (!m_rbsp_mode) {
+    set_bit_position(get_bit_position() + num);
+    return;
+  }
+
+  num -= m_cache_bits;
+  consume(m_cache_bits);
+
+  // The cache only ever contains whole bytes, so the position is byte
+  // aligned now. Whole bytes are skipped directly in the data; only
+  // emulation prevention bytes have to be recognized, and there can't
+  // be any in eight bytes without a zero byte.
+  auto num_bytes = num / 8;
+
+  while (num_bytes && (m_next_byte < m_end_of_data)) {
+    if ((num_bytes >= 8) && ((m_end_of_data - m_next_byte) >= 8) && (m_num_zero_bytes < 2)) {
+      uint64_t word{};
+      std::memcpy(&word, m_next_byte, 8);
+
+      if (!((word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull)) {
+        m_next_byte      += 8;
+        m_num_zero_bytes  = 0;
+        num_bytes        -= 8;
+        continue;
+      }
+    }
+
+    auto byte = *m_next_byte++;
+
+    if ((byte == 0x03) && (m_num_zero_bytes >= 2)) {
+      m_num_zero_bytes = 0;
+      continue;
+    }
+
+    m_num_zero_bytes = byte ? 0 : m_num_zero_bytes + 1;
+    --num_bytes;
+  }
+
+  if (num_bytes) {
+    m_out_of_data = true;
+    throw mtx::mm_io::end_of_file_x();
+  }
+
+  if (num % 8)
+    get_bits(num % 8);
+}
+
+void
+reader_c::reset_to(std::size_t pos) {
+  m_next_byte       = m_start_of_data + (pos / 8);
+  m_cache           = 0;
+  m_cache_bits      = 0;
+  m_emulation_marks = 0;
+  m_num_zero_bytes  = 0;
+
+  if (pos % 8) {
+    refill();
+    consume(pos % 8);
+  }
+}
+
+void
+reader_c::get_bytes_byte_aligned(unsigned char *buf,
+                                 std::size_t n) {
+  auto src           = m_start_of_data + get_bit_position() / 8;
+  auto bytes_to_copy = std::min<std::size_t>(n, m_end_of_data - src);
+  std::memcpy(buf, src, bytes_to_copy);
+
+  reset_to((src - m_start_of_data + bytes_to_copy) * 8);
+
+  if (bytes_to_copy < n) {
+    m_out_of_data = true;
+    throw mtx::mm_io::end_of_file_x();
+  }
+}
+
+}
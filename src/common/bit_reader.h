@@ -16,6 +16,7 @@
 
 #include "common/common_pch.h"
 
+#include "common/math.h"
 #include "common/mm_io_x.h"
 
 namespace mtx::bits {
@@ -23,11 +24,22 @@ namespace mtx::bits {
 class reader_c {
 private:
   const unsigned char *m_end_of_data;
-  const unsigned char *m_byte_position;
+  const unsigned char *m_next_byte;
   const unsigned char *m_start_of_data;
-  std::size_t m_bits_valid;
+
+  // Up to 64 bits read ahead from the data, MSB aligned. All bits
+  // below the m_cache_bits valid ones are always zero.
+  uint64_t m_cache;
+  std::size_t m_cache_bits;
+
+  // RBSP mode only: marks the first bit of each cached byte that
+  // directly followed an emulation prevention byte in the data. Moves
+  // along with the cache so that bit positions can be reported
+  // relative to the raw data.
+  uint64_t m_emulation_marks;
+  unsigned int m_num_zero_bytes;
+
   bool m_out_of_data, m_rbsp_mode;
-  uint16_t m_rbsp_bytes;
 
 public:
   reader_c() {
@@ -43,67 +55,46 @@ public:
   }
 
   void init(const unsigned char *data, std::size_t len) {
-    m_end_of_data   = data + len;
-    m_byte_position = data;
-    m_start_of_data = data;
-    m_bits_valid    = len ? 8 : 0;
-    m_out_of_data   = m_byte_position >= m_end_of_data;
-    m_rbsp_mode     = false;
-    m_rbsp_bytes    = 0xffffu;
+    m_end_of_data     = data + len;
+    m_next_byte       = data;
+    m_start_of_data   = data;
+    m_cache           = 0;
+    m_cache_bits      = 0;
+    m_emulation_marks = 0;
+    m_num_zero_bytes  = 0;
+    m_out_of_data     = !len;
+    m_rbsp_mode       = false;
   }
 
-  void enable_rbsp_mode() {
-    m_rbsp_mode  = true;
-    m_rbsp_bytes = 0xff00u | (m_bits_valid == 8 ? *m_byte_position : 0u);
-  }
+  void enable_rbsp_mode();
 
   bool eof() {
     return m_out_of_data;
   }
 
-  uint64_t get_bits(std::size_t n) {
-    uint64_t r = 0;
-
-    while (n > 0) {
-      if (m_byte_position >= m_end_of_data) {
-        m_out_of_data = true;
-        throw mtx::mm_io::end_of_file_x();
-      }
-
-      std::size_t b = 8; // number of bits to extract from the current byte
-      if (b > n)
-        b = n;
-      if (b > m_bits_valid)
-        b = m_bits_valid;
-
-      std::size_t rshift = m_bits_valid - b;
-
-      r <<= b;
-      r  |= ((*m_byte_position) >> rshift) & (0xff >> (8 - b));
-
-      m_bits_valid -= b;
-      if (0 == m_bits_valid) {
-        m_bits_valid     = 8;
-        m_byte_position += 1;
-
-        if (m_rbsp_mode && (m_byte_position < m_end_of_data)) {
-          if ((*m_byte_position == 0x03) && (m_rbsp_bytes == 0x0000)) {
-            ++m_byte_position;
-            m_rbsp_bytes = 0xff00u | *m_byte_position;
+  inline uint64_t get_bits(std::size_t n) {
+    if (n > m_cache_bits)
+      return get_bits_refill(n);
 
-          } else
-            m_rbsp_bytes = (m_rbsp_bytes << 8) | *m_byte_position;
-        }
-      }
+    if (!n)
+      return 0;
 
-      n -= b;
-    }
+    auto value = m_cache >> (64 - n);
+    consume(n);
 
-    return r;
+    return value;
   }
 
   inline int get_bit() {
-    return get_bits(1);
+    if (!m_cache_bits)
+      return get_bits_refill(1);
+
+    int bit             = m_cache >> 63;
+    m_cache           <<= 1;
+    m_emulation_marks <<= 1;
+    --m_cache_bits;
+
+    return bit;
   }
 
   inline int get_unary(bool stop,
@@ -123,14 +114,21 @@ public:
   }
 
   inline uint64_t get_unsigned_golomb() {
-    int n = 0;
+    // As the bits below the valid ones are zero, any set bit is a
+    // valid one.
+    if (m_cache) {
+      auto n = mtx::math::count_leading_zero_bits(m_cache);
 
-    while (get_bit() == 0)
-      ++n;
+      if ((n * 2 + 1) <= m_cache_bits) {
+        consume(n);
+        auto value = m_cache >> (63 - n);
+        consume(n + 1);
 
-    auto bits = get_bits(n);
+        return value - 1;
+      }
+    }
 
-    return (1u << n) - 1 + bits;
+    return get_unsigned_golomb_slow();
   }
 
   inline int64_t get_signed_golomb() {
@@ -138,93 +136,54 @@ public:
     return v & 1 ? (v + 1) / 2 : -(v / 2);
   }
 
-  uint64_t peek_bits(std::size_t n) {
-    uint64_t r                             = 0;
-    const unsigned char *tmp_byte_position = m_byte_position;
-    std::size_t tmp_bits_valid             = m_bits_valid;
-
-    while (0 < n) {
-      if (tmp_byte_position >= m_end_of_data)
-        throw mtx::mm_io::end_of_file_x();
-
-      std::size_t b = 8; // number of bits to extract from the current byte
-      if (b > n)
-        b = n;
-      if (b > tmp_bits_valid)
-        b = tmp_bits_valid;
-
-      std::size_t rshift = tmp_bits_valid - b;
-
-      r <<= b;
-      r  |= ((*tmp_byte_position) >> rshift) & (0xff >> (8 - b));
+  inline uint64_t peek_bits(std::size_t n) {
+    if ((n > m_cache_bits) || !n)
+      return peek_bits_slow(n);
 
-      tmp_bits_valid -= b;
-      if (0 == tmp_bits_valid) {
-        tmp_bits_valid     = 8;
-        tmp_byte_position += 1;
-      }
-
-      n -= b;
-    }
-
-    return r;
+    return m_cache >> (64 - n);
   }
 
-  void get_bytes(unsigned char *buf, std::size_t n) {
-    if (8 == m_bits_valid) {
-      get_bytes_byte_aligned(buf, n);
-      return;
-    }
-
-    for (auto idx = 0u; idx < n; ++idx)
-      buf[idx] = get_bits(8);
-  }
-
-  std::string get_string(unsigned int byte_length) {
-    std::string str(byte_length, ' ');
-    for (auto idx = 0u; idx < byte_length; ++idx)
-      str[idx] = static_cast<char>(get_bits(8));
-
-    return str;
-  }
+  void get_bytes(unsigned char *buf, std::size_t n);
+  std::string get_string(unsigned int byte_length);
 
   void byte_align() {
-    if (8 != m_bits_valid)
-      skip_bits(m_bits_valid);
+    // The cache only ever contains whole bytes from the data.
+    consume(m_cache_bits % 8);
   }
 
-  void set_bit_position(std::size_t pos) {
-    if (pos > (static_cast<std::size_t>(m_end_of_data - m_start_of_data) * 8)) {
-      m_byte_position = m_end_of_data;
-      m_out_of_data   = true;
+  void set_bit_position(std::size_t pos);
 
-      throw mtx::mm_io::end_of_file_x();
-    }
+  int get_bit_position() const {
+    auto position = static_cast<int>(m_next_byte - m_start_of_data) * 8 - static_cast<int>(m_cache_bits);
 
-    m_byte_position = m_start_of_data + (pos / 8);
-    m_bits_valid    = 8 - (pos % 8);
-  }
+    // An emulation prevention byte counts as having been read as soon
+    // as the byte before it has been read completely.
+    if (m_emulation_marks)
+      position -= mtx::math::count_1_bits(m_emulation_marks & ~(uint64_t{1} << 63)) * 8;
 
-  int get_bit_position() const {
-    return (m_byte_position - m_start_of_data) * 8 + (m_bits_valid ? 8 - m_bits_valid : 0);
+    else if (   !m_cache_bits
+             && m_rbsp_mode
+             && (m_num_zero_bytes >= 2)
+             && (m_next_byte < m_end_of_data)
+             && (*m_next_byte == 0x03))
+      position += 8;
+
+    return position;
   }
 
   int get_remaining_bits() const {
-    return (m_end_of_data - m_byte_position) * 8 - (m_bits_valid ? 8 - m_bits_valid : 0);
+    return (m_end_of_data - m_start_of_data) * 8 - get_bit_position();
   }
 
-  void skip_bits(std::size_t num) {
-    if (!m_rbsp_mode)
-      set_bit_position(get_bit_position() + num);
+  inline void skip_bits(std::size_t num) {
+    if (num <= m_cache_bits)
+      consume(num);
     else
-      get_bits(num);
+      skip_bits_slow(num);
   }
 
-  void skip_bit() {
-    if (!m_rbsp_mode)
-      set_bit_position(get_bit_position() + 1);
-    else
-      get_bits(1);
+  inline void skip_bit() {
+    skip_bits(1);
   }
 
   uint64_t skip_get_bits(std::size_t to_skip,
@@ -234,17 +193,28 @@ public:
   }
 
 protected:
-  void get_bytes_byte_aligned(unsigned char *buf, std::size_t n) {
-    auto bytes_to_copy = std::min<std::size_t>(n, m_end_of_data - m_byte_position);
-    std::memcpy(buf, m_byte_position, bytes_to_copy);
-
-    m_byte_position += bytes_to_copy;
-
-    if (bytes_to_copy < n) {
-      m_out_of_data = true;
-      throw mtx::mm_io::end_of_file_x();
+  inline void consume(std::size_t n) {
+    if (n < 64) {
+      m_cache           <<= n;
+      m_emulation_marks <<= n;
+    } else {
+      m_cache           = 0;
+      m_emulation_marks = 0;
     }
+
+    m_cache_bits -= n;
   }
+
+  // Tops up the cache to at least 57 bits unless the end of the data
+  // is reached.
+  void refill();
+
+  uint64_t get_bits_refill(std::size_t n);
+  uint64_t get_unsigned_golomb_slow();
+  uint64_t peek_bits_slow(std::size_t n);
+  void skip_bits_slow(std::size_t num);
+  void reset_to(std::size_t pos);
+  void get_bytes_byte_aligned(unsigned char *buf, std::size_t n);
 };
 using reader_cptr = std::shared_ptr<reader_c>;
 
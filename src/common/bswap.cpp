@@ -13,11 +13,188 @@
 
 #include <stdexcept>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define MTX_BSWAP_X86_SIMD 1
+# include <immintrin.h>
+#endif
+
 #include "common/bswap.h"
 #include "common/endian.h"
 
 namespace mtx::bytes {
 
+namespace {
+
+using swap_kernel_t = void (*)(unsigned char const *src, unsigned char *dst, std::size_t num_bytes);
+
+template<std::size_t WordLength>
+void
+swap_scalar(unsigned char const *src,
+            unsigned char *dst,
+            std::size_t num_bytes) {
+  for (std::size_t idx = 0; idx < num_bytes; idx += WordLength) {
+    if constexpr (WordLength == 2) {
+      uint16_t value;
+      std::memcpy(&value, &src[idx], 2);
+      value = swap_16(value);
+      std::memcpy(&dst[idx], &value, 2);
+
+    } else if constexpr (WordLength == 3) {
+      auto first   = src[idx];
+      dst[idx]     = src[idx + 2];
+      dst[idx + 1] = src[idx + 1];
+      dst[idx + 2] = first;
+
+    } else if constexpr (WordLength == 4) {
+      uint32_t value;
+      std::memcpy(&value, &src[idx], 4);
+      value = swap_32(value);
+      std::memcpy(&dst[idx], &value, 4);
+
+    } else {
+      uint64_t value;
+      std::memcpy(&value, &src[idx], 8);
+      value = swap_64(value);
+      std::memcpy(&dst[idx], &value, 8);
+    }
+  }
+}
+
+#if defined(MTX_BSWAP_X86_SIMD)
+
+// Shuffle masks for 16 bytes. The one for three-byte words handles
+// four words & leaves the last four bytes untouched so that writing
+// them back is harmless.
+alignas(16) unsigned char const s_swap_masks[4][16] = {
+  {  1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14 },
+  {  2,  1,  0,  5,  4,  3,  8,  7,  6, 11, 10,  9, 12, 13, 14, 15 },
+  {  3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12 },
+  {  7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8 },
+};
+
+constexpr std::size_t
+swap_mask_idx(std::size_t word_length) {
+  return word_length == 2 ? 0 : word_length == 3 ? 1 : word_length == 4 ? 2 : 3;
+}
+
+template<std::size_t WordLength>
+__attribute__((target("ssse3"))) void
+swap_ssse3(unsigned char const *src,
+           unsigned char *dst,
+           std::size_t num_bytes) {
+  constexpr std::size_t step = WordLength == 3 ? 12 : 16;
+
+  auto mask       = _mm_load_si128(reinterpret_cast<__m128i const *>(s_swap_masks[swap_mask_idx(WordLength)]));
+  std::size_t idx = 0;
+
+  for (; (idx + 16) <= num_bytes; idx += step)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[idx]), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[idx])), mask));
+
+  swap_scalar<WordLength>(&src[idx], &dst[idx], num_bytes - idx);
+}
+
+template<std::size_t WordLength>
+__attribute__((target("avx2"))) void
+swap_avx2(unsigned char const *src,
+          unsigned char *dst,
+          std::size_t num_bytes) {
+  static_assert(WordLength != 3);
+
+  auto mask       = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(s_swap_masks[swap_mask_idx(WordLength)])));
+  std::size_t idx = 0;
+
+  for (; (idx + 32) <= num_bytes; idx += 32)
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dst[idx]), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(&src[idx])), mask));
+
+  swap_ssse3<WordLength>(&src[idx], &dst[idx], num_bytes - idx);
+}
+
+// Reorders one frame of at most 32 bytes into DstSize bytes with two
+// shuffles per 16 output bytes, one for each half of the input frame.
+template<std::size_t DstSize>
+__attribute__((target("ssse3"))) std::size_t
+shuffle_frames_ssse3(unsigned char const *src,
+                     unsigned char *dst,
+                     std::size_t num_bytes,
+                     std::size_t src_frame_size,
+                     unsigned char const *masks) {
+  auto lo0       = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&masks[0]));
+  auto hi0       = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&masks[16]));
+  auto lo1       = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&masks[32]));
+  auto hi1       = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&masks[48]));
+  auto read_size = src_frame_size > 16 ? 32u : 16u;
+  auto num_done  = std::size_t{};
+
+  for (std::size_t offset = 0; (offset + read_size) <= num_bytes; offset += src_frame_size, ++num_done) {
+    alignas(16) unsigned char out[32];
+
+    auto first  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[offset]));
+    auto second = src_frame_size > 16 ? _mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[offset + 16])) : _mm_setzero_si128();
+
+    _mm_store_si128(reinterpret_cast<__m128i *>(&out[0]), _mm_or_si128(_mm_shuffle_epi8(first, lo0), _mm_shuffle_epi8(second, hi0)));
+    if constexpr (DstSize > 16)
+      _mm_store_si128(reinterpret_cast<__m128i *>(&out[16]), _mm_or_si128(_mm_shuffle_epi8(first, lo1), _mm_shuffle_epi8(second, hi1)));
+
+    // Only the frame's own bytes are written so that processing in
+    // place works even if output frames are smaller.
+    std::memcpy(&dst[num_done * DstSize], out, DstSize);
+  }
+
+  return num_done;
+}
+
+using shuffle_kernel_t = std::size_t (*)(unsigned char const *src, unsigned char *dst, std::size_t num_bytes, std::size_t src_frame_size, unsigned char const *masks);
+
+template<std::size_t... DstSizes>
+constexpr std::array<shuffle_kernel_t, sizeof...(DstSizes)>
+make_shuffle_kernels(std::index_sequence<DstSizes...>) {
+  return { &shuffle_frames_ssse3<DstSizes>... };
+}
+
+constexpr auto s_shuffle_kernels = make_shuffle_kernels(std::make_index_sequence<33>{});
+
+bool
+have_ssse3() {
+  static auto s_supported = (__builtin_cpu_init(), __builtin_cpu_supports("ssse3") != 0);
+  return s_supported;
+}
+
+bool
+have_avx2() {
+  static auto s_supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+  return s_supported;
+}
+
+#endif  // MTX_BSWAP_X86_SIMD
+
+template<std::size_t WordLength>
+swap_kernel_t
+select_swap_kernel() {
+#if defined(MTX_BSWAP_X86_SIMD)
+  if constexpr (WordLength != 3)
+    if (have_avx2())
+      return &swap_avx2<WordLength>;
+
+  if (have_ssse3())
+    return &swap_ssse3<WordLength>;
+#endif
+
+  return &swap_scalar<WordLength>;
+}
+
+swap_kernel_t
+get_swap_kernel(std::size_t word_length) {
+  static auto const s_kernels = std::array<swap_kernel_t, 4>{ select_swap_kernel<2>(), select_swap_kernel<3>(), select_swap_kernel<4>(), select_swap_kernel<8>() };
+
+  return word_length == 2 ? s_kernels[0]
+       : word_length == 3 ? s_kernels[1]
+       : word_length == 4 ? s_kernels[2]
+       : word_length == 8 ? s_kernels[3]
+       :                    nullptr;
+}
+
+} // anonymous namespace
+
 void
 swap_buffer(unsigned char const *src,
             unsigned char *dst,
@@ -26,8 +203,78 @@ swap_buffer(unsigned char const *src,
   if ((num_bytes % word_length) != 0)
     throw std::invalid_argument(fmt::format(Y("The number of bytes to swap isn't divisible by {0}."), word_length));
 
+  auto kernel = get_swap_kernel(word_length);
+  if (kernel) {
+    kernel(src, dst, num_bytes);
+    return;
+  }
+
   for (int idx = 0; idx < static_cast<int>(num_bytes); idx += word_length)
     put_uint_le(&dst[idx], get_uint_be(&src[idx], word_length), word_length);
 }
 
+pcm_frame_shuffler_c::pcm_frame_shuffler_c(std::size_t bytes_per_sample,
+                                           std::size_t num_src_channels,
+                                           std::vector<std::size_t> const &channel_map,
+                                           bool swap_bytes)
+  : m_src_frame_size{bytes_per_sample * num_src_channels}
+  , m_dst_frame_size{bytes_per_sample * channel_map.size()}
+{
+  m_pattern.reserve(m_dst_frame_size);
+
+  for (auto src_channel : channel_map) {
+    assert(src_channel < num_src_channels);
+
+    for (auto byte = 0u; byte < bytes_per_sample; ++byte)
+      m_pattern.push_back(src_channel * bytes_per_sample + (swap_bytes ? bytes_per_sample - 1 - byte : byte));
+  }
+
+#if defined(MTX_BSWAP_X86_SIMD)
+  if (!have_ssse3() || (m_src_frame_size > 32) || (m_dst_frame_size > 32) || !m_dst_frame_size)
+    return;
+
+  // Masks: 16 bytes for the first output half from the first input
+  // half, the same from the second input half, then the same two for
+  // the second output half. 0x80 produces a 0 byte.
+  std::fill(m_masks.begin(), m_masks.end(), 0x80);
+
+  for (auto idx = 0u; idx < m_dst_frame_size; ++idx) {
+    auto src_idx = m_pattern[idx];
+    auto base    = idx < 16 ? 0u : 32u;
+    auto lane    = idx % 16;
+
+    if (src_idx < 16)
+      m_masks[base + lane]      = src_idx;
+    else
+      m_masks[base + 16 + lane] = src_idx - 16;
+  }
+
+  m_kernel = s_shuffle_kernels[m_dst_frame_size];
+#endif
+}
+
+std::size_t
+pcm_frame_shuffler_c::shuffle(unsigned char const *src,
+                              unsigned char *dst,
+                              std::size_t num_bytes)
+  const {
+  if (!m_src_frame_size)
+    return 0;
+
+  auto num_frames = num_bytes / m_src_frame_size;
+  auto num_done   = m_kernel ? m_kernel(src, dst, num_bytes, m_src_frame_size, m_masks.data()) : std::size_t{};
+
+  std::vector<unsigned char> frame(m_src_frame_size);
+
+  for (; num_done < num_frames; ++num_done) {
+    std::memcpy(frame.data(), &src[num_done * m_src_frame_size], m_src_frame_size);
+
+    auto out = &dst[num_done * m_dst_frame_size];
+    for (auto idx = 0u; idx < m_dst_frame_size; ++idx)
+      out[idx] = frame[m_pattern[idx]];
+  }
+
+  return num_frames * m_dst_frame_size;
+}
+
 }
@@ -45,6 +45,36 @@ swap_64(uint64_t x) {
   return r.ll;
 }
 
+// Swaps the bytes of each word. src & dst may be identical. Word
+// lengths of 2, 3, 4 & 8 bytes use SIMD instructions if the CPU
+// supports them.
 void swap_buffer(unsigned char const *src, unsigned char *dst, std::size_t num_bytes, std::size_t word_length);
 
+// Picks & reorders the channels of interleaved PCM frames and
+// optionally swaps the bytes of each sample, all in a single pass.
+// Output channel n is input channel channel_map[n].
+class pcm_frame_shuffler_c {
+protected:
+  std::size_t m_src_frame_size{}, m_dst_frame_size{};
+  std::vector<unsigned char> m_pattern;
+  std::array<unsigned char, 64> m_masks{};
+  std::size_t (*m_kernel)(unsigned char const *src, unsigned char *dst, std::size_t num_bytes, std::size_t src_frame_size, unsigned char const *masks){};
+
+public:
+  pcm_frame_shuffler_c(std::size_t bytes_per_sample, std::size_t num_src_channels, std::vector<std::size_t> const &channel_map, bool swap_bytes);
+
+  // Processes all complete frames in src. dst may be identical to src
+  // even if output frames are smaller than input frames. Returns the
+  // number of bytes written to dst.
+  std::size_t shuffle(unsigned char const *src, unsigned char *dst, std::size_t num_bytes) const;
+
+  std::size_t get_src_frame_size() const {
+    return m_src_frame_size;
+  }
+
+  std::size_t get_dst_frame_size() const {
+    return m_dst_frame_size;
+  }
+};
+
 }
@@ -28,11 +28,8 @@
 
 #include "common/fs_sys_helpers.h"
 #include "common/hacks.h"
-#include "common/iana_language_subtag_registry.h"
-#include "common/iso639.h"
-#include "common/iso3166.h"
-#include "common/iso15924.h"
 #include "common/logger.h"
+#include "common/memory_pool.h"
 #include "common/mm_file_io.h"
 #include "common/mm_stdio.h"
 #include "common/random.h"
@@ -90,6 +87,8 @@ mtx_common_cleanup() {
     g_mm_stdio = std::shared_ptr<mm_io_c>(new mm_stdio_c);
   }
 
+  mtx::mem::pool::dump_statistics();
+
   matroska_done();
 }
 
@@ -149,11 +148,6 @@ mtx_common_init(std::string const &program_name,
 
   init_common_output(false);
 
-  mtx::iana::language_subtag_registry::init();
-  mtx::iso639::init();
-  mtx::iso3166::init();
-  mtx::iso15924::init();
-  mtx::iana::language_subtag_registry::init_preferred_values(); // uses language_c::parse() & must therefore be initialized last
   stereo_mode_c::init();
 }
 
@@ -19,15 +19,16 @@
 #include "common/compression.h"
 #include "common/ebml.h"
 #include "common/endian.h"
+#include "common/list_utils.h"
 #include "common/strings/formatting.h"
 
 using namespace libmatroska;
 
 static const char *compression_methods[] = {
-  "unspecified", "zlib", "header_removal", "mpeg4_p2", "mpeg4_p10", "dirac", "dts", "ac3", "mp3", "analyze_header_removal", "none"
+  "unspecified", "zlib", "header_removal", "mpeg4_p2", "mpeg4_p10", "dirac", "dts", "ac3", "mp3", "zstd", "lz4", "analyze_header_removal", "none"
 };
 
-static const int compression_method_map[] = {
+static const uint64_t compression_method_map[] = {
   0,                            // unspecified
   0,                            // zlib
   3,                            // header removal
@@ -37,6 +38,8 @@ static const int compression_method_map[] = {
   3,                            // dts is header removal
   3,                            // ac3 is header removal
   3,                            // mp3 is header removal
+  mtx::compression::nonstandard_algo_zstd, // zstd
+  mtx::compression::nonstandard_algo_lz4,  // lz4
   999999999,                    // analyze_header_removal
   0                             // none
 };
@@ -64,11 +67,31 @@ compressor_c::create(compression_method_e method) {
   return create(compression_methods[method]);
 }
 
+compressor_ptr
+compressor_c::create(compression_method_e method,
+                     compression_parameters_t const &parameters) {
+  auto compressor = create(method);
+  if (compressor)
+    compressor->set_parameters(parameters);
+
+  return compressor;
+}
+
 compressor_ptr
 compressor_c::create(const char *method) {
   if (!strcasecmp(method, compression_methods[COMPRESSION_ZLIB]))
     return compressor_ptr(new zlib_compressor_c());
 
+#if defined(HAVE_ZSTD)
+  if (!strcasecmp(method, compression_methods[COMPRESSION_ZSTD]))
+    return std::make_shared<zstd_compressor_c>();
+#endif
+
+#if defined(HAVE_LZ4)
+  if (!strcasecmp(method, compression_methods[COMPRESSION_LZ4]))
+    return std::make_shared<lz4_compressor_c>();
+#endif
+
   if (!strcasecmp(method, compression_methods[COMPRESSION_MPEG4_P2]))
     return compressor_ptr(new mpeg4_p2_compressor_c());
 
@@ -96,6 +119,26 @@ compressor_c::create(const char *method) {
   return compressor_ptr();
 }
 
+bool
+compressor_c::is_available(compression_method_e method) {
+#if !defined(HAVE_ZSTD)
+  if (COMPRESSION_ZSTD == method)
+    return false;
+#endif
+
+#if !defined(HAVE_LZ4)
+  if (COMPRESSION_LZ4 == method)
+    return false;
+#endif
+
+  return (COMPRESSION_UNSPECIFIED < method) && (COMPRESSION_NUM >= method);
+}
+
+bool
+compressor_c::is_nonstandard(compression_method_e method) {
+  return mtx::included_in(method, COMPRESSION_ZSTD, COMPRESSION_LZ4);
+}
+
 compressor_ptr
 compressor_c::create_from_file_name(std::string const &file_name) {
   auto pos = file_name.rfind(".");
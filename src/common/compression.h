@@ -28,12 +28,22 @@ enum compression_method_e {
   COMPRESSION_DTS,
   COMPRESSION_AC3,
   COMPRESSION_MP3,
+  COMPRESSION_ZSTD,
+  COMPRESSION_LZ4,
   COMPRESSION_ANALYZE_HEADER_REMOVAL,
   COMPRESSION_NONE,
   COMPRESSION_NUM = COMPRESSION_NONE
 };
 
 namespace mtx {
+  // ContentCompAlgo values for algorithms that aren't part of the
+  // Matroska specification (yet). Files using them can only be read
+  // by MKVToolNix.
+  namespace compression {
+    constexpr uint64_t nonstandard_algo_zstd = 0x7a737464; // 'zstd'
+    constexpr uint64_t nonstandard_algo_lz4  = 0x6c7a3420; // 'lz4 '
+  }
+
   class compression_x: public exception {
   protected:
     std::string m_message;
@@ -50,6 +60,11 @@ namespace mtx {
 class compressor_c;
 using compressor_ptr = std::shared_ptr<compressor_c>;
 
+struct compression_parameters_t {
+  std::optional<int> m_level;
+  memory_cptr m_dictionary;
+};
+
 class compressor_c {
 protected:
   compression_method_e method{COMPRESSION_UNSPECIFIED};
@@ -89,8 +104,22 @@ public:
 
   virtual void set_track_headers(libmatroska::KaxContentEncoding &c_encoding);
 
+  // Compression level & dictionary. Compressors not supporting them
+  // ignore them.
+  virtual void set_parameters(compression_parameters_t const &) {
+  }
+
+  // Whether or not compress() & decompress() may be called from
+  // several threads concurrently.
+  virtual bool is_thread_safe() const {
+    return false;
+  }
+
   static compressor_ptr create(compression_method_e method);
+  static compressor_ptr create(compression_method_e method, compression_parameters_t const &parameters);
   static compressor_ptr create(const char *method);
+  static bool is_available(compression_method_e method);
+  static bool is_nonstandard(compression_method_e method);
   static compressor_ptr create_from_file_name(std::string const &file_name);
 
 protected:
@@ -105,4 +134,6 @@ protected:
 };
 
 #include "common/compression/header_removal.h"
+#include "common/compression/lz4.h"
 #include "common/compression/zlib.h"
+#include "common/compression/zstd.h"
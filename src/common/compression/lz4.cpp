@@ -0,0 +1,164 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   LZ4 compressor
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#if defined(HAVE_LZ4)
+
+#include <matroska/KaxContentEncoding.h>
+
+#include "common/compression/lz4.h"
+#include "common/ebml.h"
+#include "common/endian.h"
+
+namespace {
+
+// The compression states are large (especially the HC one), so keep
+// one per thread instead of allocating them for each frame.
+LZ4_stream_t *
+fast_state() {
+  thread_local auto s_state = std::make_unique<LZ4_stream_t>();
+  return s_state.get();
+}
+
+LZ4_streamHC_t *
+hc_state() {
+  thread_local auto s_state = std::make_unique<LZ4_streamHC_t>();
+  return s_state.get();
+}
+
+}
+
+lz4_compressor_c::lz4_compressor_c()
+  : compressor_c(COMPRESSION_LZ4)
+{
+}
+
+lz4_compressor_c::~lz4_compressor_c() {
+}
+
+void
+lz4_compressor_c::set_parameters(compression_parameters_t const &parameters) {
+  if (parameters.m_level)
+    m_level = std::clamp(*parameters.m_level, 1, LZ4HC_CLEVEL_MAX);
+
+  if (parameters.m_dictionary)
+    set_dictionary(parameters.m_dictionary);
+}
+
+void
+lz4_compressor_c::set_dictionary(memory_cptr const &dictionary) {
+  m_dictionary = dictionary;
+  m_fast_dictionary_state.reset();
+  m_hc_dictionary_state.reset();
+
+  if (!m_dictionary || !m_dictionary->get_size())
+    return;
+
+  m_dictionary->take_ownership();
+
+  // Loading a dictionary means hashing it. Do that only once & copy
+  // the prepared state for each frame.
+  auto data = reinterpret_cast<char const *>(m_dictionary->get_buffer());
+  auto size = static_cast<int>(m_dictionary->get_size());
+
+  if (use_hc()) {
+    m_hc_dictionary_state = std::make_shared<LZ4_streamHC_t>();
+    LZ4_initStreamHC(m_hc_dictionary_state.get(), sizeof(LZ4_streamHC_t));
+    LZ4_resetStreamHC_fast(m_hc_dictionary_state.get(), m_level);
+    LZ4_loadDictHC(m_hc_dictionary_state.get(), data, size);
+
+  } else {
+    m_fast_dictionary_state = std::make_shared<LZ4_stream_t>();
+    LZ4_initStream(m_fast_dictionary_state.get(), sizeof(LZ4_stream_t));
+    LZ4_loadDict(m_fast_dictionary_state.get(), data, size);
+  }
+}
+
+void
+lz4_compressor_c::set_track_headers(libmatroska::KaxContentEncoding &c_encoding) {
+  compressor_c::set_track_headers(c_encoding);
+
+  // The dictionary is required for decompression.
+  if (m_dictionary && m_dictionary->get_size())
+    GetChild<libmatroska::KaxContentCompSettings>(GetChild<libmatroska::KaxContentCompression>(c_encoding)).CopyBuffer(m_dictionary->get_buffer(), m_dictionary->get_size());
+}
+
+memory_cptr
+lz4_compressor_c::do_decompress(unsigned char const *buffer,
+                                std::size_t size) {
+  if (size < 4)
+    throw mtx::compression_x(Y("LZ4 decompression failed: the data is too short.\n"));
+
+  // The size is taken from the data and must not be trusted. LZ4
+  // cannot expand a byte to more than 255 bytes.
+  auto raw_size = get_uint32_be(buffer);
+  if (   (raw_size > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+      || ((size - 4) > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+      || (raw_size > ((size - 4) * 255)))
+    throw mtx::compression_x(fmt::format(Y("LZ4 decompression failed: the uncompressed size {0} is invalid.\n"), raw_size));
+
+  auto dst      = memory_c::alloc(raw_size);
+  auto src      = reinterpret_cast<char const *>(buffer + 4);
+  auto out      = reinterpret_cast<char *>(dst->get_buffer());
+  auto result   = m_dictionary ? LZ4_decompress_safe_usingDict(src, out, size - 4, raw_size, reinterpret_cast<char const *>(m_dictionary->get_buffer()), m_dictionary->get_size())
+                :                LZ4_decompress_safe(          src, out, size - 4, raw_size);
+
+  if (result != static_cast<int>(raw_size))
+    throw mtx::compression_x(fmt::format(Y("LZ4 decompression failed. Result: {0}\n"), result));
+
+  mxdebug_if(m_debug, fmt::format("lz4_compressor_c: Decompression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / size));
+
+  return dst;
+}
+
+memory_cptr
+lz4_compressor_c::do_compress(unsigned char const *buffer,
+                              std::size_t size) {
+  if (size > LZ4_MAX_INPUT_SIZE)
+    throw mtx::compression_x(fmt::format(Y("LZ4 compression failed: a frame of {0} bytes is too big.\n"), size));
+
+  auto bound  = LZ4_compressBound(size);
+  auto dst    = memory_c::alloc(4 + bound);
+  auto src    = reinterpret_cast<char const *>(buffer);
+  auto out    = reinterpret_cast<char *>(dst->get_buffer() + 4);
+  auto result = 0;
+
+  if (m_hc_dictionary_state) {
+    auto state = hc_state();
+    std::memcpy(state, m_hc_dictionary_state.get(), sizeof(LZ4_streamHC_t));
+    result = LZ4_compress_HC_continue(state, src, out, size, bound);
+
+  } else if (m_fast_dictionary_state) {
+    auto state = fast_state();
+    std::memcpy(state, m_fast_dictionary_state.get(), sizeof(LZ4_stream_t));
+    result = LZ4_compress_fast_continue(state, src, out, size, bound, 1);
+
+  } else if (use_hc())
+    result = LZ4_compress_HC_extStateHC(hc_state(), src, out, size, bound, m_level);
+
+  else
+    result = LZ4_compress_fast_extState(fast_state(), src, out, size, bound, 1);
+
+  if (result <= 0)
+    throw mtx::compression_x(fmt::format(Y("LZ4 compression failed. Result: {0}\n"), result));
+
+  put_uint32_be(dst->get_buffer(), size);
+  dst->resize(4 + result);
+
+  mxdebug_if(m_debug, fmt::format("lz4_compressor_c: Compression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / std::max<std::size_t>(size, 1)));
+
+  return dst;
+}
+
+#endif  // HAVE_LZ4
@@ -0,0 +1,56 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   LZ4 compressor
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#if defined(HAVE_LZ4)
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+#include "common/compression.h"
+
+// Each frame is stored as a 32-bit big endian uncompressed size
+// followed by a single LZ4 block. Levels below LZ4HC_CLEVEL_MIN
+// select the fast compressor, all others the high compression one.
+class lz4_compressor_c: public compressor_c {
+protected:
+  int m_level{LZ4HC_CLEVEL_DEFAULT};
+  memory_cptr m_dictionary;
+  std::shared_ptr<LZ4_stream_t> m_fast_dictionary_state;
+  std::shared_ptr<LZ4_streamHC_t> m_hc_dictionary_state;
+
+public:
+  lz4_compressor_c();
+  virtual ~lz4_compressor_c();
+
+  virtual void set_parameters(compression_parameters_t const &parameters) override;
+  virtual void set_dictionary(memory_cptr const &dictionary);
+  virtual void set_track_headers(libmatroska::KaxContentEncoding &c_encoding) override;
+
+  virtual bool is_thread_safe() const override {
+    return true;
+  }
+
+protected:
+  virtual memory_cptr do_compress(unsigned char const *buffer, std::size_t size) override;
+  virtual memory_cptr do_decompress(unsigned char const *buffer, std::size_t size) override;
+
+  bool use_hc() const {
+    return m_level >= LZ4HC_CLEVEL_MIN;
+  }
+};
+
+#endif  // HAVE_LZ4
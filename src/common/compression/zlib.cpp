@@ -23,6 +23,12 @@ zlib_compressor_c::zlib_compressor_c()
 zlib_compressor_c::~zlib_compressor_c() {
 }
 
+void
+zlib_compressor_c::set_parameters(compression_parameters_t const &parameters) {
+  if (parameters.m_level)
+    m_level = std::clamp(*parameters.m_level, Z_NO_COMPRESSION, Z_BEST_COMPRESSION);
+}
+
 memory_cptr
 zlib_compressor_c::do_decompress(unsigned char const *buffer,
                                  std::size_t size) {
@@ -34,7 +40,7 @@ zlib_compressor_c::do_decompress(unsigned char const *buffer,
   int result      = inflateInit2(&d_stream, 15 + 32); // 15: window size; 32: look for zlib/gzip headers automatically
 
   if (Z_OK != result)
-    mxerror(fmt::format(Y("inflateInit() failed. Result: {0}\n"), result));
+    throw mtx::compression_x(fmt::format(Y("inflateInit() failed. Result: {0}\n"), result));
 
   d_stream.next_in   = const_cast<Bytef *>(buffer);
   d_stream.avail_in  = size;
@@ -48,8 +54,10 @@ zlib_compressor_c::do_decompress(unsigned char const *buffer,
     d_stream.avail_out = 4000;
     result             = inflate(&d_stream, Z_NO_FLUSH);
 
-    if ((Z_OK != result) && (Z_STREAM_END != result))
+    if ((Z_OK != result) && (Z_STREAM_END != result)) {
+      inflateEnd(&d_stream);
       throw mtx::compression_x(fmt::format(Y("Zlib decompression failed. Result: {0}\n"), result));
+    }
 
   } while ((0 == d_stream.avail_out) && (0 != d_stream.avail_in) && (Z_STREAM_END != result));
 
@@ -69,10 +77,10 @@ zlib_compressor_c::do_compress(unsigned char const *buffer,
   c_stream.zalloc = (alloc_func)0;
   c_stream.zfree  = (free_func)0;
   c_stream.opaque = (voidpf)0;
-  int result      = deflateInit(&c_stream, 9);
+  int result      = deflateInit(&c_stream, m_level);
 
   if (Z_OK != result)
-    mxerror(fmt::format(Y("deflateInit() failed. Result: {0}\n"), result));
+    throw mtx::compression_x(fmt::format(Y("deflateInit() failed. Result: {0}\n"), result));
 
   c_stream.next_in   = (Bytef *)buffer;
   c_stream.avail_in  = size;
@@ -86,8 +94,10 @@ zlib_compressor_c::do_compress(unsigned char const *buffer,
     c_stream.avail_out = 4000;
     result             = deflate(&c_stream, Z_FINISH);
 
-    if ((Z_OK != result) && (Z_STREAM_END != result))
-      mxerror(fmt::format(Y("Zlib decompression failed. Result: {0}\n"), result));
+    if ((Z_OK != result) && (Z_STREAM_END != result)) {
+      deflateEnd(&c_stream);
+      throw mtx::compression_x(fmt::format(Y("Zlib compression failed. Result: {0}\n"), result));
+    }
 
   } while ((c_stream.avail_out == 0) && (result != Z_STREAM_END));
 
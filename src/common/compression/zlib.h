@@ -20,10 +20,19 @@
 #include "common/compression.h"
 
 class zlib_compressor_c: public compressor_c {
+protected:
+  int m_level{9};
+
 public:
   zlib_compressor_c();
   virtual ~zlib_compressor_c();
 
+  virtual void set_parameters(compression_parameters_t const &parameters) override;
+
+  virtual bool is_thread_safe() const override {
+    return true;
+  }
+
 protected:
   virtual memory_cptr do_compress(unsigned char const *buffer, std::size_t size) override;
   virtual memory_cptr do_decompress(unsigned char const *buffer, std::size_t size) override;
@@ -0,0 +1,173 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   zstd compressor
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#if defined(HAVE_ZSTD)
+
+#include <matroska/KaxContentEncoding.h>
+
+#include "common/compression/zstd.h"
+#include "common/ebml.h"
+
+namespace {
+
+// The content size is taken from the frame header and must not be
+// trusted. Larger frames are decompressed in chunks so that memory is
+// only allocated for data that's actually there, up to a fixed limit.
+constexpr uint64_t s_max_single_call_size  =   64 * 1024 * 1024;
+constexpr uint64_t s_max_decompressed_size = 1024 * 1024 * 1024;
+
+// Contexts are expensive to set up. Keep one per thread so that
+// several threads can compress or decompress with the same
+// compressor object concurrently.
+ZSTD_CCtx *
+compression_context() {
+  thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> s_context{ZSTD_createCCtx(), ZSTD_freeCCtx};
+  return s_context.get();
+}
+
+ZSTD_DCtx *
+decompression_context() {
+  thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> s_context{ZSTD_createDCtx(), ZSTD_freeDCtx};
+  return s_context.get();
+}
+
+}
+
+zstd_compressor_c::zstd_compressor_c()
+  : compressor_c(COMPRESSION_ZSTD)
+{
+}
+
+zstd_compressor_c::~zstd_compressor_c() {
+}
+
+void
+zstd_compressor_c::set_parameters(compression_parameters_t const &parameters) {
+  if (parameters.m_level)
+    m_level = std::clamp(*parameters.m_level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+
+  if (parameters.m_dictionary)
+    set_dictionary(parameters.m_dictionary);
+}
+
+void
+zstd_compressor_c::set_dictionary(memory_cptr const &dictionary) {
+  m_dictionary = dictionary;
+  m_cdict.reset();
+  m_ddict.reset();
+
+  if (!m_dictionary || !m_dictionary->get_size())
+    return;
+
+  m_dictionary->take_ownership();
+
+  m_cdict.reset(ZSTD_createCDict(m_dictionary->get_buffer(), m_dictionary->get_size(), m_level), ZSTD_freeCDict);
+  m_ddict.reset(ZSTD_createDDict(m_dictionary->get_buffer(), m_dictionary->get_size()),          ZSTD_freeDDict);
+
+  if (!m_cdict || !m_ddict)
+    throw mtx::compression_x(Y("The zstd dictionary could not be loaded.\n"));
+}
+
+void
+zstd_compressor_c::set_track_headers(libmatroska::KaxContentEncoding &c_encoding) {
+  compressor_c::set_track_headers(c_encoding);
+
+  // The dictionary is required for decompression.
+  if (m_dictionary && m_dictionary->get_size())
+    GetChild<libmatroska::KaxContentCompSettings>(GetChild<libmatroska::KaxContentCompression>(c_encoding)).CopyBuffer(m_dictionary->get_buffer(), m_dictionary->get_size());
+}
+
+memory_cptr
+zstd_compressor_c::do_decompress(unsigned char const *buffer,
+                                 std::size_t size) {
+  auto context      = decompression_context();
+  auto content_size = ZSTD_getFrameContentSize(buffer, size);
+
+  if (ZSTD_CONTENTSIZE_ERROR == content_size)
+    throw mtx::compression_x(Y("zstd decompression failed: the data is not a valid zstd frame.\n"));
+
+  memory_cptr dst;
+
+  if ((ZSTD_CONTENTSIZE_UNKNOWN != content_size) && (content_size <= s_max_single_call_size)) {
+    // Frames written by mkvmerge always carry their size, allowing
+    // decompression in a single call.
+    dst         = memory_c::alloc(content_size);
+    auto result = m_ddict ? ZSTD_decompress_usingDDict(context, dst->get_buffer(), content_size, buffer, size, m_ddict.get())
+                :           ZSTD_decompressDCtx(       context, dst->get_buffer(), content_size, buffer, size);
+
+    if (ZSTD_isError(result))
+      throw mtx::compression_x(fmt::format(Y("zstd decompression failed: {0}\n"), ZSTD_getErrorName(result)));
+
+    dst->resize(result);
+
+  } else {
+    ZSTD_DCtx_reset(context, ZSTD_reset_session_and_parameters);
+    if (m_ddict)
+      ZSTD_DCtx_refDDict(context, m_ddict.get());
+
+    dst                = memory_c::alloc(0);
+    auto const chunk   = ZSTD_DStreamOutSize();
+    ZSTD_inBuffer in   = { buffer, size, 0 };
+    ZSTD_outBuffer out = { nullptr, 0, 0 };
+    std::size_t result = 0;
+
+    // One byte more than allowed is made available in order to detect
+    // frames exceeding the limit.
+    do {
+      dst->resize(std::min<uint64_t>(out.pos + chunk, s_max_decompressed_size + 1));
+      out.dst  = dst->get_buffer();
+      out.size = dst->get_size();
+      result   = ZSTD_decompressStream(context, &out, &in);
+
+      if (ZSTD_isError(result))
+        throw mtx::compression_x(fmt::format(Y("zstd decompression failed: {0}\n"), ZSTD_getErrorName(result)));
+
+      if (out.pos > s_max_decompressed_size)
+        throw mtx::compression_x(fmt::format(Y("zstd decompression failed: the frame is bigger than {0} bytes.\n"), s_max_decompressed_size));
+
+    } while (result && ((in.pos < in.size) || (out.pos == out.size)));
+
+    // A non-zero result means that the frame isn't complete.
+    if (result)
+      throw mtx::compression_x(Y("zstd decompression failed: the frame is truncated.\n"));
+
+    dst->resize(out.pos);
+  }
+
+  mxdebug_if(m_debug, fmt::format("zstd_compressor_c: Decompression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / std::max<std::size_t>(size, 1)));
+
+  return dst;
+}
+
+memory_cptr
+zstd_compressor_c::do_compress(unsigned char const *buffer,
+                               std::size_t size) {
+  auto context = compression_context();
+  auto bound   = ZSTD_compressBound(size);
+  auto dst     = memory_c::alloc(bound);
+  auto result  = m_cdict ? ZSTD_compress_usingCDict(context, dst->get_buffer(), bound, buffer, size, m_cdict.get())
+               :           ZSTD_compressCCtx(       context, dst->get_buffer(), bound, buffer, size, m_level);
+
+  if (ZSTD_isError(result))
+    throw mtx::compression_x(fmt::format(Y("zstd compression failed: {0}\n"), ZSTD_getErrorName(result)));
+
+  dst->resize(result);
+
+  mxdebug_if(m_debug, fmt::format("zstd_compressor_c: Compression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / std::max<std::size_t>(size, 1)));
+
+  return dst;
+}
+
+#endif  // HAVE_ZSTD
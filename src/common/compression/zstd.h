@@ -0,0 +1,48 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   zstd compressor
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#if defined(HAVE_ZSTD)
+
+#include <zstd.h>
+
+#include "common/compression.h"
+
+class zstd_compressor_c: public compressor_c {
+protected:
+  int m_level{ZSTD_CLEVEL_DEFAULT};
+  memory_cptr m_dictionary;
+  std::shared_ptr<ZSTD_CDict> m_cdict;
+  std::shared_ptr<ZSTD_DDict> m_ddict;
+
+public:
+  zstd_compressor_c();
+  virtual ~zstd_compressor_c();
+
+  virtual void set_parameters(compression_parameters_t const &parameters) override;
+  virtual void set_dictionary(memory_cptr const &dictionary);
+  virtual void set_track_headers(libmatroska::KaxContentEncoding &c_encoding) override;
+
+  virtual bool is_thread_safe() const override {
+    return true;
+  }
+
+protected:
+  virtual memory_cptr do_compress(unsigned char const *buffer, std::size_t size) override;
+  virtual memory_cptr do_decompress(unsigned char const *buffer, std::size_t size) override;
+};
+
+#endif  // HAVE_ZSTD
@@ -96,6 +96,22 @@ content_decoder_c::initialize(KaxTrackEntry &ktentry) {
         encodings.push_back(enc);
       }
 
+#if defined(HAVE_ZSTD)
+    } else if (mtx::compression::nonstandard_algo_zstd == enc.comp_algo) {
+      auto compressor = std::make_shared<zstd_compressor_c>();
+      compressor->set_dictionary(enc.comp_settings);
+      enc.compressor  = compressor;
+      encodings.push_back(enc);
+#endif
+
+#if defined(HAVE_LZ4)
+    } else if (mtx::compression::nonstandard_algo_lz4 == enc.comp_algo) {
+      auto compressor = std::make_shared<lz4_compressor_c>();
+      compressor->set_dictionary(enc.comp_settings);
+      enc.compressor  = compressor;
+      encodings.push_back(enc);
+#endif
+
     } else {
       mxwarn(fmt::format(Y("Track {0} has been compressed with an unknown/unsupported compression algorithm ({1}).\n"), tid, enc.comp_algo));
       ok = false;
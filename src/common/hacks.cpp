@@ -65,6 +65,14 @@ get_list() {
                                                             Y("The resulting tracks will be broken: the official FLAC tools will not be able to decode them and seeking will not work as expected.") });
   hacks.emplace_back("dont_normalize_parameter_sets", svec{ Y("Normally the HEVC/H.265 code in mkvmerge and mkvextract normalizes parameter sets by prefixing all key frames with all currently active parameter sets and removes duplicates that might already be present."),
                                                             Y("If this hack is enabled, the code will leave the parameter sets as they are.") });
+  hacks.emplace_back("no_parallel_compression",       svec{ Y("Normally mkvmerge compresses frames with zlib on several threads in parallel to demultiplexing."),
+                                                            Y("If this hack is enabled, frames will be compressed sequentially on the main thread.") });
+  hacks.emplace_back("allow_nonstandard_compression", svec{ Y("Allows the use of the compression methods 'zstd' and 'lz4' with '--compression'."),
+                                                            Y("They are not part of the Matroska specification. The resulting files can only be read by MKVToolNix.") });
+  hacks.emplace_back("no_cluster_copy",               svec{ Y("If only a single Matroska file is read & none of its tracks needs to be modified, mkvmerge copies whole clusters to the output file without re-creating their blocks."),
+                                                            Y("If this hack is enabled, all clusters will be re-created from their frames.") });
+  hacks.emplace_back("no_appended_file_read_ahead",   svec{ Y("Normally mkvmerge asks the operating system to read the beginnings of the next few appended files into its cache while parsing the headers of the current one."),
+                                                            Y("If this hack is enabled, no such hints are given.") });
   hacks.emplace_back("cow",                           svec{ Y("No help available.") });
 
 
@@ -45,7 +45,11 @@ constexpr unsigned int KEEP_TRACK_STATISTICS_TAGS    = 20;
 constexpr unsigned int ALL_I_SLICES_ARE_KEY_FRAMES   = 21;
 constexpr unsigned int APPEND_AND_SPLIT_FLAC         = 22;
 constexpr unsigned int DONT_NORMALIZE_PARAMETER_SETS = 23;
-constexpr unsigned int MAX_IDX                       = 23;
+constexpr unsigned int NO_PARALLEL_COMPRESSION       = 24;
+constexpr unsigned int ALLOW_NONSTANDARD_COMPRESSION = 25;
+constexpr unsigned int NO_CLUSTER_COPY               = 26;
+constexpr unsigned int NO_APPENDED_FILE_READ_AHEAD   = 27;
+constexpr unsigned int MAX_IDX                       = 27;
 }
 
 struct hack_t {
@@ -149,7 +149,13 @@ es_parser_c::handle_vps_nalu(memory_cptr const &nalu,
                              extra_data_position_e extra_data_position) {
   vps_info_t vps_info;
 
-  if (!parse_vps(mpeg::nalu_to_rbsp(nalu), vps_info))
+  if (auto cached = m_vps_cache.find(*nalu, 0); cached)
+    vps_info = cached->m_info;
+
+  else if (parse_vps(mpeg::nalu_to_rbsp(nalu), vps_info))
+    m_vps_cache.add(*nalu, 0, {}, vps_info);
+
+  else
     return;
 
   size_t i;
@@ -163,6 +169,7 @@ es_parser_c::handle_vps_nalu(memory_cptr const &nalu,
     m_vps_list.push_back(nalu->clone());
     m_vps_info_list.push_back(vps_info);
     m_configuration_record_changed = true;
+    m_sps_cache.clear();
 
   } else if (m_vps_info_list[i].checksum != vps_info.checksum) {
     mxdebug_if(m_debug_parameter_sets, fmt::format("hevc: VPS ID {0:04x} changed; checksum old {1:04x} new {2:04x}\n", vps_info.id, m_vps_info_list[i].checksum, vps_info.checksum));
@@ -170,6 +177,7 @@ es_parser_c::handle_vps_nalu(memory_cptr const &nalu,
     m_vps_info_list[i]             = vps_info;
     m_vps_list[i]                  = nalu->clone();
     m_configuration_record_changed = true;
+    m_sps_cache.clear();
 
     // Update codec private if needed
     if (m_codec_private.vps_data_id == (int) vps_info.id)
@@ -200,12 +208,22 @@ void
 es_parser_c::handle_sps_nalu(memory_cptr const &nalu,
                              extra_data_position_e extra_data_position) {
   sps_info_t sps_info;
+  memory_cptr parsed_nalu;
+  uint64_t context = m_keep_ar_info ? 1 : 0;
 
-  auto parsed_nalu = parse_sps(mpeg::nalu_to_rbsp(nalu), sps_info, m_vps_info_list, m_keep_ar_info);
-  if (!parsed_nalu)
-    return;
+  if (auto cached = m_sps_cache.find(*nalu, context); cached) {
+    sps_info                      = cached->m_info.first;
+    parsed_nalu                   = cached->m_parsed;
+    m_vps_info_list[sps_info.vps] = cached->m_info.second;
 
-  parsed_nalu = mpeg::rbsp_to_nalu(parsed_nalu);
+  } else {
+    parsed_nalu = parse_sps(mpeg::nalu_to_rbsp(nalu), sps_info, m_vps_info_list, m_keep_ar_info);
+    if (!parsed_nalu)
+      return;
+
+    parsed_nalu = mpeg::rbsp_to_nalu(parsed_nalu);
+    m_sps_cache.add(*nalu, context, parsed_nalu, { sps_info, m_vps_info_list[sps_info.vps] });
+  }
 
   size_t i;
   for (i = 0; m_sps_info_list.size() > i; ++i)
@@ -277,7 +295,13 @@ es_parser_c::handle_pps_nalu(memory_cptr const &nalu,
                              extra_data_position_e extra_data_position) {
   pps_info_t pps_info;
 
-  if (!parse_pps(mpeg::nalu_to_rbsp(nalu), pps_info))
+  if (auto cached = m_pps_cache.find(*nalu, 0); cached)
+    pps_info = cached->m_info;
+
+  else if (parse_pps(mpeg::nalu_to_rbsp(nalu), pps_info))
+    m_pps_cache.add(*nalu, 0, {}, pps_info);
+
+  else
     return;
 
   size_t i;
@@ -307,13 +331,13 @@ es_parser_c::handle_pps_nalu(memory_cptr const &nalu,
 void
 es_parser_c::handle_sei_nalu(memory_cptr const &nalu,
                              extra_data_position_e extra_data_position) {
-  if (parse_sei(mpeg::nalu_to_rbsp(nalu), m_user_data))
+  if (parse_sei(nalu, m_user_data))
     add_nalu_to_extra_data(nalu, extra_data_position);
 }
 
 void
 es_parser_c::handle_unspec62_nalu(memory_cptr const &nalu) {
-  if (parse_dovi_rpu(mpeg::nalu_to_rbsp(nalu), m_dovi_rpu_data_header))
+  if (parse_dovi_rpu(nalu, m_dovi_rpu_data_header))
     add_nalu_to_pending_frame_data(nalu);
 }
 
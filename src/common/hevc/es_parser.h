@@ -17,6 +17,7 @@
 
 #include "common/avc_hevc/types.h"
 #include "common/avc_hevc/es_parser.h"
+#include "common/avc_hevc/parameter_set_cache.h"
 #include "common/hevc/types.h"
 #include "common/math_fwd.h"
 #include "common/dovi_meta.h"
@@ -30,6 +31,14 @@ protected:
   std::vector<vps_info_t> m_vps_info_list;
   std::vector<sps_info_t> m_sps_info_list;
   std::vector<pps_info_t> m_pps_info_list;
+
+  // Parsing an SPS also stores its profile & level in the VPS it
+  // refers to. The SPS cache therefore keeps the resulting VPS, too,
+  // and is cleared whenever the list of VPSes changes.
+  mtx::avc_hevc::parameter_set_cache_c<vps_info_t> m_vps_cache;
+  mtx::avc_hevc::parameter_set_cache_c<std::pair<sps_info_t, vps_info_t>> m_sps_cache;
+  mtx::avc_hevc::parameter_set_cache_c<pps_info_t> m_pps_cache;
+
   user_data_t m_user_data;
   codec_private_t m_codec_private;
 
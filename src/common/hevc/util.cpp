@@ -762,16 +762,11 @@ parse_pps(memory_cptr const &buffer,
 
 // HEVC spec, 7.3.2.4
 bool
-parse_sei(memory_cptr const &buffer,
+parse_sei(memory_cptr const &nalu,
           user_data_t &user_data) {
   try {
-    mtx::bits::reader_c r(buffer->get_buffer(), buffer->get_size());
-    mm_mem_io_c byte_reader{*buffer};
-
-    unsigned int bytes_read   = 0;
-    unsigned int buffer_size  = buffer->get_size();
-    unsigned int payload_type = 0;
-    unsigned int payload_size = 0;
+    mtx::bits::reader_c r(nalu->get_buffer(), nalu->get_size());
+    r.enable_rbsp_mode();
 
     r.skip_bits(1);                                 // forbidden_zero_bit
     if (r.get_bits(6) != NALU_TYPE_PREFIX_SEI) // nal_unit_type
@@ -779,37 +774,34 @@ parse_sei(memory_cptr const &buffer,
     r.skip_bits(6);             // nuh_reserved_zero_6bits
     r.skip_bits(3);             // nuh_temporal_id_plus1
 
-    byte_reader.skip(2);        // skip the nalu header
-    bytes_read += 2;
-
-    while(bytes_read < buffer_size-2) {
-      payload_type = 0;
-
-      unsigned int payload_type_byte = byte_reader.read_uint8();
-      bytes_read++;
-
-      while(payload_type_byte == 0xFF) {
-        payload_type     += 255;
-        payload_type_byte = byte_reader.read_uint8();
-        bytes_read++;
+    // Messages are parsed as long as at least three bytes of RBSP data
+    // are left; the remaining bits in RBSP mode cannot be determined
+    // without decoding the rest of the NALU.
+    auto more_messages = [&r]() {
+      try {
+        r.peek_bits(24);
+        return true;
+      } catch (...) {
+        return false;
       }
+    };
 
+    while (more_messages()) {
+      unsigned int payload_type = 0;
+      unsigned int payload_type_byte;
+
+      while ((payload_type_byte = r.get_bits(8)) == 0xFF)
+        payload_type += 255;
       payload_type += payload_type_byte;
-      payload_size  = 0;
 
-      unsigned int payload_size_byte = byte_reader.read_uint8();
-      bytes_read++;
+      unsigned int payload_size = 0;
+      unsigned int payload_size_byte;
 
-      while(payload_size_byte == 0xFF) {
-        payload_size     += 255;
-        payload_size_byte = byte_reader.read_uint8();
-        bytes_read++;
-      }
+      while ((payload_size_byte = r.get_bits(8)) == 0xFF)
+        payload_size += 255;
       payload_size += payload_size_byte;
 
-      handle_sei_payload(byte_reader, payload_type, payload_size, user_data);
-
-      bytes_read += payload_size;
+      handle_sei_payload(r, payload_type, payload_size, user_data);
     }
 
     return true;
@@ -819,31 +811,30 @@ parse_sei(memory_cptr const &buffer,
 }
 
 bool
-handle_sei_payload(mm_mem_io_c &byte_reader,
+handle_sei_payload(mtx::bits::reader_c &r,
                    unsigned int sei_payload_type,
                    unsigned int sei_payload_size,
                    user_data_t &user_data) {
-  std::vector<unsigned char> uuid;
-  uint64_t file_pos = byte_reader.getFilePointer();
-
-  uuid.resize(16);
-  if (sei_payload_type == SEI_USER_DATA_UNREGISTERED) {
-    if (sei_payload_size >= 16) {
-      byte_reader.read(&uuid[0], 16); // uuid
+  // Only unregistered user data is kept. All other payloads are
+  // skipped without looking at their content.
+  if ((sei_payload_type != SEI_USER_DATA_UNREGISTERED) || (sei_payload_size < 16)) {
+    r.skip_bits(sei_payload_size * 8);
+    return true;
+  }
 
-      if (user_data.find(uuid) == user_data.end()) {
-        std::vector<unsigned char> &payload = user_data[uuid];
+  std::vector<unsigned char> uuid(16);
+  r.get_bytes(uuid.data(), 16);
 
-        payload.resize(sei_payload_size);
-        memcpy(&payload[0], &uuid[0], 16);
-        byte_reader.read(&payload[16], sei_payload_size - 16);
-      }
-    }
+  if (user_data.find(uuid) != user_data.end()) {
+    r.skip_bits((sei_payload_size - 16) * 8);
+    return true;
   }
 
-  // Go to end of SEI data by going to its beginning and then skipping over it.
-  byte_reader.setFilePointer(file_pos);
-  byte_reader.skip(sei_payload_size);
+  auto &payload = user_data[uuid];
+
+  payload.resize(sei_payload_size);
+  std::memcpy(payload.data(), uuid.data(), 16);
+  r.get_bytes(&payload[16], sei_payload_size - 16);
 
   return true;
 }
@@ -964,10 +955,11 @@ hevcc_to_nalus(const unsigned char *buffer,
 }
 
 bool
-parse_dovi_rpu(memory_cptr const &buffer, mtx::dovi::dovi_rpu_data_header_t &hdr) {
+parse_dovi_rpu(memory_cptr const &nalu, mtx::dovi::dovi_rpu_data_header_t &hdr) {
   try {
-    mtx::bits::reader_c r(buffer->get_buffer(), buffer->get_size());
-    mm_mem_io_c byte_reader{*buffer};
+    // Only the header at the start of the RPU is read.
+    mtx::bits::reader_c r(nalu->get_buffer(), nalu->get_size());
+    r.enable_rbsp_mode();
 
     r.skip_bits(1);             // forbidden_zero_bit
 
@@ -977,8 +969,6 @@ parse_dovi_rpu(memory_cptr const &buffer, mtx::dovi::dovi_rpu_data_header_t &hdr
     r.skip_bits(6);             // nuh_reserved_zero_6bits
     r.skip_bits(3);             // nuh_temporal_id_plus1
 
-    byte_reader.skip(2);        // skip the nalu header
-
     hdr.rpu_nal_prefix = r.get_bits(8);
 
     if (hdr.rpu_nal_prefix == 25) {
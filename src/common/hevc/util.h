@@ -18,6 +18,10 @@
 #include "common/dovi_meta.h"
 #include "common/hevc/types.h"
 
+namespace mtx::bits {
+class reader_c;
+}
+
 namespace mtx::hevc {
 
 struct par_extraction_t {
@@ -31,10 +35,12 @@ struct par_extraction_t {
 bool parse_vps(memory_cptr const &buffer, vps_info_t &vps);
 memory_cptr parse_sps(memory_cptr const &buffer, sps_info_t &sps, std::vector<vps_info_t> &vps_info_list, bool keep_ar_info = false);
 bool parse_pps(memory_cptr const &buffer, pps_info_t &pps);
-bool parse_sei(memory_cptr const &buffer, user_data_t &user_data);
-bool handle_sei_payload(mm_mem_io_c &byte_reader, unsigned int sei_payload_type, unsigned int sei_payload_size, user_data_t &user_data);
+// The following functions take the NALUs as they are, including their
+// emulation prevention bytes.
+bool parse_sei(memory_cptr const &nalu, user_data_t &user_data);
+bool handle_sei_payload(mtx::bits::reader_c &r, unsigned int sei_payload_type, unsigned int sei_payload_size, user_data_t &user_data);
 
-bool parse_dovi_rpu(memory_cptr const &buffer, mtx::dovi::dovi_rpu_data_header_t &dovi_rpu_data_header);
+bool parse_dovi_rpu(memory_cptr const &nalu, mtx::dovi::dovi_rpu_data_header_t &dovi_rpu_data_header);
 
 par_extraction_t extract_par(memory_cptr const &buffer);
 bool is_fourcc(const char *fourcc);
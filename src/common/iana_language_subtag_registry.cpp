@@ -14,7 +14,6 @@
 #include "common/common_pch.h"
 
 #include "common/iana_language_subtag_registry.h"
-#include "common/strings/formatting.h"
 
 namespace mtx::iana::language_subtag_registry {
 
@@ -26,9 +25,8 @@ look_up_entry(std::string const &s,
   if (s.empty())
     return {};
 
-  auto s_lower = mtx::string::to_lower_ascii(s);
-  auto itr     = std::find_if(entries.begin(), entries.end(), [&s_lower](auto const &entry) {
-    return s_lower == mtx::string::to_lower_ascii(entry.code);
+  auto itr = std::find_if(entries.begin(), entries.end(), [&s](auto const &entry) {
+    return balg::iequals(s, entry.code);
   });
 
   if (itr != entries.end())
@@ -41,17 +39,17 @@ look_up_entry(std::string const &s,
 
 std::optional<entry_t>
 look_up_extlang(std::string const &s) {
-  return look_up_entry(s, g_extlangs);
+  return look_up_entry(s, extlangs());
 }
 
 std::optional<entry_t>
 look_up_variant(std::string const &s) {
-  return look_up_entry(s, g_variants);
+  return look_up_entry(s, variants());
 }
 
 std::optional<entry_t>
 look_up_grandfathered(std::string const &s) {
-  return look_up_entry(s, g_grandfathered);
+  return look_up_entry(s, grandfathered());
 }
 
 } // namespace mtx::iana::language_subtag_registry
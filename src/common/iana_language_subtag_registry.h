@@ -34,12 +34,13 @@ struct entry_t {
   }
 };
 
-extern std::vector<entry_t> g_extlangs, g_variants, g_grandfathered;
-extern std::vector< std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c> > g_preferred_values;
-extern std::unordered_map<std::string, std::string> g_suppress_scripts;
+// All lists are created on first use.
+std::vector<entry_t> const &extlangs();
+std::vector<entry_t> const &variants();
+std::vector<entry_t> const &grandfathered();
+std::vector< std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c> > const &preferred_values();
+std::unordered_map<std::string, std::string> const &suppress_scripts();
 
-void init();
-void init_preferred_values();
 std::optional<entry_t> look_up_extlang(std::string const &s);
 std::optional<entry_t> look_up_variant(std::string const &s);
 std::optional<entry_t> look_up_grandfathered(std::string const &s);
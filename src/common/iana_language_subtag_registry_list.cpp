@@ -22,12 +22,6 @@
 
 namespace mtx::iana::language_subtag_registry {
 
-std::vector<entry_t> g_extlangs, g_variants, g_grandfathered;
-std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> g_preferred_values;
-std::unordered_map<std::string, std::string> g_suppress_scripts;
-
-using VS = std::vector<std::string>;
-
 struct extlang_variant_init_t {
   char const *code, *description;
   char const *prefixes[12];
@@ -52,7 +46,7 @@ mtx::bcp47::language_c
 preferred_values_init_t::sub_t::parse()
   const {
 
-  auto language = tag ? mtx::bcp47::language_c::parse(tag) : mtx::bcp47::language_c{};
+  auto language = tag ? mtx::bcp47::language_c::parse(tag, mtx::bcp47::normalization_mode_e::none) : mtx::bcp47::language_c{};
 
   if (region)
     language.set_region(region);
@@ -1024,49 +1018,80 @@ static preferred_values_init_t s_preferred_values_init[] = {
   { { "QPR",                    NULL, NULL, }, { "es-PR",          NULL, NULL,      } },
 };
 
-void
-init() {
-  g_extlangs.reserve(252);
+namespace {
+
+std::vector<entry_t>
+create_entries(extlang_variant_init_t const *init,
+               std::size_t num_entries,
+               bool with_prefixes) {
+  std::vector<entry_t> entries;
+  entries.reserve(num_entries);
 
-  for (auto const *extlang = s_extlangs_init, *end = extlang + 252; extlang < end; ++extlang) {
-    g_extlangs.emplace_back(extlang->code, extlang->description, extlang->is_deprecated);
+  for (auto const *entry = init, *end = init + num_entries; entry < end; ++entry) {
+    entries.emplace_back(entry->code, entry->description, entry->is_deprecated);
 
-    auto &new_extlang = g_extlangs.back();
-    for (auto prefix = extlang->prefixes; *prefix; ++prefix)
-      new_extlang.prefixes.emplace_back(*prefix);
+    if (!with_prefixes)
+      continue;
+
+    auto &new_entry = entries.back();
+    for (auto prefix = entry->prefixes; *prefix; ++prefix)
+      new_entry.prefixes.emplace_back(*prefix);
   }
 
-  g_variants.reserve(108);
+  return entries;
+}
 
-  for (auto const *variant = s_variants_init, *end = variant + 108; variant < end; ++variant) {
-    g_variants.emplace_back(variant->code, variant->description, variant->is_deprecated);
+} // anonymous namespace
 
-    auto &new_variant = g_variants.back();
-    for (auto prefix = variant->prefixes; *prefix; ++prefix)
-      new_variant.prefixes.emplace_back(*prefix);
-  }
+std::vector<entry_t> const &
+extlangs() {
+  static auto const s_extlangs = create_entries(s_extlangs_init, 252, true);
+  return s_extlangs;
+}
+
+std::vector<entry_t> const &
+variants() {
+  static auto const s_variants = create_entries(s_variants_init, 108, true);
+  return s_variants;
+}
+
+std::vector<entry_t> const &
+grandfathered() {
+  static auto const s_grandfathered = create_entries(s_grandfathered_init, 26, false);
+  return s_grandfathered;
+}
 
-  g_suppress_scripts.reserve(134);
+std::unordered_map<std::string, std::string> const &
+suppress_scripts() {
+  static auto const s_suppress_scripts = []() {
+    std::unordered_map<std::string, std::string> all;
+    all.reserve(134);
 
-  for (auto const *suppress_script = s_suppress_scripts_init, *end = suppress_script + 134; suppress_script < end; ++suppress_script)
-    g_suppress_scripts.insert_or_assign(suppress_script->first, suppress_script->second);
+    for (auto const *suppress_script = s_suppress_scripts_init, *end = suppress_script + 134; suppress_script < end; ++suppress_script)
+      all.insert_or_assign(suppress_script->first, suppress_script->second);
 
-  g_grandfathered.reserve(26);
+    return all;
+  }();
 
-  for (auto const *grandfathered = s_grandfathered_init, *end = grandfathered + 26; grandfathered < end; ++grandfathered)
-    g_grandfathered.emplace_back(grandfathered->code, grandfathered->description, grandfathered->is_deprecated);
+  return s_suppress_scripts;
 }
 
-void
-init_preferred_values() {
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::none);
+// Parsing uses language_c::parse() without any normalization. This
+// way the canonicalization triggered by other tags never asks for the
+// list while it is being created.
+std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> const &
+preferred_values() {
+  static auto const s_preferred_values = []() {
+    std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> all;
+    all.reserve(423);
 
-  g_preferred_values.reserve(423);
+    for (auto const *preferred_value = s_preferred_values_init, *end = preferred_value + 423; preferred_value < end; ++preferred_value)
+      all.emplace_back(preferred_value->from.parse(), preferred_value->to.parse());
 
-  for (auto const *preferred_value = s_preferred_values_init, *end = preferred_value + 423; preferred_value < end; ++preferred_value)
-    g_preferred_values.emplace_back(preferred_value->from.parse(), preferred_value->to.parse());
+    return all;
+  }();
 
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::default_mode);
+  return s_preferred_values;
 }
 
 } // namespace mtx::iana::language_subtag_registry
@@ -14,7 +14,6 @@
 #include "common/common_pch.h"
 
 #include "common/iso15924.h"
-#include "common/strings/formatting.h"
 
 namespace mtx::iso15924 {
 
@@ -23,12 +22,12 @@ look_up(std::string const &s) {
   if (s.empty())
     return {};
 
-  auto s_lower = mtx::string::to_lower_ascii(s);
-  auto itr     = std::find_if(g_scripts.begin(), g_scripts.end(), [&s_lower](auto const &script) {
-    return s_lower == mtx::string::to_lower_ascii(script.code);
+  auto const &all = scripts();
+  auto itr        = std::find_if(all.begin(), all.end(), [&s](auto const &script) {
+    return balg::iequals(s, script.code);
   });
 
-  if (itr != g_scripts.end())
+  if (itr != all.end())
     return *itr;
 
   return {};
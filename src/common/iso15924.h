@@ -32,9 +32,9 @@ struct script_t {
   }
 };
 
-extern std::vector<script_t> g_scripts;
+// Created on first use.
+std::vector<script_t> const &scripts();
 
-void init();
 std::optional<script_t> look_up(std::string const &s);
 
 } // namespace mtx::iso15924
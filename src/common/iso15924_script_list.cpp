@@ -21,8 +21,6 @@
 
 namespace mtx::iso15924 {
 
-std::vector<script_t> g_scripts;
-
 struct script_init_t {
   char const *code;
   unsigned int number;
@@ -294,12 +292,19 @@ static script_init_t const s_scripts_init[] = {
   { "Zzzz", 999, u8"Code for uncoded script",                                                                         false },
 };
 
-void
-init() {
-  g_scripts.reserve(261);
+std::vector<script_t> const &
+scripts() {
+  static auto const s_scripts = []() {
+    std::vector<script_t> all;
+    all.reserve(261);
+
+    for (script_init_t const *script = s_scripts_init, *end = script + 261; script < end; ++script)
+      all.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
+
+    return all;
+  }();
 
-  for (script_init_t const *script = s_scripts_init, *end = script + 261; script < end; ++script)
-    g_scripts.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
+  return s_scripts;
 }
 
 } // namespace mtx::iso15924
@@ -35,9 +35,10 @@ std::map<std::string, std::string> const s_deprecated_cctlds{
 
 std::optional<region_t>
 look_up(std::function<bool(region_t const &)> const &test) {
-  auto itr = std::find_if(g_regions.begin(), g_regions.end(), test);
+  auto const &all = regions();
+  auto itr        = std::find_if(all.begin(), all.end(), test);
 
-  if (itr != g_regions.end())
+  if (itr != all.end())
     return *itr;
 
   return {};
@@ -34,9 +34,9 @@ struct region_t {
   }
 };
 
-extern std::vector<region_t> g_regions;
+// Created on first use.
+std::vector<region_t> const &regions();
 
-void init();
 std::optional<region_t> look_up(std::string const &s);
 std::optional<region_t> look_up(unsigned int number);
 
@@ -21,8 +21,6 @@
 
 namespace mtx::iso3166 {
 
-std::vector<region_t> g_regions;
-
 struct region_init_t {
   char const *alpha_2_code, *alpha_3_code;
   unsigned int number;
@@ -377,12 +375,19 @@ static region_init_t const s_regions_init[] = {
   { "ZZ", "",      0, u8"User-assigned",                                        u8"",                                                                                                                               false },
 };
 
-void
-init() {
-  g_regions.reserve(344);
+std::vector<region_t> const &
+regions() {
+  static auto const s_regions = []() {
+    std::vector<region_t> all;
+    all.reserve(344);
+
+    for (region_init_t const *region = s_regions_init, *end = region + 344; region < end; ++region)
+      all.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
+
+    return all;
+  }();
 
-  for (region_init_t const *region = s_regions_init, *end = region + 344; region < end; ++region)
-    g_regions.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
+  return s_regions;
 }
 
 } // namespace mtx::iso3166
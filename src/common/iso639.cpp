@@ -35,14 +35,48 @@ std::unordered_map<std::string, std::string> s_deprecated_1_and_2_codes{
   { "mol", "rum" },
 };
 
+language_t
+make_language(language_init_t const &lang) {
+  return { lang.english_name, lang.alpha_3_code, lang.alpha_2_code, lang.terminology_abbrev, lang.is_part_of_iso639_2, lang.is_deprecated };
+}
+
+std::optional<std::size_t>
+find_by_code(std::string const &code) {
+  auto begin = g_languages_by_code;
+  auto end   = g_languages_by_code + g_num_languages_by_code;
+  auto itr   = std::lower_bound(begin, end, code, [](code_index_t const &entry, std::string const &value) {
+    return std::strcmp(entry.code, value.c_str()) < 0;
+  });
+
+  if ((itr == end) || (code != itr->code))
+    return {};
+
+  return itr->idx;
+}
+
 } // anonymous namespace
 
+std::vector<language_t> const &
+languages() {
+  static auto const s_languages = []() {
+    std::vector<language_t> all;
+    all.reserve(g_num_languages_init);
+
+    for (auto lang = g_languages_init, end = g_languages_init + g_num_languages_init; lang < end; ++lang)
+      all.emplace_back(make_language(*lang));
+
+    return all;
+  }();
+
+  return s_languages;
+}
+
 void
 list_languages() {
   mtx::string::table_formatter_c formatter;
   formatter.set_header({ Y("English language name"), Y("ISO 639-3 code"), Y("ISO 639-2 code"), Y("ISO 639-1 code") });
 
-  for (auto &lang : g_languages)
+  for (auto &lang : languages())
     formatter.add_row({ gettext(lang.english_name.c_str()), lang.alpha_3_code, lang.is_part_of_iso639_2 ? lang.alpha_3_code : ""s, lang.alpha_2_code });
 
   mxinfo(formatter.format());
@@ -53,11 +87,14 @@ list_languages() {
    Searches the array of ISO 639 codes. If \c s is a valid ISO 639-2
    code, a valid ISO 639-1 code, a valid terminology abbreviation
    for an ISO 639-2 code or the English name for an ISO 639-2 code
-   then it returns the index of that entry in the \c g_languages array.
+   then it returns that entry.
+
+   Codes are looked up in a sorted index without creating the list of
+   all languages. That list is only created when looking up by name.
 
    \param c The string to look for in the array of ISO 639 codes.
-   \return The index into the \c g_languages array if found or
-   an empty optional if no such entry was found.
+   \return The entry if found or an empty optional if no such entry
+   was found.
 */
 std::optional<language_t>
 look_up(std::string const &s,
@@ -70,14 +107,14 @@ look_up(std::string const &s,
   if (deprecated_code != s_deprecated_1_and_2_codes.end())
     source = deprecated_code->second;
 
-  auto lang_code = std::find_if(g_languages.begin(), g_languages.end(), [&source](auto const &lang) { return (lang.alpha_3_code == source) || (lang.terminology_abbrev == source) || (lang.alpha_2_code == source); });
-  if (lang_code != g_languages.end())
-    return *lang_code;
+  auto idx = find_by_code(source);
+  if (idx)
+    return make_language(g_languages_init[*idx]);
 
   if (!also_look_up_by_name)
     return {};
 
-  for (auto const &language : g_languages) {
+  for (auto const &language : languages()) {
     auto const &english_name = language.english_name;
     auto s_lower             = balg::to_lower_copy(s);
     auto names               = mtx::string::split(english_name, ";");
@@ -89,7 +126,7 @@ look_up(std::string const &s,
         return language;
   }
 
-  for (auto const &language : g_languages) {
+  for (auto const &language : languages()) {
     auto names = mtx::string::split(language.english_name, ";");
 
     mtx::string::strip(names);
@@ -19,7 +19,7 @@
 
 namespace mtx::iso639 {
 
-void init();
+std::vector<language_t> const &languages();
 std::optional<language_t> look_up(std::string const &s, bool also_look_up_by_name = false);
 void list_languages();
 
@@ -17,18 +17,9 @@
 
 #include "common/iso639_types.h"
 
-using namespace std::string_literals;
-
 namespace mtx::iso639 {
 
-std::vector<language_t> g_languages;
-
-struct language_init_t {
-  char const *english_name, *alpha_3_code, *alpha_2_code, *terminology_abbrev;
-  bool is_part_of_iso639_2, is_deprecated;
-};
-
-static language_init_t const s_languages_init[] = {
+language_init_t const g_languages_init[] = {
   { u8"'Are'are",                                                   "alu",     "",   "",    false, false },
   { u8"'Auhelawa",                                                  "kud",     "",   "",    false, false },
   { u8"A'ou",                                                       "aou",     "",   "",    false, false },
@@ -8786,12 +8777,8972 @@ static language_init_t const s_languages_init[] = {
   { u8"ǃXóõ",                                                       "nmn",     "",   "",    false, false },
 };
 
-void
-init() {
-  g_languages.reserve(8755);
+std::size_t const g_num_languages_init = 8755;
+
+// Sorted by code for binary searches; the index refers to g_languages_init.
+code_index_t const g_languages_by_code[] = {
+  { "aa",      70   },
+  { "aaa",     2198 },
+  { "aab",     199  },
+  { "aac",     371  },
+  { "aad",     211  },
+  { "aae",     358  },
+  { "aaf",     345  },
+  { "aag",     230  },
+  { "aah",     23   },
+  { "aai",     374  },
+  { "aak",     302  },
+  { "aal",     69   },
+  { "aam",     343  },
+  { "aan",     255  },
+  { "aao",     183  },
+  { "aap",     5699 },
+  { "aaq",     1806 },
+  { "aar",     70   },
+  { "aas",     5    },
+  { "aat",     399  },
+  { "aau",     11   },
+  { "aav",     458  },
+  { "aaw",     7080 },
+  { "aax",     4240 },
+  { "aaz",     217  },
+  { "ab",      18   },
+  { "aba",     29   },
+  { "abb",     660  },
+  { "abc",     223  },
+  { "abd",     4261 },
+  { "abe",     8300 },
+  { "abf",     8    },
+  { "abg",     7    },
+  { "abh",     7405 },
+  { "abi",     14   },
+  { "abj",     125  },
+  { "abk",     18   },
+  { "abl",     3746 },
+  { "abm",     9    },
+  { "abn",     24   },
+  { "abo",     20   },
+  { "abp",     13   },
+  { "abq",     12   },
+  { "abr",     21   },
+  { "abs",     229  },
+  { "abt",     232  },
+  { "abu",     27   },
+  { "abv",     562  },
+  { "abw",     5610 },
+  { "abx",     2640 },
+  { "aby",     278  },
+  { "abz",     25   },
+  { "aca",     31   },
+  { "acb",     8742 },
+  { "acd",     2204 },
+  { "ace",     36   },
+  { "acf",     6655 },
+  { "ach",     41   },
+  { "aci",     127  },
+  { "ack",     131  },
+  { "acl",     133  },
+  { "acm",     4518 },
+  { "acn",     32   },
+  { "acp",     1807 },
+  { "acq",     7341 },
+  { "acr",     35   },
+  { "acs",     42   },
+  { "act",     37   },
+  { "acu",     38   },
+  { "acv",     39   },
+  { "acw",     2459 },
+  { "acx",     5500 },
+  { "acy",     1508 },
+  { "acz",     34   },
+  { "ada",     48   },
+  { "adb",     430  },
+  { "add",     3875 },
+  { "ade",     52   },
+  { "adf",     1637 },
+  { "adg",     269  },
+  { "adh",     53   },
+  { "adi",     54   },
+  { "adj",     56   },
+  { "adl",     2099 },
+  { "adn",     46   },
+  { "ado",     22   },
+  { "adp",     49   },
+  { "adq",     47   },
+  { "adr",     61   },
+  { "ads",     45   },
+  { "adt",     60   },
+  { "adu",     62   },
+  { "adw",     248  },
+  { "adx",     234  },
+  { "ady",     63   },
+  { "adz",     64   },
+  { "ae",      466  },
+  { "aea",     362  },
+  { "aeb",     7864 },
+  { "aec",     6654 },
+  { "aed",     365  },
+  { "aee",     5222 },
+  { "aek",     2380 },
+  { "ael",     225  },
+  { "aem",     363  },
+  { "aen",     384  },
+  { "aeq",     68   },
+  { "aer",     1809 },
+  { "aes",     195  },
+  { "aeu",     139  },
+  { "aew",     222  },
+  { "aey",     235  },
+  { "aez",     65   },
+  { "af",      74   },
+  { "afa",     75   },
+  { "afb",     2320 },
+  { "afd",     263  },
+  { "afe",     5921 },
+  { "afg",     71   },
+  { "afh",     73   },
+  { "afi",     150  },
+  { "afk",     4907 },
+  { "afn",     1589 },
+  { "afo",     1904 },
+  { "afp",     7476 },
+  { "afr",     74   },
+  { "afs",     76   },
+  { "aft",     72   },
+  { "afu",     491  },
+  { "afz",     5413 },
+  { "aga",     91   },
+  { "agb",     3814 },
+  { "agc",     79   },
+  { "agd",     77   },
+  { "age",     284  },
+  { "agf",     367  },
+  { "agg",     292  },
+  { "agh",     5061 },
+  { "agi",     78   },
+  { "agj",     366  },
+  { "agk",     2698 },
+  { "agl",     2013 },
+  { "agm",     280  },
+  { "agn",     95   },
+  { "ago",     7396 },
+  { "agp",     5682 },
+  { "agq",     81   },
+  { "agr",     92   },
+  { "ags",     1956 },
+  { "agt",     1236 },
+  { "agu",     90   },
+  { "agv",     6019 },
+  { "agw",     2915 },
+  { "agx",     85   },
+  { "agy",     7153 },
+  { "agz",     4753 },
+  { "aha",     97   },
+  { "ahb",     493  },
+  { "ahg",     5949 },
+  { "ahh",     83   },
+  { "ahi",     7635 },
+  { "ahk",     140  },
+  { "ahl",     2602 },
+  { "ahm",     4628 },
+  { "ahn",     8741 },
+  { "aho",     101  },
+  { "ahp",     332  },
+  { "ahr",     100  },
+  { "ahs",     403  },
+  { "aht",     102  },
+  { "aia",     388  },
+  { "aib",     112  },
+  { "aic",     111  },
+  { "aid",     191  },
+  { "aie",     215  },
+  { "aif",     87   },
+  { "aig",     310  },
+  { "aih",     104  },
+  { "aii",     417  },
+  { "aij",     3910 },
+  { "aik",     136  },
+  { "ail",     109  },
+  { "aim",     110  },
+  { "ain",     113  },
+  { "aio",     116  },
+  { "aip",     1112 },
+  { "aiq",     108  },
+  { "air",     115  },
+  { "ais",     4927 },
+  { "ait",     378  },
+  { "aiw",     4    },
+  { "aix",     105  },
+  { "aiy",     188  },
+  { "aja",     118  },
+  { "ajg",     117  },
+  { "aji",     120  },
+  { "ajn",     264  },
+  { "ajp",     7127 },
+  { "ajs",     182  },
+  { "ajt",     2849 },
+  { "aju",     2845 },
+  { "ajw",     119  },
+  { "ajz",     246  },
+  { "ak",      132  },
+  { "aka",     132  },
+  { "akb",     721  },
+  { "akc",     4748 },
+  { "akd",     7945 },
+  { "ake",     135  },
+  { "akf",     148  },
+  { "akg",     252  },
+  { "akh",     283  },
+  { "aki",     114  },
+  { "akj",     128  },
+  { "akk",     142  },
+  { "akl",     144  },
+  { "akm",     126  },
+  { "ako",     155  },
+  { "akp",     7052 },
+  { "akq",     123  },
+  { "akr",     340  },
+  { "aks",     134  },
+  { "akt",     145  },
+  { "aku",     153  },
+  { "akv",     141  },
+  { "akw",     156  },
+  { "akx",     129  },
+  { "aky",     130  },
+  { "akz",     160  },
+  { "ala",     164  },
+  { "alb",     174  },
+  { "alc",     5947 },
+  { "ald",     189  },
+  { "ale",     180  },
+  { "alf",     178  },
+  { "alg",     186  },
+  { "alh",     171  },
+  { "ali",     210  },
+  { "alj",     168  },
+  { "alk",     166  },
+  { "all",     190  },
+  { "alm",     226  },
+  { "aln",     2193 },
+  { "alo",     3775 },
+  { "alp",     200  },
+  { "alq",     187  },
+  { "alr",     203  },
+  { "als",     7772 },
+  { "alt",     7154 },
+  { "alu",     0    },
+  { "alv",     437  },
+  { "alw",     159  },
+  { "alx",     242  },
+  { "aly",     205  },
+  { "alz",     202  },
+  { "am",      238  },
+  { "ama",     214  },
+  { "amb",     227  },
+  { "amc",     209  },
+  { "ame",     8515 },
+  { "amf",     2402 },
+  { "amg",     249  },
+  { "amh",     238  },
+  { "ami",     240  },
+  { "amj",     233  },
+  { "amk",     221  },
+  { "aml",     8216 },
+  { "amm",     206  },
+  { "amn",     213  },
+  { "amo",     241  },
+  { "amp",     167  },
+  { "amq",     208  },
+  { "amr",     216  },
+  { "ams",     7155 },
+  { "amt",     247  },
+  { "amu",     2297 },
+  { "amv",     224  },
+  { "amw",     8333 },
+  { "amx",     303  },
+  { "amy",     239  },
+  { "amz",     428  },
+  { "an",      339  },
+  { "ana",     267  },
+  { "anb",     273  },
+  { "anc",     5048 },
+  { "and",     307  },
+  { "ane",     8457 },
+  { "anf",     298  },
+  { "ang",     5459 },
+  { "anh",     5001 },
+  { "ani",     271  },
+  { "anj",     305  },
+  { "ank",     2234 },
+  { "anl",     311  },
+  { "anm",     253  },
+  { "ann",     5414 },
+  { "ano",     274  },
+  { "anp",     287  },
+  { "anq",     2786 },
+  { "anr",     270  },
+  { "ans",     306  },
+  { "ant",     308  },
+  { "anu",     312  },
+  { "anv",     1611 },
+  { "anw",     251  },
+  { "anx",     275  },
+  { "any",     318  },
+  { "anz",     277  },
+  { "aoa",     291  },
+  { "aob",     19   },
+  { "aoc",     5732 },
+  { "aod",     268  },
+  { "aoe",     282  },
+  { "aof",     1014 },
+  { "aog",     293  },
+  { "aoh",     381  },
+  { "aoi",     299  },
+  { "aoj",     4764 },
+  { "aok",     370  },
+  { "aol",     193  },
+  { "aom",     8743 },
+  { "aon",     1081 },
+  { "aor",     321  },
+  { "aos",     7395 },
+  { "aot",     440  },
+  { "aou",     2    },
+  { "aox",     441  },
+  { "aoz",     7918 },
+  { "apa",     323  },
+  { "apb",     6627 },
+  { "apc",     5205 },
+  { "apd",     7270 },
+  { "ape",     1065 },
+  { "apf",     5592 },
+  { "apg",     244  },
+  { "aph",     434  },
+  { "api",     329  },
+  { "apj",     2815 },
+  { "apk",     3294 },
+  { "apl",     3904 },
+  { "apm",     4513 },
+  { "apn",     330  },
+  { "apo",     231  },
+  { "app",     331  },
+  { "apq",     3    },
+  { "apr",     386  },
+  { "aps",     387  },
+  { "apt",     328  },
+  { "apu",     333  },
+  { "apv",     170  },
+  { "apw",     8301 },
+  { "apx",     334  },
+  { "apy",     325  },
+  { "apz",     6648 },
+  { "aqa",     162  },
+  { "aqc",     359  },
+  { "aqd",     245  },
+  { "aqg",     375  },
+  { "aqk",     300  },
+  { "aql",     185  },
+  { "aqm",     438  },
+  { "aqn",     5227 },
+  { "aqp",     427  },
+  { "aqr",     369  },
+  { "aqt",     281  },
+  { "aqz",     154  },
+  { "ar",      338  },
+  { "ara",     338  },
+  { "arb",     7253 },
+  { "arc",     5427 },
+  { "ard",     336  },
+  { "are",     8303 },
+  { "arg",     339  },
+  { "arh",     368  },
+  { "ari",     377  },
+  { "arj",     350  },
+  { "ark",     376  },
+  { "arl",     337  },
+  { "arm",     385  },
+  { "arn",     4293 },
+  { "aro",     348  },
+  { "arp",     349  },
+  { "arq",     181  },
+  { "arr",     3091 },
+  { "ars",     4871 },
+  { "art",     392  },
+  { "aru",     397  },
+  { "arv",     357  },
+  { "arw",     353  },
+  { "arx",     398  },
+  { "ary",     4713 },
+  { "arz",     1880 },
+  { "as",      413  },
+  { "asa",     420  },
+  { "asb",     416  },
+  { "asc",     1208 },
+  { "asd",     402  },
+  { "ase",     236  },
+  { "asf",     453  },
+  { "asg",     1417 },
+  { "ash",     17   },
+  { "asi",     1118 },
+  { "asj",     6790 },
+  { "ask",     404  },
+  { "asl",     410  },
+  { "asm",     413  },
+  { "asn",     8448 },
+  { "aso",     1558 },
+  { "asp",     184  },
+  { "asq",     457  },
+  { "asr",     424  },
+  { "ass",     2678 },
+  { "ast",     418  },
+  { "asu",     7714 },
+  { "asv",     412  },
+  { "asw",     455  },
+  { "asx",     4796 },
+  { "asy",     8533 },
+  { "asz",     400  },
+  { "ata",     5730 },
+  { "atb",     8677 },
+  { "atc",     442  },
+  { "atd",     425  },
+  { "ate",     432  },
+  { "atg",     2734 },
+  { "ath",     433  },
+  { "ati",     446  },
+  { "atj",     436  },
+  { "atk",     435  },
+  { "atl",     4752 },
+  { "atm",     426  },
+  { "atn",     406  },
+  { "ato",     439  },
+  { "atp",     5882 },
+  { "atq",     342  },
+  { "atr",     8152 },
+  { "ats",     2274 },
+  { "att",     5634 },
+  { "atu",     6011 },
+  { "atv",     5228 },
+  { "atw",     444  },
+  { "atx",     396  },
+  { "aty",     276  },
+  { "atz",     391  },
+  { "aua",     422  },
+  { "aub",     198  },
+  { "auc",     8212 },
+  { "aud",     316  },
+  { "aue",     8751 },
+  { "auf",     352  },
+  { "aug",     93   },
+  { "auh",     451  },
+  { "aui",     314  },
+  { "auj",     485  },
+  { "auk",     2448 },
+  { "aul",     449  },
+  { "aum",     419  },
+  { "aun",     4664 },
+  { "auo",     462  },
+  { "aup",     4132 },
+  { "auq",     315  },
+  { "aur",     394  },
+  { "aus",     456  },
+  { "aut",     454  },
+  { "auu",     461  },
+  { "auw",     492  },
+  { "aux",     450  },
+  { "auy",     484  },
+  { "auz",     8047 },
+  { "av",      463  },
+  { "ava",     463  },
+  { "avb",     465  },
+  { "avd",     204  },
+  { "ave",     466  },
+  { "avi",     467  },
+  { "avk",     3453 },
+  { "avl",     1817 },
+  { "avm",     288  },
+  { "avn",     464  },
+  { "avo",     80   },
+  { "avs",     452  },
+  { "avt",     448  },
+  { "avu",     468  },
+  { "avv",     469  },
+  { "awa",     475  },
+  { "awb",     471  },
+  { "awc",     1411 },
+  { "awd",     354  },
+  { "awe",     482  },
+  { "awg",     295  },
+  { "awh",     479  },
+  { "awi",     66   },
+  { "awk",     473  },
+  { "awm",     356  },
+  { "awn",     486  },
+  { "awo",     476  },
+  { "awr",     481  },
+  { "aws",     7117 },
+  { "awt",     355  },
+  { "awu",     1230 },
+  { "awv",     2760 },
+  { "aww",     490  },
+  { "awx",     478  },
+  { "awy",     1868 },
+  { "axb",     16   },
+  { "axe",     499  },
+  { "axg",     4382 },
+  { "axk",     8478 },
+  { "axl",     3985 },
+  { "axm",     4543 },
+  { "axx",     8458 },
+  { "ay",      505  },
+  { "aya",     477  },
+  { "ayb",     504  },
+  { "ayc",     7156 },
+  { "ayd",     495  },
+  { "aye",     498  },
+  { "ayg",     2214 },
+  { "ayh",     2377 },
+  { "ayi",     3858 },
+  { "ayk",     152  },
+  { "ayl",     3873 },
+  { "aym",     505  },
+  { "ayn",     6731 },
+  { "ayo",     507  },
+  { "ayp",     5207 },
+  { "ayq",     501  },
+  { "ayr",     1231 },
+  { "ays",     7109 },
+  { "ayt",     4091 },
+  { "ayu",     508  },
+  { "ayx",     500  },
+  { "ayy",     7517 },
+  { "ayz",     4104 },
+  { "az",      510  },
+  { "aza",     511  },
+  { "azb",     7118 },
+  { "azc",     8041 },
+  { "azd",     1816 },
+  { "aze",     510  },
+  { "azg",     6727 },
+  { "azj",     5195 },
+  { "azm",     2675 },
+  { "azn",     8310 },
+  { "azo",     483  },
+  { "azt",     1989 },
+  { "azz",     2457 },
+  { "ba",      710  },
+  { "baa",     522  },
+  { "bab",     574  },
+  { "bac",     535  },
+  { "bad",     633  },
+  { "bae",     701  },
+  { "baf",     5320 },
+  { "bag",     7837 },
+  { "bah",     561  },
+  { "bai",     621  },
+  { "baj",     673  },
+  { "bak",     710  },
+  { "bal",     612  },
+  { "bam",     617  },
+  { "ban",     603  },
+  { "bao",     8151 },
+  { "bap",     662  },
+  { "baq",     713  },
+  { "bar",     748  },
+  { "bas",     703  },
+  { "bat",     610  },
+  { "bau",     529  },
+  { "bav",     8083 },
+  { "baw",     619  },
+  { "bax",     624  },
+  { "bay",     739  },
+  { "baz",     7857 },
+  { "bba",     516  },
+  { "bbb",     672  },
+  { "bbc",     726  },
+  { "bbd",     741  },
+  { "bbe",     645  },
+  { "bbf",     569  },
+  { "bbg",     675  },
+  { "bbh",     1051 },
+  { "bbi",     694  },
+  { "bbj",     2197 },
+  { "bbk",     521  },
+  { "bbl",     736  },
+  { "bbm",     520  },
+  { "bbn",     7981 },
+  { "bbo",     5232 },
+  { "bbp",     8285 },
+  { "bbq",     614  },
+  { "bbr",     2215 },
+  { "bbs",     588  },
+  { "bbt",     4465 },
+  { "bbu",     3543 },
+  { "bbv",     3090 },
+  { "bbw",     518  },
+  { "bbx",     1043 },
+  { "bby",     770  },
+  { "bbz",     519  },
+  { "bca",     1232 },
+  { "bcb",     575  },
+  { "bcc",     7158 },
+  { "bcd",     5196 },
+  { "bce",     620  },
+  { "bcf",     622  },
+  { "bcg",     548  },
+  { "bch",     689  },
+  { "bci",     668  },
+  { "bcj",     685  },
+  { "bck",     1094 },
+  { "bcl",     1234 },
+  { "bcm",     661  },
+  { "bcn",     601  },
+  { "bco",     2969 },
+  { "bcp",     600  },
+  { "bcq",     795  },
+  { "bcr",     523  },
+  { "bcs",     3348 },
+  { "bct",     797  },
+  { "bcu",     474  },
+  { "bcv",     6954 },
+  { "bcw",     628  },
+  { "bcy",     525  },
+  { "bcz",     573  },
+  { "bda",     755  },
+  { "bdb",     707  },
+  { "bdc",     1913 },
+  { "bdd",     1086 },
+  { "bde",     531  },
+  { "bdf",     842  },
+  { "bdg",     981  },
+  { "bdh",     581  },
+  { "bdi",     1113 },
+  { "bdj",     568  },
+  { "bdk",     1048 },
+  { "bdl",     2648 },
+  { "bdm",     1049 },
+  { "bdn",     599  },
+  { "bdo",     4716 },
+  { "bdp",     796  },
+  { "bdq",     566  },
+  { "bdr",     8287 },
+  { "bds",     1115 },
+  { "bdt",     951  },
+  { "bdu",     5541 },
+  { "bdv",     939  },
+  { "bdw",     560  },
+  { "bdx",     1046 },
+  { "bdy",     641  },
+  { "bdz",     532  },
+  { "be",      779  },
+  { "bea",     759  },
+  { "beb",     761  },
+  { "bec",     2583 },
+  { "bed",     765  },
+  { "bee",     1144 },
+  { "bef",     793  },
+  { "beg",     776  },
+  { "beh",     844  },
+  { "bei",     773  },
+  { "bej",     772  },
+  { "bek",     762  },
+  { "bel",     779  },
+  { "bem",     788  },
+  { "ben",     800  },
+  { "beo",     758  },
+  { "bep",     818  },
+  { "beq",     768  },
+  { "ber",     809  },
+  { "bes",     817  },
+  { "bet",     2307 },
+  { "beu",     925  },
+  { "bev",     1542 },
+  { "bew",     820  },
+  { "bex",     2857 },
+  { "bey",     781  },
+  { "bez",     792  },
+  { "bfa",     688  },
+  { "bfb",     5716 },
+  { "bfc",     5663 },
+  { "bfd",     543  },
+  { "bfe",     819  },
+  { "bff",     940  },
+  { "bfg",     1122 },
+  { "bfh",     924  },
+  { "bfi",     1025 },
+  { "bfj",     540  },
+  { "bfk",     627  },
+  { "bfl",     637  },
+  { "bfm",     4623 },
+  { "bfn",     1085 },
+  { "bfo",     4176 },
+  { "bfp",     760  },
+  { "bfq",     530  },
+  { "bfr",     757  },
+  { "bfs",     7157 },
+  { "bft",     608  },
+  { "bfu",     2085 },
+  { "bfw",     976  },
+  { "bfx",     663  },
+  { "bfy",     551  },
+  { "bfz",     4099 },
+  { "bg",      1070 },
+  { "bga",     2362 },
+  { "bgb",     934  },
+  { "bgc",     2419 },
+  { "bgd",     6000 },
+  { "bge",     745  },
+  { "bgf",     644  },
+  { "bgg",     1056 },
+  { "bgi",     2200 },
+  { "bgj",     651  },
+  { "bgk",     917  },
+  { "bgl",     928  },
+  { "bgm",     547  },
+  { "bgn",     8304 },
+  { "bgo",     545  },
+  { "bgp",     1810 },
+  { "bgq",     555  },
+  { "bgr",     749  },
+  { "bgs",     7362 },
+  { "bgt",     1053 },
+  { "bgu",     4448 },
+  { "bgv",     8231 },
+  { "bgw",     831  },
+  { "bgx",     604  },
+  { "bgy",     801  },
+  { "bgz",     646  },
+  { "bh",      864  },
+  { "bha",     829  },
+  { "bhb",     836  },
+  { "bhc",     861  },
+  { "bhd",     827  },
+  { "bhe",     833  },
+  { "bhf",     5422 },
+  { "bhg",     887  },
+  { "bhh",     1062 },
+  { "bhi",     835  },
+  { "bhj",     565  },
+  { "bhk",     176  },
+  { "bhl",     882  },
+  { "bhm",     732  },
+  { "bhn",     945  },
+  { "bho",     837  },
+  { "bhp",     881  },
+  { "bhq",     7836 },
+  { "bhr",     669  },
+  { "bhs",     1132 },
+  { "bht",     832  },
+  { "bhu",     840  },
+  { "bhv",     563  },
+  { "bhw",     843  },
+  { "bhx",     828  },
+  { "bhy",     834  },
+  { "bhz",     528  },
+  { "bi",      913  },
+  { "bia",     533  },
+  { "bib",     915  },
+  { "bic",     867  },
+  { "bid",     853  },
+  { "bie",     806  },
+  { "bif",     841  },
+  { "big",     846  },
+  { "bih",     864  },
+  { "bij",     8051 },
+  { "bik",     868  },
+  { "bil",     875  },
+  { "bim",     883  },
+  { "bin",     890  },
+  { "bio",     4870 },
+  { "bip",     870  },
+  { "biq",     897  },
+  { "bir",     914  },
+  { "bis",     913  },
+  { "bit",     812  },
+  { "biu",     859  },
+  { "biv",     7162 },
+  { "biw",     3364 },
+  { "bix",     866  },
+  { "biy",     902  },
+  { "biz",     607  },
+  { "bja",     1050 },
+  { "bjb",     647  },
+  { "bjc",     690  },
+  { "bjd",     642  },
+  { "bje",     849  },
+  { "bjf",     700  },
+  { "bjg",     855  },
+  { "bjh",     564  },
+  { "bji",     1105 },
+  { "bjj",     3005 },
+  { "bjk",     693  },
+  { "bjl",     1077 },
+  { "bjm",     579  },
+  { "bjn",     656  },
+  { "bjo",     4542 },
+  { "bjp",     1998 },
+  { "bjq",     7159 },
+  { "bjr",     896  },
+  { "bjs",     578  },
+  { "bjt",     595  },
+  { "bju",     1128 },
+  { "bjv",     764  },
+  { "bjw",     590  },
+  { "bjx",     629  },
+  { "bjy",     751  },
+  { "bjz",     697  },
+  { "bka",     3662 },
+  { "bkb",     2020 },
+  { "bkc",     580  },
+  { "bkd",     895  },
+  { "bkf",     766  },
+  { "bkg",     1099 },
+  { "bkh",     586  },
+  { "bki",     585  },
+  { "bkj",     5646 },
+  { "bkk",     1028 },
+  { "bkl",     811  },
+  { "bkm",     3371 },
+  { "bkn",     1064 },
+  { "bko",     3625 },
+  { "bkp",     949  },
+  { "bkq",     582  },
+  { "bkr",     589  },
+  { "bks",     5278 },
+  { "bkt",     961  },
+  { "bku",     1058 },
+  { "bkv",     774  },
+  { "bkw",     775  },
+  { "bkx",     570  },
+  { "bky",     952  },
+  { "bkz",     1091 },
+  { "bla",     6999 },
+  { "blb",     879  },
+  { "blc",     784  },
+  { "bld",     954  },
+  { "ble",     596  },
+  { "blf",     1096 },
+  { "blg",     598  },
+  { "blh",     3618 },
+  { "bli",     958  },
+  { "blj",     964  },
+  { "blk",     5577 },
+  { "bll",     878  },
+  { "blm",     782  },
+  { "bln",     7166 },
+  { "blo",     297  },
+  { "blp",     923  },
+  { "blq",     611  },
+  { "blr",     926  },
+  { "bls",     591  },
+  { "blt",     7379 },
+  { "blv",     3263 },
+  { "blw",     593  },
+  { "blx",     4088 },
+  { "bly",     5308 },
+  { "blz",     597  },
+  { "bm",      617  },
+  { "bma",     3738 },
+  { "bmb",     789  },
+  { "bmc",     856  },
+  { "bmd",     546  },
+  { "bme",     3890 },
+  { "bmf",     966  },
+  { "bmg",     626  },
+  { "bmh",     3161 },
+  { "bmi",     553  },
+  { "bmj",     1007 },
+  { "bmk",     2192 },
+  { "bml",     968  },
+  { "bmm",     5230 },
+  { "bmn",     885  },
+  { "bmo",     615  },
+  { "bmp",     1071 },
+  { "bmq",     971  },
+  { "bmr",     4766 },
+  { "bms",     877  },
+  { "bmt",     847  },
+  { "bmu",     7084 },
+  { "bmv",     1078 },
+  { "bmw",     972  },
+  { "bmx",     572  },
+  { "bmy",     787  },
+  { "bmz",     677  },
+  { "bn",      800  },
+  { "bna",     979  },
+  { "bnb",     990  },
+  { "bnc",     989  },
+  { "bnd",     631  },
+  { "bne",     893  },
+  { "bnf",     4367 },
+  { "bng",     799  },
+  { "bni",     648  },
+  { "bnj",     1855 },
+  { "bnk",     857  },
+  { "bnl",     991  },
+  { "bnm",     729  },
+  { "bnn",     1095 },
+  { "bno",     665  },
+  { "bnp",     953  },
+  { "bnq",     664  },
+  { "bnr",     1130 },
+  { "bns",     1087 },
+  { "bnt",     666  },
+  { "bnu",     803  },
+  { "bnv",     980  },
+  { "bnw",     912  },
+  { "bnx",     652  },
+  { "bny",     894  },
+  { "bnz",     769  },
+  { "bo",      7640 },
+  { "boa",     993  },
+  { "bob",     480  },
+  { "bod",     7640 },
+  { "boe",     4781 },
+  { "bof",     962  },
+  { "bog",     613  },
+  { "boh",     967  },
+  { "boi",     683  },
+  { "boj",     301  },
+  { "bok",     986  },
+  { "bol",     955  },
+  { "bom",     813  },
+  { "bon",     889  },
+  { "boo",     7648 },
+  { "bop",     988  },
+  { "boq",     942  },
+  { "bor",     1003 },
+  { "bos",     1006 },
+  { "bot",     984  },
+  { "bou",     975  },
+  { "bov",     7900 },
+  { "bow",     6015 },
+  { "box",     1040 },
+  { "boy",     936  },
+  { "boz",     7690 },
+  { "bpa",     1514 },
+  { "bpb",     681  },
+  { "bpc",     4455 },
+  { "bpd",     635  },
+  { "bpe",     743  },
+  { "bpg",     982  },
+  { "bph",     1008 },
+  { "bpi",     556  },
+  { "bpj",     891  },
+  { "bpk",     5545 },
+  { "bpl",     1030 },
+  { "bpm",     922  },
+  { "bpn",     1785 },
+  { "bpo",     257  },
+  { "bpp",     3125 },
+  { "bpq",     632  },
+  { "bpr",     3431 },
+  { "bps",     6785 },
+  { "bpt",     696  },
+  { "bpu",     985  },
+  { "bpv",     845  },
+  { "bpw",     929  },
+  { "bpx",     5627 },
+  { "bpy",     910  },
+  { "bpz",     873  },
+  { "bqa",     7523 },
+  { "bqb",     557  },
+  { "bqc",     948  },
+  { "bqd",     1088 },
+  { "bqf",     544  },
+  { "bqg",     554  },
+  { "bqh",     571  },
+  { "bqi",     584  },
+  { "bqj",     640  },
+  { "bqk",     636  },
+  { "bql",     871  },
+  { "bqm",     8412 },
+  { "bqn",     1069 },
+  { "bqo",     606  },
+  { "bqp",     1119 },
+  { "bqq",     904  },
+  { "bqr",     1117 },
+  { "bqs",     1005 },
+  { "bqt",     623  },
+  { "bqu",     944  },
+  { "bqv",     3427 },
+  { "bqw",     1110 },
+  { "bqx",     515  },
+  { "bqy",     802  },
+  { "bqz",     583  },
+  { "br",      1021 },
+  { "bra",     1016 },
+  { "brb",     1017 },
+  { "brc",     810  },
+  { "brd",     670  },
+  { "bre",     1021 },
+  { "brf",     898  },
+  { "brg",     744  },
+  { "brh",     1015 },
+  { "bri",     4656 },
+  { "brj",     858  },
+  { "brk",     905  },
+  { "brl",     908  },
+  { "brm",     676  },
+  { "brn",     1002 },
+  { "bro",     1026 },
+  { "brp",     678  },
+  { "brq",     1020 },
+  { "brr",     900  },
+  { "brs",     679  },
+  { "brt",     918  },
+  { "bru",     1813 },
+  { "brv",     8306 },
+  { "brw",     785  },
+  { "brx",     937  },
+  { "bry",     1111 },
+  { "brz",     874  },
+  { "bs",      1006 },
+  { "bsa",     15   },
+  { "bsb",     1032 },
+  { "bsc",     716  },
+  { "bse",     8420 },
+  { "bsf",     742  },
+  { "bsg",     709  },
+  { "bsh",     3116 },
+  { "bsi",     717  },
+  { "bsj",     653  },
+  { "bsk",     1116 },
+  { "bsl",     705  },
+  { "bsm",     1121 },
+  { "bsn",     680  },
+  { "bso",     1125 },
+  { "bsp",     549  },
+  { "bsq",     714  },
+  { "bsr",     715  },
+  { "bss",     146  },
+  { "bst",     711  },
+  { "bsu",     567  },
+  { "bsv",     550  },
+  { "bsw",     576  },
+  { "bsx",     8520 },
+  { "bsy",     6636 },
+  { "bta",     718  },
+  { "btb",     823  },
+  { "btc",     733  },
+  { "btd",     722  },
+  { "bte",     2108 },
+  { "btf",     901  },
+  { "btg",     2083 },
+  { "bth",     850  },
+  { "bti",     1101 },
+  { "btj",     526  },
+  { "btk",     727  },
+  { "btl",     830  },
+  { "btm",     724  },
+  { "btn",     5997 },
+  { "bto",     6563 },
+  { "btp",     1045 },
+  { "btq",     730  },
+  { "btr",     539  },
+  { "bts",     725  },
+  { "btt",     822  },
+  { "btu",     737  },
+  { "btv",     731  },
+  { "btw",     1131 },
+  { "btx",     723  },
+  { "bty",     935  },
+  { "btz",     720  },
+  { "bua",     1104 },
+  { "bub",     1038 },
+  { "buc",     1123 },
+  { "bud",     5317 },
+  { "bue",     805  },
+  { "buf",     1124 },
+  { "bug",     1054 },
+  { "buh",     8640 },
+  { "bui",     983  },
+  { "buj",     706  },
+  { "buk",     1052 },
+  { "bul",     1070 },
+  { "bum",     1076 },
+  { "bun",     6940 },
+  { "buo",     7583 },
+  { "bup",     1126 },
+  { "buq",     1019 },
+  { "bur",     1107 },
+  { "bus",     950  },
+  { "but",     1089 },
+  { "buu",     1047 },
+  { "buv",     1083 },
+  { "buw",     1042 },
+  { "bux",     943  },
+  { "buy",     1074 },
+  { "buz",     1068 },
+  { "bva",     686  },
+  { "bvb",     1041 },
+  { "bvc",     538  },
+  { "bvd",     537  },
+  { "bve",     808  },
+  { "bvf",     992  },
+  { "bvg",     987  },
+  { "bvh",     1103 },
+  { "bvi",     778  },
+  { "bvj",     514  },
+  { "bvk",     1061 },
+  { "bvl",     960  },
+  { "bvm",     625  },
+  { "bvn",     1084 },
+  { "bvo",     957  },
+  { "bvp",     1080 },
+  { "bvq",     906  },
+  { "bvr",     1100 },
+  { "bvt",     734  },
+  { "bvu",     1063 },
+  { "bvv",     654  },
+  { "bvw",     941  },
+  { "bvx",     1649 },
+  { "bvy",     752  },
+  { "bvz",     747  },
+  { "bwa",     1139 },
+  { "bwb",     4896 },
+  { "bwc",     1142 },
+  { "bwd",     1137 },
+  { "bwe",     1140 },
+  { "bwf",     1004 },
+  { "bwg",     699  },
+  { "bwh",     911  },
+  { "bwi",     655  },
+  { "bwj",     4045 },
+  { "bwk",     746  },
+  { "bwl",     1141 },
+  { "bwm",     920  },
+  { "bwn",     8415 },
+  { "bwo",     999  },
+  { "bwp",     4241 },
+  { "bwq",     7163 },
+  { "bwr",     1097 },
+  { "bws",     969  },
+  { "bwt",     541  },
+  { "bwu",     1072 },
+  { "bww",     1136 },
+  { "bwx",     1037 },
+  { "bwy",     1507 },
+  { "bwz",     1143 },
+  { "bxa",     7398 },
+  { "bxb",     777  },
+  { "bxc",     4662 },
+  { "bxd",     5729 },
+  { "bxe",     899  },
+  { "bxf",     880  },
+  { "bxg",     643  },
+  { "bxh",     1059 },
+  { "bxi",     5809 },
+  { "bxj",     756  },
+  { "bxk",     1067 },
+  { "bxl",     2766 },
+  { "bxm",     4682 },
+  { "bxn",     1102 },
+  { "bxo",     691  },
+  { "bxp",     763  },
+  { "bxq",     767  },
+  { "bxr",     6612 },
+  { "bxs",     1120 },
+  { "bxu",     1348 },
+  { "bxv",     807  },
+  { "bxw",     657  },
+  { "bxx",     998  },
+  { "bxz",     886  },
+  { "bya",     728  },
+  { "byb",     869  },
+  { "byc",     7921 },
+  { "byd",     804  },
+  { "bye",     5867 },
+  { "byf",     821  },
+  { "byg",     753  },
+  { "byh",     839  },
+  { "byi",     1134 },
+  { "byj",     884  },
+  { "byk",     848  },
+  { "byl",     754  },
+  { "bym",     854  },
+  { "byn",     876  },
+  { "byo",     921  },
+  { "byp",     1079 },
+  { "byq",     708  },
+  { "byr",     698  },
+  { "bys",     1098 },
+  { "byt",     815  },
+  { "byv",     4476 },
+  { "byw",     780  },
+  { "byx",     5943 },
+  { "byy",     1133 },
+  { "byz",     630  },
+  { "bza",     639  },
+  { "bzb",     272  },
+  { "bzc",     7160 },
+  { "bzd",     1023 },
+  { "bze",     2802 },
+  { "bzf",     946  },
+  { "bzg",     524  },
+  { "bzh",     4291 },
+  { "bzi",     916  },
+  { "bzj",     783  },
+  { "bzk",     5108 },
+  { "bzl",     933  },
+  { "bzm",     963  },
+  { "bzn",     932  },
+  { "bzo",     1013 },
+  { "bzp",     3175 },
+  { "bzq",     1073 },
+  { "bzr",     903  },
+  { "bzs",     1018 },
+  { "bzt",     1024 },
+  { "bzu",     1108 },
+  { "bzv",     4851 },
+  { "bzw",     704  },
+  { "bzx",     3671 },
+  { "bzy",     5409 },
+  { "bzz",     1976 },
+  { "ca",      1211 },
+  { "caa",     1386 },
+  { "cab",     2125 },
+  { "cac",     1393 },
+  { "cad",     1155 },
+  { "cae",     3818 },
+  { "caf",     7165 },
+  { "cag",     5147 },
+  { "cah",     1159 },
+  { "cai",     1227 },
+  { "caj",     1300 },
+  { "cak",     3048 },
+  { "cal",     1202 },
+  { "cam",     1225 },
+  { "can",     1292 },
+  { "cao",     1407 },
+  { "cap",     1358 },
+  { "caq",     1192 },
+  { "car",     2094 },
+  { "cas",     7811 },
+  { "cat",     1211 },
+  { "cau",     1214 },
+  { "cav",     1215 },
+  { "caw",     1170 },
+  { "cax",     1363 },
+  { "cay",     1217 },
+  { "caz",     1185 },
+  { "cba",     1330 },
+  { "cbb",     1149 },
+  { "cbc",     1196 },
+  { "cbd",     1200 },
+  { "cbe",     1360 },
+  { "cbg",     1347 },
+  { "cbh",     1158 },
+  { "cbi",     1274 },
+  { "cbj",     1864 },
+  { "cbk",     1305 },
+  { "cbl",     1039 },
+  { "cbn",     5352 },
+  { "cbo",     2753 },
+  { "cbq",     7821 },
+  { "cbr",     1205 },
+  { "cbs",     1206 },
+  { "cbt",     1306 },
+  { "cbu",     1183 },
+  { "cbv",     1154 },
+  { "cbw",     3282 },
+  { "cby",     1194 },
+  { "cca",     1213 },
+  { "ccc",     1294 },
+  { "ccd",     1157 },
+  { "cce",     1383 },
+  { "ccg",     6689 },
+  { "cch",     443  },
+  { "ccj",     3099 },
+  { "ccl",     1503 },
+  { "ccm",     4152 },
+  { "ccn",     5198 },
+  { "cco",     1450 },
+  { "ccp",     1284 },
+  { "ccq",     1303 },
+  { "ccr",     1152 },
+  { "ccs",     7120 },
+  { "cda",     1381 },
+  { "cdc",     1277 },
+  { "cdd",     1156 },
+  { "cde",     1314 },
+  { "cdf",     1366 },
+  { "cdg",     1290 },
+  { "cdh",     1291 },
+  { "cdi",     1375 },
+  { "cdj",     1400 },
+  { "cdm",     1316 },
+  { "cdn",     1302 },
+  { "cdo",     4570 },
+  { "cdr",     1413 },
+  { "cds",     1276 },
+  { "cdy",     1278 },
+  { "cdz",     3334 },
+  { "ce",      1310 },
+  { "cea",     3980 },
+  { "ceb",     1222 },
+  { "ceg",     1288 },
+  { "cek",     1831 },
+  { "cel",     1224 },
+  { "cen",     1226 },
+  { "ces",     1510 },
+  { "cet",     1270 },
+  { "cey",     1887 },
+  { "cfa",     1657 },
+  { "cfd",     1193 },
+  { "cfg",     1453 },
+  { "cfm",     1993 },
+  { "cga",     1297 },
+  { "cgc",     2910 },
+  { "cgg",     1336 },
+  { "cgk",     1372 },
+  { "ch",      1295 },
+  { "cha",     1295 },
+  { "chb",     1329 },
+  { "chc",     1212 },
+  { "chd",     2455 },
+  { "che",     1310 },
+  { "chf",     7345 },
+  { "chg",     1279 },
+  { "chh",     1357 },
+  { "chi",     1355 },
+  { "chj",     5436 },
+  { "chk",     1403 },
+  { "chl",     1160 },
+  { "chm",     4320 },
+  { "chn",     1356 },
+  { "cho",     1374 },
+  { "chp",     1359 },
+  { "chq",     5965 },
+  { "chr",     1319 },
+  { "cht",     1379 },
+  { "chu",     1401 },
+  { "chv",     1405 },
+  { "chw",     1406 },
+  { "chx",     1299 },
+  { "chy",     1323 },
+  { "chz",     5574 },
+  { "cia",     1409 },
+  { "cib",     1408 },
+  { "cic",     1334 },
+  { "cid",     1345 },
+  { "cie",     1414 },
+  { "cih",     1349 },
+  { "cik",     1368 },
+  { "cim",     1412 },
+  { "cin",     1415 },
+  { "cip",     1328 },
+  { "cir",     7680 },
+  { "ciw",     1361 },
+  { "ciy",     1280 },
+  { "cja",     8308 },
+  { "cje",     1389 },
+  { "cjh",     7990 },
+  { "cji",     1289 },
+  { "cjk",     1377 },
+  { "cjm",     1815 },
+  { "cjn",     1313 },
+  { "cjo",     408  },
+  { "cjp",     1150 },
+  { "cjr",     1385 },
+  { "cjs",     6955 },
+  { "cjv",     1391 },
+  { "cjy",     2823 },
+  { "cka",     3257 },
+  { "ckb",     1242 },
+  { "ckh",     1281 },
+  { "ckl",     1410 },
+  { "ckm",     1283 },
+  { "ckn",     2871 },
+  { "cko",     313  },
+  { "ckq",     2934 },
+  { "ckr",     2926 },
+  { "cks",     7519 },
+  { "ckt",     1395 },
+  { "cku",     3326 },
+  { "ckv",     3128 },
+  { "ckx",     1165 },
+  { "cky",     1167 },
+  { "ckz",     1166 },
+  { "cla",     6587 },
+  { "clc",     1338 },
+  { "cld",     1286 },
+  { "cle",     3807 },
+  { "clh",     1341 },
+  { "cli",     1282 },
+  { "clj",     3704 },
+  { "clk",     2593 },
+  { "cll",     1285 },
+  { "clm",     1420 },
+  { "clo",     3988 },
+  { "clt",     3797 },
+  { "clu",     1171 },
+  { "clw",     1397 },
+  { "cly",     1821 },
+  { "cma",     4053 },
+  { "cmc",     1293 },
+  { "cme",     1271 },
+  { "cmg",     1423 },
+  { "cmi",     1915 },
+  { "cmk",     1343 },
+  { "cml",     1178 },
+  { "cmm",     4538 },
+  { "cmn",     4232 },
+  { "cmo",     1250 },
+  { "cmr",     4749 },
+  { "cms",     4520 },
+  { "cmt",     1181 },
+  { "cna",     1298 },
+  { "cnb",     1350 },
+  { "cnc",     1511 },
+  { "cng",     5273 },
+  { "cnh",     2391 },
+  { "cni",     407  },
+  { "cnk",     3258 },
+  { "cnl",     3722 },
+  { "cno",     1455 },
+  { "cnp",     5268 },
+  { "cnq",     1399 },
+  { "cnr",     4694 },
+  { "cns",     1228 },
+  { "cnt",     7576 },
+  { "cnu",     1315 },
+  { "cnw",     5051 },
+  { "cnx",     4545 },
+  { "co",      1465 },
+  { "coa",     1441 },
+  { "cob",     1335 },
+  { "coc",     1440 },
+  { "cod",     1438 },
+  { "coe",     3418 },
+  { "cof",     1448 },
+  { "cog",     1380 },
+  { "coh",     1382 },
+  { "coj",     1439 },
+  { "cok",     6765 },
+  { "col",     1449 },
+  { "com",     1451 },
+  { "con",     1443 },
+  { "coo",     1454 },
+  { "cop",     1460 },
+  { "coq",     1461 },
+  { "cor",     1463 },
+  { "cos",     1465 },
+  { "cot",     1191 },
+  { "cou",     8185 },
+  { "cov",     1187 },
+  { "cow",     1469 },
+  { "cox",     4905 },
+  { "coy",     1471 },
+  { "coz",     1373 },
+  { "cpa",     5613 },
+  { "cpb",     7926 },
+  { "cpc",     122  },
+  { "cpe",     1477 },
+  { "cpf",     1478 },
+  { "cpg",     1190 },
+  { "cpi",     1353 },
+  { "cpn",     1318 },
+  { "cpo",     3475 },
+  { "cpp",     1479 },
+  { "cps",     1189 },
+  { "cpu",     5785 },
+  { "cpx",     5880 },
+  { "cpy",     7136 },
+  { "cqd",     1390 },
+  { "cqu",     1339 },
+  { "cr",      1474 },
+  { "cra",     1301 },
+  { "crb",     2705 },
+  { "crc",     3961 },
+  { "crd",     1442 },
+  { "cre",     1474 },
+  { "crf",     1195 },
+  { "crg",     4537 },
+  { "crh",     1480 },
+  { "cri",     7336 },
+  { "crj",     7170 },
+  { "crk",     5824 },
+  { "crl",     5238 },
+  { "crm",     4699 },
+  { "crn",     1896 },
+  { "cro",     1484 },
+  { "crp",     1476 },
+  { "crq",     2747 },
+  { "crr",     1201 },
+  { "crs",     6904 },
+  { "crt",     2748 },
+  { "crv",     1304 },
+  { "crw",     1388 },
+  { "crx",     1204 },
+  { "cry",     1462 },
+  { "crz",     1485 },
+  { "cs",      1510 },
+  { "csa",     1342 },
+  { "csb",     3103 },
+  { "csc",     1210 },
+  { "csd",     1327 },
+  { "cse",     1509 },
+  { "csf",     1487 },
+  { "csg",     1340 },
+  { "csh",     405  },
+  { "csi",     1430 },
+  { "csj",     7093 },
+  { "csk",     2833 },
+  { "csl",     1354 },
+  { "csm",     1262 },
+  { "csn",     1446 },
+  { "cso",     7071 },
+  { "csp",     7200 },
+  { "csq",     1481 },
+  { "csr",     1466 },
+  { "css",     7195 },
+  { "cst",     5262 },
+  { "csu",     1264 },
+  { "csv",     7295 },
+  { "csw",     7322 },
+  { "csx",     1174 },
+  { "csy",     7053 },
+  { "csz",     1457 },
+  { "cta",     7492 },
+  { "ctc",     1321 },
+  { "ctd",     7530 },
+  { "cte",     7578 },
+  { "ctg",     1369 },
+  { "cth",     7616 },
+  { "ctl",     7696 },
+  { "ctm",     1367 },
+  { "ctn",     1325 },
+  { "cto",     1914 },
+  { "ctp",     8313 },
+  { "cts",     5234 },
+  { "ctt",     8263 },
+  { "ctu",     1378 },
+  { "cty",     4731 },
+  { "ctz",     8674 },
+  { "cu",      1401 },
+  { "cua",     1486 },
+  { "cub",     1488 },
+  { "cuc",     8035 },
+  { "cug",     1497 },
+  { "cuh",     1394 },
+  { "cui",     1489 },
+  { "cuj",     4362 },
+  { "cuk",     6710 },
+  { "cul",     1491 },
+  { "cum",     1494 },
+  { "cuo",     1492 },
+  { "cup",     1498 },
+  { "cuq",     1495 },
+  { "cur",     1326 },
+  { "cus",     1502 },
+  { "cut",     7602 },
+  { "cuu",     7391 },
+  { "cuv",     1504 },
+  { "cuw",     1396 },
+  { "cux",     7577 },
+  { "cuy",     1490 },
+  { "cv",      1405 },
+  { "cvg",     1392 },
+  { "cvn",     8059 },
+  { "cwa",     2885 },
+  { "cwb",     4110 },
+  { "cwd",     8396 },
+  { "cwe",     3652 },
+  { "cwg",     1322 },
+  { "cwt",     3619 },
+  { "cy",      8273 },
+  { "cya",     5186 },
+  { "cyb",     1216 },
+  { "cym",     8273 },
+  { "cyo",     1506 },
+  { "cze",     1510 },
+  { "czh",     2532 },
+  { "czk",     3323 },
+  { "czn",     8705 },
+  { "czo",     4572 },
+  { "czt",     8726 },
+  { "da",      1557 },
+  { "daa",     1554 },
+  { "dac",     1546 },
+  { "dad",     4326 },
+  { "dae",     1770 },
+  { "daf",     1549 },
+  { "dag",     1528 },
+  { "dah",     2360 },
+  { "dai",     1583 },
+  { "daj",     1563 },
+  { "dak",     1538 },
+  { "dal",     1532 },
+  { "dam",     1544 },
+  { "dan",     1557 },
+  { "dao",     1513 },
+  { "dap",     5143 },
+  { "daq",     1553 },
+  { "dar",     1566 },
+  { "das",     1533 },
+  { "dau",     1564 },
+  { "dav",     7400 },
+  { "daw",     1578 },
+  { "dax",     1584 },
+  { "day",     3749 },
+  { "daz",     1560 },
+  { "dba",     649  },
+  { "dbb",     1610 },
+  { "dbd",     1524 },
+  { "dbe",     1520 },
+  { "dbf",     1871 },
+  { "dbg",     1701 },
+  { "dbi",     1702 },
+  { "dbj",     2584 },
+  { "dbl",     1779 },
+  { "dbm",     1739 },
+  { "dbn",     1759 },
+  { "dbo",     1743 },
+  { "dbp",     1772 },
+  { "dbq",     1518 },
+  { "dbr",     1519 },
+  { "dbt",     790  },
+  { "dbu",     978  },
+  { "dbv",     1754 },
+  { "dbw",     659  },
+  { "dby",     1647 },
+  { "dcc",     1587 },
+  { "dcr",     4989 },
+  { "dda",     1522 },
+  { "ddd",     1717 },
+  { "dde",     1721 },
+  { "ddg",     2010 },
+  { "ddi",     8290 },
+  { "ddj",     2788 },
+  { "ddn",     1606 },
+  { "ddo",     1652 },
+  { "ddr",     1638 },
+  { "dds",     1720 },
+  { "ddw",     1580 },
+  { "de",      2181 },
+  { "dec",     1529 },
+  { "ded",     1588 },
+  { "dee",     1619 },
+  { "def",     1620 },
+  { "deg",     1593 },
+  { "deh",     1597 },
+  { "dei",     1604 },
+  { "dek",     1598 },
+  { "del",     1600 },
+  { "dem",     1602 },
+  { "den",     7059 },
+  { "dep",     5787 },
+  { "deq",     1607 },
+  { "der",     1613 },
+  { "des",     1616 },
+  { "deu",     2181 },
+  { "dev",     1713 },
+  { "dez",     1608 },
+  { "dga",     7168 },
+  { "dgb",     1093 },
+  { "dgc",     1207 },
+  { "dgd",     1526 },
+  { "dge",     1594 },
+  { "dgg",     1694 },
+  { "dgh",     1621 },
+  { "dgi",     5236 },
+  { "dgk",     1527 },
+  { "dgl",     262  },
+  { "dgn",     1530 },
+  { "dgo",     1698 },
+  { "dgr",     1700 },
+  { "dgs",     1696 },
+  { "dgt",     4976 },
+  { "dgu",     1592 },
+  { "dgw",     1576 },
+  { "dgx",     1695 },
+  { "dgz",     1525 },
+  { "dha",     1626 },
+  { "dhd",     1639 },
+  { "dhg",     1624 },
+  { "dhi",     1634 },
+  { "dhl",     1623 },
+  { "dhm",     8700 },
+  { "dhn",     1625 },
+  { "dho",     1636 },
+  { "dhr",     1630 },
+  { "dhs",     1622 },
+  { "dhu",     1641 },
+  { "dhv",     1596 },
+  { "dhw",     1627 },
+  { "dhx",     1640 },
+  { "dia",     1645 },
+  { "dib",     7122 },
+  { "dic",     3716 },
+  { "did",     1651 },
+  { "dif",     1653 },
+  { "dig",     1655 },
+  { "dih",     3555 },
+  { "dii",     1661 },
+  { "dij",     1535 },
+  { "dik",     7231 },
+  { "dil",     1658 },
+  { "dim",     1662 },
+  { "din",     1665 },
+  { "dio",     1648 },
+  { "dip",     5223 },
+  { "diq",     1663 },
+  { "dir",     1670 },
+  { "dis",     1660 },
+  { "dit",     1666 },
+  { "diu",     1669 },
+  { "div",     1635 },
+  { "diw",     5297 },
+  { "dix",     1676 },
+  { "diy",     1674 },
+  { "diz",     1664 },
+  { "dja",     1680 },
+  { "djb",     1688 },
+  { "djc",     1562 },
+  { "djd",     1682 },
+  { "dje",     8690 },
+  { "djf",     1683 },
+  { "dji",     1687 },
+  { "djj",     1685 },
+  { "djk",     1839 },
+  { "djl",     1689 },
+  { "djm",     2773 },
+  { "djn",     2794 },
+  { "djo",     2776 },
+  { "djr",     1681 },
+  { "dju",     3045 },
+  { "djw",     1684 },
+  { "dka",     1539 },
+  { "dkg",     2902 },
+  { "dkk",     1537 },
+  { "dkl",     3369 },
+  { "dkr",     3520 },
+  { "dks",     7145 },
+  { "dkx",     4418 },
+  { "dlg",     1704 },
+  { "dlk",     1531 },
+  { "dlm",     1541 },
+  { "dln",     1570 },
+  { "dma",     1745 },
+  { "dmb",     4671 },
+  { "dmc",     2135 },
+  { "dmd",     4080 },
+  { "dme",     1740 },
+  { "dmf",     4471 },
+  { "dmg",     7993 },
+  { "dmk",     1707 },
+  { "dml",     1547 },
+  { "dmm",     1543 },
+  { "dmn",     4234 },
+  { "dmo",     3177 },
+  { "dmr",     1795 },
+  { "dms",     1548 },
+  { "dmu",     1737 },
+  { "dmv",     1748 },
+  { "dmw",     4760 },
+  { "dmx",     1603 },
+  { "dmy",     1605 },
+  { "dna",     7991 },
+  { "dnd",     1561 },
+  { "dne",     4963 },
+  { "dng",     1751 },
+  { "dni",     3981 },
+  { "dnj",     1550 },
+  { "dnk",     1609 },
+  { "dnn",     1787 },
+  { "dno",     4977 },
+  { "dnr",     1551 },
+  { "dnt",     4541 },
+  { "dnu",     1552 },
+  { "dnv",     1559 },
+  { "dnw",     8309 },
+  { "dny",     1612 },
+  { "doa",     1706 },
+  { "dob",     1692 },
+  { "doc",     5237 },
+  { "doe",     1693 },
+  { "dof",     1712 },
+  { "doh",     1715 },
+  { "doi",     1699 },
+  { "dok",     1714 },
+  { "dol",     1726 },
+  { "don",     7781 },
+  { "doo",     1716 },
+  { "dop",     4009 },
+  { "doq",     1710 },
+  { "dor",     1722 },
+  { "dos",     1697 },
+  { "dot",     1574 },
+  { "dov",     1709 },
+  { "dow",     1729 },
+  { "dox",     1127 },
+  { "doy",     1711 },
+  { "doz",     1725 },
+  { "dpp",     5667 },
+  { "dra",     1730 },
+  { "drb",     1536 },
+  { "drc",     4580 },
+  { "drd",     1571 },
+  { "dre",     1705 },
+  { "drg",     6610 },
+  { "drh",     1568 },
+  { "dri",     1147 },
+  { "drl",     5579 },
+  { "drn",     8288 },
+  { "dro",     1572 },
+  { "drq",     1756 },
+  { "drr",     1724 },
+  { "drs",     2165 },
+  { "drt",     1731 },
+  { "dru",     6602 },
+  { "drw",     1573 },
+  { "dry",     1565 },
+  { "dsb",     3984 },
+  { "dse",     1766 },
+  { "dsh",     1516 },
+  { "dsi",     1671 },
+  { "dsl",     1556 },
+  { "dsn",     1762 },
+  { "dso",     1617 },
+  { "dsq",     7357 },
+  { "dsz",     4309 },
+  { "dta",     1577 },
+  { "dtb",     3681 },
+  { "dtd",     1673 },
+  { "dth",     57   },
+  { "dti",     250  },
+  { "dtk",     7566 },
+  { "dtm",     7743 },
+  { "dtn",     1517 },
+  { "dto",     7742 },
+  { "dtp",     2898 },
+  { "dtr",     3972 },
+  { "dts",     7763 },
+  { "dtt",     7764 },
+  { "dtu",     7527 },
+  { "dty",     1727 },
+  { "dua",     1733 },
+  { "dub",     1736 },
+  { "duc",     1750 },
+  { "dud",     2541 },
+  { "due",     7972 },
+  { "duf",     1746 },
+  { "dug",     1760 },
+  { "duh",     1753 },
+  { "dui",     1749 },
+  { "duj",     1642 },
+  { "duk",     8045 },
+  { "dul",     161  },
+  { "dum",     4546 },
+  { "dun",     1763 },
+  { "duo",     1755 },
+  { "dup",     1734 },
+  { "duq",     1764 },
+  { "dur",     1656 },
+  { "dus",     1747 },
+  { "dut",     1767 },
+  { "duu",     1732 },
+  { "duv",     1771 },
+  { "duw",     1765 },
+  { "dux",     1769 },
+  { "duy",     1650 },
+  { "duz",     1744 },
+  { "dv",      1635 },
+  { "dva",     1735 },
+  { "dwa",     1668 },
+  { "dwk",     1581 },
+  { "dwl",     8176 },
+  { "dwr",     1582 },
+  { "dws",     1768 },
+  { "dwu",     1643 },
+  { "dww",     1579 },
+  { "dwy",     1644 },
+  { "dwz",     1618 },
+  { "dya",     1777 },
+  { "dyb",     1776 },
+  { "dyd",     1780 },
+  { "dyg",     8093 },
+  { "dyi",     1686 },
+  { "dym",     8511 },
+  { "dyn",     1778 },
+  { "dyo",     2832 },
+  { "dyu",     1781 },
+  { "dyy",     1678 },
+  { "dz",      1786 },
+  { "dza",     7868 },
+  { "dzd",     1585 },
+  { "dze",     1690 },
+  { "dzg",     1586 },
+  { "dzl",     1783 },
+  { "dzn",     1784 },
+  { "dzo",     1786 },
+  { "eaa",     3076 },
+  { "ebc",     771  },
+  { "ebg",     1862 },
+  { "ebk",     1812 },
+  { "ebo",     7537 },
+  { "ebr",     1861 },
+  { "ebu",     1917 },
+  { "ecr",     1968 },
+  { "ecs",     1863 },
+  { "ecy",     1969 },
+  { "ee",      1981 },
+  { "eee",     1789 },
+  { "efa",     1872 },
+  { "efe",     1873 },
+  { "efi",     1874 },
+  { "ega",     1876 },
+  { "egl",     1919 },
+  { "egm",     794  },
+  { "ego",     1877 },
+  { "egx",     1881 },
+  { "egy",     1879 },
+  { "ehs",     4616 },
+  { "ehu",     1882 },
+  { "eip",     1883 },
+  { "eit",     1884 },
+  { "eiv",     411  },
+  { "eja",     1886 },
+  { "eka",     1888 },
+  { "ekc",     1827 },
+  { "eke",     1891 },
+  { "ekg",     1889 },
+  { "eki",     1890 },
+  { "ekk",     7254 },
+  { "ekl",     3363 },
+  { "ekm",     1901 },
+  { "eko",     3454 },
+  { "ekp",     1892 },
+  { "ekr",     8466 },
+  { "eky",     1829 },
+  { "el",      2266 },
+  { "ele",     1899 },
+  { "elh",     1894 },
+  { "eli",     4965 },
+  { "elk",     1902 },
+  { "ell",     2266 },
+  { "elm",     1898 },
+  { "elo",     1895 },
+  { "elp",     1905 },
+  { "elu",     1907 },
+  { "elx",     1897 },
+  { "ema",     1910 },
+  { "emb",     1912 },
+  { "eme",     1918 },
+  { "emg",     1840 },
+  { "emi",     4816 },
+  { "emk",     1837 },
+  { "emm",     4212 },
+  { "emn",     1911 },
+  { "emo",     1920 },
+  { "emp",     5239 },
+  { "emq",     1841 },
+  { "ems",     5584 },
+  { "emu",     1843 },
+  { "emw",     1921 },
+  { "emx",     1948 },
+  { "emy",     1941 },
+  { "emz",     4441 },
+  { "en",      1930 },
+  { "ena",     326  },
+  { "enb",     4338 },
+  { "enc",     1923 },
+  { "end",     1925 },
+  { "enf",     2042 },
+  { "eng",     1930 },
+  { "enh",     7856 },
+  { "enl",     1931 },
+  { "enm",     4547 },
+  { "enn",     1928 },
+  { "eno",     1929 },
+  { "enq",     1926 },
+  { "enr",     1922 },
+  { "enu",     1933 },
+  { "env",     1935 },
+  { "enw",     1934 },
+  { "enx",     1936 },
+  { "eo",      1959 },
+  { "eot",     824  },
+  { "epi",     1940 },
+  { "epo",     1959 },
+  { "era",     1942 },
+  { "erg",     6986 },
+  { "erh",     1950 },
+  { "eri",     5433 },
+  { "erk",     7123 },
+  { "ero",     2504 },
+  { "err",     1947 },
+  { "ers",     1949 },
+  { "ert",     1945 },
+  { "erw",     1946 },
+  { "es",      7246 },
+  { "ese",     1953 },
+  { "esg",     98   },
+  { "esh",     1955 },
+  { "esi",     5190 },
+  { "esk",     5292 },
+  { "esl",     1878 },
+  { "esm",     1964 },
+  { "esn",     6681 },
+  { "eso",     1962 },
+  { "esq",     1960 },
+  { "ess",     1261 },
+  { "est",     1963 },
+  { "esu",     1268 },
+  { "esx",     1958 },
+  { "esy",     1957 },
+  { "et",      1963 },
+  { "etb",     1966 },
+  { "etc",     1965 },
+  { "eth",     1970 },
+  { "etn",     1973 },
+  { "eto",     1972 },
+  { "etr",     1869 },
+  { "ets",     8572 },
+  { "ett",     1974 },
+  { "etu",     1885 },
+  { "etx",     1967 },
+  { "etz",     6868 },
+  { "eu",      713  },
+  { "euq",     712  },
+  { "eus",     713  },
+  { "eve",     1977 },
+  { "evh",     8043 },
+  { "evn",     1978 },
+  { "ewe",     1981 },
+  { "ewo",     1982 },
+  { "ext",     1983 },
+  { "eya",     1984 },
+  { "eyo",     3162 },
+  { "eza",     1985 },
+  { "eze",     8048 },
+  { "fa",      5745 },
+  { "faa",     2008 },
+  { "fab",     1986 },
+  { "fad",     8140 },
+  { "faf",     1987 },
+  { "fag",     2025 },
+  { "fah",     577  },
+  { "fai",     1991 },
+  { "faj",     1990 },
+  { "fak",     2000 },
+  { "fal",     7124 },
+  { "fam",     1996 },
+  { "fan",     2001 },
+  { "fao",     2006 },
+  { "fap",     5621 },
+  { "far",     2009 },
+  { "fas",     5745 },
+  { "fat",     2003 },
+  { "fau",     2011 },
+  { "fax",     1992 },
+  { "fay",     7232 },
+  { "faz",     5298 },
+  { "fbl",     8281 },
+  { "fcs",     5952 },
+  { "fer",     2015 },
+  { "ff",      2051 },
+  { "ffi",     2033 },
+  { "ffm",     4055 },
+  { "fgr",     2037 },
+  { "fi",      2023 },
+  { "fia",     5167 },
+  { "fie",     2063 },
+  { "fif",     1988 },
+  { "fij",     2017 },
+  { "fil",     2018 },
+  { "fin",     2023 },
+  { "fip",     2026 },
+  { "fir",     2027 },
+  { "fit",     7762 },
+  { "fiu",     2024 },
+  { "fiw",     2028 },
+  { "fj",      2017 },
+  { "fkk",     3304 },
+  { "fkv",     3622 },
+  { "fla",     2963 },
+  { "flh",     2031 },
+  { "fli",     1994 },
+  { "fll",     5201 },
+  { "fln",     2030 },
+  { "flr",     2052 },
+  { "fly",     2029 },
+  { "fmp",     2012 },
+  { "fmu",     2004 },
+  { "fnb",     1999 },
+  { "fng",     1997 },
+  { "fni",     2002 },
+  { "fo",      2006 },
+  { "fod",     2038 },
+  { "foi",     2032 },
+  { "fom",     2035 },
+  { "fon",     2036 },
+  { "for",     2041 },
+  { "fos",     7038 },
+  { "fox",     2044 },
+  { "fpe",     2014 },
+  { "fqs",     2007 },
+  { "fr",      2049 },
+  { "fra",     2049 },
+  { "frc",     1164 },
+  { "frd",     2040 },
+  { "fre",     2049 },
+  { "frk",     2047 },
+  { "frm",     4548 },
+  { "fro",     5460 },
+  { "frp",     389  },
+  { "frq",     2039 },
+  { "frr",     5240 },
+  { "frs",     1818 },
+  { "frt",     2045 },
+  { "fry",     8312 },
+  { "fse",     2022 },
+  { "fsl",     2048 },
+  { "fss",     2021 },
+  { "fub",     44   },
+  { "fuc",     5889 },
+  { "fud",     1796 },
+  { "fue",     997  },
+  { "fuf",     5891 },
+  { "fuh",     8334 },
+  { "fui",     552  },
+  { "fuj",     3324 },
+  { "ful",     2051 },
+  { "fum",     2054 },
+  { "fun",     2053 },
+  { "fuq",     1269 },
+  { "fur",     2050 },
+  { "fut",     2058 },
+  { "fuu",     2057 },
+  { "fuv",     5113 },
+  { "fuy",     2059 },
+  { "fvr",     2056 },
+  { "fwa",     2061 },
+  { "fwe",     2060 },
+  { "fy",      8312 },
+  { "ga",      2692 },
+  { "gaa",     2064 },
+  { "gab",     2070 },
+  { "gac",     4611 },
+  { "gad",     2074 },
+  { "gae",     2288 },
+  { "gaf",     2174 },
+  { "gag",     2082 },
+  { "gah",     179  },
+  { "gai",     996  },
+  { "gaj",     2079 },
+  { "gak",     2106 },
+  { "gal",     2100 },
+  { "gam",     3007 },
+  { "gan",     2109 },
+  { "gao",     2118 },
+  { "gap",     2089 },
+  { "gaq",     2134 },
+  { "gar",     2093 },
+  { "gas",     59   },
+  { "gat",     3182 },
+  { "gau",     4761 },
+  { "gav",     2072 },
+  { "gaw",     5168 },
+  { "gax",     994  },
+  { "gay",     2142 },
+  { "gaz",     8286 },
+  { "gba",     2150 },
+  { "gbb",     3147 },
+  { "gbc",     2123 },
+  { "gbd",     3058 },
+  { "gbe",     5119 },
+  { "gbf",     2086 },
+  { "gbg",     2147 },
+  { "gbh",     1590 },
+  { "gbi",     2092 },
+  { "gbj",     938  },
+  { "gbk",     2075 },
+  { "gbl",     2105 },
+  { "gbm",     2124 },
+  { "gbn",     4624 },
+  { "gbo",     5243 },
+  { "gbp",     2152 },
+  { "gbq",     2153 },
+  { "gbr",     2145 },
+  { "gbs",     2156 },
+  { "gbu",     2081 },
+  { "gbv",     2146 },
+  { "gbw",     2069 },
+  { "gbx",     1857 },
+  { "gby",     2148 },
+  { "gbz",     8725 },
+  { "gcc",     4185 },
+  { "gcd",     2114 },
+  { "gce",     2095 },
+  { "gcf",     2276 },
+  { "gcl",     2270 },
+  { "gcn",     2088 },
+  { "gcr",     2305 },
+  { "gct",     1447 },
+  { "gd",      6823 },
+  { "gda",     2076 },
+  { "gdb",     5865 },
+  { "gdc",     2301 },
+  { "gdd",     2164 },
+  { "gde",     2294 },
+  { "gdf",     2296 },
+  { "gdg",     2066 },
+  { "gdh",     2078 },
+  { "gdi",     2327 },
+  { "gdj",     2339 },
+  { "gdk",     2073 },
+  { "gdl",     1667 },
+  { "gdm",     3673 },
+  { "gdn",     7962 },
+  { "gdo",     2195 },
+  { "gdq",     4482 },
+  { "gdr",     8373 },
+  { "gds",     2189 },
+  { "gdt",     3567 },
+  { "gdu",     2295 },
+  { "gdx",     2233 },
+  { "gea",     2183 },
+  { "geb",     3299 },
+  { "gec",     2160 },
+  { "ged",     2077 },
+  { "gef",     2179 },
+  { "geg",     2175 },
+  { "geh",     2556 },
+  { "gei",     2163 },
+  { "gej",     2173 },
+  { "gek",     8670 },
+  { "gel",     8740 },
+  { "gem",     2182 },
+  { "geo",     2176 },
+  { "geq",     2172 },
+  { "ger",     2181 },
+  { "ges",     2184 },
+  { "gev",     1979 },
+  { "gew",     2178 },
+  { "gex",     2130 },
+  { "gey",     1937 },
+  { "gez",     2166 },
+  { "gfk",     5708 },
+  { "gft",     2080 },
+  { "gfx",     4253 },
+  { "gga",     2121 },
+  { "ggb",     2157 },
+  { "ggd",     2300 },
+  { "gge",     2347 },
+  { "ggg",     2341 },
+  { "ggk",     3566 },
+  { "ggl",     2115 },
+  { "ggn",     1820 },
+  { "ggo",     7172 },
+  { "ggr",     82   },
+  { "ggt",     2220 },
+  { "ggu",     2084 },
+  { "ggw",     2237 },
+  { "gha",     2186 },
+  { "ghc",     2449 },
+  { "ghe",     7171 },
+  { "ghh",     5241 },
+  { "ghk",     2169 },
+  { "ghl",     2199 },
+  { "ghn",     2190 },
+  { "gho",     2196 },
+  { "ghr",     2194 },
+  { "ghs",     2304 },
+  { "ght",     3525 },
+  { "gia",     3267 },
+  { "gib",     2201 },
+  { "gic",     2087 },
+  { "gid",     2202 },
+  { "gie",     2144 },
+  { "gig",     2229 },
+  { "gih",     2218 },
+  { "gii",     2216 },
+  { "gil",     2206 },
+  { "gim",     2209 },
+  { "gin",     2466 },
+  { "gio",     2171 },
+  { "gip",     2210 },
+  { "giq",     2269 },
+  { "gir",     6010 },
+  { "gis",     5203 },
+  { "git",     2221 },
+  { "giu",     4771 },
+  { "giw",     8353 },
+  { "gix",     2207 },
+  { "giy",     2222 },
+  { "giz",     7125 },
+  { "gji",     2167 },
+  { "gjk",     2891 },
+  { "gjm",     2328 },
+  { "gjn",     2245 },
+  { "gjr",     2343 },
+  { "gju",     2313 },
+  { "gka",     2355 },
+  { "gkd",     4096 },
+  { "gke",     4951 },
+  { "gkn",     2238 },
+  { "gko",     3355 },
+  { "gkp",     2309 },
+  { "gku",     8752 },
+  { "gl",      2096 },
+  { "gla",     6823 },
+  { "glb",     786  },
+  { "glc",     973  },
+  { "gld",     4898 },
+  { "gle",     2692 },
+  { "glg",     2096 },
+  { "glh",     5296 },
+  { "gli",     2321 },
+  { "glj",     2316 },
+  { "glk",     2205 },
+  { "gll",     2128 },
+  { "glo",     2090 },
+  { "glr",     2224 },
+  { "glu",     2315 },
+  { "glv",     4278 },
+  { "glw",     2225 },
+  { "gly",     2319 },
+  { "gma",     2102 },
+  { "gmb",     2317 },
+  { "gmd",     4838 },
+  { "gme",     1797 },
+  { "gmg",     4097 },
+  { "gmh",     4549 },
+  { "gml",     4554 },
+  { "gmm",     2154 },
+  { "gmn",     2212 },
+  { "gmq",     5202 },
+  { "gmr",     4600 },
+  { "gmu",     2322 },
+  { "gmv",     2107 },
+  { "gmw",     8289 },
+  { "gmx",     4093 },
+  { "gmy",     4834 },
+  { "gmz",     4531 },
+  { "gn",      2286 },
+  { "gna",     2872 },
+  { "gnb",     2116 },
+  { "gnc",     2284 },
+  { "gnd",     8729 },
+  { "gne",     2111 },
+  { "gng",     5037 },
+  { "gnh",     3848 },
+  { "gni",     2247 },
+  { "gnj",     5063 },
+  { "gnk",     8748 },
+  { "gnl",     2117 },
+  { "gnm",     2213 },
+  { "gnn",     2323 },
+  { "gno",     5242 },
+  { "gnq",     2110 },
+  { "gnr",     2340 },
+  { "gnt",     2332 },
+  { "gnu",     2227 },
+  { "gnw",     8305 },
+  { "gnz",     2120 },
+  { "goa",     2346 },
+  { "gob",     5830 },
+  { "goc",     2249 },
+  { "god",     2232 },
+  { "goe",     2244 },
+  { "gof",     2235 },
+  { "gog",     2236 },
+  { "goh",     5463 },
+  { "goi",     2230 },
+  { "goj",     2258 },
+  { "gok",     2259 },
+  { "gol",     2239 },
+  { "gom",     2228 },
+  { "gon",     2242 },
+  { "goo",     2243 },
+  { "gop",     8585 },
+  { "goq",     2250 },
+  { "gor",     2252 },
+  { "gos",     2273 },
+  { "got",     2255 },
+  { "gou",     2136 },
+  { "gov",     2246 },
+  { "gow",     2254 },
+  { "gox",     2231 },
+  { "goy",     2256 },
+  { "goz",     2261 },
+  { "gpa",     2335 },
+  { "gpe",     2187 },
+  { "gpn",     7394 },
+  { "gqa",     2065 },
+  { "gqi",     2311 },
+  { "gqn",     2281 },
+  { "gqr",     2248 },
+  { "gqu",     5946 },
+  { "gra",     5976 },
+  { "grb",     2264 },
+  { "grc",     2265 },
+  { "grd",     2349 },
+  { "gre",     2266 },
+  { "grg",     4081 },
+  { "grh",     2159 },
+  { "gri",     2191 },
+  { "grj",     7173 },
+  { "grk",     2268 },
+  { "grm",     3450 },
+  { "grn",     2286 },
+  { "gro",     2272 },
+  { "grq",     2253 },
+  { "grr",     7520 },
+  { "grs",     2271 },
+  { "grt",     2129 },
+  { "gru",     3311 },
+  { "grv",     1237 },
+  { "grw",     2364 },
+  { "grx",     2342 },
+  { "gry",     684  },
+  { "grz",     2337 },
+  { "gse",     2188 },
+  { "gsg",     2180 },
+  { "gsl",     2351 },
+  { "gsm",     2289 },
+  { "gsn",     4997 },
+  { "gso",     7226 },
+  { "gsp",     8246 },
+  { "gss",     2267 },
+  { "gsw",     7326 },
+  { "gta",     2290 },
+  { "gti",     2149 },
+  { "gtu",     84   },
+  { "gu",      2312 },
+  { "gua",     6946 },
+  { "gub",     2278 },
+  { "guc",     8266 },
+  { "gud",     8615 },
+  { "gue",     2344 },
+  { "guf",     2336 },
+  { "gug",     5679 },
+  { "guh",     2277 },
+  { "gui",     1811 },
+  { "guj",     2312 },
+  { "guk",     2325 },
+  { "gul",     6825 },
+  { "gum",     2280 },
+  { "gun",     4467 },
+  { "guo",     2291 },
+  { "gup",     2333 },
+  { "guq",     40   },
+  { "gur",     2005 },
+  { "gus",     2310 },
+  { "gut",     4198 },
+  { "guu",     8528 },
+  { "guv",     2185 },
+  { "guw",     2326 },
+  { "gux",     2257 },
+  { "guz",     2350 },
+  { "gv",      4278 },
+  { "gva",     2282 },
+  { "gvc",     2283 },
+  { "gve",     1773 },
+  { "gvf",     2240 },
+  { "gvj",     2279 },
+  { "gvl",     2318 },
+  { "gvm",     2345 },
+  { "gvn",     3533 },
+  { "gvo",     2137 },
+  { "gvp",     5700 },
+  { "gvr",     2348 },
+  { "gvs",     2324 },
+  { "gvy",     2357 },
+  { "gwa",     4434 },
+  { "gwb",     2359 },
+  { "gwc",     2139 },
+  { "gwd",     2140 },
+  { "gwe",     2365 },
+  { "gwf",     2260 },
+  { "gwg",     4698 },
+  { "gwi",     2367 },
+  { "gwj",     8745 },
+  { "gwm",     487  },
+  { "gwn",     2363 },
+  { "gwr",     2366 },
+  { "gwt",     2138 },
+  { "gwu",     2354 },
+  { "gww",     3656 },
+  { "gwx",     2275 },
+  { "gxx",     8432 },
+  { "gya",     5293 },
+  { "gyb",     2132 },
+  { "gyd",     3142 },
+  { "gye",     2370 },
+  { "gyf",     2330 },
+  { "gyg",     2155 },
+  { "gyi",     2369 },
+  { "gyl",     2141 },
+  { "gym",     5102 },
+  { "gyn",     2356 },
+  { "gyo",     2368 },
+  { "gyr",     2287 },
+  { "gyy",     2334 },
+  { "gyz",     2168 },
+  { "gza",     2119 },
+  { "gzi",     2143 },
+  { "gzn",     2113 },
+  { "ha",      2426 },
+  { "haa",     2404 },
+  { "hab",     2410 },
+  { "hac",     2338 },
+  { "had",     2423 },
+  { "hae",     1847 },
+  { "haf",     2384 },
+  { "hag",     2406 },
+  { "hah",     2381 },
+  { "hai",     2382 },
+  { "haj",     2390 },
+  { "hak",     2392 },
+  { "hal",     2395 },
+  { "ham",     2447 },
+  { "han",     2407 },
+  { "hao",     2393 },
+  { "hap",     2554 },
+  { "haq",     2373 },
+  { "har",     2413 },
+  { "has",     2385 },
+  { "hat",     2387 },
+  { "hau",     2426 },
+  { "hav",     2429 },
+  { "haw",     2432 },
+  { "hax",     7175 },
+  { "hay",     2433 },
+  { "haz",     2434 },
+  { "hba",     2401 },
+  { "hbb",     2527 },
+  { "hbn",     2438 },
+  { "hbo",     258  },
+  { "hbs",     6893 },
+  { "hbu",     2374 },
+  { "hca",     266  },
+  { "hch",     2529 },
+  { "hdn",     5245 },
+  { "hds",     2497 },
+  { "hdy",     2375 },
+  { "he",      2436 },
+  { "hea",     5272 },
+  { "heb",     2436 },
+  { "hed",     2443 },
+  { "heg",     2440 },
+  { "heh",     2437 },
+  { "hei",     2439 },
+  { "hem",     2442 },
+  { "her",     2444 },
+  { "hgm",     2388 },
+  { "hgw",     2383 },
+  { "hhi",     2489 },
+  { "hhr",     3200 },
+  { "hhy",     2509 },
+  { "hi",      2464 },
+  { "hia",     3730 },
+  { "hib",     2450 },
+  { "hid",     2451 },
+  { "hif",     2016 },
+  { "hig",     2999 },
+  { "hih",     5632 },
+  { "hii",     2465 },
+  { "hij",     2460 },
+  { "hik",     6842 },
+  { "hil",     2461 },
+  { "him",     2462 },
+  { "hin",     2464 },
+  { "hio",     7816 },
+  { "hir",     2463 },
+  { "hit",     2468 },
+  { "hiw",     2470 },
+  { "hix",     2471 },
+  { "hji",     2389 },
+  { "hka",     2914 },
+  { "hke",     2542 },
+  { "hkh",     3214 },
+  { "hkk",     2548 },
+  { "hkn",     4486 },
+  { "hks",     2498 },
+  { "hla",     2398 },
+  { "hlb",     2396 },
+  { "hld",     2394 },
+  { "hle",     2474 },
+  { "hlt",     4388 },
+  { "hlu",     2452 },
+  { "hma",     7186 },
+  { "hmb",     2538 },
+  { "hmc",     1240 },
+  { "hmd",     3773 },
+  { "hme",     1825 },
+  { "hmf",     2477 },
+  { "hmg",     7233 },
+  { "hmh",     7234 },
+  { "hmi",     5247 },
+  { "hmj",     2161 },
+  { "hmk",     4084 },
+  { "hml",     4024 },
+  { "hmm",     1247 },
+  { "hmn",     2481 },
+  { "hmo",     2467 },
+  { "hmp",     5255 },
+  { "hmq",     1851 },
+  { "hmr",     2475 },
+  { "hms",     7205 },
+  { "hmt",     2403 },
+  { "hmu",     2400 },
+  { "hmv",     2478 },
+  { "hmw",     8329 },
+  { "hmx",     2482 },
+  { "hmy",     7174 },
+  { "hmz",     2480 },
+  { "hna",     4573 },
+  { "hnd",     7176 },
+  { "hne",     1324 },
+  { "hng",     2547 },
+  { "hnh",     8747 },
+  { "hni",     2408 },
+  { "hnj",     2479 },
+  { "hnn",     2411 },
+  { "hno",     5246 },
+  { "hns",     1198 },
+  { "hnu",     2543 },
+  { "ho",      2467 },
+  { "hoa",     2487 },
+  { "hob",     4319 },
+  { "hoc",     2485 },
+  { "hod",     2493 },
+  { "hoe",     2503 },
+  { "hoh",     2488 },
+  { "hoi",     2491 },
+  { "hoj",     2376 },
+  { "hok",     2490 },
+  { "hol",     2495 },
+  { "hom",     2496 },
+  { "hoo",     2494 },
+  { "hop",     2500 },
+  { "hor",     2502 },
+  { "hos",     2484 },
+  { "hot",     2506 },
+  { "hov",     2508 },
+  { "how",     2499 },
+  { "hoy",     2492 },
+  { "hoz",     2510 },
+  { "hpo",     2511 },
+  { "hps",     2431 },
+  { "hr",      1482 },
+  { "hra",     2512 },
+  { "hrc",     5148 },
+  { "hre",     2513 },
+  { "hrk",     2418 },
+  { "hrm",     2501 },
+  { "hro",     2415 },
+  { "hrp",     5105 },
+  { "hrr",     2505 },
+  { "hrt",     2561 },
+  { "hru",     2514 },
+  { "hrv",     1482 },
+  { "hrw",     8243 },
+  { "hrx",     2550 },
+  { "hrz",     2420 },
+  { "hsb",     7997 },
+  { "hsh",     2545 },
+  { "hsl",     2425 },
+  { "hsn",     8444 },
+  { "hss",     2416 },
+  { "ht",      2387 },
+  { "hti",     2507 },
+  { "hto",     4584 },
+  { "hts",     2379 },
+  { "htu",     2469 },
+  { "htx",     4550 },
+  { "hu",      2546 },
+  { "hub",     2519 },
+  { "huc",     8750 },
+  { "hud",     2522 },
+  { "hue",     6713 },
+  { "huf",     2539 },
+  { "hug",     2516 },
+  { "huh",     2530 },
+  { "hui",     2536 },
+  { "huj",     5244 },
+  { "huk",     2537 },
+  { "hul",     2534 },
+  { "hum",     2544 },
+  { "hun",     2546 },
+  { "huo",     2515 },
+  { "hup",     2552 },
+  { "huq",     7806 },
+  { "hur",     2399 },
+  { "hus",     2521 },
+  { "hut",     2540 },
+  { "huu",     4803 },
+  { "huv",     6723 },
+  { "huw",     2533 },
+  { "hux",     5405 },
+  { "huy",     2535 },
+  { "huz",     2551 },
+  { "hvc",     2386 },
+  { "hve",     6711 },
+  { "hvk",     2428 },
+  { "hvn",     6641 },
+  { "hvv",     6761 },
+  { "hwa",     8211 },
+  { "hwc",     2430 },
+  { "hwo",     2557 },
+  { "hy",      385  },
+  { "hya",     2558 },
+  { "hye",     385  },
+  { "hyw",     8302 },
+  { "hyx",     383  },
+  { "hz",      2444 },
+  { "ia",      2666 },
+  { "iai",     2564 },
+  { "ian",     2567 },
+  { "iap",     2566 },
+  { "iar",     5909 },
+  { "iba",     2571 },
+  { "ibb",     2576 },
+  { "ibd",     2735 },
+  { "ibe",     149  },
+  { "ibg",     2572 },
+  { "ibh",     863  },
+  { "ibi",     2577 },
+  { "ibl",     2570 },
+  { "ibm",     89   },
+  { "ibn",     2578 },
+  { "ibo",     2599 },
+  { "ibr",     2580 },
+  { "ibu",     2579 },
+  { "iby",     2573 },
+  { "ica",     1865 },
+  { "ice",     2582 },
+  { "ich",     1971 },
+  { "icl",     2581 },
+  { "icr",     2706 },
+  { "id",      2650 },
+  { "ida",     2585 },
+  { "idb",     2647 },
+  { "idc",     2592 },
+  { "idd",     1866 },
+  { "ide",     2587 },
+  { "idi",     2589 },
+  { "ido",     2590 },
+  { "idr",     2651 },
+  { "ids",     2588 },
+  { "idt",     2586 },
+  { "idu",     2591 },
+  { "ie",      2667 },
+  { "ifa",     237  },
+  { "ifb",     719  },
+  { "ife",     2596 },
+  { "iff",     2595 },
+  { "ifk",     7898 },
+  { "ifm",     7538 },
+  { "ifu",     4417 },
+  { "ify",     3169 },
+  { "ig",      2599 },
+  { "igb",     1859 },
+  { "ige",     2600 },
+  { "igg",     2598 },
+  { "igl",     2597 },
+  { "igm",     3013 },
+  { "ign",     2601 },
+  { "igo",     2700 },
+  { "igs",     2665 },
+  { "igw",     2604 },
+  { "ihb",     2605 },
+  { "ihi",     2607 },
+  { "ihp",     2606 },
+  { "ihw",     852  },
+  { "ii",      6981 },
+  { "iii",     6981 },
+  { "iin",     7625 },
+  { "iir",     2646 },
+  { "ijc",     2752 },
+  { "ije",     909  },
+  { "ijj",     1867 },
+  { "ijn",     2949 },
+  { "ijo",     2609 },
+  { "ijs",     7142 },
+  { "ik",      2673 },
+  { "ike",     1814 },
+  { "iki",     2614 },
+  { "ikk",     2611 },
+  { "ikl",     2621 },
+  { "iko",     5496 },
+  { "ikp",     2618 },
+  { "ikr",     2612 },
+  { "iks",     2671 },
+  { "ikt",     2670 },
+  { "iku",     2672 },
+  { "ikv",     2620 },
+  { "ikw",     2622 },
+  { "ikx",     2610 },
+  { "ikz",     2613 },
+  { "ila",     2625 },
+  { "ilb",     2624 },
+  { "ile",     2667 },
+  { "ilg",     2126 },
+  { "ili",     2626 },
+  { "ilk",     2631 },
+  { "ill",     2686 },
+  { "ilm",     2684 },
+  { "ilo",     2630 },
+  { "ilp",     2685 },
+  { "ils",     2668 },
+  { "ilu",     2627 },
+  { "ilv",     2632 },
+  { "ilw",     7427 },
+  { "ima",     4151 },
+  { "ime",     2636 },
+  { "imi",     256  },
+  { "iml",     4567 },
+  { "imn",     2637 },
+  { "imo",     2635 },
+  { "imr",     2639 },
+  { "ims",     4346 },
+  { "imt",     2638 },
+  { "imy",     4568 },
+  { "ina",     2666 },
+  { "inb",     2656 },
+  { "inc",     2644 },
+  { "ind",     2650 },
+  { "ine",     2645 },
+  { "ing",     1595 },
+  { "inh",     2658 },
+  { "inj",     2855 },
+  { "inl",     2649 },
+  { "inm",     4575 },
+  { "inn",     2703 },
+  { "ino",     2661 },
+  { "inp",     2754 },
+  { "ins",     2643 },
+  { "int",     2669 },
+  { "inz",     2655 },
+  { "io",      2590 },
+  { "ior",     2663 },
+  { "iou",     7846 },
+  { "iow",     2674 },
+  { "ipi",     2677 },
+  { "ipk",     2673 },
+  { "ipo",     2676 },
+  { "iqu",     2679 },
+  { "iqw",     2623 },
+  { "ira",     2683 },
+  { "ire",     2690 },
+  { "irh",     2688 },
+  { "iri",     6561 },
+  { "irk",     2687 },
+  { "irn",     2695 },
+  { "iro",     2693 },
+  { "irr",     2680 },
+  { "iru",     2694 },
+  { "irx",     2990 },
+  { "iry",     2689 },
+  { "is",      2582 },
+  { "isa",     2696 },
+  { "isc",     2699 },
+  { "isd",     2707 },
+  { "ise",     2719 },
+  { "isg",     2691 },
+  { "ish",     1952 },
+  { "isi",     5157 },
+  { "isk",     2702 },
+  { "isl",     2582 },
+  { "ism",     4366 },
+  { "isn",     2697 },
+  { "iso",     2708 },
+  { "isr",     2709 },
+  { "ist",     2715 },
+  { "isu",     2718 },
+  { "it",      2720 },
+  { "ita",     2720 },
+  { "itb",     892  },
+  { "itc",     2721 },
+  { "itd",     7218 },
+  { "ite",     2724 },
+  { "iti",     2659 },
+  { "itk",     2844 },
+  { "itl",     2723 },
+  { "itm",     2729 },
+  { "ito",     2728 },
+  { "itr",     2725 },
+  { "its",     2701 },
+  { "itt",     4085 },
+  { "itv",     2722 },
+  { "itw",     2727 },
+  { "itx",     2726 },
+  { "ity",     4735 },
+  { "itz",     2731 },
+  { "iu",      2672 },
+  { "ium",     2732 },
+  { "ivb",     2574 },
+  { "ivv",     2733 },
+  { "iwk",     2563 },
+  { "iwm",     2737 },
+  { "iwo",     2738 },
+  { "iws",     6890 },
+  { "ixc",     2739 },
+  { "ixl",     2741 },
+  { "iya",     2744 },
+  { "iyo",     4512 },
+  { "iyx",     8479 },
+  { "izh",     2657 },
+  { "izi",     2750 },
+  { "izr",     2749 },
+  { "izz",     2751 },
+  { "ja",      2781 },
+  { "jaa",     2770 },
+  { "jab",     2559 },
+  { "jac",     5854 },
+  { "jad",     2759 },
+  { "jae",     8462 },
+  { "jaf",     2784 },
+  { "jah",     2758 },
+  { "jaj",     8697 },
+  { "jak",     2764 },
+  { "jal",     8488 },
+  { "jam",     2768 },
+  { "jan",     2774 },
+  { "jao",     8531 },
+  { "jaq",     8537 },
+  { "jar",     2787 },
+  { "jas",     5011 },
+  { "jat",     2762 },
+  { "jau",     8556 },
+  { "jav",     2791 },
+  { "jax",     2771 },
+  { "jay",     8507 },
+  { "jaz",     2793 },
+  { "jbe",     2841 },
+  { "jbi",     534  },
+  { "jbj",     347  },
+  { "jbk",     692  },
+  { "jbm",     865  },
+  { "jbn",     4862 },
+  { "jbo",     3935 },
+  { "jbr",     2830 },
+  { "jbt",     2755 },
+  { "jbu",     2851 },
+  { "jbw",     8565 },
+  { "jcs",     2767 },
+  { "jct",     3495 },
+  { "jda",     2756 },
+  { "jdg",     2757 },
+  { "jdt",     2847 },
+  { "jeb",     2796 },
+  { "jee",     2807 },
+  { "jeg",     2803 },
+  { "jeh",     2797 },
+  { "jei",     8571 },
+  { "jek",     2806 },
+  { "jel",     8576 },
+  { "jen",     1782 },
+  { "jer",     2805 },
+  { "jet",     4242 },
+  { "jeu",     2834 },
+  { "jgb",     5058 },
+  { "jge",     2842 },
+  { "jgk",     2361 },
+  { "jgo",     5076 },
+  { "jhi",     2798 },
+  { "jhs",     2810 },
+  { "jia",     2821 },
+  { "jib",     2814 },
+  { "jic",     7731 },
+  { "jid",     1036 },
+  { "jie",     2817 },
+  { "jig",     2822 },
+  { "jih",     8737 },
+  { "jii",     2816 },
+  { "jil",     2818 },
+  { "jim",     2819 },
+  { "jio",     2811 },
+  { "jiq",     2285 },
+  { "jit",     2827 },
+  { "jiu",     8639 },
+  { "jiv",     6959 },
+  { "jiy",     1135 },
+  { "jje",     2800 },
+  { "jjr",     658  },
+  { "jka",     2905 },
+  { "jkm",     4629 },
+  { "jko",     3507 },
+  { "jkp",     5607 },
+  { "jkr",     3423 },
+  { "jks",     212  },
+  { "jku",     3677 },
+  { "jle",     5070 },
+  { "jls",     2769 },
+  { "jma",     1659 },
+  { "jmb",     8732 },
+  { "jmc",     4069 },
+  { "jmd",     8499 },
+  { "jmi",     2820 },
+  { "jml",     2854 },
+  { "jmn",     4143 },
+  { "jmr",     2977 },
+  { "jms",     4363 },
+  { "jmw",     4733 },
+  { "jmx",     8316 },
+  { "jna",     2777 },
+  { "jnd",     2775 },
+  { "jng",     8521 },
+  { "jni",     2778 },
+  { "jnj",     8579 },
+  { "jnl",     6005 },
+  { "jns",     2790 },
+  { "job",     2829 },
+  { "jod",     8385 },
+  { "jog",     2831 },
+  { "jor",     2836 },
+  { "jos",     2835 },
+  { "jow",     2837 },
+  { "jpa",     2809 },
+  { "jpn",     2781 },
+  { "jpr",     2846 },
+  { "jpx",     2779 },
+  { "jqr",     2783 },
+  { "jra",     2785 },
+  { "jrb",     2840 },
+  { "jrr",     2826 },
+  { "jrt",     2763 },
+  { "jru",     2782 },
+  { "jsl",     2780 },
+  { "jua",     2867 },
+  { "jub",     8206 },
+  { "juc",     2859 },
+  { "jud",     8399 },
+  { "juh",     2562 },
+  { "jui",     5019 },
+  { "juk",     8213 },
+  { "jul",     2825 },
+  { "jum",     2852 },
+  { "jun",     2839 },
+  { "juo",     2813 },
+  { "jup",     2553 },
+  { "jur",     2860 },
+  { "jus",     2853 },
+  { "jut",     2861 },
+  { "juu",     2838 },
+  { "juw",     8430 },
+  { "juy",     2858 },
+  { "jv",      2791 },
+  { "jvd",     2792 },
+  { "jvn",     1199 },
+  { "jwi",     2865 },
+  { "jya",     2812 },
+  { "jye",     2850 },
+  { "jyy",     2795 },
+  { "ka",      2176 },
+  { "kaa",     3053 },
+  { "kab",     2887 },
+  { "kac",     2892 },
+  { "kad",     50   },
+  { "kae",     3208 },
+  { "kaf",     3120 },
+  { "kag",     2936 },
+  { "kah",     3049 },
+  { "kai",     3073 },
+  { "kaj",     2828 },
+  { "kak",     2957 },
+  { "kal",     2946 },
+  { "kam",     2986 },
+  { "kan",     3029 },
+  { "kao",     8434 },
+  { "kap",     826  },
+  { "kaq",     1188 },
+  { "kar",     3075 },
+  { "kas",     3102 },
+  { "kat",     2176 },
+  { "kau",     3036 },
+  { "kav",     3122 },
+  { "kaw",     3133 },
+  { "kax",     3038 },
+  { "kay",     2984 },
+  { "kaz",     3149 },
+  { "kba",     2960 },
+  { "kbb",     3135 },
+  { "kbc",     2899 },
+  { "kbd",     2875 },
+  { "kbe",     3026 },
+  { "kbf",     2940 },
+  { "kbg",     3219 },
+  { "kbh",     1180 },
+  { "kbi",     3046 },
+  { "kbj",     3078 },
+  { "kbk",     2263 },
+  { "kbl",     3009 },
+  { "kbm",     2736 },
+  { "kbn",     3071 },
+  { "kbo",     3170 },
+  { "kbp",     2878 },
+  { "kbq",     2974 },
+  { "kbr",     2906 },
+  { "kbs",     3008 },
+  { "kbt",     6    },
+  { "kbu",     2883 },
+  { "kbv",     1614 },
+  { "kbw",     2919 },
+  { "kbx",     322  },
+  { "kby",     4244 },
+  { "kbz",     1741 },
+  { "kca",     3225 },
+  { "kcb",     3130 },
+  { "kcc",     3996 },
+  { "kcd",     5074 },
+  { "kce",     2931 },
+  { "kcf",     7941 },
+  { "kcg",     7908 },
+  { "kch",     8107 },
+  { "kci",     2975 },
+  { "kcj",     3328 },
+  { "kck",     2956 },
+  { "kcl",     3165 },
+  { "kcm",     2314 },
+  { "kcn",     5321 },
+  { "kco",     3283 },
+  { "kcp",     3011 },
+  { "kcq",     2994 },
+  { "kcr",     3118 },
+  { "kcs",     3340 },
+  { "kct",     2916 },
+  { "kcu",     2993 },
+  { "kcv",     3209 },
+  { "kcw",     2886 },
+  { "kcx",     2888 },
+  { "kcy",     3414 },
+  { "kcz",     3401 },
+  { "kda",     8398 },
+  { "kdc",     3611 },
+  { "kdd",     8527 },
+  { "kde",     4141 },
+  { "kdf",     4213 },
+  { "kdg",     6826 },
+  { "kdh",     7549 },
+  { "kdi",     3545 },
+  { "kdj",     3062 },
+  { "kdk",     5340 },
+  { "kdl",     7810 },
+  { "kdm",     2911 },
+  { "kdn",     3561 },
+  { "kdo",     3415 },
+  { "kdp",     3020 },
+  { "kdq",     3332 },
+  { "kdr",     3057 },
+  { "kdt",     3621 },
+  { "kdu",     2897 },
+  { "kdv",     2900 },
+  { "kdw",     3391 },
+  { "kdx",     2971 },
+  { "kdy",     3156 },
+  { "kdz",     3629 },
+  { "kea",     2884 },
+  { "keb",     3669 },
+  { "kec",     3160 },
+  { "ked",     3203 },
+  { "kee",     1830 },
+  { "kef",     3477 },
+  { "keg",     7593 },
+  { "keh",     3152 },
+  { "kei",     3159 },
+  { "kej",     2896 },
+  { "kek",     3163 },
+  { "kel",     3164 },
+  { "kem",     3173 },
+  { "ken",     3193 },
+  { "keo",     2944 },
+  { "kep",     2920 },
+  { "keq",     2976 },
+  { "ker",     3199 },
+  { "kes",     3515 },
+  { "ket",     3207 },
+  { "keu",     137  },
+  { "kev",     3019 },
+  { "kew",     8291 },
+  { "kex",     3527 },
+  { "key",     3583 },
+  { "kez",     3526 },
+  { "kfa",     3336 },
+  { "kfb",     5299 },
+  { "kfc",     3390 },
+  { "kfd",     3437 },
+  { "kfe",     3448 },
+  { "kff",     3463 },
+  { "kfg",     3510 },
+  { "kfh",     3592 },
+  { "kfi",     3028 },
+  { "kfj",     3179 },
+  { "kfk",     3287 },
+  { "kfl",     3564 },
+  { "kfm",     3259 },
+  { "kfn",     3523 },
+  { "kfo",     3422 },
+  { "kfp",     3440 },
+  { "kfq",     3420 },
+  { "kfr",     2890 },
+  { "kfs",     872  },
+  { "kft",     3025 },
+  { "kfu",     3117 },
+  { "kfv",     3593 },
+  { "kfw",     3227 },
+  { "kfx",     3539 },
+  { "kfy",     3548 },
+  { "kfz",     3429 },
+  { "kg",      3392 },
+  { "kga",     3464 },
+  { "kgb",     3132 },
+  { "kgc",     3107 },
+  { "kgd",     3109 },
+  { "kge",     3377 },
+  { "kgf",     3505 },
+  { "kgg",     3605 },
+  { "kgh",     8000 },
+  { "kgi",     6853 },
+  { "kgj",     2101 },
+  { "kgk",     2932 },
+  { "kgl",     3569 },
+  { "kgm",     3082 },
+  { "kgn",     3079 },
+  { "kgo",     3492 },
+  { "kgp",     2925 },
+  { "kgq",     2995 },
+  { "kgr",     26   },
+  { "kgs",     3551 },
+  { "kgt",     7087 },
+  { "kgu",     3330 },
+  { "kgv",     3067 },
+  { "kgw",     3094 },
+  { "kgx",     2979 },
+  { "kgy",     3667 },
+  { "kha",     3230 },
+  { "khb",     4046 },
+  { "khc",     7835 },
+  { "khd",     1146 },
+  { "khe",     3436 },
+  { "khf",     3256 },
+  { "khg",     3220 },
+  { "khh",     3158 },
+  { "khi",     3249 },
+  { "khj",     3612 },
+  { "khk",     2397 },
+  { "khl",     4029 },
+  { "khm",     3244 },
+  { "khn",     3224 },
+  { "kho",     3253 },
+  { "khp",     3044 },
+  { "khq",     3466 },
+  { "khr",     3229 },
+  { "khs",     3108 },
+  { "kht",     3221 },
+  { "khu",     5158 },
+  { "khv",     3260 },
+  { "khw",     3254 },
+  { "khx",     3034 },
+  { "khy",     3167 },
+  { "khz",     3153 },
+  { "ki",      3269 },
+  { "kia",     3275 },
+  { "kib",     3325 },
+  { "kic",     3266 },
+  { "kid",     3445 },
+  { "kie",     3264 },
+  { "kif",     1848 },
+  { "kig",     3276 },
+  { "kih",     3273 },
+  { "kii",     3314 },
+  { "kij",     3271 },
+  { "kik",     3269 },
+  { "kil",     3085 },
+  { "kim",     3055 },
+  { "kin",     3290 },
+  { "kio",     3295 },
+  { "kip",     6943 },
+  { "kiq",     3442 },
+  { "kir",     3300 },
+  { "kis",     3305 },
+  { "kit",     88   },
+  { "kiu",     3303 },
+  { "kiv",     3278 },
+  { "kiw",     5220 },
+  { "kix",     3238 },
+  { "kiy",     3302 },
+  { "kiz",     3310 },
+  { "kj",      3503 },
+  { "kja",     4620 },
+  { "kjb",     5941 },
+  { "kjc",     1432 },
+  { "kjd",     7181 },
+  { "kje",     3309 },
+  { "kjf",     3216 },
+  { "kjg",     3245 },
+  { "kjh",     3215 },
+  { "kji",     8673 },
+  { "kjj",     3239 },
+  { "kjk",     2454 },
+  { "kjl",     8337 },
+  { "kjm",     3261 },
+  { "kjn",     3576 },
+  { "kjo",     2414 },
+  { "kjp",     5927 },
+  { "kjq",     8321 },
+  { "kjr",     3598 },
+  { "kjs",     1798 },
+  { "kjt",     5767 },
+  { "kju",     3101 },
+  { "kjv",     2921 },
+  { "kjx",     5982 },
+  { "kjy",     1943 },
+  { "kjz",     1082 },
+  { "kk",      3149 },
+  { "kka",     2939 },
+  { "kkb",     3653 },
+  { "kkc",     5423 },
+  { "kkd",     3289 },
+  { "kke",     2938 },
+  { "kkf",     2952 },
+  { "kkg",     4061 },
+  { "kkh",     3262 },
+  { "kki",     2913 },
+  { "kkj",     2943 },
+  { "kkk",     3362 },
+  { "kkl",     3443 },
+  { "kkm",     3292 },
+  { "kkn",     3387 },
+  { "kko",     3089 },
+  { "kkp",     2303 },
+  { "kkq",     2904 },
+  { "kkr",     3298 },
+  { "kks",     2203 },
+  { "kkt",     3349 },
+  { "kku",     7850 },
+  { "kkv",     3012 },
+  { "kkw",     7539 },
+  { "kkx",     3345 },
+  { "kky",     2352 },
+  { "kkz",     3105 },
+  { "kl",      2946 },
+  { "kla",     3319 },
+  { "klb",     3272 },
+  { "klc",     3367 },
+  { "kld",     2104 },
+  { "kle",     3542 },
+  { "klf",     3184 },
+  { "klg",     7363 },
+  { "klh",     8271 },
+  { "kli",     2970 },
+  { "klj",     3217 },
+  { "klk",     3398 },
+  { "kll",     2908 },
+  { "klm",     4562 },
+  { "kln",     2962 },
+  { "klo",     3047 },
+  { "klp",     2981 },
+  { "klq",     6605 },
+  { "klr",     3218 },
+  { "kls",     2961 },
+  { "klt",     5329 },
+  { "klu",     3320 },
+  { "klv",     4368 },
+  { "klw",     7358 },
+  { "klx",     3370 },
+  { "kly",     2958 },
+  { "klz",     2879 },
+  { "km",      3244 },
+  { "kma",     3396 },
+  { "kmb",     3279 },
+  { "kmc",     7169 },
+  { "kmd",     4123 },
+  { "kme",     587  },
+  { "kmf",     3072 },
+  { "kmg",     3668 },
+  { "kmh",     2953 },
+  { "kmi",     2992 },
+  { "kmj",     3549 },
+  { "kmk",     3896 },
+  { "kml",     7473 },
+  { "kmm",     3372 },
+  { "kmn",     488  },
+  { "kmo",     3659 },
+  { "kmp",     2211 },
+  { "kmq",     3634 },
+  { "kmr",     5253 },
+  { "kms",     2982 },
+  { "kmt",     3180 },
+  { "kmu",     3024 },
+  { "kmv",     3081 },
+  { "kmw",     3382 },
+  { "kmx",     8124 },
+  { "kmy",     3373 },
+  { "kmz",     3251 },
+  { "kn",      3029 },
+  { "kna",     1615 },
+  { "knb",     3998 },
+  { "knc",     1241 },
+  { "knd",     3389 },
+  { "kne",     3027 },
+  { "knf",     4265 },
+  { "kng",     3406 },
+  { "kni",     3035 },
+  { "knj",     8317 },
+  { "knk",     3588 },
+  { "knl",     3188 },
+  { "knm",     3001 },
+  { "knn",     3393 },
+  { "kno",     3399 },
+  { "knp",     3643 },
+  { "knq",     3288 },
+  { "knr",     3022 },
+  { "kns",     3189 },
+  { "knt",     5661 },
+  { "knu",     3397 },
+  { "knv",     7350 },
+  { "knw",     3565 },
+  { "knx",     3183 },
+  { "kny",     3037 },
+  { "knz",     2954 },
+  { "ko",      3417 },
+  { "koa",     3400 },
+  { "koc",     3473 },
+  { "kod",     3338 },
+  { "koe",     2894 },
+  { "kof",     3506 },
+  { "kog",     1444 },
+  { "koh",     3465 },
+  { "koi",     3379 },
+  { "koj",     6778 },
+  { "kok",     3394 },
+  { "kol",     3365 },
+  { "kom",     3378 },
+  { "kon",     3392 },
+  { "koo",     3405 },
+  { "kop",     8255 },
+  { "koq",     3447 },
+  { "kor",     3417 },
+  { "kos",     3446 },
+  { "kot",     3694 },
+  { "kou",     3357 },
+  { "kov",     3512 },
+  { "kow",     3514 },
+  { "kox",     1470 },
+  { "koy",     3468 },
+  { "koz",     3412 },
+  { "kpa",     3610 },
+  { "kpb",     4773 },
+  { "kpc",     1500 },
+  { "kpd",     3327 },
+  { "kpe",     3476 },
+  { "kpf",     3374 },
+  { "kpg",     3043 },
+  { "kph",     3478 },
+  { "kpi",     3342 },
+  { "kpj",     3059 },
+  { "kpk",     3471 },
+  { "kpl",     3470 },
+  { "kpm",     3347 },
+  { "kpn",     3197 },
+  { "kpo",     2619 },
+  { "kpp",     5608 },
+  { "kpq",     3439 },
+  { "kpr",     3411 },
+  { "kps",     7534 },
+  { "kpt",     3068 },
+  { "kpu",     2907 },
+  { "kpv",     3380 },
+  { "kpw",     3331 },
+  { "kpx",     4732 },
+  { "kpy",     3441 },
+  { "kpz",     3584 },
+  { "kqa",     4776 },
+  { "kqb",     3458 },
+  { "kqc",     1723 },
+  { "kqd",     3462 },
+  { "kqe",     2951 },
+  { "kqf",     2937 },
+  { "kqg",     3233 },
+  { "kqh",     3308 },
+  { "kqi",     3352 },
+  { "kqj",     3430 },
+  { "kqk",     3452 },
+  { "kql",     3666 },
+  { "kqm",     3241 },
+  { "kqn",     3039 },
+  { "kqo",     1832 },
+  { "kqp",     3281 },
+  { "kqq",     3482 },
+  { "kqr",     3277 },
+  { "kqs",     5252 },
+  { "kqt",     3321 },
+  { "kqu",     6898 },
+  { "kqv",     5445 },
+  { "kqw",     3006 },
+  { "kqx",     4751 },
+  { "kqy",     3408 },
+  { "kqz",     3413 },
+  { "kr",      3036 },
+  { "kra",     3554 },
+  { "krb",     3088 },
+  { "krc",     3054 },
+  { "krd",     2928 },
+  { "kre",     5641 },
+  { "krf",     3425 },
+  { "krh",     3587 },
+  { "kri",     3488 },
+  { "krj",     3285 },
+  { "krk",     3202 },
+  { "krl",     3074 },
+  { "krm",     3487 },
+  { "krn",     6772 },
+  { "kro",     3493 },
+  { "krp",     3433 },
+  { "krr",     3494 },
+  { "krs",     2151 },
+  { "krt",     7848 },
+  { "kru",     3599 },
+  { "krv",     3129 },
+  { "krw",     8322 },
+  { "krx",     3095 },
+  { "kry",     3496 },
+  { "krz",     7111 },
+  { "ks",      3102 },
+  { "ksa",     6966 },
+  { "ksb",     6920 },
+  { "ksc",     7178 },
+  { "ksd",     3502 },
+  { "kse",     3571 },
+  { "ksf",     542  },
+  { "ksg",     3602 },
+  { "ksh",     3670 },
+  { "ksi",     3490 },
+  { "ksj",     7920 },
+  { "ksk",     3032 },
+  { "ksl",     3544 },
+  { "ksm",     3550 },
+  { "ksn",     3104 },
+  { "kso",     3341 },
+  { "ksp",     2873 },
+  { "ksq",     3626 },
+  { "ksr",     1001 },
+  { "kss",     7180 },
+  { "kst",     8372 },
+  { "ksu",     3222 },
+  { "ksv",     3604 },
+  { "ksw",     6625 },
+  { "ksx",     3155 },
+  { "ksy",     3228 },
+  { "ksz",     3335 },
+  { "kta",     3121 },
+  { "ktb",     2987 },
+  { "ktc",     3250 },
+  { "ktd",     3356 },
+  { "kte",     5323 },
+  { "ktf",     3637 },
+  { "ktg",     2965 },
+  { "kth",     3064 },
+  { "kti",     5211 },
+  { "ktj",     5827 },
+  { "ktk",     3018 },
+  { "ktl",     3435 },
+  { "ktm",     3596 },
+  { "ktn",     3084 },
+  { "kto",     3580 },
+  { "ktp",     2903 },
+  { "ktq",     3110 },
+  { "ktr",     3451 },
+  { "kts",     7129 },
+  { "ktt",     3211 },
+  { "ktu",     3316 },
+  { "ktv",     1828 },
+  { "ktw",     3119 },
+  { "ktx",     3134 },
+  { "kty",     3015 },
+  { "ktz",     2864 },
+  { "ku",      3589 },
+  { "kua",     3503 },
+  { "kub",     3607 },
+  { "kuc",     3657 },
+  { "kud",     1    },
+  { "kue",     3546 },
+  { "kuf",     8319 },
+  { "kug",     3581 },
+  { "kuh",     3603 },
+  { "kui",     3521 },
+  { "kuj",     3591 },
+  { "kuk",     3198 },
+  { "kul",     3535 },
+  { "kum",     3557 },
+  { "kun",     3559 },
+  { "kuo",     3556 },
+  { "kup",     3574 },
+  { "kuq",     3080 },
+  { "kur",     3589 },
+  { "kus",     3601 },
+  { "kut",     3606 },
+  { "kuu",     7994 },
+  { "kuv",     3585 },
+  { "kuw",     3469 },
+  { "kux",     3524 },
+  { "kuy",     3615 },
+  { "kuz",     3578 },
+  { "kv",      3378 },
+  { "kva",     558  },
+  { "kvb",     3508 },
+  { "kvc",     3459 },
+  { "kvd",     3519 },
+  { "kve",     2948 },
+  { "kvf",     2874 },
+  { "kvg",     3572 },
+  { "kvh",     3384 },
+  { "kvi",     3640 },
+  { "kvj",     5878 },
+  { "kvk",     3416 },
+  { "kvl",     3143 },
+  { "kvm",     3185 },
+  { "kvn",     995  },
+  { "kvo",     1691 },
+  { "kvp",     3385 },
+  { "kvq",     2162 },
+  { "kvr",     3205 },
+  { "kvs",     3568 },
+  { "kvt",     3699 },
+  { "kvu",     8599 },
+  { "kvv",     3366 },
+  { "kvw",     8280 },
+  { "kvx",     5693 },
+  { "kvy",     8606 },
+  { "kvz",     7804 },
+  { "kw",      1463 },
+  { "kwa",     1788 },
+  { "kwb",     3624 },
+  { "kwc",     3887 },
+  { "kwd",     3628 },
+  { "kwe",     3651 },
+  { "kwf",     3644 },
+  { "kwg",     6779 },
+  { "kwh",     3461 },
+  { "kwi",     472  },
+  { "kwj",     3641 },
+  { "kwk",     3631 },
+  { "kwl",     3343 },
+  { "kwm",     3635 },
+  { "kwn",     3642 },
+  { "kwo",     3660 },
+  { "kwp",     3339 },
+  { "kwq",     3630 },
+  { "kwr",     3649 },
+  { "kws",     3654 },
+  { "kwt",     3655 },
+  { "kwu",     3632 },
+  { "kwv",     6780 },
+  { "kww",     3658 },
+  { "kwx",     3240 },
+  { "kwy",     6729 },
+  { "kwz",     3627 },
+  { "kxa",     2927 },
+  { "kxb",     3491 },
+  { "kxc",     3402 },
+  { "kxd",     1033 },
+  { "kxe",     2942 },
+  { "kxf",     4277 },
+  { "kxh",     3092 },
+  { "kxi",     3187 },
+  { "kxj",     3536 },
+  { "kxk",     8694 },
+  { "kxl",     5009 },
+  { "kxm",     5251 },
+  { "kxn",     3030 },
+  { "kxo",     3031 },
+  { "kxp",     8130 },
+  { "kxq",     7066 },
+  { "kxr",     3424 },
+  { "kxs",     3014 },
+  { "kxt",     3353 },
+  { "kxu",     3517 },
+  { "kxv",     3617 },
+  { "kxw",     3388 },
+  { "kxx",     3885 },
+  { "kxy",     3145 },
+  { "kxz",     3204 },
+  { "ky",      3300 },
+  { "kya",     3646 },
+  { "kyb",     1129 },
+  { "kyc",     3663 },
+  { "kyd",     3077 },
+  { "kye",     3479 },
+  { "kyf",     3457 },
+  { "kyg",     3212 },
+  { "kyh",     3093 },
+  { "kyi",     3297 },
+  { "kyj",     3066 },
+  { "kyk",     2983 },
+  { "kyl",     2959 },
+  { "kym",     3474 },
+  { "kyn",     5231 },
+  { "kyo",     3172 },
+  { "kyp",     3010 },
+  { "kyq",     3186 },
+  { "kyr",     3600 },
+  { "kys",     674  },
+  { "kyt",     3137 },
+  { "kyu",     8320 },
+  { "kyv",     3146 },
+  { "kyw",     3511 },
+  { "kyx",     5992 },
+  { "kyy",     2988 },
+  { "kyz",     3136 },
+  { "kza",     8318 },
+  { "kzb",     2917 },
+  { "kzc",     977  },
+  { "kzd",     2895 },
+  { "kze",     3444 },
+  { "kzf",     1512 },
+  { "kzg",     3268 },
+  { "kzh",     3191 },
+  { "kzi",     3166 },
+  { "kzj",     1431 },
+  { "kzk",     3150 },
+  { "kzl",     3144 },
+  { "kzm",     2929 },
+  { "kzn",     3361 },
+  { "kzo",     3021 },
+  { "kzp",     2918 },
+  { "kzq",     2922 },
+  { "kzr",     3063 },
+  { "kzs",     7277 },
+  { "kzt",     7441 },
+  { "kzu",     3148 },
+  { "kzv",     3386 },
+  { "kzw",     3083 },
+  { "kzx",     2978 },
+  { "kzy",     3016 },
+  { "kzz",     2950 },
+  { "la",      3786 },
+  { "laa",     7216 },
+  { "lab",     3897 },
+  { "lac",     3682 },
+  { "lad",     3688 },
+  { "lae",     5710 },
+  { "laf",     3691 },
+  { "lag",     3754 },
+  { "lah",     3698 },
+  { "lai",     3737 },
+  { "laj",     3758 },
+  { "lak",     3708 },
+  { "lal",     3723 },
+  { "lam",     3732 },
+  { "lan",     3778 },
+  { "lao",     3764 },
+  { "lap",     3707 },
+  { "laq",     5942 },
+  { "lar",     3777 },
+  { "las",     3724 },
+  { "lat",     3786 },
+  { "lau",     3675 },
+  { "lav",     3790 },
+  { "law",     3794 },
+  { "lax",     7686 },
+  { "lay",     3725 },
+  { "laz",     372  },
+  { "lb",      4035 },
+  { "lba",     4006 },
+  { "lbb",     3676 },
+  { "lbc",     3713 },
+  { "lbe",     3706 },
+  { "lbf",     7669 },
+  { "lbg",     3766 },
+  { "lbi",     3672 },
+  { "lbj",     3686 },
+  { "lbk",     1235 },
+  { "lbl",     3871 },
+  { "lbm",     3925 },
+  { "lbn",     6570 },
+  { "lbo",     3799 },
+  { "lbq",     8188 },
+  { "lbr",     3933 },
+  { "lbs",     3874 },
+  { "lbt",     3683 },
+  { "lbu",     3680 },
+  { "lbv",     3798 },
+  { "lbw",     7732 },
+  { "lbx",     3802 },
+  { "lby",     3727 },
+  { "lbz",     3771 },
+  { "lcc",     3815 },
+  { "lcd",     3940 },
+  { "lce",     3954 },
+  { "lcf",     3997 },
+  { "lch",     3999 },
+  { "lcl",     3907 },
+  { "lcm",     7859 },
+  { "lcp",     8324 },
+  { "lcq",     4005 },
+  { "lcs",     3906 },
+  { "lda",     3318 },
+  { "ldb",     1774 },
+  { "ldd",     4025 },
+  { "ldg",     3844 },
+  { "ldh",     3740 },
+  { "ldi",     3674 },
+  { "ldj",     3833 },
+  { "ldk",     3810 },
+  { "ldl",     2870 },
+  { "ldm",     3750 },
+  { "ldn",     4044 },
+  { "ldo",     3963 },
+  { "ldp",     7815 },
+  { "ldq",     4002 },
+  { "lea",     3813 },
+  { "leb",     3720 },
+  { "lec",     3808 },
+  { "led",     3836 },
+  { "lee",     4043 },
+  { "lef",     3826 },
+  { "leg",     3840 },
+  { "leh",     3842 },
+  { "lei",     3830 },
+  { "lej",     3839 },
+  { "lek",     3820 },
+  { "lel",     3823 },
+  { "lem",     5175 },
+  { "len",     3835 },
+  { "leo",     3852 },
+  { "lep",     3845 },
+  { "leq",     3828 },
+  { "ler",     3843 },
+  { "les",     3849 },
+  { "let",     3850 },
+  { "leu",     3051 },
+  { "lev",     3742 },
+  { "lew",     3809 },
+  { "lex",     3993 },
+  { "ley",     3832 },
+  { "lez",     3859 },
+  { "lfa",     3811 },
+  { "lfn",     3902 },
+  { "lg",      2112 },
+  { "lga",     4021 },
+  { "lgb",     3692 },
+  { "lgg",     4003 },
+  { "lgh",     3693 },
+  { "lgi",     3837 },
+  { "lgk",     3900 },
+  { "lgl",     8165 },
+  { "lgm",     3812 },
+  { "lgn",     7339 },
+  { "lgo",     3756 },
+  { "lgq",     3926 },
+  { "lgr",     3838 },
+  { "lgt",     5595 },
+  { "lgu",     3957 },
+  { "lgz",     3877 },
+  { "lha",     3696 },
+  { "lhh",     3695 },
+  { "lhi",     3700 },
+  { "lhl",     3702 },
+  { "lhm",     3861 },
+  { "lhn",     3697 },
+  { "lhp",     3860 },
+  { "lhs",     4619 },
+  { "lht",     3921 },
+  { "lhu",     3701 },
+  { "li",      3893 },
+  { "lia",     8299 },
+  { "lib",     3886 },
+  { "lic",     2472 },
+  { "lid",     5385 },
+  { "lie",     3884 },
+  { "lif",     3891 },
+  { "lig",     3876 },
+  { "lih",     3880 },
+  { "lii",     3901 },
+  { "lij",     3879 },
+  { "lik",     3882 },
+  { "lil",     3889 },
+  { "lim",     3893 },
+  { "lin",     3898 },
+  { "lio",     3883 },
+  { "lip",     6852 },
+  { "liq",     3869 },
+  { "lir",     3868 },
+  { "lis",     3912 },
+  { "lit",     3915 },
+  { "liu",     3931 },
+  { "liv",     3919 },
+  { "liw",     1445 },
+  { "lix",     3863 },
+  { "liy",     634  },
+  { "liz",     3870 },
+  { "lja",     2241 },
+  { "lje",     5983 },
+  { "lji",     3705 },
+  { "ljl",     3862 },
+  { "ljp",     3745 },
+  { "ljw",     8610 },
+  { "ljx",     8665 },
+  { "lka",     3709 },
+  { "lkb",     2881 },
+  { "lkc",     3509 },
+  { "lkd",     3715 },
+  { "lke",     3194 },
+  { "lkh",     3711 },
+  { "lki",     3712 },
+  { "lkj",     6021 },
+  { "lkl",     3690 },
+  { "lkm",     2947 },
+  { "lkn",     3714 },
+  { "lko",     3231 },
+  { "lkr",     5937 },
+  { "lks",     3306 },
+  { "lkt",     3717 },
+  { "lku",     3570 },
+  { "lky",     3939 },
+  { "lla",     3721 },
+  { "llb",     3943 },
+  { "llc",     3824 },
+  { "lld",     3687 },
+  { "lle",     3825 },
+  { "llf",     2445 },
+  { "llg",     3942 },
+  { "llh",     3747 },
+  { "lli",     7540 },
+  { "llj",     3689 },
+  { "llk",     3821 },
+  { "lll",     3888 },
+  { "llm",     3780 },
+  { "lln",     3822 },
+  { "llo",     3242 },
+  { "llp",     5200 },
+  { "llq",     3941 },
+  { "lls",     3914 },
+  { "llu",     3791 },
+  { "llx",     3793 },
+  { "lma",     1799 },
+  { "lmb",     4505 },
+  { "lmc",     3895 },
+  { "lmd",     4015 },
+  { "lme",     5939 },
+  { "lmf",     7126 },
+  { "lmg",     3744 },
+  { "lmh",     3735 },
+  { "lmi",     3951 },
+  { "lmj",     8292 },
+  { "lmk",     3741 },
+  { "lml",     2409 },
+  { "lmm",     3729 },
+  { "lmn",     3733 },
+  { "lmo",     3950 },
+  { "lmp",     3892 },
+  { "lmq",     3731 },
+  { "lmr",     3728 },
+  { "lmu",     3739 },
+  { "lmv",     3948 },
+  { "lmw",     3710 },
+  { "lmx",     3703 },
+  { "lmy",     3736 },
+  { "lmz",     4013 },
+  { "ln",      3898 },
+  { "lna",     3753 },
+  { "lnb",     4425 },
+  { "lnd",     4019 },
+  { "lng",     3759 },
+  { "lnh",     3762 },
+  { "lni",     1515 },
+  { "lnj",     3841 },
+  { "lnl",     7121 },
+  { "lnm",     3752 },
+  { "lnn",     3968 },
+  { "lno",     3757 },
+  { "lns",     3743 },
+  { "lnu",     3959 },
+  { "lnw",     3761 },
+  { "lnz",     3962 },
+  { "lo",      3764 },
+  { "loa",     3944 },
+  { "lob",     3924 },
+  { "loc",     2662 },
+  { "loe",     6679 },
+  { "lof",     3929 },
+  { "log",     3928 },
+  { "loh",     4916 },
+  { "loi",     3946 },
+  { "loj",     3973 },
+  { "lok",     3938 },
+  { "lol",     4680 },
+  { "lom",     3947 },
+  { "lon",     4165 },
+  { "loo",     3952 },
+  { "lop",     3964 },
+  { "loq",     3923 },
+  { "lor",     7915 },
+  { "los",     3960 },
+  { "lot",     5562 },
+  { "lou",     3974 },
+  { "lov",     3965 },
+  { "low",     7446 },
+  { "lox",     3975 },
+  { "loy",     3937 },
+  { "loz",     3991 },
+  { "lpa",     3827 },
+  { "lpe",     3846 },
+  { "lpn",     3955 },
+  { "lpo",     3905 },
+  { "lpx",     3966 },
+  { "lqr",     3927 },
+  { "lra",     5994 },
+  { "lrc",     5254 },
+  { "lre",     3796 },
+  { "lrg",     3769 },
+  { "lri",     4297 },
+  { "lrk",     3922 },
+  { "lrl",     3774 },
+  { "lrm",     4301 },
+  { "lrn",     3967 },
+  { "lro",     3776 },
+  { "lrr",     7224 },
+  { "lrt",     3770 },
+  { "lrv",     3772 },
+  { "lrz",     3829 },
+  { "lsa",     3781 },
+  { "lsb",     1114 },
+  { "lsc",     175  },
+  { "lsd",     3909 },
+  { "lse",     4026 },
+  { "lsg",     4042 },
+  { "lsh",     3908 },
+  { "lsi",     3782 },
+  { "lsl",     3789 },
+  { "lsm",     6632 },
+  { "lsn",     7639 },
+  { "lso",     3767 },
+  { "lsp",     5637 },
+  { "lsr",     395  },
+  { "lss",     3783 },
+  { "lst",     7794 },
+  { "lsv",     7049 },
+  { "lsw",     6911 },
+  { "lsy",     4394 },
+  { "lt",      3915 },
+  { "ltc",     3784 },
+  { "ltg",     3785 },
+  { "lth",     7633 },
+  { "lti",     3853 },
+  { "ltn",     3788 },
+  { "lto",     7819 },
+  { "lts",     7356 },
+  { "ltu",     3787 },
+  { "ltz",     4035 },
+  { "lu",      3994 },
+  { "lua",     3995 },
+  { "lub",     3994 },
+  { "luc",     380  },
+  { "lud",     4001 },
+  { "lue",     4032 },
+  { "luf",     3792 },
+  { "lug",     2112 },
+  { "lui",     4008 },
+  { "luj",     4016 },
+  { "luk",     4017 },
+  { "lul",     5495 },
+  { "lum",     4007 },
+  { "lun",     4018 },
+  { "luo",     4023 },
+  { "lup",     4014 },
+  { "luq",     4000 },
+  { "lur",     3795 },
+  { "lus",     4027 },
+  { "lut",     4028 },
+  { "luu",     4012 },
+  { "luv",     4033 },
+  { "luw",     4022 },
+  { "luy",     4037 },
+  { "luz",     7184 },
+  { "lv",      3790 },
+  { "lva",     4142 },
+  { "lvi",     3800 },
+  { "lvk",     3801 },
+  { "lvs",     7255 },
+  { "lvu",     3854 },
+  { "lwa",     4038 },
+  { "lwe",     3855 },
+  { "lwg",     8199 },
+  { "lwh",     8354 },
+  { "lwl",     1834 },
+  { "lwm",     3765 },
+  { "lwo",     4034 },
+  { "lws",     4167 },
+  { "lwt",     3857 },
+  { "lwu",     3803 },
+  { "lww",     3856 },
+  { "lxm",     3718 },
+  { "lya",     3805 },
+  { "lyg",     4041 },
+  { "lyn",     4036 },
+  { "lzh",     3913 },
+  { "lzl",     3916 },
+  { "lzn",     3819 },
+  { "lzz",     3806 },
+  { "maa",     6715 },
+  { "mab",     8667 },
+  { "mac",     4068 },
+  { "mad",     4082 },
+  { "mae",     930  },
+  { "maf",     4086 },
+  { "mag",     4090 },
+  { "mah",     4345 },
+  { "mai",     4115 },
+  { "maj",     2765 },
+  { "mak",     4130 },
+  { "mal",     4170 },
+  { "mam",     4199 },
+  { "man",     4237 },
+  { "mao",     4286 },
+  { "map",     459  },
+  { "maq",     1362 },
+  { "mar",     4306 },
+  { "mas",     4358 },
+  { "mat",     6714 },
+  { "mau",     2523 },
+  { "mav",     6803 },
+  { "maw",     4210 },
+  { "max",     5210 },
+  { "may",     4169 },
+  { "maz",     1248 },
+  { "mba",     2453 },
+  { "mbb",     8307 },
+  { "mbc",     4075 },
+  { "mbd",     1646 },
+  { "mbe",     4659 },
+  { "mbf",     517  },
+  { "mbh",     4258 },
+  { "mbi",     2628 },
+  { "mbj",     4858 },
+  { "mbk",     4192 },
+  { "mbl",     4403 },
+  { "mbm",     5502 },
+  { "mbn",     4065 },
+  { "mbo",     4442 },
+  { "mbp",     4173 },
+  { "mbq",     4114 },
+  { "mbr",     5328 },
+  { "mbs",     6786 },
+  { "mbt",     4379 },
+  { "mbu",     4459 },
+  { "mbv",     4461 },
+  { "mbw",     4330 },
+  { "mbx",     4318 },
+  { "mby",     4490 },
+  { "mbz",     243  },
+  { "mca",     4063 },
+  { "mcb",     4070 },
+  { "mcc",     919  },
+  { "mcd",     6924 },
+  { "mce",     2730 },
+  { "mcf",     4386 },
+  { "mcg",     4292 },
+  { "mch",     4295 },
+  { "mci",     4514 },
+  { "mcj",     4823 },
+  { "mck",     4463 },
+  { "mcl",     4064 },
+  { "mcm",     4153 },
+  { "mcn",     4360 },
+  { "mco",     1435 },
+  { "mcp",     4126 },
+  { "mcq",     1954 },
+  { "mcr",     4501 },
+  { "mcs",     4207 },
+  { "mct",     4497 },
+  { "mcu",     1175 },
+  { "mcv",     4578 },
+  { "mcw",     4396 },
+  { "mcx",     4742 },
+  { "mcy",     7137 },
+  { "mcz",     4399 },
+  { "mda",     4077 },
+  { "mdb",     4710 },
+  { "mdc",     4178 },
+  { "mdd",     4462 },
+  { "mde",     4057 },
+  { "mdf",     4658 },
+  { "mdg",     4372 },
+  { "mdh",     4095 },
+  { "mdi",     4214 },
+  { "mdj",     4250 },
+  { "mdk",     4251 },
+  { "mdl",     4193 },
+  { "mdm",     4416 },
+  { "mdn",     4433 },
+  { "mdp",     4424 },
+  { "mdq",     4446 },
+  { "mdr",     4229 },
+  { "mds",     4322 },
+  { "mdt",     4439 },
+  { "mdu",     4445 },
+  { "mdv",     6760 },
+  { "mdw",     4449 },
+  { "mdx",     1677 },
+  { "mdy",     4177 },
+  { "mdz",     7310 },
+  { "mea",     4498 },
+  { "meb",     2615 },
+  { "mec",     4341 },
+  { "med",     4489 },
+  { "mee",     4496 },
+  { "mef",     4478 },
+  { "meg",     4469 },
+  { "meh",     7240 },
+  { "mei",     4559 },
+  { "mej",     4526 },
+  { "mek",     4483 },
+  { "mel",     1249 },
+  { "mem",     4245 },
+  { "men",     4494 },
+  { "meo",     3154 },
+  { "mep",     4599 },
+  { "meq",     4506 },
+  { "mer",     4510 },
+  { "mes",     4371 },
+  { "met",     4383 },
+  { "meu",     4729 },
+  { "mev",     4269 },
+  { "mew",     4054 },
+  { "mey",     2422 },
+  { "mez",     4499 },
+  { "mfa",     5709 },
+  { "mfb",     650  },
+  { "mfc",     4423 },
+  { "mfd",     4492 },
+  { "mfe",     4711 },
+  { "mff",     4877 },
+  { "mfg",     4639 },
+  { "mfh",     4375 },
+  { "mfi",     8195 },
+  { "mfj",     4477 },
+  { "mfk",     5209 },
+  { "mfl",     5919 },
+  { "mfm",     4315 },
+  { "mfn",     1483 },
+  { "mfo",     4436 },
+  { "mfp",     4131 },
+  { "mfq",     4626 },
+  { "mfr",     4343 },
+  { "mfs",     4525 },
+  { "mft",     4652 },
+  { "mfu",     4466 },
+  { "mfv",     4239 },
+  { "mfw",     4769 },
+  { "mfx",     4488 },
+  { "mfy",     4415 },
+  { "mfz",     4060 },
+  { "mg",      4154 },
+  { "mga",     4551 },
+  { "mgb",     4305 },
+  { "mgc",     4715 },
+  { "mgd",     4722 },
+  { "mge",     4256 },
+  { "mgf",     4139 },
+  { "mgg",     4746 },
+  { "mgh",     4135 },
+  { "mgi",     3881 },
+  { "mgj",     28   },
+  { "mgk",     4402 },
+  { "mgl",     4181 },
+  { "mgm",     4206 },
+  { "mgn",     4428 },
+  { "mgo",     4521 },
+  { "mgp",     1835 },
+  { "mgq",     4187 },
+  { "mgr",     4209 },
+  { "mgs",     4224 },
+  { "mgt",     4681 },
+  { "mgu",     4109 },
+  { "mgv",     4377 },
+  { "mgw",     4390 },
+  { "mgx",     5501 },
+  { "mgy",     4464 },
+  { "mgz",     4454 },
+  { "mh",      4345 },
+  { "mha",     4223 },
+  { "mhb",     4102 },
+  { "mhc",     4632 },
+  { "mhd",     4453 },
+  { "mhe",     816  },
+  { "mhf",     4201 },
+  { "mhg",     4317 },
+  { "mhh",     4369 },
+  { "mhi",     4051 },
+  { "mhj",     4638 },
+  { "mhk",     4787 },
+  { "mhl",     4395 },
+  { "mhm",     4136 },
+  { "mhn",     4842 },
+  { "mho",     4364 },
+  { "mhp",     602  },
+  { "mhq",     4227 },
+  { "mhr",     1838 },
+  { "mhs",     1109 },
+  { "mht",     4225 },
+  { "mhu",     1654 },
+  { "mhw",     4457 },
+  { "mhx",     4351 },
+  { "mhy",     4050 },
+  { "mhz",     4702 },
+  { "mi",      4286 },
+  { "mia",     4534 },
+  { "mib",     429  },
+  { "mic",     4532 },
+  { "mid",     4226 },
+  { "mie",     5418 },
+  { "mif",     4637 },
+  { "mig",     6725 },
+  { "mih",     1307 },
+  { "mii",     1337 },
+  { "mij",     10   },
+  { "mik",     4564 },
+  { "mil",     5750 },
+  { "mim",     163  },
+  { "min",     4577 },
+  { "mio",     5803 },
+  { "mip",     327  },
+  { "miq",     4841 },
+  { "mir",     2710 },
+  { "mis",     7978 },
+  { "mit",     7202 },
+  { "miu",     1151 },
+  { "miw",     147  },
+  { "mix",     4612 },
+  { "miy",     509  },
+  { "miz",     1437 },
+  { "mja",     4100 },
+  { "mjb",     4128 },
+  { "mjc",     6717 },
+  { "mjd",     5294 },
+  { "mje",     4813 },
+  { "mjg",     7828 },
+  { "mjh",     4831 },
+  { "mji",     3274 },
+  { "mjj",     4398 },
+  { "mjk",     4389 },
+  { "mjl",     4235 },
+  { "mjm",     4470 },
+  { "mjn",     4048 },
+  { "mjo",     4159 },
+  { "mjp",     4160 },
+  { "mjq",     4161 },
+  { "mjr",     4164 },
+  { "mjs",     4602 },
+  { "mjt",     6808 },
+  { "mju",     4267 },
+  { "mjv",     4268 },
+  { "mjw",     3070 },
+  { "mjx",     4098 },
+  { "mjy",     4101 },
+  { "mjz",     4121 },
+  { "mk",      4068 },
+  { "mka",     4451 },
+  { "mkb",     4147 },
+  { "mkc",     7006 },
+  { "mkd",     4068 },
+  { "mke",     4401 },
+  { "mkf",     4614 },
+  { "mkg",     4124 },
+  { "mkh",     4676 },
+  { "mki",     1633 },
+  { "mkj",     4653 },
+  { "mkk",     1145 },
+  { "mkl",     4655 },
+  { "mkm",     4654 },
+  { "mkn",     3582 },
+  { "mko",     4582 },
+  { "mkp",     4647 },
+  { "mkq",     750  },
+  { "mkr",     4162 },
+  { "mks",     7002 },
+  { "mkt",     8063 },
+  { "mku",     3404 },
+  { "mkv",     4087 },
+  { "mkw",     3315 },
+  { "mkx",     3284 },
+  { "mky",     1800 },
+  { "mkz",     4129 },
+  { "ml",      4170 },
+  { "mla",     4191 },
+  { "mlb",     4460 },
+  { "mlc",     1186 },
+  { "mld",     4156 },
+  { "mle",     4218 },
+  { "mlf",     4148 },
+  { "mlg",     4154 },
+  { "mlh",     4287 },
+  { "mli",     4189 },
+  { "mlj",     4566 },
+  { "mlk",     2633 },
+  { "mll",     4195 },
+  { "mlm",     4770 },
+  { "mln",     4158 },
+  { "mlo",     4621 },
+  { "mlp",     687  },
+  { "mlq",     8327 },
+  { "mlr",     8064 },
+  { "mls",     4359 },
+  { "mlt",     4194 },
+  { "mlu",     7703 },
+  { "mlv",     4728 },
+  { "mlw",     4667 },
+  { "mlx",     4182 },
+  { "mlz",     4172 },
+  { "mma",     4200 },
+  { "mmb",     4673 },
+  { "mmc",     4539 },
+  { "mmd",     4284 },
+  { "mme",     4083 },
+  { "mmf",     4785 },
+  { "mmg",     5191 },
+  { "mmh",     4481 },
+  { "mmi",     4807 },
+  { "mmj",     4122 },
+  { "mmk",     4767 },
+  { "mml",     4215 },
+  { "mmm",     4108 },
+  { "mmn",     4203 },
+  { "mmo",     4254 },
+  { "mmp",     6975 },
+  { "mmq",     4806 },
+  { "mmr",     8346 },
+  { "mmt",     4157 },
+  { "mmu",     4622 },
+  { "mmv",     4597 },
+  { "mmw",     1909 },
+  { "mmx",     4079 },
+  { "mmy",     4560 },
+  { "mmz",     4059 },
+  { "mn",      4685 },
+  { "mna",     4458 },
+  { "mnb",     4778 },
+  { "mnc",     4221 },
+  { "mnd",     4679 },
+  { "mne",     4853 },
+  { "mnf",     4783 },
+  { "mng",     1842 },
+  { "mnh",     4689 },
+  { "mni",     4264 },
+  { "mnj",     4792 },
+  { "mnk",     4238 },
+  { "mnl",     7636 },
+  { "mnm",     4288 },
+  { "mnn",     7187 },
+  { "mno",     4270 },
+  { "mnp",     4569 },
+  { "mnq",     4590 },
+  { "mnr",     4691 },
+  { "mns",     4273 },
+  { "mnt",     4414 },
+  { "mnu",     4503 },
+  { "mnv",     6024 },
+  { "mnw",     4675 },
+  { "mnx",     4262 },
+  { "mny",     4280 },
+  { "mnz",     4687 },
+  { "moa",     4827 },
+  { "moc",     4633 },
+  { "mod",     4627 },
+  { "moe",     2660 },
+  { "mof",     4643 },
+  { "mog",     4686 },
+  { "moh",     4642 },
+  { "moi",     4444 },
+  { "moj",     4697 },
+  { "mok",     4718 },
+  { "mom",     4259 },
+  { "mon",     4685 },
+  { "moo",     4692 },
+  { "mop",     4700 },
+  { "moq",     4701 },
+  { "mor",     4712 },
+  { "mos",     4726 },
+  { "mot",     702  },
+  { "mou",     4640 },
+  { "mov",     4641 },
+  { "mow",     4645 },
+  { "mox",     4663 },
+  { "moy",     6934 },
+  { "moz",     4768 },
+  { "mpa",     4744 },
+  { "mpb",     4155 },
+  { "mpc",     4247 },
+  { "mpd",     4071 },
+  { "mpe",     4119 },
+  { "mpg",     4308 },
+  { "mph",     4393 },
+  { "mpi",     4739 },
+  { "mpj",     4349 },
+  { "mpk",     4431 },
+  { "mpl",     4557 },
+  { "mpm",     8636 },
+  { "mpn",     4581 },
+  { "mpo",     4609 },
+  { "mpp",     4561 },
+  { "mpq",     4392 },
+  { "mpr",     8066 },
+  { "mps",     1523 },
+  { "mpt",     4535 },
+  { "mpu",     4144 },
+  { "mpv",     4789 },
+  { "mpw",     4290 },
+  { "mpx",     4603 },
+  { "mpy",     4289 },
+  { "mpz",     4741 },
+  { "mqa",     4058 },
+  { "mqb",     4456 },
+  { "mqc",     4257 },
+  { "mqe",     4378 },
+  { "mqf",     4674 },
+  { "mqg",     3449 },
+  { "mqh",     7700 },
+  { "mqi",     4333 },
+  { "mqj",     4205 },
+  { "mqk",     5971 },
+  { "mql",     4438 },
+  { "mqm",     7128 },
+  { "mqn",     4717 },
+  { "mqo",     4635 },
+  { "mqp",     4263 },
+  { "mqq",     4589 },
+  { "mqr",     4236 },
+  { "mqs",     8293 },
+  { "mqt",     4650 },
+  { "mqu",     4231 },
+  { "mqv",     4723 },
+  { "mqw",     4804 },
+  { "mqx",     4211 },
+  { "mqy",     4255 },
+  { "mqz",     5660 },
+  { "mr",      4306 },
+  { "mra",     4618 },
+  { "mrb",     4332 },
+  { "mrc",     4323 },
+  { "mrd",     8325 },
+  { "mre",     4347 },
+  { "mrf",     1906 },
+  { "mrg",     4604 },
+  { "mrh",     4296 },
+  { "mri",     4286 },
+  { "mrj",     8328 },
+  { "mrk",     2483 },
+  { "mrl",     4721 },
+  { "mrm",     4508 },
+  { "mrn",     1311 },
+  { "mro",     4750 },
+  { "mrp",     4719 },
+  { "mrq",     5206 },
+  { "mrr",     4321 },
+  { "mrs",     4299 },
+  { "mrt",     4314 },
+  { "mru",     4688 },
+  { "mrv",     4246 },
+  { "mrw",     4303 },
+  { "mrx",     4310 },
+  { "mry",     4233 },
+  { "mrz",     4328 },
+  { "ms",      4169 },
+  { "msa",     4169 },
+  { "msb",     4361 },
+  { "msc",     6752 },
+  { "msd",     8644 },
+  { "mse",     4809 },
+  { "msf",     4485 },
+  { "msg",     4703 },
+  { "msh",     4365 },
+  { "msi",     6637 },
+  { "msj",     4047 },
+  { "msk",     4272 },
+  { "msl",     4666 },
+  { "msm",     94   },
+  { "msn",     8113 },
+  { "mso",     4672 },
+  { "msp",     4335 },
+  { "msq",     1148 },
+  { "msr",     4683 },
+  { "mss",     8294 },
+  { "mst",     1209 },
+  { "msu",     4815 },
+  { "msv",     4370 },
+  { "msw",     4274 },
+  { "msx",     4707 },
+  { "msy",     393  },
+  { "msz",     4670 },
+  { "mt",      4194 },
+  { "mta",     1467 },
+  { "mtb",     317  },
+  { "mtc",     4791 },
+  { "mtd",     4755 },
+  { "mte",     4690 },
+  { "mtf",     4798 },
+  { "mtg",     7976 },
+  { "mth",     4788 },
+  { "mti",     4117 },
+  { "mtj",     4725 },
+  { "mtk",     4437 },
+  { "mtl",     4695 },
+  { "mtm",     4384 },
+  { "mtn",     4374 },
+  { "mto",     7777 },
+  { "mtp",     8359 },
+  { "mtq",     4794 },
+  { "mtr",     4523 },
+  { "mts",     8631 },
+  { "mtt",     4727 },
+  { "mtu",     7894 },
+  { "mtv",     401  },
+  { "mtw",     7161 },
+  { "mtx",     7644 },
+  { "mty",     4855 },
+  { "mua",     4782 },
+  { "mub",     4757 },
+  { "muc",     121  },
+  { "mud",     4475 },
+  { "mue",     4472 },
+  { "mug",     4810 },
+  { "muh",     4844 },
+  { "mui",     4812 },
+  { "muj",     4062 },
+  { "muk",     4765 },
+  { "mul",     4774 },
+  { "mum",     4118 },
+  { "mun",     4779 },
+  { "muo",     5391 },
+  { "mup",     4196 },
+  { "muq",     1856 },
+  { "mur",     4800 },
+  { "mus",     1475 },
+  { "mut",     8332 },
+  { "muu",     8459 },
+  { "muv",     4817 },
+  { "mux",     931  },
+  { "muy",     4820 },
+  { "muz",     4802 },
+  { "mva",     4217 },
+  { "mvb",     4387 },
+  { "mvd",     4208 },
+  { "mve",     4353 },
+  { "mvf",     5743 },
+  { "mvg",     8647 },
+  { "mvh",     4772 },
+  { "mvi",     4615 },
+  { "mvk",     4484 },
+  { "mvl",     4430 },
+  { "mvm",     4819 },
+  { "mvn",     4579 },
+  { "mvo",     4340 },
+  { "mvp",     1758 },
+  { "mvq",     4636 },
+  { "mvr",     4307 },
+  { "mvs",     4373 },
+  { "mvt",     4745 },
+  { "mvu",     4312 },
+  { "mvv",     7364 },
+  { "mvw",     4072 },
+  { "mvx",     4502 },
+  { "mvy",     2652 },
+  { "mvz",     4519 },
+  { "mwa",     4829 },
+  { "mwb",     2862 },
+  { "mwc",     361  },
+  { "mwd",     4759 },
+  { "mwe",     4830 },
+  { "mwf",     4801 },
+  { "mwg",     107  },
+  { "mwh",     4730 },
+  { "mwi",     3679 },
+  { "mwj",     4186 },
+  { "mwk",     3312 },
+  { "mwl",     4594 },
+  { "mwm",     6777 },
+  { "mwn",     5359 },
+  { "mwo",     1243 },
+  { "mwp",     2945 },
+  { "mwq",     4843 },
+  { "mwr",     4354 },
+  { "mws",     4832 },
+  { "mwt",     4651 },
+  { "mwu",     4607 },
+  { "mwv",     4500 },
+  { "mww",     2476 },
+  { "mwx",     4473 },
+  { "mwy",     4724 },
+  { "mwz",     4648 },
+  { "mxa",     5295 },
+  { "mxb",     7609 },
+  { "mxc",     4281 },
+  { "mxd",     4634 },
+  { "mxe",     4487 },
+  { "mxf",     4184 },
+  { "mxg",     4427 },
+  { "mxh",     4824 },
+  { "mxi",     4738 },
+  { "mxj",     4563 },
+  { "mxk",     4696 },
+  { "mxl",     4404 },
+  { "mxm",     4504 },
+  { "mxn",     4646 },
+  { "mxo",     4450 },
+  { "mxp",     7698 },
+  { "mxq",     2856 },
+  { "mxr",     4797 },
+  { "mxs",     2531 },
+  { "mxt",     2772 },
+  { "mxu",     4076 },
+  { "mxv",     4522 },
+  { "mxw",     4894 },
+  { "mxx",     4103 },
+  { "mxy",     7148 },
+  { "mxz",     1246 },
+  { "my",      1107 },
+  { "mya",     1107 },
+  { "myb",     4435 },
+  { "myc",     4410 },
+  { "myd",     4302 },
+  { "mye",     4835 },
+  { "myf",     618  },
+  { "myg",     4275 },
+  { "myh",     4127 },
+  { "myi",     4574 },
+  { "myj",     4249 },
+  { "myk",     4204 },
+  { "myl",     4669 },
+  { "mym",     4468 },
+  { "myn",     4407 },
+  { "myo",     279  },
+  { "myp",     5807 },
+  { "myq",     2043 },
+  { "myr",     4790 },
+  { "mys",     4517 },
+  { "myt",     6737 },
+  { "myu",     4786 },
+  { "myv",     1951 },
+  { "myw",     4821 },
+  { "myx",     4356 },
+  { "myy",     4074 },
+  { "myz",     1422 },
+  { "mza",     6764 },
+  { "mzb",     7855 },
+  { "mzc",     4078 },
+  { "mzd",     4188 },
+  { "mze",     4704 },
+  { "mzg",     4677 },
+  { "mzh",     8358 },
+  { "mzi",     2740 },
+  { "mzj",     4279 },
+  { "mzk",     5112 },
+  { "mzl",     4422 },
+  { "mzm",     4777 },
+  { "mzn",     4420 },
+  { "mzo",     4380 },
+  { "mzp",     4734 },
+  { "mzq",     4708 },
+  { "mzr",     4355 },
+  { "mzs",     4066 },
+  { "mzt",     4591 },
+  { "mzu",     2641 },
+  { "mzv",     4282 },
+  { "mzw",     1591 },
+  { "mzx",     4400 },
+  { "mzy",     4737 },
+  { "mzz",     4106 },
+  { "na",      4937 },
+  { "naa",     4893 },
+  { "nab",     7190 },
+  { "nac",     4912 },
+  { "nad",     5118 },
+  { "nae",     4872 },
+  { "naf",     4854 },
+  { "nag",     4863 },
+  { "nah",     4869 },
+  { "nai",     5192 },
+  { "naj",     4882 },
+  { "nak",     4875 },
+  { "nal",     4881 },
+  { "nam",     5030 },
+  { "nan",     4571 },
+  { "nao",     4850 },
+  { "nap",     4986 },
+  { "naq",     3247 },
+  { "nar",     2603 },
+  { "nas",     4852 },
+  { "nat",     1220 },
+  { "nau",     4937 },
+  { "nav",     4938 },
+  { "naw",     4943 },
+  { "nax",     4878 },
+  { "nay",     5047 },
+  { "naz",     1434 },
+  { "nb",      5304 },
+  { "nba",     5376 },
+  { "nbb",     4968 },
+  { "nbc",     1296 },
+  { "nbd",     5059 },
+  { "nbe",     3403 },
+  { "nbf",     4944 },
+  { "nbg",     4864 },
+  { "nbh",     5029 },
+  { "nbi",     4283 },
+  { "nbj",     5043 },
+  { "nbk",     4876 },
+  { "nbl",     7130 },
+  { "nbm",     5055 },
+  { "nbn",     3590 },
+  { "nbo",     5163 },
+  { "nbp",     5165 },
+  { "nbq",     5066 },
+  { "nbr",     5335 },
+  { "nbs",     4892 },
+  { "nbt",     4847 },
+  { "nbu",     6590 },
+  { "nbv",     5026 },
+  { "nbw",     7191 },
+  { "nbx",     5095 },
+  { "nby",     5132 },
+  { "nca",     2746 },
+  { "ncb",     1252 },
+  { "ncc",     5848 },
+  { "ncd",     4856 },
+  { "nce",     8491 },
+  { "ncf",     5309 },
+  { "ncg",     5141 },
+  { "nch",     1239 },
+  { "nci",     1424 },
+  { "ncj",     5270 },
+  { "nck",     4849 },
+  { "ncl",     4540 },
+  { "ncm",     4888 },
+  { "ncn",     4935 },
+  { "nco",     6976 },
+  { "ncp",     4953 },
+  { "ncq",     5250 },
+  { "ncr",     4948 },
+  { "ncs",     5109 },
+  { "nct",     1387 },
+  { "ncu",     1398 },
+  { "ncx",     1259 },
+  { "ncz",     4928 },
+  { "nd",      5212 },
+  { "nda",     4958 },
+  { "ndb",     3190 },
+  { "ndc",     4959 },
+  { "ndd",     4961 },
+  { "nde",     5212 },
+  { "ndf",     4857 },
+  { "ndg",     4964 },
+  { "ndh",     4954 },
+  { "ndi",     6690 },
+  { "ndj",     4956 },
+  { "ndk",     4952 },
+  { "ndl",     4970 },
+  { "ndm",     4955 },
+  { "ndn",     5092 },
+  { "ndo",     4974 },
+  { "ndp",     4966 },
+  { "ndq",     4972 },
+  { "ndr",     4975 },
+  { "nds",     3978 },
+  { "ndt",     4981 },
+  { "ndu",     1738 },
+  { "ndv",     4982 },
+  { "ndw",     4967 },
+  { "ndx",     4978 },
+  { "ndy",     4031 },
+  { "ndz",     4969 },
+  { "ne",      5008 },
+  { "nea",     1844 },
+  { "neb",     7780 },
+  { "nec",     4987 },
+  { "ned",     4960 },
+  { "nee",     5404 },
+  { "nef",     4988 },
+  { "neg",     4991 },
+  { "neh",     5378 },
+  { "nei",     5005 },
+  { "nej",     4995 },
+  { "nek",     4996 },
+  { "nem",     4999 },
+  { "nen",     5003 },
+  { "neo",     5403 },
+  { "nep",     5008 },
+  { "neq",     5199 },
+  { "ner",     8475 },
+  { "nes",     838  },
+  { "net",     5010 },
+  { "neu",     5004 },
+  { "nev",     5351 },
+  { "new",     5013 },
+  { "nex",     4998 },
+  { "ney",     5014 },
+  { "nez",     5015 },
+  { "nfa",     1628 },
+  { "nfd",     103  },
+  { "nfl",     502  },
+  { "nfr",     4859 },
+  { "nfu",     4530 },
+  { "ng",      4974 },
+  { "nga",     5057 },
+  { "ngb",     5258 },
+  { "ngc",     5079 },
+  { "ngd",     5034 },
+  { "nge",     5062 },
+  { "ngf",     7783 },
+  { "ngg",     5056 },
+  { "ngh",     5406 },
+  { "ngi",     5073 },
+  { "ngj",     5068 },
+  { "ngk",     1540 },
+  { "ngl",     3953 },
+  { "ngm",     5050 },
+  { "ngn",     5101 },
+  { "ngo",     5084 },
+  { "ngp",     5087 },
+  { "ngq",     5096 },
+  { "ngr",     1927 },
+  { "ngs",     2358 },
+  { "ngt",     3485 },
+  { "ngu",     2298 },
+  { "ngv",     4866 },
+  { "ngw",     5099 },
+  { "ngx",     5067 },
+  { "ngy",     7638 },
+  { "ngz",     5094 },
+  { "nha",     5103 },
+  { "nhb",     798  },
+  { "nhc",     7346 },
+  { "nhd",     1365 },
+  { "nhe",     1824 },
+  { "nhf",     5106 },
+  { "nhg",     7597 },
+  { "nhh",     4868 },
+  { "nhi",     8675 },
+  { "nhk",     2712 },
+  { "nhm",     4705 },
+  { "nhn",     1251 },
+  { "nho",     7413 },
+  { "nhp",     2714 },
+  { "nhq",     2524 },
+  { "nhr",     4917 },
+  { "nht",     5505 },
+  { "nhu",     5184 },
+  { "nhv",     7551 },
+  { "nhw",     8315 },
+  { "nhx",     2713 },
+  { "nhy",     5261 },
+  { "nhz",     6762 },
+  { "nia",     5107 },
+  { "nib",     4874 },
+  { "nic",     5111 },
+  { "nid",     5033 },
+  { "nie",     5110 },
+  { "nif",     4993 },
+  { "nig",     5023 },
+  { "nih",     5381 },
+  { "nii",     5117 },
+  { "nij",     5021 },
+  { "nik",     7192 },
+  { "nil",     5120 },
+  { "nim",     5121 },
+  { "nin",     5137 },
+  { "nio",     5032 },
+  { "niq",     4901 },
+  { "nir",     5126 },
+  { "nis",     5127 },
+  { "nit",     7147 },
+  { "niu",     5146 },
+  { "niv",     2208 },
+  { "niw",     5128 },
+  { "nix",     2441 },
+  { "niy",     5072 },
+  { "niz",     5134 },
+  { "nja",     5401 },
+  { "njb",     5170 },
+  { "njd",     4973 },
+  { "njh",     3971 },
+  { "nji",     2293 },
+  { "njj",     5151 },
+  { "njl",     5149 },
+  { "njm",     285  },
+  { "njn",     3865 },
+  { "njo",     319  },
+  { "njr",     5152 },
+  { "njs",     5139 },
+  { "njt",     4984 },
+  { "nju",     5018 },
+  { "njx",     3577 },
+  { "njy",     5153 },
+  { "njz",     5387 },
+  { "nka",     5162 },
+  { "nkb",     3248 },
+  { "nkc",     5159 },
+  { "nkd",     3351 },
+  { "nke",     1742 },
+  { "nkf",     2664 },
+  { "nkg",     4994 },
+  { "nkh",     3237 },
+  { "nki",     7618 },
+  { "nkj",     4873 },
+  { "nkk",     5174 },
+  { "nkm",     4887 },
+  { "nkn",     5155 },
+  { "nko",     5160 },
+  { "nkp",     5145 },
+  { "nkq",     5154 },
+  { "nkr",     5333 },
+  { "nks",     5193 },
+  { "nkt",     5383 },
+  { "nku",     1010 },
+  { "nkv",     5382 },
+  { "nkw",     5164 },
+  { "nkx",     5161 },
+  { "nkz",     5156 },
+  { "nl",      1767 },
+  { "nla",     5077 },
+  { "nlc",     4879 },
+  { "nld",     1767 },
+  { "nle",     1802 },
+  { "nlg",     2170 },
+  { "nli",     2262 },
+  { "nlj",     5354 },
+  { "nlk",     5136 },
+  { "nll",     5116 },
+  { "nlm",     4266 },
+  { "nln",     1757 },
+  { "nlo",     5086 },
+  { "nlq",     3763 },
+  { "nlr",     5044 },
+  { "nlu",     4949 },
+  { "nlv",     5531 },
+  { "nlw",     8167 },
+  { "nlx",     4867 },
+  { "nly",     5356 },
+  { "nlz",     4884 },
+  { "nma",     4300 },
+  { "nmb",     860  },
+  { "nmc",     5025 },
+  { "nmd",     4979 },
+  { "nme",     4837 },
+  { "nmf",     7461 },
+  { "nmg",     3645 },
+  { "nmh",     4693 },
+  { "nmi",     5355 },
+  { "nmj",     5078 },
+  { "nmk",     4886 },
+  { "nml",     4962 },
+  { "nmm",     4219 },
+  { "nmn",     8754 },
+  { "nmo",     4736 },
+  { "nmp",     5124 },
+  { "nmq",     4889 },
+  { "nmr",     5125 },
+  { "nms",     3851 },
+  { "nmt",     4895 },
+  { "nmu",     5221 },
+  { "nmv",     5028 },
+  { "nmw",     5129 },
+  { "nmx",     4885 },
+  { "nmy",     4897 },
+  { "nmz",     4942 },
+  { "nn",      5305 },
+  { "nna",     5368 },
+  { "nnb",     4900 },
+  { "nnc",     4899 },
+  { "nnd",     8282 },
+  { "nne",     5036 },
+  { "nnf",     5020 },
+  { "nng",     4329 },
+  { "nnh",     5069 },
+  { "nni",     5213 },
+  { "nnj",     5365 },
+  { "nnk",     4904 },
+  { "nnl",     5274 },
+  { "nnm",     4890 },
+  { "nnn",     5065 },
+  { "nno",     5305 },
+  { "nnp",     8193 },
+  { "nnq",     5071 },
+  { "nnr",     4921 },
+  { "nns",     5135 },
+  { "nnt",     4906 },
+  { "nnu",     1775 },
+  { "nnv",     5325 },
+  { "nnw",     7194 },
+  { "nnx",     5080 },
+  { "nny",     5367 },
+  { "nnz",     4950 },
+  { "no",      5307 },
+  { "noa",     8405 },
+  { "nob",     5304 },
+  { "noc",     5327 },
+  { "nod",     5283 },
+  { "noe",     5123 },
+  { "nof",     5176 },
+  { "nog",     5171 },
+  { "noh",     5179 },
+  { "noi",     5173 },
+  { "noj",     5181 },
+  { "nok",     5182 },
+  { "nol",     5178 },
+  { "nom",     5169 },
+  { "non",     5476 },
+  { "noo",     5185 },
+  { "nop",     5336 },
+  { "noq",     5081 },
+  { "nor",     5307 },
+  { "nos",     1845 },
+  { "not",     5177 },
+  { "nou",     1980 },
+  { "nov",     5312 },
+  { "now",     5357 },
+  { "noy",     5313 },
+  { "noz",     4946 },
+  { "npa",     4910 },
+  { "npb",     5345 },
+  { "npg",     5853 },
+  { "nph",     5765 },
+  { "npi",     5007 },
+  { "npl",     7150 },
+  { "npn",     4678 },
+  { "npo",     5832 },
+  { "nps",     5138 },
+  { "npu",     5886 },
+  { "npx",     5172 },
+  { "npy",     4909 },
+  { "nqg",     7189 },
+  { "nqk",     3586 },
+  { "nql",     5064 },
+  { "nqm",     4971 },
+  { "nqn",     5000 },
+  { "nqo",     4846 },
+  { "nqq",     3664 },
+  { "nqt",     5318 },
+  { "nqy",     157  },
+  { "nr",      7130 },
+  { "nra",     5075 },
+  { "nrb",     4911 },
+  { "nrc",     5187 },
+  { "nre",     7207 },
+  { "nrf",     2866 },
+  { "nrg",     4913 },
+  { "nri",     1376 },
+  { "nrk",     5045 },
+  { "nrl",     5046 },
+  { "nrm",     4918 },
+  { "nrn",     5188 },
+  { "nrp",     5214 },
+  { "nrr",     5189 },
+  { "nrt",     5248 },
+  { "nru",     4920 },
+  { "nrx",     5097 },
+  { "nrz",     3719 },
+  { "nsa",     6746 },
+  { "nsb",     3982 },
+  { "nsc",     5315 },
+  { "nsd",     7193 },
+  { "nse",     5314 },
+  { "nsf",     5300 },
+  { "nsg",     5049 },
+  { "nsh",     5085 },
+  { "nsi",     5115 },
+  { "nsk",     4924 },
+  { "nsl",     5306 },
+  { "nsm",     7293 },
+  { "nsn",     4992 },
+  { "nso",     5726 },
+  { "nsp",     5006 },
+  { "nsq",     5277 },
+  { "nsr",     4334 },
+  { "nss",     4880 },
+  { "nst",     7489 },
+  { "nsu",     6988 },
+  { "nsv",     7235 },
+  { "nsw",     4939 },
+  { "nsx",     5316 },
+  { "nsy",     4922 },
+  { "nsz",     5140 },
+  { "ntd",     5284 },
+  { "nte",     4930 },
+  { "ntg",     5038 },
+  { "nti",     4931 },
+  { "ntj",     5016 },
+  { "ntk",     2616 },
+  { "ntm",     4929 },
+  { "nto",     5319 },
+  { "ntp",     5282 },
+  { "ntr",     1601 },
+  { "nts",     4925 },
+  { "ntu",     4932 },
+  { "ntw",     5310 },
+  { "ntx",     7462 },
+  { "nty",     4276 },
+  { "ntz",     4926 },
+  { "nua",     8643 },
+  { "nub",     5322 },
+  { "nuc",     5330 },
+  { "nud",     5022 },
+  { "nue",     5093 },
+  { "nuf",     5348 },
+  { "nug",     5342 },
+  { "nuh",     4980 },
+  { "nui",     5090 },
+  { "nuj",     5390 },
+  { "nuk",     5349 },
+  { "nul",     5347 },
+  { "num",     5144 },
+  { "nun",     304  },
+  { "nuo",     5098 },
+  { "nup",     5346 },
+  { "nuq",     5331 },
+  { "nur",     5334 },
+  { "nus",     5324 },
+  { "nut",     5341 },
+  { "nuu",     5060 },
+  { "nuv",     5260 },
+  { "nuw",     5088 },
+  { "nux",     4480 },
+  { "nuy",     5343 },
+  { "nuz",     7699 },
+  { "nv",      4938 },
+  { "nvh",     4923 },
+  { "nvm",     4891 },
+  { "nvo",     5389 },
+  { "nwa",     4941 },
+  { "nwb",     5350 },
+  { "nwc",     1425 },
+  { "nwe",     5100 },
+  { "nwg",     5053 },
+  { "nwi",     7229 },
+  { "nwm",     5358 },
+  { "nwo",     4936 },
+  { "nwr",     4940 },
+  { "nww",     4983 },
+  { "nwx",     4556 },
+  { "nwy",     5311 },
+  { "nxa",     4933 },
+  { "nxd",     5035 },
+  { "nxe",     4865 },
+  { "nxg",     5017 },
+  { "nxi",     5131 },
+  { "nxk",     3358 },
+  { "nxl",     7131 },
+  { "nxm",     5339 },
+  { "nxn",     5052 },
+  { "nxo",     4957 },
+  { "nxq",     4945 },
+  { "nxr",     5133 },
+  { "nxu",     4914 },
+  { "nxx",     4861 },
+  { "ny",      5369 },
+  { "nya",     5369 },
+  { "nyb",     5366 },
+  { "nyc",     5364 },
+  { "nyd",     5392 },
+  { "nye",     5377 },
+  { "nyf",     2217 },
+  { "nyg",     5386 },
+  { "nyh",     5384 },
+  { "nyi",     207  },
+  { "nyj",     5363 },
+  { "nyk",     5361 },
+  { "nyl",     5379 },
+  { "nym",     5360 },
+  { "nyn",     5370 },
+  { "nyo",     5393 },
+  { "nyp",     5362 },
+  { "nyq",     4947 },
+  { "nyr",     5380 },
+  { "nys",     5395 },
+  { "nyt",     5375 },
+  { "nyu",     5396 },
+  { "nyv",     5394 },
+  { "nyw",     5374 },
+  { "nyx",     5039 },
+  { "nyy",     5353 },
+  { "nza",     7652 },
+  { "nzb",     5150 },
+  { "nzd",     5398 },
+  { "nzi",     5402 },
+  { "nzk",     5400 },
+  { "nzm",     8701 },
+  { "nzs",     5012 },
+  { "nzu",     7541 },
+  { "nzy",     5399 },
+  { "nzz",     4903 },
+  { "oaa",     5539 },
+  { "oac",     5537 },
+  { "oar",     5451 },
+  { "oav",     5452 },
+  { "obi",     5410 },
+  { "obk",     7164 },
+  { "obl",     5411 },
+  { "obm",     4625 },
+  { "obo",     5412 },
+  { "obr",     5454 },
+  { "obt",     5453 },
+  { "obu",     5415 },
+  { "oc",      5417 },
+  { "oca",     5416 },
+  { "och",     5456 },
+  { "oci",     5417 },
+  { "ocm",     5455 },
+  { "oco",     5457 },
+  { "ocu",     447  },
+  { "oda",     5425 },
+  { "odk",     5420 },
+  { "odt",     5458 },
+  { "odu",     5424 },
+  { "ofo",     5428 },
+  { "ofs",     5461 },
+  { "ofu",     1875 },
+  { "ogb",     5430 },
+  { "ogc",     5429 },
+  { "oge",     5462 },
+  { "ogg",     5431 },
+  { "ogo",     3223 },
+  { "ogu",     5432 },
+  { "oht",     5464 },
+  { "ohu",     5465 },
+  { "oia",     5434 },
+  { "oie",     5444 },
+  { "oin",     2654 },
+  { "oj",      5435 },
+  { "ojb",     5301 },
+  { "ojc",     1253 },
+  { "ojg",     1846 },
+  { "oji",     5435 },
+  { "ojp",     5467 },
+  { "ojs",     6909 },
+  { "ojv",     5521 },
+  { "ojw",     8335 },
+  { "oka",     5437 },
+  { "okb",     5442 },
+  { "okc",     3329 },
+  { "okd",     5443 },
+  { "oke",     5448 },
+  { "okg",     3359 },
+  { "okh",     3419 },
+  { "oki",     5439 },
+  { "okj",     5441 },
+  { "okk",     3638 },
+  { "okl",     5468 },
+  { "okm",     4553 },
+  { "okn",     5438 },
+  { "oko",     5470 },
+  { "okr",     3301 },
+  { "oks",     5440 },
+  { "oku",     5450 },
+  { "okv",     5540 },
+  { "okx",     5447 },
+  { "okz",     5469 },
+  { "ola",     8178 },
+  { "old",     4630 },
+  { "ole",     5490 },
+  { "olk",     5491 },
+  { "olm",     5493 },
+  { "olo",     3920 },
+  { "olr",     5494 },
+  { "olt",     5471 },
+  { "olu",     3616 },
+  { "om",      5543 },
+  { "oma",     5499 },
+  { "omb",     1793 },
+  { "omc",     4631 },
+  { "ome",     5504 },
+  { "omg",     5498 },
+  { "omi",     5506 },
+  { "omk",     5507 },
+  { "oml",     5503 },
+  { "omn",     4588 },
+  { "omo",     8039 },
+  { "omp",     5473 },
+  { "omq",     5557 },
+  { "omr",     5474 },
+  { "omt",     5509 },
+  { "omu",     5510 },
+  { "omv",     5508 },
+  { "omw",     7135 },
+  { "omx",     5475 },
+  { "omy",     5472 },
+  { "ona",     5511 },
+  { "onb",     3899 },
+  { "one",     5512 },
+  { "ong",     5492 },
+  { "oni",     5515 },
+  { "onj",     5516 },
+  { "onk",     2880 },
+  { "onn",     5518 },
+  { "ono",     5519 },
+  { "onp",     6794 },
+  { "onr",     5263 },
+  { "ons",     5517 },
+  { "ont",     5520 },
+  { "onu",     7987 },
+  { "onw",     5477 },
+  { "onx",     5514 },
+  { "ood",     7722 },
+  { "oog",     5513 },
+  { "oon",     8744 },
+  { "oor",     5522 },
+  { "oos",     5478 },
+  { "opa",     5446 },
+  { "opk",     3410 },
+  { "opm",     5449 },
+  { "opo",     5523 },
+  { "opt",     5524 },
+  { "opy",     5426 },
+  { "or",      5530 },
+  { "ora",     5538 },
+  { "orc",     5532 },
+  { "ore",     5528 },
+  { "org",     5529 },
+  { "orh",     5544 },
+  { "ori",     5530 },
+  { "orm",     5543 },
+  { "orn",     5525 },
+  { "oro",     5542 },
+  { "orr",     5546 },
+  { "ors",     5526 },
+  { "ort",     58   },
+  { "oru",     5534 },
+  { "orv",     5481 },
+  { "orw",     5535 },
+  { "orx",     5536 },
+  { "ory",     5421 },
+  { "orz",     5533 },
+  { "os",      5553 },
+  { "osa",     5548 },
+  { "osc",     5550 },
+  { "osi",     5551 },
+  { "osn",     5484 },
+  { "oso",     5552 },
+  { "osp",     5483 },
+  { "oss",     5553 },
+  { "ost",     5549 },
+  { "osu",     7196 },
+  { "osx",     5482 },
+  { "ota",     5561 },
+  { "otb",     5486 },
+  { "otd",     5554 },
+  { "ote",     4528 },
+  { "oti",     5556 },
+  { "otk",     5487 },
+  { "otl",     7659 },
+  { "otm",     1822 },
+  { "otn",     7565 },
+  { "oto",     5558 },
+  { "otq",     5957 },
+  { "otr",     5559 },
+  { "ots",     1961 },
+  { "ott",     7559 },
+  { "otu",     5563 },
+  { "otw",     5560 },
+  { "otx",     7606 },
+  { "oty",     5485 },
+  { "otz",     2743 },
+  { "oua",     7367 },
+  { "oub",     2226 },
+  { "oue",     5565 },
+  { "oui",     5488 },
+  { "oum",     5564 },
+  { "oun",     8753 },
+  { "ovd",     1900 },
+  { "owi",     5568 },
+  { "owl",     5489 },
+  { "oyb",     5569 },
+  { "oyd",     5571 },
+  { "oym",     8261 },
+  { "oyy",     5570 },
+  { "ozm",     3407 },
+  { "pa",      5655 },
+  { "paa",     5676 },
+  { "pab",     5691 },
+  { "pac",     5585 },
+  { "pad",     5714 },
+  { "pae",     5590 },
+  { "paf",     5684 },
+  { "pag",     5647 },
+  { "pah",     7569 },
+  { "pai",     5722 },
+  { "pak",     5681 },
+  { "pal",     5597 },
+  { "pam",     5633 },
+  { "pan",     5655 },
+  { "pao",     5264 },
+  { "pap",     5671 },
+  { "paq",     5698 },
+  { "par",     5638 },
+  { "pas",     5668 },
+  { "pat",     5672 },
+  { "pau",     5614 },
+  { "pav",     5605 },
+  { "paw",     5719 },
+  { "pax",     5656 },
+  { "pay",     5724 },
+  { "paz",     5657 },
+  { "pbb",     5935 },
+  { "pbc",     5703 },
+  { "pbe",     4527 },
+  { "pbf",     1472 },
+  { "pbg",     5685 },
+  { "pbh",     1791 },
+  { "pbi",     5694 },
+  { "pbl",     4125 },
+  { "pbm",     5883 },
+  { "pbn",     3472 },
+  { "pbo",     5669 },
+  { "pbp",     536  },
+  { "pbr",     5651 },
+  { "pbs",     1256 },
+  { "pbt",     7198 },
+  { "pbu",     5266 },
+  { "pbv",     5831 },
+  { "pby",     5934 },
+  { "pbz",     5623 },
+  { "pca",     6758 },
+  { "pcb",     5723 },
+  { "pcc",     1012 },
+  { "pcd",     5784 },
+  { "pce",     6598 },
+  { "pcf",     5619 },
+  { "pcg",     5654 },
+  { "pch",     5688 },
+  { "pci",     1761 },
+  { "pcj",     5692 },
+  { "pck",     5601 },
+  { "pcl",     5689 },
+  { "pcm",     5114 },
+  { "pcn",     5819 },
+  { "pcp",     5582 },
+  { "pcr",     5639 },
+  { "pcw",     5930 },
+  { "pda",     254  },
+  { "pdc",     5737 },
+  { "pdi",     5575 },
+  { "pdn",     5834 },
+  { "pdo",     5586 },
+  { "pdt",     5829 },
+  { "pdu",     3140 },
+  { "pea",     5741 },
+  { "peb",     1850 },
+  { "ped",     4150 },
+  { "pee",     7403 },
+  { "pef",     5224 },
+  { "peg",     5736 },
+  { "peh",     974  },
+  { "pei",     1333 },
+  { "pej",     5269 },
+  { "pek",     5734 },
+  { "pel",     5728 },
+  { "pem",     5758 },
+  { "peo",     5479 },
+  { "pep",     3575 },
+  { "peq",     7201 },
+  { "per",     5745 },
+  { "pes",     2681 },
+  { "pev",     5938 },
+  { "pex",     5748 },
+  { "pey",     5749 },
+  { "pez",     1849 },
+  { "pfa",     5936 },
+  { "pfe",     5742 },
+  { "pfl",     5751 },
+  { "pga",     7271 },
+  { "pgd",     2372 },
+  { "pgg",     5652 },
+  { "pgi",     5589 },
+  { "pgk",     6029 },
+  { "pgl",     5874 },
+  { "pgn",     5588 },
+  { "pgs",     5648 },
+  { "pgu",     5591 },
+  { "pgy",     5850 },
+  { "pgz",     5674 },
+  { "pha",     5578 },
+  { "phd",     5771 },
+  { "phg",     5776 },
+  { "phh",     5773 },
+  { "phi",     5760 },
+  { "phj",     5593 },
+  { "phk",     5753 },
+  { "phl",     5755 },
+  { "phm",     5761 },
+  { "phn",     5762 },
+  { "pho",     5775 },
+  { "phq",     5756 },
+  { "phr",     5594 },
+  { "pht",     5769 },
+  { "phu",     5770 },
+  { "phv",     5596 },
+  { "phw",     5757 },
+  { "pi",      5617 },
+  { "pia",     5794 },
+  { "pib",     8602 },
+  { "pic",     5802 },
+  { "pid",     5783 },
+  { "pie",     5810 },
+  { "pif",     5798 },
+  { "pig",     5813 },
+  { "pih",     5817 },
+  { "pii",     5799 },
+  { "pij",     5789 },
+  { "pil",     8623 },
+  { "pim",     5869 },
+  { "pin",     5781 },
+  { "pio",     5782 },
+  { "pip",     5744 },
+  { "pir",     5808 },
+  { "pis",     5791 },
+  { "pit",     5821 },
+  { "piu",     5804 },
+  { "piv",     5793 },
+  { "piw",     5795 },
+  { "pix",     5822 },
+  { "piy",     5823 },
+  { "piz",     5790 },
+  { "pjt",     5820 },
+  { "pka",     360  },
+  { "pkb",     5839 },
+  { "pkc",     5587 },
+  { "pkg",     5603 },
+  { "pkh",     5658 },
+  { "pkn",     5604 },
+  { "pko",     5940 },
+  { "pkp",     5888 },
+  { "pkr",     445  },
+  { "pks",     5606 },
+  { "pkt",     4180 },
+  { "pku",     5609 },
+  { "pl",      5844 },
+  { "pla",     4536 },
+  { "plb",     5845 },
+  { "plc",     1255 },
+  { "pld",     5841 },
+  { "ple",     5624 },
+  { "plf",     1245 },
+  { "plg",     5792 },
+  { "plh",     5713 },
+  { "pli",     5617 },
+  { "plj",     5842 },
+  { "plk",     3346 },
+  { "pll",     6968 },
+  { "pln",     5616 },
+  { "plo",     5497 },
+  { "plp",     5622 },
+  { "plq",     5611 },
+  { "plr",     5612 },
+  { "pls",     6720 },
+  { "plt",     5828 },
+  { "plu",     5618 },
+  { "plv",     7227 },
+  { "plw",     1029 },
+  { "ply",     965  },
+  { "plz",     5625 },
+  { "pma",     5580 },
+  { "pmb",     5629 },
+  { "pmc",     5626 },
+  { "pmd",     5620 },
+  { "pme",     5925 },
+  { "pmf",     5631 },
+  { "pmh",     4845 },
+  { "pmi",     5271 },
+  { "pmj",     7204 },
+  { "pmk",     5630 },
+  { "pml",     3903 },
+  { "pmm",     5847 },
+  { "pmn",     5628 },
+  { "pmo",     5846 },
+  { "pmq",     5265 },
+  { "pmr",     5720 },
+  { "pms",     5788 },
+  { "pmt",     7829 },
+  { "pmu",     4601 },
+  { "pmw",     5826 },
+  { "pmx",     5866 },
+  { "pmy",     5675 },
+  { "pmz",     7197 },
+  { "pna",     5897 },
+  { "pnb",     8336 },
+  { "pnc",     5659 },
+  { "pnd",     4743 },
+  { "pne",     8338 },
+  { "png",     5649 },
+  { "pnh",     5738 },
+  { "pni",     320  },
+  { "pnj",     5801 },
+  { "pnk",     5715 },
+  { "pnl",     5615 },
+  { "pnm",     5898 },
+  { "pnn",     5796 },
+  { "pno",     5662 },
+  { "pnp",     5644 },
+  { "pnq",     5635 },
+  { "pnr",     5653 },
+  { "pns",     5851 },
+  { "pnt",     5852 },
+  { "pnu",     2824 },
+  { "pnv",     5800 },
+  { "pnw",     667  },
+  { "pnx",     5766 },
+  { "pny",     5805 },
+  { "pnz",     5636 },
+  { "poc",     5855 },
+  { "pod",     5849 },
+  { "poe",     6716 },
+  { "pof",     5838 },
+  { "pog",     5864 },
+  { "poh",     5856 },
+  { "poi",     2456 },
+  { "pok",     5837 },
+  { "pol",     5844 },
+  { "pom",     7149 },
+  { "pon",     5836 },
+  { "poo",     1258 },
+  { "pop",     5926 },
+  { "poq",     7607 },
+  { "por",     5862 },
+  { "pos",     6821 },
+  { "pot",     5863 },
+  { "pov",     7992 },
+  { "pow",     6712 },
+  { "pox",     5840 },
+  { "poy",     5835 },
+  { "poz",     4174 },
+  { "ppa",     5664 },
+  { "ppe",     5670 },
+  { "ppi",     5600 },
+  { "ppk",     7959 },
+  { "ppl",     5806 },
+  { "ppm",     5677 },
+  { "ppn",     5666 },
+  { "ppo",     2034 },
+  { "ppp",     5731 },
+  { "ppq",     5727 },
+  { "ppr",     5812 },
+  { "pps",     6719 },
+  { "ppt",     5690 },
+  { "ppu",     5673 },
+  { "pqa",     5576 },
+  { "pqe",     1836 },
+  { "pqm",     4179 },
+  { "pqw",     8326 },
+  { "pra",     5871 },
+  { "prb",     3992 },
+  { "prc",     5678 },
+  { "prd",     5696 },
+  { "pre",     5875 },
+  { "prf",     5683 },
+  { "prg",     5877 },
+  { "prh",     5857 },
+  { "pri",     5599 },
+  { "prk",     5686 },
+  { "prl",     5746 },
+  { "prm",     3265 },
+  { "prn",     5872 },
+  { "pro",     5480 },
+  { "prp",     5695 },
+  { "prq",     409  },
+  { "prr",     5911 },
+  { "prs",     1567 },
+  { "prt",     5752 },
+  { "pru",     5908 },
+  { "prw",     5687 },
+  { "prx",     5912 },
+  { "pry",     5873 },
+  { "prz",     5876 },
+  { "ps",      5918 },
+  { "psa",     421  },
+  { "psc",     2682 },
+  { "psd",     5825 },
+  { "pse",     1244 },
+  { "psg",     5733 },
+  { "psh",     7228 },
+  { "psi",     7143 },
+  { "psl",     5885 },
+  { "psm",     5717 },
+  { "psn",     5642 },
+  { "pso",     5843 },
+  { "psp",     5759 },
+  { "psq",     5701 },
+  { "psr",     5861 },
+  { "pss",     3123 },
+  { "pst",     1257 },
+  { "psu",     6805 },
+  { "psw",     5858 },
+  { "psy",     5815 },
+  { "pt",      5862 },
+  { "pta",     5598 },
+  { "pth",     5705 },
+  { "pti",     5797 },
+  { "ptn",     5704 },
+  { "pto",     8722 },
+  { "ptp",     5706 },
+  { "ptq",     5711 },
+  { "ptr",     5780 },
+  { "ptt",     1932 },
+  { "ptu",     616  },
+  { "ptv",     5860 },
+  { "ptw",     5739 },
+  { "pty",     5707 },
+  { "pua",     8314 },
+  { "pub",     5917 },
+  { "puc",     5900 },
+  { "pud",     5896 },
+  { "pue",     5884 },
+  { "puf",     5899 },
+  { "pug",     5772 },
+  { "pui",     5887 },
+  { "puj",     5901 },
+  { "puk",     5879 },
+  { "pum",     5893 },
+  { "puo",     5906 },
+  { "pup",     5890 },
+  { "puq",     5907 },
+  { "pur",     5915 },
+  { "pus",     5918 },
+  { "put",     5920 },
+  { "puu",     5905 },
+  { "puw",     5892 },
+  { "pux",     5881 },
+  { "puy",     5913 },
+  { "puz",     5916 },
+  { "pwa",     5718 },
+  { "pwb",     5643 },
+  { "pwg",     2122 },
+  { "pwi",     5712 },
+  { "pwm",     4660 },
+  { "pwn",     5602 },
+  { "pwo",     5929 },
+  { "pwr",     5868 },
+  { "pww",     5928 },
+  { "pxm",     5958 },
+  { "pye",     5931 },
+  { "pym",     2062 },
+  { "pyn",     5870 },
+  { "pys",     5680 },
+  { "pyu",     5924 },
+  { "pyx",     5933 },
+  { "pyy",     5932 },
+  { "pzh",     5721 },
+  { "pzn",     2799 },
+  { "qaa",     6031 },
+  { "qaa-qtz", 6030 },
+  { "qab",     6032 },
+  { "qac",     6033 },
+  { "qad",     6034 },
+  { "qae",     6035 },
+  { "qaf",     6036 },
+  { "qag",     6037 },
+  { "qah",     6038 },
+  { "qai",     6039 },
+  { "qaj",     6040 },
+  { "qak",     6041 },
+  { "qal",     6042 },
+  { "qam",     6043 },
+  { "qan",     6044 },
+  { "qao",     6045 },
+  { "qap",     6046 },
+  { "qaq",     6047 },
+  { "qar",     6048 },
+  { "qas",     6049 },
+  { "qat",     6050 },
+  { "qau",     6051 },
+  { "qav",     6052 },
+  { "qaw",     6053 },
+  { "qax",     6054 },
+  { "qay",     6055 },
+  { "qaz",     6056 },
+  { "qba",     6057 },
+  { "qbb",     6058 },
+  { "qbc",     6059 },
+  { "qbd",     6060 },
+  { "qbe",     6061 },
+  { "qbf",     6062 },
+  { "qbg",     6063 },
+  { "qbh",     6064 },
+  { "qbi",     6065 },
+  { "qbj",     6066 },
+  { "qbk",     6067 },
+  { "qbl",     6068 },
+  { "qbm",     6069 },
+  { "qbn",     6070 },
+  { "qbo",     6071 },
+  { "qbp",     6072 },
+  { "qbq",     6073 },
+  { "qbr",     6074 },
+  { "qbs",     6075 },
+  { "qbt",     6076 },
+  { "qbu",     6077 },
+  { "qbv",     6078 },
+  { "qbw",     6079 },
+  { "qbx",     6080 },
+  { "qby",     6081 },
+  { "qbz",     6082 },
+  { "qca",     6083 },
+  { "qcb",     6084 },
+  { "qcc",     6085 },
+  { "qcd",     6086 },
+  { "qce",     6087 },
+  { "qcf",     6088 },
+  { "qcg",     6089 },
+  { "qch",     6090 },
+  { "qci",     6091 },
+  { "qcj",     6092 },
+  { "qck",     6093 },
+  { "qcl",     6094 },
+  { "qcm",     6095 },
+  { "qcn",     6096 },
+  { "qco",     6097 },
+  { "qcp",     6098 },
+  { "qcq",     6099 },
+  { "qcr",     6100 },
+  { "qcs",     6101 },
+  { "qct",     6102 },
+  { "qcu",     6103 },
+  { "qcv",     6104 },
+  { "qcw",     6105 },
+  { "qcx",     6106 },
+  { "qcy",     6107 },
+  { "qcz",     6108 },
+  { "qda",     6109 },
+  { "qdb",     6110 },
+  { "qdc",     6111 },
+  { "qdd",     6112 },
+  { "qde",     6113 },
+  { "qdf",     6114 },
+  { "qdg",     6115 },
+  { "qdh",     6116 },
+  { "qdi",     6117 },
+  { "qdj",     6118 },
+  { "qdk",     6119 },
+  { "qdl",     6120 },
+  { "qdm",     6121 },
+  { "qdn",     6122 },
+  { "qdo",     6123 },
+  { "qdp",     6124 },
+  { "qdq",     6125 },
+  { "qdr",     6126 },
+  { "qds",     6127 },
+  { "qdt",     6128 },
+  { "qdu",     6129 },
+  { "qdv",     6130 },
+  { "qdw",     6131 },
+  { "qdx",     6132 },
+  { "qdy",     6133 },
+  { "qdz",     6134 },
+  { "qea",     6135 },
+  { "qeb",     6136 },
+  { "qec",     6137 },
+  { "qed",     6138 },
+  { "qee",     6139 },
+  { "qef",     6140 },
+  { "qeg",     6141 },
+  { "qeh",     6142 },
+  { "qei",     6143 },
+  { "qej",     6144 },
+  { "qek",     6145 },
+  { "qel",     6146 },
+  { "qem",     6147 },
+  { "qen",     6148 },
+  { "qeo",     6149 },
+  { "qep",     6150 },
+  { "qeq",     6151 },
+  { "qer",     6152 },
+  { "qes",     6153 },
+  { "qet",     6154 },
+  { "qeu",     6155 },
+  { "qev",     6156 },
+  { "qew",     6157 },
+  { "qex",     6158 },
+  { "qey",     6159 },
+  { "qez",     6160 },
+  { "qfa",     6161 },
+  { "qfb",     6162 },
+  { "qfc",     6163 },
+  { "qfd",     6164 },
+  { "qfe",     6165 },
+  { "qff",     6166 },
+  { "qfg",     6167 },
+  { "qfh",     6168 },
+  { "qfi",     6169 },
+  { "qfj",     6170 },
+  { "qfk",     6171 },
+  { "qfl",     6172 },
+  { "qfm",     6173 },
+  { "qfn",     6174 },
+  { "qfo",     6175 },
+  { "qfp",     6176 },
+  { "qfq",     6177 },
+  { "qfr",     6178 },
+  { "qfs",     6179 },
+  { "qft",     6180 },
+  { "qfu",     6181 },
+  { "qfv",     6182 },
+  { "qfw",     6183 },
+  { "qfx",     6184 },
+  { "qfy",     6185 },
+  { "qfz",     6186 },
+  { "qga",     6187 },
+  { "qgb",     6188 },
+  { "qgc",     6189 },
+  { "qgd",     6190 },
+  { "qge",     6191 },
+  { "qgf",     6192 },
+  { "qgg",     6193 },
+  { "qgh",     6194 },
+  { "qgi",     6195 },
+  { "qgj",     6196 },
+  { "qgk",     6197 },
+  { "qgl",     6198 },
+  { "qgm",     6199 },
+  { "qgn",     6200 },
+  { "qgo",     6201 },
+  { "qgp",     6202 },
+  { "qgq",     6203 },
+  { "qgr",     6204 },
+  { "qgs",     6205 },
+  { "qgt",     6206 },
+  { "qgu",     6207 },
+  { "qgv",     6208 },
+  { "qgw",     6209 },
+  { "qgx",     6210 },
+  { "qgy",     6211 },
+  { "qgz",     6212 },
+  { "qha",     6213 },
+  { "qhb",     6214 },
+  { "qhc",     6215 },
+  { "qhd",     6216 },
+  { "qhe",     6217 },
+  { "qhf",     6218 },
+  { "qhg",     6219 },
+  { "qhh",     6220 },
+  { "qhi",     6221 },
+  { "qhj",     6222 },
+  { "qhk",     6223 },
+  { "qhl",     6224 },
+  { "qhm",     6225 },
+  { "qhn",     6226 },
+  { "qho",     6227 },
+  { "qhp",     6228 },
+  { "qhq",     6229 },
+  { "qhr",     6230 },
+  { "qhs",     6231 },
+  { "qht",     6232 },
+  { "qhu",     6233 },
+  { "qhv",     6234 },
+  { "qhw",     6235 },
+  { "qhx",     6236 },
+  { "qhy",     6237 },
+  { "qhz",     6238 },
+  { "qia",     6239 },
+  { "qib",     6240 },
+  { "qic",     6241 },
+  { "qid",     6242 },
+  { "qie",     6243 },
+  { "qif",     6244 },
+  { "qig",     6245 },
+  { "qih",     6246 },
+  { "qii",     6247 },
+  { "qij",     6248 },
+  { "qik",     6249 },
+  { "qil",     6250 },
+  { "qim",     6251 },
+  { "qin",     6252 },
+  { "qio",     6253 },
+  { "qip",     6254 },
+  { "qiq",     6255 },
+  { "qir",     6256 },
+  { "qis",     6257 },
+  { "qit",     6258 },
+  { "qiu",     6259 },
+  { "qiv",     6260 },
+  { "qiw",     6261 },
+  { "qix",     6262 },
+  { "qiy",     6263 },
+  { "qiz",     6264 },
+  { "qja",     6265 },
+  { "qjb",     6266 },
+  { "qjc",     6267 },
+  { "qjd",     6268 },
+  { "qje",     6269 },
+  { "qjf",     6270 },
+  { "qjg",     6271 },
+  { "qjh",     6272 },
+  { "qji",     6273 },
+  { "qjj",     6274 },
+  { "qjk",     6275 },
+  { "qjl",     6276 },
+  { "qjm",     6277 },
+  { "qjn",     6278 },
+  { "qjo",     6279 },
+  { "qjp",     6280 },
+  { "qjq",     6281 },
+  { "qjr",     6282 },
+  { "qjs",     6283 },
+  { "qjt",     6284 },
+  { "qju",     6285 },
+  { "qjv",     6286 },
+  { "qjw",     6287 },
+  { "qjx",     6288 },
+  { "qjy",     6289 },
+  { "qjz",     6290 },
+  { "qka",     6291 },
+  { "qkb",     6292 },
+  { "qkc",     6293 },
+  { "qkd",     6294 },
+  { "qke",     6295 },
+  { "qkf",     6296 },
+  { "qkg",     6297 },
+  { "qkh",     6298 },
+  { "qki",     6299 },
+  { "qkj",     6300 },
+  { "qkk",     6301 },
+  { "qkl",     6302 },
+  { "qkm",     6303 },
+  { "qkn",     6304 },
+  { "qko",     6305 },
+  { "qkp",     6306 },
+  { "qkq",     6307 },
+  { "qkr",     6308 },
+  { "qks",     6309 },
+  { "qkt",     6310 },
+  { "qku",     6311 },
+  { "qkv",     6312 },
+  { "qkw",     6313 },
+  { "qkx",     6314 },
+  { "qky",     6315 },
+  { "qkz",     6316 },
+  { "qla",     6317 },
+  { "qlb",     6318 },
+  { "qlc",     6319 },
+  { "qld",     6320 },
+  { "qle",     6321 },
+  { "qlf",     6322 },
+  { "qlg",     6323 },
+  { "qlh",     6324 },
+  { "qli",     6325 },
+  { "qlj",     6326 },
+  { "qlk",     6327 },
+  { "qll",     6328 },
+  { "qlm",     6329 },
+  { "qln",     6330 },
+  { "qlo",     6331 },
+  { "qlp",     6332 },
+  { "qlq",     6333 },
+  { "qlr",     6334 },
+  { "qls",     6335 },
+  { "qlt",     6336 },
+  { "qlu",     6337 },
+  { "qlv",     6338 },
+  { "qlw",     6339 },
+  { "qlx",     6340 },
+  { "qly",     6341 },
+  { "qlz",     6342 },
+  { "qma",     6343 },
+  { "qmb",     6344 },
+  { "qmc",     6345 },
+  { "qmd",     6346 },
+  { "qme",     6347 },
+  { "qmf",     6348 },
+  { "qmg",     6349 },
+  { "qmh",     6350 },
+  { "qmi",     6351 },
+  { "qmj",     6352 },
+  { "qmk",     6353 },
+  { "qml",     6354 },
+  { "qmm",     6355 },
+  { "qmn",     6356 },
+  { "qmo",     6357 },
+  { "qmp",     6358 },
+  { "qmq",     6359 },
+  { "qmr",     6360 },
+  { "qms",     6361 },
+  { "qmt",     6362 },
+  { "qmu",     6363 },
+  { "qmv",     6364 },
+  { "qmw",     6365 },
+  { "qmx",     6366 },
+  { "qmy",     6367 },
+  { "qmz",     6368 },
+  { "qna",     6369 },
+  { "qnb",     6370 },
+  { "qnc",     6371 },
+  { "qnd",     6372 },
+  { "qne",     6373 },
+  { "qnf",     6374 },
+  { "qng",     6375 },
+  { "qnh",     6376 },
+  { "qni",     6377 },
+  { "qnj",     6378 },
+  { "qnk",     6379 },
+  { "qnl",     6380 },
+  { "qnm",     6381 },
+  { "qnn",     6382 },
+  { "qno",     6383 },
+  { "qnp",     6384 },
+  { "qnq",     6385 },
+  { "qnr",     6386 },
+  { "qns",     6387 },
+  { "qnt",     6388 },
+  { "qnu",     6389 },
+  { "qnv",     6390 },
+  { "qnw",     6391 },
+  { "qnx",     6392 },
+  { "qny",     6393 },
+  { "qnz",     6394 },
+  { "qoa",     6395 },
+  { "qob",     6396 },
+  { "qoc",     6397 },
+  { "qod",     6398 },
+  { "qoe",     6399 },
+  { "qof",     6400 },
+  { "qog",     6401 },
+  { "qoh",     6402 },
+  { "qoi",     6403 },
+  { "qoj",     6404 },
+  { "qok",     6405 },
+  { "qol",     6406 },
+  { "qom",     6407 },
+  { "qon",     6408 },
+  { "qoo",     6409 },
+  { "qop",     6410 },
+  { "qoq",     6411 },
+  { "qor",     6412 },
+  { "qos",     6413 },
+  { "qot",     6414 },
+  { "qou",     6415 },
+  { "qov",     6416 },
+  { "qow",     6417 },
+  { "qox",     6418 },
+  { "qoy",     6419 },
+  { "qoz",     6420 },
+  { "qpa",     6421 },
+  { "qpb",     6422 },
+  { "qpc",     6423 },
+  { "qpd",     6424 },
+  { "qpe",     6425 },
+  { "qpf",     6426 },
+  { "qpg",     6427 },
+  { "qph",     6428 },
+  { "qpi",     6429 },
+  { "qpj",     6430 },
+  { "qpk",     6431 },
+  { "qpl",     6432 },
+  { "qpm",     6433 },
+  { "qpn",     6434 },
+  { "qpo",     6435 },
+  { "qpp",     6436 },
+  { "qpq",     6437 },
+  { "qpr",     6438 },
+  { "qps",     6439 },
+  { "qpt",     6440 },
+  { "qpu",     6441 },
+  { "qpv",     6442 },
+  { "qpw",     6443 },
+  { "qpx",     6444 },
+  { "qpy",     6445 },
+  { "qpz",     6446 },
+  { "qqa",     6447 },
+  { "qqb",     6448 },
+  { "qqc",     6449 },
+  { "qqd",     6450 },
+  { "qqe",     6451 },
+  { "qqf",     6452 },
+  { "qqg",     6453 },
+  { "qqh",     6454 },
+  { "qqi",     6455 },
+  { "qqj",     6456 },
+  { "qqk",     6457 },
+  { "qql",     6458 },
+  { "qqm",     6459 },
+  { "qqn",     6460 },
+  { "qqo",     6461 },
+  { "qqp",     6462 },
+  { "qqq",     6463 },
+  { "qqr",     6464 },
+  { "qqs",     6465 },
+  { "qqt",     6466 },
+  { "qqu",     6467 },
+  { "qqv",     6468 },
+  { "qqw",     6469 },
+  { "qqx",     6470 },
+  { "qqy",     6471 },
+  { "qqz",     6472 },
+  { "qra",     6473 },
+  { "qrb",     6474 },
+  { "qrc",     6475 },
+  { "qrd",     6476 },
+  { "qre",     6477 },
+  { "qrf",     6478 },
+  { "qrg",     6479 },
+  { "qrh",     6480 },
+  { "qri",     6481 },
+  { "qrj",     6482 },
+  { "qrk",     6483 },
+  { "qrl",     6484 },
+  { "qrm",     6485 },
+  { "qrn",     6486 },
+  { "qro",     6487 },
+  { "qrp",     6488 },
+  { "qrq",     6489 },
+  { "qrr",     6490 },
+  { "qrs",     6491 },
+  { "qrt",     6492 },
+  { "qru",     6493 },
+  { "qrv",     6494 },
+  { "qrw",     6495 },
+  { "qrx",     6496 },
+  { "qry",     6497 },
+  { "qrz",     6498 },
+  { "qsa",     6499 },
+  { "qsb",     6500 },
+  { "qsc",     6501 },
+  { "qsd",     6502 },
+  { "qse",     6503 },
+  { "qsf",     6504 },
+  { "qsg",     6505 },
+  { "qsh",     6506 },
+  { "qsi",     6507 },
+  { "qsj",     6508 },
+  { "qsk",     6509 },
+  { "qsl",     6510 },
+  { "qsm",     6511 },
+  { "qsn",     6512 },
+  { "qso",     6513 },
+  { "qsp",     6514 },
+  { "qsq",     6515 },
+  { "qsr",     6516 },
+  { "qss",     6517 },
+  { "qst",     6518 },
+  { "qsu",     6519 },
+  { "qsv",     6520 },
+  { "qsw",     6521 },
+  { "qsx",     6522 },
+  { "qsy",     6523 },
+  { "qsz",     6524 },
+  { "qta",     6525 },
+  { "qtb",     6526 },
+  { "qtc",     6527 },
+  { "qtd",     6528 },
+  { "qte",     6529 },
+  { "qtf",     6530 },
+  { "qtg",     6531 },
+  { "qth",     6532 },
+  { "qti",     6533 },
+  { "qtj",     6534 },
+  { "qtk",     6535 },
+  { "qtl",     6536 },
+  { "qtm",     6537 },
+  { "qtn",     6538 },
+  { "qto",     6539 },
+  { "qtp",     6540 },
+  { "qtq",     6541 },
+  { "qtr",     6542 },
+  { "qts",     6543 },
+  { "qtt",     6544 },
+  { "qtu",     6545 },
+  { "qtv",     6546 },
+  { "qtw",     6547 },
+  { "qtx",     6548 },
+  { "qty",     6549 },
+  { "qtz",     6550 },
+  { "qu",      5954 },
+  { "qua",     5951 },
+  { "qub",     2517 },
+  { "quc",     2868 },
+  { "qud",     1169 },
+  { "que",     5954 },
+  { "quf",     3734 },
+  { "qug",     1346 },
+  { "quh",     7119 },
+  { "qui",     5961 },
+  { "quk",     1273 },
+  { "qul",     5197 },
+  { "qum",     7036 },
+  { "qun",     5962 },
+  { "qup",     7199 },
+  { "quq",     5963 },
+  { "qur",     8510 },
+  { "qus",     6768 },
+  { "quv",     6643 },
+  { "quw",     7564 },
+  { "qux",     8558 },
+  { "quy",     496  },
+  { "quz",     1501 },
+  { "qva",     228  },
+  { "qvc",     1161 },
+  { "qve",     1808 },
+  { "qvh",     2518 },
+  { "qvi",     2634 },
+  { "qvj",     3934 },
+  { "qvl",     1162 },
+  { "qvm",     4316 },
+  { "qvn",     5204 },
+  { "qvo",     4908 },
+  { "qvp",     5583 },
+  { "qvs",     6722 },
+  { "qvw",     2526 },
+  { "qvy",     5959 },
+  { "qvz",     5267 },
+  { "qwa",     1464 },
+  { "qwc",     1426 },
+  { "qwe",     5955 },
+  { "qwh",     2525 },
+  { "qwm",     3547 },
+  { "qws",     6993 },
+  { "qwt",     3633 },
+  { "qxa",     1364 },
+  { "qxc",     1351 },
+  { "qxh",     5640 },
+  { "qxl",     6670 },
+  { "qxn",     5235 },
+  { "qxo",     7167 },
+  { "qxp",     5903 },
+  { "qxq",     5944 },
+  { "qxr",     1219 },
+  { "qxs",     7206 },
+  { "qxt",     6756 },
+  { "qxu",     364  },
+  { "qxw",     2789 },
+  { "qya",     5956 },
+  { "qyp",     5966 },
+  { "raa",     1752 },
+  { "rab",     1177 },
+  { "rac",     5996 },
+  { "rad",     5968 },
+  { "raf",     8330 },
+  { "rag",     3930 },
+  { "rah",     5967 },
+  { "rai",     5981 },
+  { "raj",     5972 },
+  { "rak",     7845 },
+  { "ral",     5979 },
+  { "ram",     1184 },
+  { "ran",     6558 },
+  { "rao",     5989 },
+  { "rap",     5991 },
+  { "raq",     6631 },
+  { "rar",     5995 },
+  { "ras",     7533 },
+  { "rat",     6009 },
+  { "rau",     6001 },
+  { "rav",     6704 },
+  { "raw",     6004 },
+  { "rax",     5985 },
+  { "ray",     5990 },
+  { "raz",     5970 },
+  { "rbb",     6604 },
+  { "rbk",     5233 },
+  { "rbl",     4595 },
+  { "rbp",     671  },
+  { "rcf",     6623 },
+  { "rdb",     6599 },
+  { "rea",     6028 },
+  { "reb",     6017 },
+  { "ree",     6012 },
+  { "reg",     3052 },
+  { "rei",     6014 },
+  { "rej",     6013 },
+  { "rel",     6022 },
+  { "rem",     6018 },
+  { "ren",     6023 },
+  { "rer",     6027 },
+  { "res",     6551 },
+  { "ret",     6553 },
+  { "rey",     6554 },
+  { "rga",     6594 },
+  { "rge",     6579 },
+  { "rgk",     5986 },
+  { "rgn",     6574 },
+  { "rgr",     6552 },
+  { "rgs",     7209 },
+  { "rgu",     6565 },
+  { "rhg",     6572 },
+  { "rhp",     8476 },
+  { "ria",     6555 },
+  { "rib",     1022 },
+  { "rie",     6560 },
+  { "rif",     7482 },
+  { "ril",     6557 },
+  { "rim",     5373 },
+  { "rin",     5344 },
+  { "rir",     6559 },
+  { "rit",     6567 },
+  { "riu",     6568 },
+  { "rjg",     5975 },
+  { "rji",     5974 },
+  { "rjs",     5973 },
+  { "rka",     3481 },
+  { "rkb",     6562 },
+  { "rkh",     5977 },
+  { "rki",     5978 },
+  { "rkm",     4337 },
+  { "rkt",     5988 },
+  { "rkw",     341  },
+  { "rm",      6582 },
+  { "rma",     5980 },
+  { "rmb",     6016 },
+  { "rmc",     1203 },
+  { "rmd",     7785 },
+  { "rme",     290  },
+  { "rmf",     2967 },
+  { "rmg",     7786 },
+  { "rmh",     4799 },
+  { "rmi",     3949 },
+  { "rmk",     6586 },
+  { "rml",     609  },
+  { "rmm",     6573 },
+  { "rmn",     605  },
+  { "rmo",     7031 },
+  { "rmp",     6020 },
+  { "rmq",     1172 },
+  { "rmr",     1173 },
+  { "rms",     6577 },
+  { "rmt",     1708 },
+  { "rmu",     7506 },
+  { "rmv",     6581 },
+  { "rmw",     8272 },
+  { "rmx",     6575 },
+  { "rmy",     8104 },
+  { "rmz",     4339 },
+  { "rn",      6607 },
+  { "rna",     6606 },
+  { "rnb",     1031 },
+  { "rnd",     6619 },
+  { "rng",     6588 },
+  { "rnl",     5987 },
+  { "rnn",     6593 },
+  { "rnp",     6591 },
+  { "rnr",     4915 },
+  { "rnw",     6611 },
+  { "ro",      6578 },
+  { "roa",     6576 },
+  { "rob",     7360 },
+  { "roc",     1153 },
+  { "rod",     6571 },
+  { "roe",     6592 },
+  { "rof",     6585 },
+  { "rog",     5275 },
+  { "roh",     6582 },
+  { "rol",     6584 },
+  { "rom",     6583 },
+  { "ron",     6578 },
+  { "roo",     6595 },
+  { "rop",     3489 },
+  { "ror",     6589 },
+  { "rou",     6608 },
+  { "row",     1599 },
+  { "rpn",     6026 },
+  { "rpt",     5993 },
+  { "rri",     6566 },
+  { "rro",     8149 },
+  { "rrt",     390  },
+  { "rsb",     6580 },
+  { "rsi",     6025 },
+  { "rsk",     6616 },
+  { "rsl",     6613 },
+  { "rsm",     4598 },
+  { "rsn",     6622 },
+  { "rtc",     6609 },
+  { "rth",     5998 },
+  { "rtm",     6596 },
+  { "rts",     8663 },
+  { "rtw",     5999 },
+  { "ru",      6614 },
+  { "rub",     2331 },
+  { "ruc",     6618 },
+  { "rue",     6615 },
+  { "ruf",     4004 },
+  { "rug",     6597 },
+  { "ruh",     6601 },
+  { "rui",     6600 },
+  { "ruk",     1309 },
+  { "rum",     6578 },
+  { "run",     6607 },
+  { "ruo",     2716 },
+  { "rup",     4067 },
+  { "ruq",     4479 },
+  { "rus",     6614 },
+  { "rut",     6617 },
+  { "ruu",     3748 },
+  { "ruy",     4149 },
+  { "ruz",     6603 },
+  { "rw",      3290 },
+  { "rwa",     6007 },
+  { "rwk",     6621 },
+  { "rwl",     6620 },
+  { "rwm",     220  },
+  { "rwo",     6003 },
+  { "rwr",     4352 },
+  { "rxd",     5040 },
+  { "rxw",     3098 },
+  { "ryn",     5229 },
+  { "rys",     8467 },
+  { "ryu",     1254 },
+  { "rzh",     6624 },
+  { "sa",      6754 },
+  { "saa",     6634 },
+  { "sab",     1055 },
+  { "sac",     4515 },
+  { "sad",     6734 },
+  { "sae",     6638 },
+  { "saf",     6647 },
+  { "sag",     6745 },
+  { "sah",     8486 },
+  { "sai",     7116 },
+  { "saj",     6653 },
+  { "sak",     6663 },
+  { "sal",     6676 },
+  { "sam",     6684 },
+  { "san",     6754 },
+  { "sao",     6809 },
+  { "sap",     6732 },
+  { "saq",     6696 },
+  { "sar",     6788 },
+  { "sas",     6798 },
+  { "sat",     6766 },
+  { "sau",     6673 },
+  { "sav",     6630 },
+  { "saw",     6816 },
+  { "sax",     6626 },
+  { "say",     6820 },
+  { "saz",     6806 },
+  { "sba",     5027 },
+  { "sbb",     7013 },
+  { "sbc",     3168 },
+  { "sbd",     7212 },
+  { "sbe",     6674 },
+  { "sbf",     1272 },
+  { "sbg",     6839 },
+  { "sbh",     7106 },
+  { "sbi",     6907 },
+  { "sbj",     7302 },
+  { "sbk",     6649 },
+  { "sbl",     1009 },
+  { "sbm",     6650 },
+  { "sbn",     7021 },
+  { "sbo",     6642 },
+  { "sbp",     6748 },
+  { "sbq",     7003 },
+  { "sbr",     6866 },
+  { "sbs",     7268 },
+  { "sbt",     3280 },
+  { "sbu",     7259 },
+  { "sbv",     6640 },
+  { "sbw",     7010 },
+  { "sbx",     6828 },
+  { "sby",     7078 },
+  { "sbz",     6781 },
+  { "sc",      6789 },
+  { "sca",     6755 },
+  { "scb",     1402 },
+  { "sce",     1719 },
+  { "scf",     6724 },
+  { "scg",     6738 },
+  { "sch",     6659 },
+  { "sci",     7251 },
+  { "sck",     6644 },
+  { "scl",     6948 },
+  { "scn",     6982 },
+  { "sco",     6822 },
+  { "scp",     2560 },
+  { "scq",     6629 },
+  { "scs",     5215 },
+  { "sct",     7179 },
+  { "scu",     6964 },
+  { "scv",     6939 },
+  { "scw",     6913 },
+  { "scx",     6980 },
+  { "sd",      7022 },
+  { "sda",     7759 },
+  { "sdb",     6914 },
+  { "sdc",     6800 },
+  { "sde",     7309 },
+  { "sdf",     6792 },
+  { "sdg",     6812 },
+  { "sdh",     7182 },
+  { "sdj",     7315 },
+  { "sdk",     7110 },
+  { "sdl",     6804 },
+  { "sdm",     6863 },
+  { "sdn",     2098 },
+  { "sdo",     1060 },
+  { "sdp",     6941 },
+  { "sdq",     6864 },
+  { "sdr",     5527 },
+  { "sds",     6878 },
+  { "sdt",     6958 },
+  { "sdu",     6796 },
+  { "sdv",     1853 },
+  { "sdx",     6978 },
+  { "sdz",     6677 },
+  { "se",      5276 },
+  { "sea",     6862 },
+  { "seb",     6937 },
+  { "sec",     6831 },
+  { "sed",     6833 },
+  { "see",     6877 },
+  { "sef",     1221 },
+  { "seg",     6838 },
+  { "seh",     6873 },
+  { "sei",     6896 },
+  { "sej",     6876 },
+  { "sek",     6843 },
+  { "sel",     6859 },
+  { "sem",     6869 },
+  { "sen",     4902 },
+  { "seo",     7263 },
+  { "sep",     7337 },
+  { "seq",     6874 },
+  { "ser",     6899 },
+  { "ses",     3467 },
+  { "set",     6885 },
+  { "seu",     6903 },
+  { "sev",     5372 },
+  { "sew",     6910 },
+  { "sey",     6832 },
+  { "sez",     6886 },
+  { "sfb",     3760 },
+  { "sfe",     1852 },
+  { "sfm",     7065 },
+  { "sfs",     7115 },
+  { "sfw",     6840 },
+  { "sg",      6745 },
+  { "sga",     5466 },
+  { "sgb",     4089 },
+  { "sgc",     3296 },
+  { "sgd",     7304 },
+  { "sge",     6837 },
+  { "sgg",     7328 },
+  { "sgh",     6961 },
+  { "sgi",     7275 },
+  { "sgj",     7303 },
+  { "sgk",     6742 },
+  { "sgl",     6744 },
+  { "sgm",     7024 },
+  { "sgn",     6991 },
+  { "sgo",     7090 },
+  { "sgp",     7026 },
+  { "sgr",     6741 },
+  { "sgs",     6701 },
+  { "sgt",     1027 },
+  { "sgu",     6669 },
+  { "sgw",     6827 },
+  { "sgx",     6987 },
+  { "sgy",     6743 },
+  { "sgz",     7307 },
+  { "sh",      6893 },
+  { "sha",     6917 },
+  { "shb",     5130 },
+  { "shc",     7089 },
+  { "shd",     3562 },
+  { "she",     6935 },
+  { "shg",     6957 },
+  { "shh",     6956 },
+  { "shi",     7355 },
+  { "shj",     6928 },
+  { "shk",     6947 },
+  { "shl",     6938 },
+  { "shm",     6916 },
+  { "shn",     6921 },
+  { "sho",     6923 },
+  { "shp",     6950 },
+  { "shq",     6666 },
+  { "shr",     6944 },
+  { "shs",     6965 },
+  { "sht",     6927 },
+  { "shu",     1275 },
+  { "shv",     6932 },
+  { "shw",     6967 },
+  { "shx",     6931 },
+  { "shy",     7354 },
+  { "shz",     7331 },
+  { "si",      7027 },
+  { "sia",     143  },
+  { "sib",     6829 },
+  { "sid",     6984 },
+  { "sie",     7009 },
+  { "sif",     6970 },
+  { "sig",     5581 },
+  { "sih",     8719 },
+  { "sii",     6952 },
+  { "sij",     5337 },
+  { "sik",     6997 },
+  { "sil",     7854 },
+  { "sim",     4493 },
+  { "sin",     7027 },
+  { "sio",     7035 },
+  { "sip",     6998 },
+  { "siq",     7098 },
+  { "sir",     7040 },
+  { "sis",     7047 },
+  { "sit",     7030 },
+  { "siu",     7017 },
+  { "siv",     7288 },
+  { "siw",     7050 },
+  { "six",     7289 },
+  { "siy",     7048 },
+  { "siz",     7051 },
+  { "sja",     1938 },
+  { "sjb",     6658 },
+  { "sjd",     3270 },
+  { "sje",     5818 },
+  { "sjg",     415  },
+  { "sjk",     3178 },
+  { "sjl",     6657 },
+  { "sjm",     4294 },
+  { "sjn",     7020 },
+  { "sjo",     8445 },
+  { "sjp",     7306 },
+  { "sjr",     6974 },
+  { "sjs",     6883 },
+  { "sjt",     7580 },
+  { "sju",     7969 },
+  { "sjw",     6930 },
+  { "sk",      7062 },
+  { "ska",     7054 },
+  { "skb",     6645 },
+  { "skc",     4049 },
+  { "skd",     7213 },
+  { "ske",     6847 },
+  { "skf",     6664 },
+  { "skg",     6660 },
+  { "skh",     7000 },
+  { "ski",     6994 },
+  { "skj",     6846 },
+  { "skk",     7075 },
+  { "skm",     3609 },
+  { "skn",     3368 },
+  { "sko",     6851 },
+  { "skp",     6844 },
+  { "skq",     7029 },
+  { "skr",     6783 },
+  { "sks",     4105 },
+  { "skt",     6662 },
+  { "sku",     6661 },
+  { "skv",     7058 },
+  { "skw",     7056 },
+  { "skx",     6850 },
+  { "sky",     6995 },
+  { "skz",     6845 },
+  { "sl",      7064 },
+  { "sla",     7060 },
+  { "slc",     7334 },
+  { "sld",     7045 },
+  { "sle",     6951 },
+  { "slf",     7329 },
+  { "slg",     6860 },
+  { "slh",     7203 },
+  { "sli",     3983 },
+  { "slj",     6680 },
+  { "slk",     7062 },
+  { "sll",     6678 },
+  { "slm",     5650 },
+  { "sln",     6675 },
+  { "slo",     7062 },
+  { "slp",     3726 },
+  { "slq",     6672 },
+  { "slr",     6668 },
+  { "sls",     7025 },
+  { "slt",     7001 },
+  { "slu",     6854 },
+  { "slv",     7064 },
+  { "slw",     6969 },
+  { "slx",     6667 },
+  { "sly",     6855 },
+  { "slz",     4052 },
+  { "sm",      6700 },
+  { "sma",     7211 },
+  { "smb",     7012 },
+  { "smc",     7082 },
+  { "smd",     6683 },
+  { "sme",     5276 },
+  { "smf",     460  },
+  { "smg",     7011 },
+  { "smh",     6697 },
+  { "smi",     6698 },
+  { "smj",     4010 },
+  { "smk",     959  },
+  { "sml",     1260 },
+  { "smm",     4808 },
+  { "smn",     2642 },
+  { "smo",     6700 },
+  { "smp",     6685 },
+  { "smq",     6699 },
+  { "smr",     7015 },
+  { "sms",     7057 },
+  { "smt",     7016 },
+  { "smu",     7086 },
+  { "smv",     6707 },
+  { "smw",     7290 },
+  { "smx",     6691 },
+  { "smy",     6871 },
+  { "smz",     7014 },
+  { "sn",      6953 },
+  { "sna",     6953 },
+  { "snb",     6830 },
+  { "snc",     7019 },
+  { "snd",     7022 },
+  { "sne",     740  },
+  { "snf",     5183 },
+  { "sng",     6735 },
+  { "snh",     6949 },
+  { "sni",     6884 },
+  { "snj",     6569 },
+  { "snk",     7099 },
+  { "snl",     6739 },
+  { "snm",     7185 },
+  { "snn",     7034 },
+  { "sno",     7067 },
+  { "snp",     6972 },
+  { "snq",     6747 },
+  { "snr",     6992 },
+  { "sns",     7139 },
+  { "snu",     6880 },
+  { "snv",     6628 },
+  { "snw",     6856 },
+  { "snx",     6682 },
+  { "sny",     6751 },
+  { "snz",     3456 },
+  { "so",      7083 },
+  { "soa",     7614 },
+  { "sob",     7070 },
+  { "soc",     7068 },
+  { "sod",     7096 },
+  { "soe",     7095 },
+  { "sog",     7073 },
+  { "soh",     124  },
+  { "soi",     7097 },
+  { "soj",     7074 },
+  { "sok",     7076 },
+  { "sol",     7081 },
+  { "som",     7083 },
+  { "son",     7092 },
+  { "soo",     7094 },
+  { "sop",     7091 },
+  { "soq",     3004 },
+  { "sor",     7085 },
+  { "sos",     6836 },
+  { "sot",     7215 },
+  { "sou",     7217 },
+  { "sov",     7100 },
+  { "sow",     7242 },
+  { "sox",     7330 },
+  { "soy",     4617 },
+  { "soz",     7557 },
+  { "spa",     7246 },
+  { "spb",     6888 },
+  { "spc",     6776 },
+  { "spd",     6646 },
+  { "spe",     6889 },
+  { "spg",     6971 },
+  { "spi",     6773 },
+  { "spk",     6881 },
+  { "spl",     6857 },
+  { "spm",     151  },
+  { "spn",     6733 },
+  { "spo",     7248 },
+  { "spp",     7300 },
+  { "spq",     3969 },
+  { "spr",     6771 },
+  { "sps",     6774 },
+  { "spt",     7247 },
+  { "spu",     6775 },
+  { "spv",     6693 },
+  { "spx",     7132 },
+  { "spy",     6639 },
+  { "sq",      174  },
+  { "sqa",     6918 },
+  { "sqh",     6929 },
+  { "sqi",     174  },
+  { "sqj",     173  },
+  { "sqk",     172  },
+  { "sqm",     7287 },
+  { "sqn",     7312 },
+  { "sqo",     7107 },
+  { "sqq",     7114 },
+  { "sqr",     6983 },
+  { "sqs",     7252 },
+  { "sqt",     7103 },
+  { "squ",     7249 },
+  { "sqx",     3513 },
+  { "sr",      6892 },
+  { "sra",     6797 },
+  { "srb",     7104 },
+  { "src",     3932 },
+  { "srd",     6789 },
+  { "sre",     6782 },
+  { "srf",     4860 },
+  { "srg",     7286 },
+  { "srh",     6791 },
+  { "sri",     7041 },
+  { "srk",     6902 },
+  { "srl",     2704 },
+  { "srm",     6784 },
+  { "srn",     7250 },
+  { "sro",     1179 },
+  { "srp",     6892 },
+  { "srq",     7042 },
+  { "srr",     6895 },
+  { "srs",     6793 },
+  { "srt",     6807 },
+  { "sru",     7311 },
+  { "srv",     7214 },
+  { "srw",     6901 },
+  { "srx",     7043 },
+  { "sry",     6891 },
+  { "srz",     6915 },
+  { "ss",      7323 },
+  { "ssa",     5122 },
+  { "ssb",     7210 },
+  { "ssc",     7266 },
+  { "ssd",     7044 },
+  { "sse",     594  },
+  { "ssf",     7620 },
+  { "ssg",     6841 },
+  { "ssh",     6945 },
+  { "ssi",     6753 },
+  { "ssj",     6810 },
+  { "ssk",     7296 },
+  { "ssl",     8339 },
+  { "ssm",     6870 },
+  { "ssn",     8121 },
+  { "sso",     7046 },
+  { "ssp",     7245 },
+  { "ssq",     7069 },
+  { "ssr",     7327 },
+  { "sss",     7338 },
+  { "sst",     7018 },
+  { "ssu",     7314 },
+  { "ssv",     6925 },
+  { "ssw",     7323 },
+  { "ssx",     6695 },
+  { "ssy",     6652 },
+  { "ssz",     6882 },
+  { "st",      7215 },
+  { "sta",     6908 },
+  { "stb",     5279 },
+  { "std",     6887 },
+  { "ste",     3864 },
+  { "stf",     6905 },
+  { "stg",     7790 },
+  { "sth",     6936 },
+  { "sti",     1075 },
+  { "stj",     4391 },
+  { "stk",     344  },
+  { "stl",     7258 },
+  { "stm",     6906 },
+  { "stn",     5566 },
+  { "sto",     7260 },
+  { "stp",     7152 },
+  { "stq",     6802 },
+  { "str",     7261 },
+  { "sts",     6963 },
+  { "stt",     1044 },
+  { "stu",     6706 },
+  { "stv",     7008 },
+  { "stw",     6801 },
+  { "sty",     6977 },
+  { "su",      7297 },
+  { "sua",     7285 },
+  { "sub",     7280 },
+  { "suc",     8340 },
+  { "sue",     7274 },
+  { "sug",     7276 },
+  { "sui",     7279 },
+  { "suj",     6960 },
+  { "suk",     7281 },
+  { "sul",     7305 },
+  { "sum",     7294 },
+  { "sun",     7297 },
+  { "suo",     1011 },
+  { "suq",     7681 },
+  { "sur",     4825 },
+  { "sus",     7313 },
+  { "sut",     7269 },
+  { "suv",     5914 },
+  { "suw",     7291 },
+  { "sux",     7292 },
+  { "suy",     7317 },
+  { "suz",     7298 },
+  { "sv",      7325 },
+  { "sva",     7318 },
+  { "svb",     7952 },
+  { "svc",     8094 },
+  { "sve",     6897 },
+  { "svk",     7063 },
+  { "svm",     7061 },
+  { "svr",     6811 },
+  { "svs",     6813 },
+  { "svx",     7055 },
+  { "sw",      7321 },
+  { "swa",     7321 },
+  { "swb",     4285 },
+  { "swc",     1456 },
+  { "swe",     7325 },
+  { "swf",     6894 },
+  { "swg",     7319 },
+  { "swh",     7320 },
+  { "swi",     7278 },
+  { "swj",     7037 },
+  { "swk",     4166 },
+  { "swl",     7324 },
+  { "swm",     6702 },
+  { "swn",     6818 },
+  { "swo",     6922 },
+  { "swp",     7264 },
+  { "swq",     6926 },
+  { "swr",     6815 },
+  { "sws",     6861 },
+  { "swt",     6817 },
+  { "swu",     7316 },
+  { "swv",     6933 },
+  { "sww",     7241 },
+  { "swx",     7308 },
+  { "swy",     6795 },
+  { "sxb",     7265 },
+  { "sxc",     6979 },
+  { "sxe",     6990 },
+  { "sxg",     6962 },
+  { "sxk",     7177 },
+  { "sxl",     6858 },
+  { "sxm",     6705 },
+  { "sxn",     6740 },
+  { "sxo",     7108 },
+  { "sxr",     6633 },
+  { "sxs",     6799 },
+  { "sxu",     7996 },
+  { "sxw",     6819 },
+  { "sya",     6973 },
+  { "syb",     1263 },
+  { "syc",     1427 },
+  { "syd",     6703 },
+  { "syi",     6849 },
+  { "syk",     7282 },
+  { "syl",     7332 },
+  { "sym",     4405 },
+  { "syn",     6875 },
+  { "syo",     7299 },
+  { "syr",     7333 },
+  { "sys",     7032 },
+  { "syw",     2909 },
+  { "syx",     6688 },
+  { "syy",     158  },
+  { "sza",     6867 },
+  { "szb",     5024 },
+  { "szc",     6865 },
+  { "szd",     6900 },
+  { "sze",     6912 },
+  { "szg",     6879 },
+  { "szl",     7004 },
+  { "szn",     7284 },
+  { "szp",     7262 },
+  { "szs",     7079 },
+  { "szv",     2717 },
+  { "szw",     6814 },
+  { "szy",     6665 },
+  { "ta",      7443 },
+  { "taa",     3987 },
+  { "tab",     7348 },
+  { "tac",     3989 },
+  { "tad",     7500 },
+  { "tae",     7481 },
+  { "taf",     7478 },
+  { "tag",     7373 },
+  { "tah",     7376 },
+  { "tai",     7392 },
+  { "taj",     1854 },
+  { "tak",     7416 },
+  { "tal",     7415 },
+  { "tam",     7443 },
+  { "tan",     7457 },
+  { "tao",     8501 },
+  { "tap",     7342 },
+  { "taq",     7436 },
+  { "tar",     1266 },
+  { "tas",     7515 },
+  { "tat",     7494 },
+  { "tau",     7999 },
+  { "tav",     7495 },
+  { "taw",     7393 },
+  { "tax",     7444 },
+  { "tay",     431  },
+  { "taz",     7715 },
+  { "tba",     106  },
+  { "tbb",     7475 },
+  { "tbc",     7410 },
+  { "tbd",     2941 },
+  { "tbe",     7469 },
+  { "tbf",     4230 },
+  { "tbg",     5216 },
+  { "tbh",     1629 },
+  { "tbi",     2068 },
+  { "tbj",     7637 },
+  { "tbk",     1168 },
+  { "tbl",     7521 },
+  { "tbm",     7369 },
+  { "tbn",     695  },
+  { "tbo",     7507 },
+  { "tbp",     7512 },
+  { "tbq",     7641 },
+  { "tbr",     7853 },
+  { "tbs",     7467 },
+  { "tbt",     7552 },
+  { "tbu",     7830 },
+  { "tbv",     7713 },
+  { "tbw",     7368 },
+  { "tbx",     3041 },
+  { "tby",     7344 },
+  { "tbz",     1672 },
+  { "tca",     7643 },
+  { "tcb",     7449 },
+  { "tcc",     1575 },
+  { "tcd",     7361 },
+  { "tce",     7222 },
+  { "tcf",     4190 },
+  { "tcg",     7431 },
+  { "tch",     7885 },
+  { "tci",     8429 },
+  { "tck",     7522 },
+  { "tcl",     7433 },
+  { "tcm",     7450 },
+  { "tcn",     7642 },
+  { "tco",     7498 },
+  { "tcp",     7514 },
+  { "tcq",     2933 },
+  { "tcs",     7768 },
+  { "tct",     7340 },
+  { "tcu",     7151 },
+  { "tcw",     7528 },
+  { "tcx",     7716 },
+  { "tcy",     7844 },
+  { "tcz",     7612 },
+  { "tda",     7370 },
+  { "tdb",     5645 },
+  { "tdc",     1916 },
+  { "tdd",     7388 },
+  { "tde",     7679 },
+  { "tdf",     7419 },
+  { "tdg",     8341 },
+  { "tdh",     7632 },
+  { "tdi",     7736 },
+  { "tdj",     7406 },
+  { "tdk",     7438 },
+  { "tdl",     7301 },
+  { "tdm",     7487 },
+  { "tdn",     7745 },
+  { "tdo",     7555 },
+  { "tdq",     7683 },
+  { "tdr",     7717 },
+  { "tds",     1728 },
+  { "tdt",     7601 },
+  { "tdu",     7561 },
+  { "tdv",     7765 },
+  { "tdx",     7455 },
+  { "tdy",     7359 },
+  { "te",      7548 },
+  { "tea",     7558 },
+  { "teb",     7598 },
+  { "tec",     7588 },
+  { "ted",     7579 },
+  { "tee",     2528 },
+  { "tef",     7585 },
+  { "teg",     7542 },
+  { "teh",     7535 },
+  { "tei",     7769 },
+  { "tek",     2569 },
+  { "tel",     7548 },
+  { "tem",     7665 },
+  { "ten",     7430 },
+  { "teo",     7595 },
+  { "tep",     7575 },
+  { "teq",     7556 },
+  { "ter",     7584 },
+  { "tes",     7568 },
+  { "tet",     7600 },
+  { "teu",     7101 },
+  { "tev",     7574 },
+  { "tew",     7604 },
+  { "tex",     7572 },
+  { "tey",     7843 },
+  { "tez",     7599 },
+  { "tfi",     7719 },
+  { "tfn",     7451 },
+  { "tfo",     7532 },
+  { "tfr",     7587 },
+  { "tft",     7590 },
+  { "tg",      7404 },
+  { "tga",     6651 },
+  { "tgb",     7712 },
+  { "tgc",     7651 },
+  { "tgd",     1419 },
+  { "tge",     1819 },
+  { "tgf",     1287 },
+  { "tgg",     7459 },
+  { "tgh",     7707 },
+  { "tgi",     3804 },
+  { "tgj",     7371 },
+  { "tgk",     7404 },
+  { "tgl",     7366 },
+  { "tgn",     7453 },
+  { "tgo",     7272 },
+  { "tgp",     7465 },
+  { "tgq",     7792 },
+  { "tgr",     7480 },
+  { "tgs",     5338 },
+  { "tgt",     1265 },
+  { "tgu",     7460 },
+  { "tgv",     7672 },
+  { "tgw",     7374 },
+  { "tgx",     7372 },
+  { "tgy",     7721 },
+  { "tgz",     7365 },
+  { "th",      7615 },
+  { "tha",     7615 },
+  { "thc",     7382 },
+  { "thd",     3613 },
+  { "the",     1370 },
+  { "thf",     7619 },
+  { "thh",     5280 },
+  { "thi",     7386 },
+  { "thk",     7621 },
+  { "thl",     1555 },
+  { "thm",     99   },
+  { "thn",     7611 },
+  { "thp",     7627 },
+  { "thq",     3333 },
+  { "thr",     5984 },
+  { "ths",     7617 },
+  { "tht",     7377 },
+  { "thu",     7634 },
+  { "thv",     7375 },
+  { "thw",     7631 },
+  { "thx",     7624 },
+  { "thy",     7610 },
+  { "thz",     7518 },
+  { "ti",      7654 },
+  { "tia",     7645 },
+  { "tib",     7640 },
+  { "tic",     7677 },
+  { "tid",     7646 },
+  { "tie",     7671 },
+  { "tif",     7650 },
+  { "tig",     7653 },
+  { "tih",     7668 },
+  { "tii",     7649 },
+  { "tij",     7662 },
+  { "tik",     7657 },
+  { "til",     7660 },
+  { "tim",     7664 },
+  { "tin",     7670 },
+  { "tio",     7573 },
+  { "tip",     7791 },
+  { "tiq",     7689 },
+  { "tir",     7654 },
+  { "tis",     4357 },
+  { "tit",     7673 },
+  { "tiu",     51   },
+  { "tiv",     7685 },
+  { "tiw",     7687 },
+  { "tix",     7219 },
+  { "tiy",     7682 },
+  { "tiz",     7383 },
+  { "tja",     7407 },
+  { "tjg",     7866 },
+  { "tji",     5288 },
+  { "tjj",     7691 },
+  { "tjl",     7384 },
+  { "tjm",     7667 },
+  { "tjn",     7751 },
+  { "tjo",     7550 },
+  { "tjp",     7692 },
+  { "tjs",     7221 },
+  { "tju",     7693 },
+  { "tjw",     1679 },
+  { "tk",      7884 },
+  { "tka",     7798 },
+  { "tkb",     1066 },
+  { "tkd",     7839 },
+  { "tke",     7414 },
+  { "tkf",     7840 },
+  { "tkg",     7592 },
+  { "tkk",     7411 },
+  { "tkl",     7726 },
+  { "tkm",     7408 },
+  { "tkn",     7730 },
+  { "tkp",     7658 },
+  { "tkq",     7531 },
+  { "tkr",     7802 },
+  { "tks",     7409 },
+  { "tkt",     3114 },
+  { "tku",     7995 },
+  { "tkv",     4795 },
+  { "tkw",     7525 },
+  { "tkx",     7463 },
+  { "tkz",     7412 },
+  { "tl",      7366 },
+  { "tla",     7239 },
+  { "tlb",     7710 },
+  { "tlc",     8570 },
+  { "tld",     7417 },
+  { "tlf",     7547 },
+  { "tlg",     7718 },
+  { "tlh",     3322 },
+  { "tli",     7701 },
+  { "tlj",     7420 },
+  { "tlk",     7423 },
+  { "tll",     7596 },
+  { "tlm",     7733 },
+  { "tln",     7424 },
+  { "tlo",     7422 },
+  { "tlp",     2019 },
+  { "tlq",     7385 },
+  { "tlr",     7421 },
+  { "tls",     7440 },
+  { "tlt",     7112 },
+  { "tlu",     7842 },
+  { "tlv",     7418 },
+  { "tlw",     7138 },
+  { "tlx",     3234 },
+  { "tly",     7428 },
+  { "tma",     7429 },
+  { "tmb",     3112 },
+  { "tmc",     7847 },
+  { "tmd",     2417 },
+  { "tme",     7789 },
+  { "tmf",     7706 },
+  { "tmg",     7591 },
+  { "tmh",     7435 },
+  { "tmi",     7893 },
+  { "tmj",     6686 },
+  { "tmk",     5302 },
+  { "tml",     7445 },
+  { "tmm",     7390 },
+  { "tmn",     7432 },
+  { "tmo",     7560 },
+  { "tmp",     7387 },
+  { "tmq",     7851 },
+  { "tmr",     2808 },
+  { "tms",     7663 },
+  { "tmt",     7491 },
+  { "tmu",     2568 },
+  { "tmv",     7553 },
+  { "tmw",     7562 },
+  { "tmy",     7442 },
+  { "tmz",     7434 },
+  { "tn",      7826 },
+  { "tna",     7353 },
+  { "tnb",     8345 },
+  { "tnc",     7470 },
+  { "tnd",     294  },
+  { "tne",     7674 },
+  { "tnf",     7466 },
+  { "tng",     7708 },
+  { "tnh",     4107 },
+  { "tni",     7454 },
+  { "tnk",     3636 },
+  { "tnl",     3834 },
+  { "tnm",     7349 },
+  { "tnn",     5217 },
+  { "tno",     7766 },
+  { "tnp",     8355 },
+  { "tnq",     7397 },
+  { "tnr",     4840 },
+  { "tns",     7571 },
+  { "tnt",     7755 },
+  { "tnu",     7516 },
+  { "tnv",     7458 },
+  { "tnw",     7753 },
+  { "tnx",     7456 },
+  { "tny",     7750 },
+  { "tnz",     7563 },
+  { "to",      7748 },
+  { "tob",     7705 },
+  { "toc",     1473 },
+  { "tod",     7735 },
+  { "toe",     7740 },
+  { "tof",     2223 },
+  { "tog",     7747 },
+  { "toh",     2219 },
+  { "toi",     7749 },
+  { "toj",     7723 },
+  { "tok",     7729 },
+  { "tol",     7734 },
+  { "tom",     7739 },
+  { "ton",     7748 },
+  { "too",     8446 },
+  { "top",     5665 },
+  { "toq",     7758 },
+  { "tor",     7720 },
+  { "tos",     2458 },
+  { "tou",     7626 },
+  { "tov",     8001 },
+  { "tow",     2801 },
+  { "tox",     7711 },
+  { "toy",     7757 },
+  { "toz",     7702 },
+  { "tpa",     7499 },
+  { "tpc",     513  },
+  { "tpe",     7676 },
+  { "tpf",     7485 },
+  { "tpg",     3534 },
+  { "tpi",     7724 },
+  { "tpj",     7477 },
+  { "tpk",     7873 },
+  { "tpl",     7695 },
+  { "tpm",     7448 },
+  { "tpn",     7872 },
+  { "tpo",     7389 },
+  { "tpp",     5814 },
+  { "tpq",     7838 },
+  { "tpr",     7870 },
+  { "tpt",     7694 },
+  { "tpu",     7447 },
+  { "tpv",     7452 },
+  { "tpw",     7875 },
+  { "tpx",     30   },
+  { "tpy",     7799 },
+  { "tpz",     7675 },
+  { "tqb",     7554 },
+  { "tql",     3816 },
+  { "tqm",     7887 },
+  { "tqn",     7570 },
+  { "tqo",     7704 },
+  { "tqp",     7744 },
+  { "tqq",     7867 },
+  { "tqr",     7767 },
+  { "tqt",     8344 },
+  { "tqu",     7779 },
+  { "tqw",     7752 },
+  { "tr",      7883 },
+  { "tra",     7678 },
+  { "trb",     7582 },
+  { "trc",     1459 },
+  { "trd",     7877 },
+  { "tre",     1804 },
+  { "trf",     7795 },
+  { "trg",     3911 },
+  { "trh",     7876 },
+  { "tri",     7797 },
+  { "trj",     7760 },
+  { "trk",     7881 },
+  { "trl",     7787 },
+  { "trm",     7788 },
+  { "trn",     7796 },
+  { "tro",     7479 },
+  { "trp",     3354 },
+  { "trq",     6721 },
+  { "trr",     7501 },
+  { "trs",     1331 },
+  { "trt",     7860 },
+  { "tru",     7886 },
+  { "trv",     6834 },
+  { "trw",     7770 },
+  { "trx",     7793 },
+  { "try",     7888 },
+  { "trz",     7771 },
+  { "ts",      7818 },
+  { "tsa",     7801 },
+  { "tsb",     7805 },
+  { "tsc",     7825 },
+  { "tsd",     7803 },
+  { "tse",     7865 },
+  { "tsf",     7236 },
+  { "tsg",     7502 },
+  { "tsh",     7824 },
+  { "tsi",     7813 },
+  { "tsj",     7809 },
+  { "tsk",     7807 },
+  { "tsl",     7800 },
+  { "tsm",     7882 },
+  { "tsn",     7826 },
+  { "tso",     7818 },
+  { "tsp",     5287 },
+  { "tsq",     7613 },
+  { "tsr",     138  },
+  { "tss",     7402 },
+  { "tst",     7746 },
+  { "tsu",     7820 },
+  { "tsv",     7817 },
+  { "tsw",     7814 },
+  { "tsx",     4756 },
+  { "tsy",     7526 },
+  { "tsz",     5910 },
+  { "tt",      7494 },
+  { "tta",     7890 },
+  { "ttb",     2067 },
+  { "ttc",     7545 },
+  { "ttd",     7496 },
+  { "tte",     1138 },
+  { "ttf",     7869 },
+  { "ttg",     7891 },
+  { "tth",     7998 },
+  { "tti",     7709 },
+  { "ttj",     7756 },
+  { "ttk",     7778 },
+  { "ttl",     7773 },
+  { "ttm",     5289 },
+  { "ttn",     7782 },
+  { "tto",     3986 },
+  { "ttp",     7737 },
+  { "ttq",     7508 },
+  { "ttr",     7581 },
+  { "tts",     5226 },
+  { "ttt",     4814 },
+  { "ttu",     7761 },
+  { "ttv",     7684 },
+  { "ttw",     3956 },
+  { "tty",     6996 },
+  { "ttz",     7822 },
+  { "tua",     8356 },
+  { "tub",     7916 },
+  { "tuc",     4818 },
+  { "tud",     7902 },
+  { "tue",     7903 },
+  { "tuf",     1267 },
+  { "tug",     7862 },
+  { "tuh",     7497 },
+  { "tui",     7874 },
+  { "tuj",     7834 },
+  { "tuk",     7884 },
+  { "tul",     7841 },
+  { "tum",     7849 },
+  { "tun",     7863 },
+  { "tuo",     7831 },
+  { "tup",     7871 },
+  { "tuq",     7529 },
+  { "tur",     7883 },
+  { "tus",     7889 },
+  { "tut",     196  },
+  { "tuu",     7895 },
+  { "tuv",     7880 },
+  { "tuw",     7861 },
+  { "tux",     7901 },
+  { "tuy",     7832 },
+  { "tuz",     7879 },
+  { "tva",     8053 },
+  { "tvd",     7823 },
+  { "tve",     7524 },
+  { "tvk",     7140 },
+  { "tvl",     7896 },
+  { "tvm",     7546 },
+  { "tvn",     7505 },
+  { "tvo",     7647 },
+  { "tvs",     7504 },
+  { "tvt",     7892 },
+  { "tvu",     7858 },
+  { "tvw",     6835 },
+  { "tvx",     7401 },
+  { "tvy",     7666 },
+  { "tw",      7907 },
+  { "twa",     7904 },
+  { "twb",     8342 },
+  { "twc",     7594 },
+  { "twd",     7906 },
+  { "twe",     7603 },
+  { "twf",     5285 },
+  { "twg",     7586 },
+  { "twh",     7381 },
+  { "twi",     7907 },
+  { "twl",     7511 },
+  { "twm",     7510 },
+  { "twn",     7905 },
+  { "two",     7827 },
+  { "twp",     1944 },
+  { "twq",     7488 },
+  { "twr",     7237 },
+  { "twt",     7878 },
+  { "twu",     7589 },
+  { "tww",     7899 },
+  { "twx",     7605 },
+  { "twy",     7513 },
+  { "txa",     7738 },
+  { "txb",     7728 },
+  { "txc",     7808 },
+  { "txe",     7775 },
+  { "txg",     7468 },
+  { "txh",     7629 },
+  { "txi",     2617 },
+  { "txj",     7483 },
+  { "txm",     7741 },
+  { "txn",     8296 },
+  { "txo",     7774 },
+  { "txq",     7655 },
+  { "txr",     7486 },
+  { "txs",     7754 },
+  { "txt",     1418 },
+  { "txu",     3141 },
+  { "txx",     7493 },
+  { "txy",     7472 },
+  { "ty",      7376 },
+  { "tya",     7503 },
+  { "tye",     3665 },
+  { "tyh",     5408 },
+  { "tyi",     7543 },
+  { "tyj",     7380 },
+  { "tyl",     7630 },
+  { "tyn",     3375 },
+  { "typ",     7623 },
+  { "tyr",     7378 },
+  { "tys",     7912 },
+  { "tyt",     7913 },
+  { "tyu",     3497 },
+  { "tyv",     7897 },
+  { "tyx",     7544 },
+  { "tyy",     7688 },
+  { "tyz",     7914 },
+  { "tza",     7474 },
+  { "tzh",     7910 },
+  { "tzj",     7909 },
+  { "tzl",     7425 },
+  { "tzm",     1229 },
+  { "tzn",     7833 },
+  { "tzo",     7911 },
+  { "tzx",     7351 },
+  { "uam",     7919 },
+  { "uan",     3500 },
+  { "uar",     7399 },
+  { "uba",     7922 },
+  { "ubi",     7923 },
+  { "ubl",     1057 },
+  { "ubr",     7924 },
+  { "ubu",     7966 },
+  { "uby",     7925 },
+  { "uda",     7927 },
+  { "ude",     7929 },
+  { "udg",     4763 },
+  { "udi",     7928 },
+  { "udj",     7940 },
+  { "udl",     8425 },
+  { "udm",     7930 },
+  { "udu",     7931 },
+  { "ues",     3291 },
+  { "ufi",     7932 },
+  { "ug",      7938 },
+  { "uga",     7934 },
+  { "ugb",     3531 },
+  { "uge",     7935 },
+  { "ugh",     3504 },
+  { "ugn",     7933 },
+  { "ugo",     7936 },
+  { "ugy",     8028 },
+  { "uha",     7937 },
+  { "uhn",     1545 },
+  { "uig",     7938 },
+  { "uis",     7939 },
+  { "uiv",     2745 },
+  { "uji",     7471 },
+  { "uk",      7947 },
+  { "uka",     2882 },
+  { "ukg",     7949 },
+  { "ukh",     7942 },
+  { "uki",     3518 },
+  { "ukk",     4754 },
+  { "ukl",     7946 },
+  { "ukp",     7944 },
+  { "ukq",     7950 },
+  { "ukr",     7947 },
+  { "uks",     8026 },
+  { "uku",     7948 },
+  { "ukv",     3528 },
+  { "ukw",     7951 },
+  { "uky",     3614 },
+  { "ula",     2055 },
+  { "ulb",     7956 },
+  { "ulc",     7953 },
+  { "ule",     4011 },
+  { "ulf",     8036 },
+  { "uli",     7954 },
+  { "ulk",     4507 },
+  { "ull",     7955 },
+  { "ulm",     7957 },
+  { "uln",     7986 },
+  { "ulu",     7961 },
+  { "ulw",     7958 },
+  { "uma",     7963 },
+  { "umb",     7968 },
+  { "umc",     4344 },
+  { "umd",     7964 },
+  { "umg",     4720 },
+  { "umi",     7943 },
+  { "umm",     7973 },
+  { "umn",     4146 },
+  { "umo",     7974 },
+  { "ump",     7975 },
+  { "umr",     7967 },
+  { "ums",     5735 },
+  { "umu",     4793 },
+  { "una",     5219 },
+  { "und",     7980 },
+  { "une",     7982 },
+  { "ung",     5042 },
+  { "uni",     7985 },
+  { "unk",     1924 },
+  { "unm",     7977 },
+  { "unn",     3594 },
+  { "unp",     8400 },
+  { "unr",     4784 },
+  { "unu",     7988 },
+  { "unx",     4780 },
+  { "unz",     7979 },
+  { "uok",     7989 },
+  { "uon",     3540 },
+  { "upi",     7970 },
+  { "upv",     8019 },
+  { "ur",      8013 },
+  { "ura",     8010 },
+  { "urb",     8027 },
+  { "urc",     8020 },
+  { "urd",     8013 },
+  { "ure",     8021 },
+  { "urf",     8005 },
+  { "urg",     8016 },
+  { "urh",     8014 },
+  { "uri",     8017 },
+  { "urj",     8008 },
+  { "urk",     8006 },
+  { "url",     8007 },
+  { "urm",     8009 },
+  { "urn",     8024 },
+  { "uro",     8003 },
+  { "urp",     8023 },
+  { "urr",     3817 },
+  { "urt",     8012 },
+  { "uru",     8030 },
+  { "urv",     8025 },
+  { "urw",     7102 },
+  { "urx",     8018 },
+  { "ury",     5547 },
+  { "urz",     8022 },
+  { "usa",     8033 },
+  { "ush",     8034 },
+  { "usi",     8038 },
+  { "usk",     8031 },
+  { "usp",     8037 },
+  { "uss",     8738 },
+  { "usu",     8044 },
+  { "uta",     5555 },
+  { "ute",     8040 },
+  { "uth",     8739 },
+  { "utp",     219  },
+  { "utr",     1975 },
+  { "utu",     8042 },
+  { "uum",     8029 },
+  { "uun",     3541 },
+  { "uur",     8004 },
+  { "uuu",     7917 },
+  { "uve",     8297 },
+  { "uvh",     8015 },
+  { "uvl",     3970 },
+  { "uwa",     3532 },
+  { "uya",     1703 },
+  { "uz",      8046 },
+  { "uzb",     8046 },
+  { "uzn",     5290 },
+  { "uzs",     7223 },
+  { "vaa",     8049 },
+  { "vae",     8057 },
+  { "vaf",     8050 },
+  { "vag",     8054 },
+  { "vah",     8071 },
+  { "vai",     8055 },
+  { "vaj",     6848 },
+  { "val",     8076 },
+  { "vam",     8067 },
+  { "van",     8061 },
+  { "vao",     8070 },
+  { "vap",     8056 },
+  { "var",     2520 },
+  { "vas",     8074 },
+  { "vau",     8069 },
+  { "vav",     8073 },
+  { "vay",     8265 },
+  { "vbb",     7141 },
+  { "vbk",     7230 },
+  { "ve",      8079 },
+  { "vec",     8080 },
+  { "ved",     8075 },
+  { "vel",     8077 },
+  { "vem",     8078 },
+  { "ven",     8079 },
+  { "veo",     8084 },
+  { "vep",     8085 },
+  { "ver",     4668 },
+  { "vgr",     8052 },
+  { "vgt",     8103 },
+  { "vi",      8090 },
+  { "vic",     8097 },
+  { "vid",     8088 },
+  { "vie",     8090 },
+  { "vif",     8092 },
+  { "vig",     8089 },
+  { "vil",     8091 },
+  { "vin",     8096 },
+  { "vis",     8098 },
+  { "vit",     8099 },
+  { "viv",     2594 },
+  { "vka",     3086 },
+  { "vki",     2608 },
+  { "vkj",     3522 },
+  { "vkk",     3124 },
+  { "vkl",     3538 },
+  { "vkm",     2972 },
+  { "vkn",     3426 },
+  { "vko",     3337 },
+  { "vkp",     3421 },
+  { "vkt",     7567 },
+  { "vku",     3595 },
+  { "vkz",     3428 },
+  { "vlp",     8062 },
+  { "vls",     8102 },
+  { "vma",     4350 },
+  { "vmb",     682  },
+  { "vmc",     2863 },
+  { "vmd",     4762 },
+  { "vme",     1801 },
+  { "vmf",     4111 },
+  { "vmg",     4020 },
+  { "vmh",     4298 },
+  { "vmi",     4610 },
+  { "vmj",     2742 },
+  { "vmk",     4138 },
+  { "vml",     4183 },
+  { "vmm",     4606 },
+  { "vmp",     7243 },
+  { "vmq",     7244 },
+  { "vmr",     4311 },
+  { "vms",     4657 },
+  { "vmu",     4775 },
+  { "vmv",     8060 },
+  { "vmw",     4133 },
+  { "vmx",     7437 },
+  { "vmy",     497  },
+  { "vmz",     4421 },
+  { "vnk",     8068 },
+  { "vnm",     8095 },
+  { "vnp",     8111 },
+  { "vo",      8105 },
+  { "vol",     8105 },
+  { "vor",     8108 },
+  { "vot",     8109 },
+  { "vra",     8086 },
+  { "vro",     8116 },
+  { "vrs",     8072 },
+  { "vrt",     1106 },
+  { "vsi",     4661 },
+  { "vsl",     8082 },
+  { "vsv",     8058 },
+  { "vto",     8100 },
+  { "vum",     8110 },
+  { "vun",     8112 },
+  { "vut",     8114 },
+  { "vwa",     470  },
+  { "wa",      8174 },
+  { "waa",     8172 },
+  { "wab",     8122 },
+  { "wac",     8245 },
+  { "wad",     8184 },
+  { "wae",     8177 },
+  { "waf",     8164 },
+  { "wag",     8118 },
+  { "wah",     8254 },
+  { "wai",     8226 },
+  { "waj",     8135 },
+  { "wak",     8160 },
+  { "wal",     8388 },
+  { "wam",     8187 },
+  { "wan",     8190 },
+  { "wao",     8215 },
+  { "wap",     8214 },
+  { "waq",     8141 },
+  { "war",     8221 },
+  { "was",     8247 },
+  { "wat",     3023 },
+  { "wau",     8256 },
+  { "wav",     8158 },
+  { "waw",     8154 },
+  { "wax",     8251 },
+  { "way",     8262 },
+  { "waz",     8189 },
+  { "wba",     8218 },
+  { "wbb",     8123 },
+  { "wbe",     8228 },
+  { "wbf",     8217 },
+  { "wbh",     8194 },
+  { "wbi",     8115 },
+  { "wbj",     165  },
+  { "wbk",     8145 },
+  { "wbl",     8163 },
+  { "wbm",     8117 },
+  { "wbp",     8233 },
+  { "wbq",     8127 },
+  { "wbr",     8139 },
+  { "wbs",     8283 },
+  { "wbt",     8235 },
+  { "wbv",     8156 },
+  { "wbw",     8383 },
+  { "wca",     8529 },
+  { "wci",     8125 },
+  { "wdd",     8197 },
+  { "wdg",     8126 },
+  { "wdj",     8132 },
+  { "wdk",     8129 },
+  { "wdt",     8277 },
+  { "wdu",     8133 },
+  { "wdy",     8131 },
+  { "wea",     8351 },
+  { "wec",     8433 },
+  { "wed",     8267 },
+  { "weg",     8278 },
+  { "weh",     8268 },
+  { "wei",     3317 },
+  { "wel",     8273 },
+  { "wem",     8276 },
+  { "wen",     7105 },
+  { "weo",     8274 },
+  { "wep",     8349 },
+  { "wer",     8279 },
+  { "wes",     1176 },
+  { "wet",     5740 },
+  { "weu",     6006 },
+  { "wew",     8269 },
+  { "wfg",     8468 },
+  { "wga",     8138 },
+  { "wgb",     8136 },
+  { "wgg",     8203 },
+  { "wgi",     8144 },
+  { "wgo",     8146 },
+  { "wgu",     8376 },
+  { "wgw",     8137 },
+  { "wgy",     8237 },
+  { "wha",     7113 },
+  { "whg",     5218 },
+  { "whk",     8143 },
+  { "whu",     8142 },
+  { "wib",     7220 },
+  { "wic",     8357 },
+  { "wie",     8362 },
+  { "wif",     8364 },
+  { "wig",     8361 },
+  { "wih",     8365 },
+  { "wii",     4585 },
+  { "wij",     8363 },
+  { "wik",     8367 },
+  { "wil",     8369 },
+  { "wim",     8366 },
+  { "win",     2486 },
+  { "wir",     8375 },
+  { "wit",     8370 },
+  { "wiu",     8378 },
+  { "wiv",     8101 },
+  { "wiw",     8377 },
+  { "wiy",     8379 },
+  { "wja",     8155 },
+  { "wji",     8230 },
+  { "wka",     3623 },
+  { "wkb",     3552 },
+  { "wkd",     8162 },
+  { "wkl",     2955 },
+  { "wkr",     3157 },
+  { "wku",     3563 },
+  { "wkw",     8161 },
+  { "wky",     8204 },
+  { "wla",     8171 },
+  { "wlc",     4826 },
+  { "wle",     8386 },
+  { "wlg",     3560 },
+  { "wlh",     8270 },
+  { "wli",     8153 },
+  { "wlk",     8147 },
+  { "wll",     8169 },
+  { "wlm",     4558 },
+  { "wln",     8174 },
+  { "wlo",     8390 },
+  { "wlr",     8148 },
+  { "wls",     8173 },
+  { "wlu",     8410 },
+  { "wlv",     8360 },
+  { "wlw",     8166 },
+  { "wlx",     8168 },
+  { "wly",     8170 },
+  { "wma",     4397 },
+  { "wmb",     8181 },
+  { "wmc",     8180 },
+  { "wmd",     4202 },
+  { "wme",     8183 },
+  { "wmg",     8331 },
+  { "wmh",     8150 },
+  { "wmi",     8186 },
+  { "wmm",     4116 },
+  { "wmn",     8120 },
+  { "wmo",     8393 },
+  { "wms",     8182 },
+  { "wmt",     8175 },
+  { "wmw",     4828 },
+  { "wmx",     8394 },
+  { "wnb",     8191 },
+  { "wnc",     8208 },
+  { "wnd",     8196 },
+  { "wne",     8198 },
+  { "wng",     8202 },
+  { "wni",     4985 },
+  { "wnk",     8209 },
+  { "wnm",     8201 },
+  { "wnn",     8417 },
+  { "wno",     8207 },
+  { "wnp",     8192 },
+  { "wnu",     8032 },
+  { "wnw",     8371 },
+  { "wny",     8210 },
+  { "wo",      8391 },
+  { "woa",     3620 },
+  { "wob",     8431 },
+  { "woc",     8382 },
+  { "wod",     8387 },
+  { "woe",     8389 },
+  { "wof",     2103 },
+  { "wog",     8381 },
+  { "woi",     2973 },
+  { "wok",     3958 },
+  { "wol",     8391 },
+  { "wom",     8392 },
+  { "won",     8395 },
+  { "woo",     4271 },
+  { "wor",     8397 },
+  { "wos",     2405 },
+  { "wow",     8259 },
+  { "woy",     8352 },
+  { "wpc",     4073 },
+  { "wra",     8219 },
+  { "wrb",     8179 },
+  { "wrd",     8224 },
+  { "wrg",     8242 },
+  { "wrh",     8374 },
+  { "wri",     8229 },
+  { "wrk",     2131 },
+  { "wrl",     8232 },
+  { "wrm",     8240 },
+  { "wrn",     8234 },
+  { "wro",     8401 },
+  { "wrp",     8236 },
+  { "wrr",     8222 },
+  { "wrs",     8227 },
+  { "wru",     8239 },
+  { "wrv",     8241 },
+  { "wrw",     2302 },
+  { "wrx",     8134 },
+  { "wry",     4511 },
+  { "wrz",     8220 },
+  { "wsa",     8225 },
+  { "wsg",     55   },
+  { "wsi",     8421 },
+  { "wsk",     8248 },
+  { "wsr",     5567 },
+  { "wss",     8244 },
+  { "wsu",     8249 },
+  { "wsv",     8402 },
+  { "wtf",     8253 },
+  { "wth",     8252 },
+  { "wti",     814  },
+  { "wtk",     8250 },
+  { "wtm",     4524 },
+  { "wtw",     8404 },
+  { "wua",     8368 },
+  { "wub",     8416 },
+  { "wud",     8409 },
+  { "wuh",     8423 },
+  { "wul",     7005 },
+  { "wum",     8413 },
+  { "wun",     1092 },
+  { "wur",     8418 },
+  { "wut",     8422 },
+  { "wuu",     8407 },
+  { "wuv",     8424 },
+  { "wux",     8411 },
+  { "wuy",     8257 },
+  { "wwa",     8119 },
+  { "wwb",     8159 },
+  { "wwo",     8350 },
+  { "wwr",     8238 },
+  { "www",     8258 },
+  { "wxa",     8260 },
+  { "wxw",     8223 },
+  { "wya",     8426 },
+  { "wyb",     8200 },
+  { "wyi",     8384 },
+  { "wym",     8428 },
+  { "wyn",     8427 },
+  { "wyr",     8264 },
+  { "wyy",     8311 },
+  { "xaa",     265  },
+  { "xab",     6694 },
+  { "xac",     2889 },
+  { "xad",     43   },
+  { "xae",     67   },
+  { "xag",     86   },
+  { "xai",     2924 },
+  { "xaj",     351  },
+  { "xak",     4839 },
+  { "xal",     2966 },
+  { "xam",     8746 },
+  { "xan",     8437 },
+  { "xao",     3226 },
+  { "xap",     324  },
+  { "xaq",     335  },
+  { "xar",     3061 },
+  { "xas",     2980 },
+  { "xat",     3111 },
+  { "xau",     3127 },
+  { "xav",     8439 },
+  { "xaw",     3131 },
+  { "xay",     3138 },
+  { "xba",     2985 },
+  { "xbb",     3979 },
+  { "xbc",     527  },
+  { "xbd",     888  },
+  { "xbe",     862  },
+  { "xbg",     1090 },
+  { "xbi",     3376 },
+  { "xbj",     907  },
+  { "xbm",     4544 },
+  { "xbn",     3181 },
+  { "xbo",     956  },
+  { "xbp",     851  },
+  { "xbr",     2989 },
+  { "xbw",     2991 },
+  { "xbx",     2877 },
+  { "xby",     735  },
+  { "xcb",     1493 },
+  { "xcc",     1182 },
+  { "xce",     1223 },
+  { "xcg",     1416 },
+  { "xch",     1312 },
+  { "xcl",     1421 },
+  { "xcm",     1452 },
+  { "xcn",     1468 },
+  { "xco",     1384 },
+  { "xcr",     1197 },
+  { "xct",     1428 },
+  { "xcu",     1499 },
+  { "xcv",     1404 },
+  { "xcw",     1429 },
+  { "xcy",     1218 },
+  { "xda",     1569 },
+  { "xdc",     1521 },
+  { "xdk",     1631 },
+  { "xdm",     1870 },
+  { "xdo",     3639 },
+  { "xdq",     2930 },
+  { "xdy",     4171 },
+  { "xeb",     1860 },
+  { "xed",     2435 },
+  { "xeg",     8749 },
+  { "xel",     3171 },
+  { "xem",     3174 },
+  { "xep",     1939 },
+  { "xer",     8440 },
+  { "xes",     3206 },
+  { "xet",     8441 },
+  { "xeu",     3196 },
+  { "xfa",     1995 },
+  { "xga",     2091 },
+  { "xgb",     2158 },
+  { "xgd",     2292 },
+  { "xgf",     2071 },
+  { "xgg",     2251 },
+  { "xgi",     2127 },
+  { "xgl",     2097 },
+  { "xgm",     1632 },
+  { "xgn",     4684 },
+  { "xgr",     2133 },
+  { "xgu",     7984 },
+  { "xgw",     2353 },
+  { "xh",      8442 },
+  { "xha",     2412 },
+  { "xhc",     2549 },
+  { "xhd",     2378 },
+  { "xhe",     3236 },
+  { "xhm",     4552 },
+  { "xho",     8442 },
+  { "xhr",     2446 },
+  { "xht",     2424 },
+  { "xhu",     2555 },
+  { "xhv",     3255 },
+  { "xia",     8443 },
+  { "xib",     2575 },
+  { "xii",     8451 },
+  { "xil",     2629 },
+  { "xin",     8447 },
+  { "xip",     8450 },
+  { "xir",     8452 },
+  { "xis",     3307 },
+  { "xiv",     2653 },
+  { "xiy",     8449 },
+  { "xjb",     4586 },
+  { "xjt",     2761 },
+  { "xka",     2964 },
+  { "xkb",     5257 },
+  { "xkc",     3246 },
+  { "xkd",     4491 },
+  { "xke",     3201 },
+  { "xkf",     3235 },
+  { "xkg",     2912 },
+  { "xkh",     3056 },
+  { "xki",     3192 },
+  { "xkj",     2935 },
+  { "xkk",     2893 },
+  { "xkl",     4112 },
+  { "xkn",     3139 },
+  { "xko",     3293 },
+  { "xkp",     2876 },
+  { "xkq",     3432 },
+  { "xkr",     8436 },
+  { "xks",     3553 },
+  { "xkt",     3033 },
+  { "xku",     2869 },
+  { "xkv",     3213 },
+  { "xkw",     3176 },
+  { "xkx",     3096 },
+  { "xky",     7960 },
+  { "xkz",     3597 },
+  { "xla",     2997 },
+  { "xlb",     3977 },
+  { "xlc",     4039 },
+  { "xld",     4040 },
+  { "xle",     3831 },
+  { "xlg",     3878 },
+  { "xli",     3872 },
+  { "xln",     169  },
+  { "xlo",     3976 },
+  { "xlp",     3847 },
+  { "xls",     4030 },
+  { "xlu",     1496 },
+  { "xly",     1908 },
+  { "xma",     4811 },
+  { "xmb",     4447 },
+  { "xmc",     4134 },
+  { "xmd",     4452 },
+  { "xme",     4474 },
+  { "xmf",     4583 },
+  { "xmg",     4495 },
+  { "xmh",     3516 },
+  { "xmj",     4120 },
+  { "xmk",     259  },
+  { "xml",     4175 },
+  { "xmm",     4216 },
+  { "xmn",     4260 },
+  { "xmo",     4706 },
+  { "xmp",     3530 },
+  { "xmq",     3529 },
+  { "xmr",     4509 },
+  { "xms",     4714 },
+  { "xmt",     4376 },
+  { "xmu",     2996 },
+  { "xmv",     309  },
+  { "xmw",     7812 },
+  { "xmx",     6671 },
+  { "xmy",     4406 },
+  { "xmz",     4709 },
+  { "xna",     260  },
+  { "xnb",     3000 },
+  { "xnd",     4848 },
+  { "xng",     4555 },
+  { "xnh",     3501 },
+  { "xni",     5041 },
+  { "xnj",     5083 },
+  { "xnk",     5031 },
+  { "xnm",     5089 },
+  { "xnn",     5249 },
+  { "xno",     289  },
+  { "xnq",     5082 },
+  { "xnr",     3017 },
+  { "xns",     3003 },
+  { "xnt",     4919 },
+  { "xnu",     5332 },
+  { "xny",     5388 },
+  { "xnz",     3195 },
+  { "xoc",     5407 },
+  { "xod",     3360 },
+  { "xog",     7072 },
+  { "xoi",     3381 },
+  { "xok",     8454 },
+  { "xom",     3383 },
+  { "xon",     3395 },
+  { "xoo",     8455 },
+  { "xop",     3409 },
+  { "xor",     3438 },
+  { "xow",     3460 },
+  { "xpa",     5811 },
+  { "xpb",     5225 },
+  { "xpc",     5725 },
+  { "xpd",     5572 },
+  { "xpe",     3867 },
+  { "xpf",     7144 },
+  { "xpg",     5768 },
+  { "xph",     5208 },
+  { "xpi",     5786 },
+  { "xpj",     4740 },
+  { "xpk",     3537 },
+  { "xpl",     5859 },
+  { "xpm",     5894 },
+  { "xpn",     3042 },
+  { "xpo",     5833 },
+  { "xpp",     5923 },
+  { "xpq",     4644 },
+  { "xpr",     5697 },
+  { "xps",     5816 },
+  { "xpt",     5904 },
+  { "xpu",     5902 },
+  { "xpv",     5281 },
+  { "xpw",     5303 },
+  { "xpx",     7238 },
+  { "xpy",     5922 },
+  { "xpz",     1034 },
+  { "xqa",     3060 },
+  { "xqt",     5945 },
+  { "xra",     3480 },
+  { "xrb",     1826 },
+  { "xrd",     2329 },
+  { "xre",     3484 },
+  { "xrg",     4576 },
+  { "xri",     3486 },
+  { "xrm",     382  },
+  { "xrn",     379  },
+  { "xrq",     3097 },
+  { "xrr",     5969 },
+  { "xrt",     346  },
+  { "xru",     4342 },
+  { "xrw",     3069 },
+  { "xsa",     6635 },
+  { "xsb",     6692 },
+  { "xsc",     6824 },
+  { "xsd",     6985 },
+  { "xse",     6872 },
+  { "xsh",     6919 },
+  { "xsi",     7033 },
+  { "xsj",     7267 },
+  { "xsl",     7133 },
+  { "xsm",     3100 },
+  { "xsn",     6736 },
+  { "xso",     7077 },
+  { "xsp",     7007 },
+  { "xsq",     4137 },
+  { "xsr",     6942 },
+  { "xss",     414  },
+  { "xsu",     6770 },
+  { "xsv",     7273 },
+  { "xsy",     6656 },
+  { "xta",     177  },
+  { "xtb",     1308 },
+  { "xtc",     3113 },
+  { "xtd",     1675 },
+  { "xte",     3210 },
+  { "xtg",     7784 },
+  { "xth",     8613 },
+  { "xti",     7028 },
+  { "xtj",     6718 },
+  { "xtl",     7656 },
+  { "xtm",     4092 },
+  { "xtn",     5286 },
+  { "xto",     7727 },
+  { "xtp",     6726 },
+  { "xtq",     7852 },
+  { "xtr",     1792 },
+  { "xts",     7023 },
+  { "xtt",     7352 },
+  { "xtu",     1505 },
+  { "xtv",     7622 },
+  { "xtw",     7509 },
+  { "xty",     8621 },
+  { "xtz",     7490 },
+  { "xua",     197  },
+  { "xub",     825  },
+  { "xud",     7971 },
+  { "xug",     3573 },
+  { "xuj",     2804 },
+  { "xul",     5091 },
+  { "xum",     7965 },
+  { "xun",     7983 },
+  { "xuo",     3579 },
+  { "xup",     8002 },
+  { "xur",     8011 },
+  { "xut",     3608 },
+  { "xuu",     3661 },
+  { "xve",     8081 },
+  { "xvi",     2998 },
+  { "xvn",     8065 },
+  { "xvo",     8106 },
+  { "xvs",     8087 },
+  { "xwa",     3647 },
+  { "xwc",     8380 },
+  { "xwd",     8128 },
+  { "xwe",     8456 },
+  { "xwg",     3648 },
+  { "xwj",     8157 },
+  { "xwk",     8205 },
+  { "xwl",     8347 },
+  { "xwo",     8406 },
+  { "xwr",     3650 },
+  { "xwt",     8403 },
+  { "xww",     8275 },
+  { "xxb",     1000 },
+  { "xxk",     3151 },
+  { "xxm",     4587 },
+  { "xxr",     3434 },
+  { "xxt",     7439 },
+  { "xya",     8568 },
+  { "xyb",     8513 },
+  { "xyj",     4413 },
+  { "xyk",     4411 },
+  { "xyl",     8489 },
+  { "xyt",     4412 },
+  { "xyy",     8633 },
+  { "xzh",     8708 },
+  { "xzm",     8702 },
+  { "xzp",     261  },
+  { "yaa",     8502 },
+  { "yab",     8655 },
+  { "yac",     5702 },
+  { "yad",     8473 },
+  { "yae",     5895 },
+  { "yaf",     8480 },
+  { "yag",     8671 },
+  { "yah",     8569 },
+  { "yai",     8471 },
+  { "yaj",     638  },
+  { "yak",     8482 },
+  { "yal",     8493 },
+  { "yam",     8496 },
+  { "yan",     4408 },
+  { "yao",     8532 },
+  { "yap",     8535 },
+  { "yaq",     8538 },
+  { "yar",     8460 },
+  { "yas",     5326 },
+  { "yat",     8498 },
+  { "yau",     8668 },
+  { "yav",     8517 },
+  { "yaw",     8561 },
+  { "yax",     8555 },
+  { "yay",     96   },
+  { "yaz",     3936 },
+  { "yba",     8487 },
+  { "ybb",     8578 },
+  { "ybd",     8518 },
+  { "ybe",     8298 },
+  { "ybh",     8484 },
+  { "ybi",     8506 },
+  { "ybj",     2421 },
+  { "ybk",     947  },
+  { "ybl",     8658 },
+  { "ybm",     8463 },
+  { "ybn",     8461 },
+  { "ybo",     8464 },
+  { "ybx",     8566 },
+  { "yby",     8564 },
+  { "ych",     1320 },
+  { "ycl",     3945 },
+  { "ycn",     8648 },
+  { "ycp",     1317 },
+  { "yda",     8512 },
+  { "ydd",     1858 },
+  { "yde",     8524 },
+  { "ydg",     8594 },
+  { "ydk",     8617 },
+  { "yds",     8592 },
+  { "yea",     6002 },
+  { "yec",     8583 },
+  { "yee",     8597 },
+  { "yei",     8582 },
+  { "yej",     8590 },
+  { "yel",     8574 },
+  { "yen",     8580 },
+  { "yer",     7484 },
+  { "yes",     5371 },
+  { "yet",     8589 },
+  { "yeu",     8587 },
+  { "yev",     8536 },
+  { "yey",     8591 },
+  { "yga",     4197 },
+  { "ygi",     8605 },
+  { "ygl",     8525 },
+  { "ygm",     8472 },
+  { "ygp",     2177 },
+  { "ygr",     8470 },
+  { "ygs",     8622 },
+  { "ygu",     8654 },
+  { "ygw",     8474 },
+  { "yha",     559  },
+  { "yhd",     2843 },
+  { "yhl",     2473 },
+  { "yhs",     8508 },
+  { "yi",      8593 },
+  { "yia",     8603 },
+  { "yid",     8593 },
+  { "yif",     33   },
+  { "yig",     8419 },
+  { "yih",     8348 },
+  { "yii",     8595 },
+  { "yij",     8600 },
+  { "yik",     1718 },
+  { "yil",     8601 },
+  { "yim",     8598 },
+  { "yin",     6556 },
+  { "yip",     5764 },
+  { "yiq",     4593 },
+  { "yir",     5194 },
+  { "yis",     8612 },
+  { "yit",     1833 },
+  { "yiu",     489  },
+  { "yiv",     5259 },
+  { "yix",     494  },
+  { "yiy",     8608 },
+  { "yiz",     512  },
+  { "yka",     8483 },
+  { "ykg",     5291 },
+  { "yki",     8618 },
+  { "ykk",     8481 },
+  { "ykl",     3243 },
+  { "ykm",     3040 },
+  { "ykn",     3498 },
+  { "yko",     8547 },
+  { "ykr",     8573 },
+  { "ykt",     3115 },
+  { "yku",     3499 },
+  { "yky",     8485 },
+  { "yla",     8554 },
+  { "ylb",     8492 },
+  { "yle",     8575 },
+  { "ylg",     8577 },
+  { "yli",     286  },
+  { "yll",     8596 },
+  { "ylm",     3894 },
+  { "yln",     3755 },
+  { "ylo",     4883 },
+  { "ylr",     8490 },
+  { "ylu",     373  },
+  { "yly",     5397 },
+  { "yma",     8505 },
+  { "ymb",     8497 },
+  { "ymc",     7188 },
+  { "ymd",     4758 },
+  { "yme",     8500 },
+  { "ymg",     8504 },
+  { "ymh",     4565 },
+  { "ymi",     4649 },
+  { "ymk",     4145 },
+  { "yml",     2565 },
+  { "ymm",     4056 },
+  { "ymn",     8503 },
+  { "ymo",     8526 },
+  { "ymp",     8495 },
+  { "ymq",     5948 },
+  { "ymr",     4163 },
+  { "yms",     4836 },
+  { "ymt",     4385 },
+  { "ymx",     5256 },
+  { "ymz",     4822 },
+  { "yna",     201  },
+  { "ynd",     8514 },
+  { "yne",     3751 },
+  { "yng",     8522 },
+  { "ynh",     8519 },
+  { "ynk",     4934 },
+  { "ynl",     8523 },
+  { "ynn",     8509 },
+  { "yno",     8626 },
+  { "ynq",     8581 },
+  { "yns",     8530 },
+  { "ynu",     8477 },
+  { "yo",      8634 },
+  { "yob",     8614 },
+  { "yog",     8616 },
+  { "yoi",     8625 },
+  { "yok",     8619 },
+  { "yol",     8620 },
+  { "yom",     8624 },
+  { "yon",     8628 },
+  { "yor",     8634 },
+  { "yos",     8635 },
+  { "yot",     8637 },
+  { "yox",     8632 },
+  { "yoy",     8642 },
+  { "ypa",     5754 },
+  { "ypb",     3678 },
+  { "ypg",     5763 },
+  { "yph",     5778 },
+  { "ypk",     8660 },
+  { "ypm",     5774 },
+  { "ypn",     296  },
+  { "ypo",     192  },
+  { "ypp",     5777 },
+  { "ypz",     5779 },
+  { "yra",     8584 },
+  { "yrb",     8541 },
+  { "yre",     8534 },
+  { "yri",     8546 },
+  { "yrk",     5002 },
+  { "yrl",     5104 },
+  { "yrm",     8611 },
+  { "yrn",     8586 },
+  { "yro",     8544 },
+  { "yrs",     8545 },
+  { "yrw",     8539 },
+  { "yry",     8543 },
+  { "ysc",     8548 },
+  { "ysd",     6687 },
+  { "ysg",     7088 },
+  { "ysl",     8653 },
+  { "ysm",     4833 },
+  { "ysn",     6749 },
+  { "yso",     5142 },
+  { "ysp",     7183 },
+  { "ysr",     7039 },
+  { "yss",     8588 },
+  { "ysy",     6750 },
+  { "yta",     7426 },
+  { "ytl",     7464 },
+  { "ytp",     7628 },
+  { "ytw",     8641 },
+  { "yty",     8549 },
+  { "yua",     8645 },
+  { "yub",     8651 },
+  { "yuc",     8646 },
+  { "yud",     2848 },
+  { "yue",     8649 },
+  { "yuf",     2427 },
+  { "yug",     8650 },
+  { "yui",     8666 },
+  { "yuj",     3087 },
+  { "yuk",     8656 },
+  { "yul",     8659 },
+  { "yum",     5953 },
+  { "yun",     791  },
+  { "yup",     8657 },
+  { "yuq",     8661 },
+  { "yur",     8664 },
+  { "yut",     8630 },
+  { "yuu",     8652 },
+  { "yuw",     8552 },
+  { "yux",     7225 },
+  { "yuy",     1805 },
+  { "yuz",     8662 },
+  { "yva",     8560 },
+  { "yvt",     8559 },
+  { "ywa",     2968 },
+  { "ywg",     8604 },
+  { "ywl",     8323 },
+  { "ywn",     8562 },
+  { "ywq",     8408 },
+  { "ywr",     8567 },
+  { "ywt",     8453 },
+  { "ywu",     8414 },
+  { "yww",     8563 },
+  { "yxa",     4409 },
+  { "yxg",     8469 },
+  { "yxl",     8540 },
+  { "yxm",     8607 },
+  { "yxu",     8669 },
+  { "yxy",     8465 },
+  { "yyr",     8609 },
+  { "yyu",     8553 },
+  { "yyz",     503  },
+  { "yzg",     1790 },
+  { "yzk",     8723 },
+  { "za",      8711 },
+  { "zaa",     6989 },
+  { "zab",     8343 },
+  { "zac",     5419 },
+  { "zad",     1163 },
+  { "zae",     8542 },
+  { "zaf",     506  },
+  { "zag",     8676 },
+  { "zah",     8685 },
+  { "zai",     2711 },
+  { "zaj",     8688 },
+  { "zak",     8681 },
+  { "zal",     8692 },
+  { "zam",     4533 },
+  { "zao",     5573 },
+  { "zap",     8687 },
+  { "zaq",     194  },
+  { "zar",     6564 },
+  { "zas",     6769 },
+  { "zat",     7343 },
+  { "zau",     8684 },
+  { "zav",     8551 },
+  { "zaw",     4605 },
+  { "zax",     8435 },
+  { "zay",     8695 },
+  { "zaz",     8689 },
+  { "zba",     592  },
+  { "zbc",     1233 },
+  { "zbe",     1794 },
+  { "zbl",     927  },
+  { "zbt",     738  },
+  { "zbu",     1035 },
+  { "zbw",     8284 },
+  { "zca",     1433 },
+  { "zcd",     3779 },
+  { "zch",     1238 },
+  { "zdj",     5054 },
+  { "zea",     8699 },
+  { "zeg",     8703 },
+  { "zeh",     1823 },
+  { "zen",     8704 },
+  { "zga",     3286 },
+  { "zgb",     2306 },
+  { "zgh",     7257 },
+  { "zgm",     4592 },
+  { "zgn",     2308 },
+  { "zgr",     4094 },
+  { "zh",      1355 },
+  { "zha",     8711 },
+  { "zhb",     8707 },
+  { "zhd",     1534 },
+  { "zhi",     8709 },
+  { "zhn",     5180 },
+  { "zho",     1355 },
+  { "zhw",     8710 },
+  { "zhx",     1352 },
+  { "zia",     8712 },
+  { "zib",     8717 },
+  { "zik",     8715 },
+  { "zil",     8713 },
+  { "zim",     4516 },
+  { "zin",     8718 },
+  { "zir",     8720 },
+  { "ziw",     8714 },
+  { "ziz",     8721 },
+  { "zka",     2923 },
+  { "zkb",     3350 },
+  { "zkd",     2901 },
+  { "zkg",     3344 },
+  { "zkh",     3252 },
+  { "zkk",     3065 },
+  { "zkn",     3002 },
+  { "zko",     3455 },
+  { "zkp",     7335 },
+  { "zkr",     8678 },
+  { "zkt",     3313 },
+  { "zku",     3126 },
+  { "zkv",     3483 },
+  { "zkz",     3232 },
+  { "zla",     8728 },
+  { "zle",     1803 },
+  { "zlj",     3917 },
+  { "zlm",     4168 },
+  { "zln",     3866 },
+  { "zlq",     3918 },
+  { "zls",     7134 },
+  { "zlw",     8295 },
+  { "zma",     4222 },
+  { "zmb",     8716 },
+  { "zmc",     4313 },
+  { "zmd",     4324 },
+  { "zme",     4252 },
+  { "zmf",     4529 },
+  { "zmg",     4348 },
+  { "zmh",     4140 },
+  { "zmi",     4990 },
+  { "zmj",     4325 },
+  { "zmk",     4228 },
+  { "zml",     4381 },
+  { "zmm",     4327 },
+  { "zmn",     4429 },
+  { "zmo",     4665 },
+  { "zmp",     4747 },
+  { "zmq",     4608 },
+  { "zmr",     4304 },
+  { "zms",     4440 },
+  { "zmt",     4331 },
+  { "zmu",     4805 },
+  { "zmv",     4432 },
+  { "zmw",     4443 },
+  { "zmx",     970  },
+  { "zmy",     4336 },
+  { "zmz",     4426 },
+  { "zna",     8680 },
+  { "znd",     8683 },
+  { "zne",     8682 },
+  { "zng",     4243 },
+  { "znk",     4220 },
+  { "zns",     4248 },
+  { "zoc",     1458 },
+  { "zoh",     1344 },
+  { "zom",     8727 },
+  { "zoo",     423  },
+  { "zoq",     7347 },
+  { "zor",     6008 },
+  { "zos",     2046 },
+  { "zpa",     3684 },
+  { "zpb",     8557 },
+  { "zpc",     1371 },
+  { "zpd",     7146 },
+  { "zpe",     5747 },
+  { "zpf",     6728 },
+  { "zpg",     2299 },
+  { "zph",     7776 },
+  { "zpi",     6763 },
+  { "zpj",     5960 },
+  { "zpk",     7697 },
+  { "zpl",     3685 },
+  { "zpm",     4613 },
+  { "zpn",     6759 },
+  { "zpo",     218  },
+  { "zpp",     1893 },
+  { "zpq",     8724 },
+  { "zpr",     6767 },
+  { "zps",     1436 },
+  { "zpt",     6730 },
+  { "zpu",     8494 },
+  { "zpv",     1332 },
+  { "zpw",     8686 },
+  { "zpx",     6709 },
+  { "zpy",     4419 },
+  { "zpz",     7608 },
+  { "zqe",     5950 },
+  { "zra",     3050 },
+  { "zrg",     4596 },
+  { "zrn",     8706 },
+  { "zro",     8736 },
+  { "zrp",     8691 },
+  { "zrs",     4113 },
+  { "zsa",     6787 },
+  { "zsk",     3106 },
+  { "zsl",     8679 },
+  { "zsm",     7256 },
+  { "zsr",     7208 },
+  { "zsu",     7283 },
+  { "zte",     1903 },
+  { "ztg",     8438 },
+  { "ztl",     3768 },
+  { "ztm",     6708 },
+  { "ztn",     6757 },
+  { "ztp",     3990 },
+  { "ztq",     5964 },
+  { "zts",     7661 },
+  { "ztt",     7536 },
+  { "ztu",     2371 },
+  { "ztx",     8672 },
+  { "zty",     8550 },
+  { "zu",      8730 },
+  { "zua",     8698 },
+  { "zuh",     7725 },
+  { "zul",     8730 },
+  { "zum",     3558 },
+  { "zun",     8733 },
+  { "zuy",     8731 },
+  { "zwa",     8693 },
+  { "zxx",     5166 },
+  { "zyb",     8627 },
+  { "zyg",     8516 },
+  { "zyj",     8638 },
+  { "zyn",     8629 },
+  { "zyp",     8735 },
+  { "zza",     8696 },
+  { "zzj",     8734 },
+};
 
-  for (language_init_t const *lang = s_languages_init, *end = lang + 8755; lang < end; ++lang)
-    g_languages.emplace_back(lang->english_name, lang->alpha_3_code, lang->alpha_2_code, lang->terminology_abbrev, lang->is_part_of_iso639_2, lang->is_deprecated);
-}
+std::size_t const g_num_languages_by_code = 8960;
 
 } // namespace mtx::iso639
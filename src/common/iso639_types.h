@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -33,6 +34,21 @@ struct language_t {
   }
 };
 
-extern std::vector<language_t> g_languages;
+// The generated tables in iso639_language_list.cpp are constant
+// initialized; language_t objects are only created when needed.
+struct language_init_t {
+  char const *english_name, *alpha_3_code, *alpha_2_code, *terminology_abbrev;
+  bool is_part_of_iso639_2, is_deprecated;
+};
+
+struct code_index_t {
+  char const *code;
+  std::size_t idx;
+};
+
+extern language_init_t const g_languages_init[];
+extern std::size_t const g_num_languages_init;
+extern code_index_t const g_languages_by_code[];
+extern std::size_t const g_num_languages_by_code;
 
 } // namespace mtx::iso639
@@ -486,6 +486,11 @@ kax_analyzer_c::update_element(EbmlElement *e,
     if (validate_and_break("update_element_1"))
       return uer_success;
 
+    std::vector<uint64_t> previous_positions;
+    for (auto const &data : m_data)
+      if (data->m_id == EbmlId(*e))
+        previous_positions.push_back(data->m_pos);
+
     overwrite_all_instances(EbmlId(*e));
     if (validate_and_break("update_element_2"))
       return uer_success;
@@ -494,7 +499,7 @@ kax_analyzer_c::update_element(EbmlElement *e,
     if (validate_and_break("update_element_3"))
       return uer_success;
 
-    write_element(e, write_defaults, strategy);
+    write_element(e, write_defaults, strategy, previous_positions);
     if (validate_and_break("update_element_4"))
       return uer_success;
 
@@ -1045,8 +1050,10 @@ kax_analyzer_c::merge_void_elements() {
 /** \brief Finds a suitable spot for an element and writes it to the file
 
     First, a suitable spot for the element is determined by looking at
-    EbmlVoid elements. If none is found in the middle of the file then
-    the element will be appended at the end.
+    EbmlVoid elements. The space the element occupied before it was
+    overwritten is preferred over all other spots. If none is found in
+    the middle of the file then the element will be appended at the
+    end.
 
     Second, the element is written at the location determined in the
     first step. If EbmlVoid elements are overwritten then a new,
@@ -1058,25 +1065,45 @@ kax_analyzer_c::merge_void_elements() {
     \param e Pointer to the element to write.
     \param write_defaults Boolean that decides whether or not elements
       which contain their default value are written to the file.
+    \param strategy Where to look for EbmlVoid elements to overwrite.
+    \param previous_positions The positions of the instances of the
+      element before they were overwritten.
  */
 void
 kax_analyzer_c::write_element(EbmlElement *e,
                               bool write_defaults,
-                              placement_strategy_e strategy) {
+                              placement_strategy_e strategy,
+                              std::vector<uint64_t> const &previous_positions) {
   e->UpdateSize(write_defaults, true);
-  int64_t element_size = e->ElementSize(write_defaults);
 
-  size_t data_idx;
-  for (data_idx = (ps_anywhere == strategy ? 0 : m_data.size() - 1); m_data.size() > data_idx; ++data_idx) {
-    // We're only interested in EbmlVoid elements. Skip the others.
-    if (!Is<EbmlVoid>(m_data[data_idx]->m_id))
-      continue;
+  auto is_suitable = [this, e](size_t data_idx) {
+    return Is<EbmlVoid>(m_data[data_idx]->m_id) && fit_element_into(*e, m_data[data_idx]->m_size);
+  };
 
-    // Skip the element if it doesn't provide enough space.
-    if (m_data[data_idx]->m_size < element_size)
-      continue;
+  auto covers_previous_position = [this, &previous_positions](size_t data_idx) {
+    auto const &data = *m_data[data_idx];
+    return mtx::any(previous_positions, [&data](uint64_t position) { return (position >= data.m_pos) && (position < (data.m_pos + data.m_size)); });
+  };
 
+  // Writing the element to the spot it occupied before doesn't
+  // relocate anything; the meta seek entries stay the same, too.
+  std::optional<size_t> target_idx;
+
+  for (auto data_idx = 0u; m_data.size() > data_idx; ++data_idx)
+    if (covers_previous_position(data_idx) && is_suitable(data_idx)) {
+      mxdebug_if(m_debug, fmt::format("write_element: writing to the previous spot at {0}\n", m_data[data_idx]->m_pos));
+      target_idx = data_idx;
+      break;
+    }
+
+  for (auto data_idx = (ps_anywhere == strategy ? 0 : m_data.size() - 1); !target_idx && (m_data.size() > data_idx); ++data_idx)
+    if (is_suitable(data_idx))
+      target_idx = data_idx;
+
+  if (target_idx) {
     // We've found our element. Overwrite it.
+    auto data_idx = *target_idx;
+
     m_file->setFilePointer(m_data[data_idx]->m_pos);
     e->Render(*m_file, write_defaults, false, true);
     if (m_doc_type_version_handler)
@@ -1105,6 +1132,47 @@ kax_analyzer_c::write_element(EbmlElement *e,
   adjust_segment_size();
 }
 
+/** \brief Determines whether or not an element fits into a given space
+
+    The length of the element's coded size field is adjusted if that
+    avoids relocating the element: it is shortened if the element
+    only fits with the shortest possible size field, and it is
+    lengthened by one byte if exactly one byte would be left over. A
+    single byte cannot be filled with an EbmlVoid element, and filling
+    it otherwise means moving the following element's head.
+
+    The element's size must have been updated before.
+
+    \param e The element to fit.
+    \param available_size The total size of the space available.
+
+    \return \c true if the element fits into the space.
+ */
+bool
+kax_analyzer_c::fit_element_into(EbmlElement &e,
+                                 int64_t available_size) {
+  auto fixed_size     = static_cast<int64_t>(EBML_ID_LENGTH(static_cast<const EbmlId &>(e)) + e.GetSize());
+  auto current_length = CodedSizeLength(e.GetSize(), e.GetSizeLength(), true);
+  auto minimal_length = CodedSizeLength(e.GetSize(), 0, true);
+  auto space_left     = [available_size, fixed_size](int size_length) { return available_size - fixed_size - size_length; };
+
+  if (space_left(current_length) == 1) {
+    if (current_length < 8)
+      e.SetSizeLength(current_length + 1);
+    return true;
+  }
+
+  if (space_left(current_length) >= 0)
+    return true;
+
+  if (space_left(minimal_length) < 0)
+    return false;
+
+  e.SetSizeLength(minimal_length + (space_left(minimal_length) == 1 ? 1 : 0));
+
+  return true;
+}
+
 int
 kax_analyzer_c::ensure_front_seek_head_links_to(unsigned int seek_head_idx) {
   // It is possible that the seek head at the front has been removed
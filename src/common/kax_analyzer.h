@@ -182,6 +182,8 @@ public:
     return get_placement_strategy_for(e.get());
   }
 
+  static bool fit_element_into(libebml::EbmlElement &e, int64_t available_size);
+
   static mtx::bits::value_cptr read_segment_uid_from(std::string const &file_name);
 
 protected:
@@ -190,7 +192,7 @@ protected:
   virtual void remove_from_meta_seeks(libebml::EbmlId id);
   virtual void overwrite_all_instances(libebml::EbmlId id);
   virtual void merge_void_elements();
-  virtual void write_element(libebml::EbmlElement *e, bool write_defaults, placement_strategy_e strategy);
+  virtual void write_element(libebml::EbmlElement *e, bool write_defaults, placement_strategy_e strategy, std::vector<uint64_t> const &previous_positions);
   virtual void add_to_meta_seek(libebml::EbmlElement *e);
   virtual std::pair<bool, int> try_adding_to_existing_meta_seek(libebml::EbmlElement *e);
   virtual void move_seek_head_to_end_and_create_new_one_at_start(libebml::EbmlElement *e, int first_seek_head_idx);
@@ -302,6 +302,42 @@ kax_file_c::read_next_cluster() {
   return std::static_pointer_cast<KaxCluster>(read_next_level1_element(EBML_ID_VALUE(EBML_ID(KaxCluster))));
 }
 
+// Tries the lightweight parser first. Clusters it cannot handle
+// (unknown sizes, damaged structures, anything requiring a resync)
+// are read via libebml & converted.
+bool
+kax_file_c::read_next_cluster(kax_flat_cluster_c &cluster) {
+  auto end_position   = m_segment_end ? std::min(m_segment_end, m_file_size) : m_file_size;
+  auto start_position = m_in.getFilePointer();
+
+  if (start_position < end_position) {
+    try {
+      if (cluster.read(m_in, end_position)) {
+        m_resynced         = false;
+        m_resync_start_pos = 0;
+
+        mxdebug_if(m_debug_read_next, fmt::format("kax_file::read_next_cluster(): flat cluster at {0} size {1} blocks {2}\n", cluster.get_position(), cluster.get_size(), cluster.get_blocks().size()));
+
+        m_in.setFilePointer(cluster.get_position() + cluster.get_size());
+        return true;
+      }
+
+    } catch (mtx::mm_io::exception &) {
+      m_in.setFilePointer(start_position);
+    }
+  }
+
+  auto tree = read_next_cluster();
+  if (!tree) {
+    cluster.clear();
+    return false;
+  }
+
+  cluster.assign(tree);
+
+  return true;
+}
+
 bool
 kax_file_c::was_resynced() const {
   return m_resynced;
@@ -18,6 +18,7 @@
 #include <matroska/KaxSegment.h>
 #include <matroska/KaxCluster.h>
 
+#include "common/kax_flat_cluster.h"
 #include "common/vint.h"
 
 class kax_file_c {
@@ -39,6 +40,7 @@ public:
 
   virtual std::shared_ptr<libebml::EbmlElement> read_next_level1_element(uint32_t wanted_id = 0, bool report_cluster_timestamp = false);
   virtual std::shared_ptr<libmatroska::KaxCluster> read_next_cluster();
+  virtual bool read_next_cluster(kax_flat_cluster_c &cluster);
 
   virtual std::shared_ptr<libebml::EbmlElement> resync_to_level1_element(uint32_t wanted_id = 0);
   virtual std::shared_ptr<libmatroska::KaxCluster> resync_to_cluster();
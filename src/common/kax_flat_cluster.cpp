@@ -0,0 +1,557 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   a lightweight cluster parser
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <matroska/KaxBlock.h>
+#include <matroska/KaxBlockData.h>
+#include <matroska/KaxCluster.h>
+#include <matroska/KaxClusterData.h>
+
+#include "common/ebml.h"
+#include "common/kax_file.h"
+#include "common/kax_flat_cluster.h"
+
+using namespace libmatroska;
+
+namespace {
+
+constexpr uint32_t ID_CLUSTER           = 0x1f43b675;
+constexpr uint32_t ID_CLUSTER_TIMESTAMP = 0xe7;
+constexpr uint32_t ID_SIMPLE_BLOCK      = 0xa3;
+constexpr uint32_t ID_BLOCK_GROUP       = 0xa0;
+constexpr uint32_t ID_BLOCK             = 0xa1;
+constexpr uint32_t ID_BLOCK_DURATION    = 0x9b;
+constexpr uint32_t ID_REFERENCE_BLOCK   = 0xfb;
+constexpr uint32_t ID_CODEC_STATE       = 0xa4;
+constexpr uint32_t ID_DISCARD_PADDING   = 0x75a2;
+constexpr uint32_t ID_BLOCK_ADDITIONS   = 0x75a1;
+constexpr uint32_t ID_BLOCK_MORE        = 0xa6;
+constexpr uint32_t ID_BLOCK_ADD_ID      = 0xee;
+constexpr uint32_t ID_BLOCK_ADDITIONAL  = 0xa5;
+
+// Returns the number of bytes the variable-length integer occupies
+// or 0 if it is invalid or doesn't fit into the buffer. For IDs the
+// length marker is kept.
+std::size_t
+read_vint(unsigned char const *data,
+          std::size_t size,
+          uint64_t &value,
+          bool keep_marker,
+          bool *unknown = nullptr) {
+  if (!size || !data[0])
+    return 0;
+
+  std::size_t length = 1;
+  auto mask          = 0x80u;
+  while (!(data[0] & mask)) {
+    ++length;
+    mask >>= 1;
+  }
+
+  if (length > size)
+    return 0;
+
+  value         = keep_marker ? data[0] : data[0] & (mask - 1);
+  auto all_ones = value == (mask - 1);
+
+  for (auto idx = 1u; idx < length; ++idx) {
+    value    = (value << 8) | data[idx];
+    all_ones = all_ones && (data[idx] == 0xff);
+  }
+
+  if (unknown)
+    *unknown = !keep_marker && all_ones;
+
+  return length;
+}
+
+// Reads an element's ID & size. Returns the header's length or 0 if
+// the element is invalid, has an unknown size or exceeds the buffer.
+std::size_t
+read_element_header(unsigned char const *data,
+                    std::size_t size,
+                    uint32_t &id,
+                    uint64_t &element_size) {
+  uint64_t id64{};
+  auto unknown     = false;
+  auto id_length   = read_vint(data, size, id64, true);
+  auto size_length = id_length && (id_length <= 4) ? read_vint(data + id_length, size - id_length, element_size, false, &unknown) : 0;
+
+  if (!size_length || unknown || (element_size > (size - id_length - size_length)))
+    return 0;
+
+  id = id64;
+
+  return id_length + size_length;
+}
+
+uint64_t
+read_uint(unsigned char const *data,
+          std::size_t size) {
+  uint64_t value{};
+  for (auto idx = 0u; idx < std::min<std::size_t>(size, 8); ++idx)
+    value = (value << 8) | data[idx];
+
+  return value;
+}
+
+int64_t
+read_int(unsigned char const *data,
+         std::size_t size) {
+  if (!size)
+    return 0;
+
+  size       = std::min<std::size_t>(size, 8);
+  auto value = read_uint(data, size);
+
+  // Sign-extend.
+  if ((size < 8) && (data[0] & 0x80))
+    value |= ~uint64_t{} << (size * 8);
+
+  return static_cast<int64_t>(value);
+}
+
+}
+
+void
+kax_flat_cluster_c::set_timestamp_scale(int64_t timestamp_scale) {
+  m_timestamp_scale = timestamp_scale;
+}
+
+void
+kax_flat_cluster_c::clear() {
+  m_blocks.clear();
+  m_frames.clear();
+  m_additions.clear();
+  m_tree.reset();
+
+  m_position      = 0;
+  m_size          = 0;
+  m_body_position = 0;
+  m_timestamp     = 0;
+  m_raw           = false;
+}
+
+bool
+kax_flat_cluster_c::read(mm_io_c &in,
+                         uint64_t max_end_position) {
+  unsigned char header[12];
+  auto start_position = in.getFilePointer();
+  auto num_read       = in.read(header, std::min<uint64_t>(sizeof(header), max_end_position > start_position ? max_end_position - start_position : 0));
+
+  uint64_t id{}, body_size{};
+  auto unknown     = false;
+  auto id_length   = read_vint(header, num_read, id, true);
+  auto size_length = ID_CLUSTER == id ? read_vint(header + id_length, num_read - id_length, body_size, false, &unknown) : 0;
+  auto head_size   = id_length + size_length;
+
+  if (   !size_length
+      || unknown
+      || (body_size > MAX_BODY_SIZE)
+      || ((start_position + head_size + body_size) > max_end_position)) {
+    in.setFilePointer(start_position);
+    return false;
+  }
+
+  // Only grow the buffer so that it can be re-used for all clusters.
+  if (m_data.size() < body_size)
+    m_data.resize(body_size);
+
+  in.setFilePointer(start_position + head_size);
+  if (in.read(m_data.data(), body_size) != body_size) {
+    in.setFilePointer(start_position);
+    return false;
+  }
+
+  clear();
+
+  m_position      = start_position;
+  m_size          = head_size + body_size;
+  m_body_position = start_position + head_size;
+
+  if (!parse(m_data.data(), body_size)) {
+    clear();
+    in.setFilePointer(start_position);
+    return false;
+  }
+
+  m_raw = true;
+
+  finish();
+
+  return true;
+}
+
+bool
+kax_flat_cluster_c::parse(unsigned char const *data,
+                          std::size_t size) {
+  auto body_position = m_body_position;
+  auto pos           = std::size_t{};
+
+  while (pos < size) {
+    uint32_t id{};
+    uint64_t element_size{};
+    auto head_size = read_element_header(data + pos, size - pos, id, element_size);
+
+    if (!head_size)
+      return false;
+
+    auto element_data     = data + pos + head_size;
+    auto element_position = body_position + pos;
+
+    if (ID_CLUSTER_TIMESTAMP == id)
+      m_timestamp = read_uint(element_data, element_size);
+
+    else if (ID_SIMPLE_BLOCK == id) {
+      block_t block;
+      block.m_simple       = true;
+      block.m_position     = element_position;
+      block.m_element_size = head_size + element_size;
+
+      if (!parse_block(element_data, element_size, element_position + head_size, block))
+        return false;
+
+      m_blocks.push_back(std::move(block));
+
+    } else if (ID_BLOCK_GROUP == id) {
+      auto num_blocks = m_blocks.size();
+
+      if (!parse_block_group(element_data, element_size, element_position, element_position + head_size))
+        return false;
+
+      if (m_blocks.size() > num_blocks)
+        m_blocks.back().m_element_size = head_size + element_size;
+    }
+
+    pos += head_size + element_size;
+  }
+
+  return true;
+}
+
+bool
+kax_flat_cluster_c::parse_block_group(unsigned char const *data,
+                                      std::size_t size,
+                                      uint64_t position,
+                                      uint64_t body_position) {
+  block_t block;
+  auto have_block = false;
+  auto pos        = std::size_t{};
+
+  block.m_position = position;
+
+  while (pos < size) {
+    uint32_t id{};
+    uint64_t element_size{};
+    auto head_size = read_element_header(data + pos, size - pos, id, element_size);
+    if (!head_size)
+      return false;
+
+    auto element_data     = data + pos + head_size;
+    auto element_position = body_position + pos + head_size;
+
+    if (ID_BLOCK == id) {
+      have_block = parse_block(element_data, element_size, element_position, block);
+      if (!have_block)
+        return false;
+
+    } else if (ID_BLOCK_DURATION == id)
+      block.m_duration = read_uint(element_data, element_size) * m_timestamp_scale;
+
+    else if (ID_REFERENCE_BLOCK == id)
+      block.m_references.push_back(read_int(element_data, element_size));
+
+    else if (ID_CODEC_STATE == id)
+      block.m_codec_state = frame_t{ element_data, static_cast<std::size_t>(element_size), element_position };
+
+    else if (ID_DISCARD_PADDING == id)
+      block.m_discard_padding = read_int(element_data, element_size);
+
+    else if ((ID_BLOCK_ADDITIONS == id) && !parse_block_additions(element_data, element_size, block))
+      return false;
+
+    pos += head_size + element_size;
+  }
+
+  if (have_block)
+    m_blocks.push_back(std::move(block));
+
+  return true;
+}
+
+bool
+kax_flat_cluster_c::parse_block_additions(unsigned char const *data,
+                                          std::size_t size,
+                                          block_t &block) {
+  auto pos               = std::size_t{};
+  block.m_first_addition = m_additions.size();
+
+  while (pos < size) {
+    uint32_t id{};
+    uint64_t element_size{};
+    auto head_size = read_element_header(data + pos, size - pos, id, element_size);
+    if (!head_size)
+      return false;
+
+    if (ID_BLOCK_MORE == id) {
+      addition_t addition;
+      addition.m_id  = 1;
+      auto more_data = data + pos + head_size;
+      auto more_pos  = std::size_t{};
+
+      while (more_pos < element_size) {
+        uint32_t child_id{};
+        uint64_t child_size{};
+        auto child_head_size = read_element_header(more_data + more_pos, element_size - more_pos, child_id, child_size);
+        if (!child_head_size)
+          return false;
+
+        if (ID_BLOCK_ADD_ID == child_id)
+          addition.m_id = read_uint(more_data + more_pos + child_head_size, child_size);
+
+        else if (ID_BLOCK_ADDITIONAL == child_id) {
+          addition.m_data = more_data + more_pos + child_head_size;
+          addition.m_size = child_size;
+        }
+
+        more_pos += child_head_size + child_size;
+      }
+
+      if (addition.m_data)
+        m_additions.push_back(addition);
+    }
+
+    pos += head_size + element_size;
+  }
+
+  block.m_num_additions = m_additions.size() - block.m_first_addition;
+
+  return true;
+}
+
+bool
+kax_flat_cluster_c::parse_block(unsigned char const *data,
+                                std::size_t size,
+                                uint64_t position,
+                                block_t &block) {
+  uint64_t track_number{};
+  auto pos = read_vint(data, size, track_number, false);
+
+  if (!pos || ((pos + 3) > size))
+    return false;
+
+  auto flags                 = data[pos + 2];
+  block.m_track_number       = track_number;
+  block.m_relative_timestamp = static_cast<int16_t>((data[pos] << 8) | data[pos + 1]);
+  block.m_invisible          = !!(flags & 0x08);
+  pos                       += 3;
+
+  if (block.m_simple) {
+    block.m_key         = !!(flags & 0x80);
+    block.m_discardable = !!(flags & 0x01);
+  }
+
+  block.m_first_frame = m_frames.size();
+
+  auto lacing = (flags >> 1) & 0x03;
+
+  if (!lacing) {
+    m_frames.push_back({ data + pos, size - pos, position + pos });
+    block.m_num_frames = 1;
+    return true;
+  }
+
+  if (pos >= size)
+    return false;
+
+  auto num_frames = static_cast<std::size_t>(data[pos]) + 1;
+  ++pos;
+
+  boost::container::small_vector<uint64_t, 16> sizes(num_frames);
+  uint64_t laced_size{};
+
+  // The sizes are read from the file. Each one must fit into what's
+  // left of the block after the lacing header read so far.
+  auto fits = [&pos, &laced_size, size](uint64_t frame_size) {
+    return ((pos + laced_size) <= size) && (frame_size <= (size - pos - laced_size));
+  };
+
+  if (0x01 == lacing) {         // Xiph lacing
+    for (auto idx = 0u; idx < (num_frames - 1); ++idx) {
+      unsigned char byte{};
+      do {
+        if (pos >= size)
+          return false;
+        byte        = data[pos++];
+        sizes[idx] += byte;
+      } while (0xff == byte);
+
+      if (!fits(sizes[idx]))
+        return false;
+
+      laced_size += sizes[idx];
+    }
+
+  } else if (0x03 == lacing) {  // EBML lacing
+    for (auto idx = 0u; idx < (num_frames - 1); ++idx) {
+      uint64_t value{};
+      auto length = read_vint(data + pos, size - pos, value, false);
+      if (!length)
+        return false;
+
+      pos += length;
+
+      if (!idx)
+        sizes[idx] = value;
+
+      else {
+        // Signed difference to the previous frame's size. Both the
+        // value & the bias are less than 2^56, and the previous size
+        // has already been checked against the block's size.
+        auto bias = (uint64_t{1} << (7 * length - 1)) - 1;
+
+        if ((value < bias) && ((bias - value) > sizes[idx - 1]))
+          return false;
+
+        sizes[idx] = value >= bias ? sizes[idx - 1] + (value - bias) : sizes[idx - 1] - (bias - value);
+      }
+
+      if (!fits(sizes[idx]))
+        return false;
+
+      laced_size += sizes[idx];
+    }
+
+  } else {                      // fixed-size lacing
+    if ((size - pos) % num_frames)
+      return false;
+
+    for (auto idx = 0u; idx < (num_frames - 1); ++idx)
+      sizes[idx] = (size - pos) / num_frames;
+
+    laced_size = (size - pos) / num_frames * (num_frames - 1);
+  }
+
+  if ((pos + laced_size) > size)
+    return false;
+
+  sizes[num_frames - 1] = size - pos - laced_size;
+
+  for (auto idx = 0u; idx < num_frames; ++idx) {
+    m_frames.push_back({ data + pos, static_cast<std::size_t>(sizes[idx]), position + pos });
+    pos += sizes[idx];
+  }
+
+  block.m_num_frames = num_frames;
+
+  return true;
+}
+
+void
+kax_flat_cluster_c::finish() {
+  // The cluster's timestamp isn't required to precede its blocks.
+  for (auto &block : m_blocks)
+    block.m_timestamp = (static_cast<int64_t>(m_timestamp) + block.m_relative_timestamp) * m_timestamp_scale;
+}
+
+void
+kax_flat_cluster_c::assign(std::shared_ptr<KaxCluster> const &cluster) {
+  clear();
+
+  m_tree      = cluster;
+  m_position  = cluster->GetElementPosition();
+  m_size      = kax_file_c::get_element_size(*cluster);
+  m_timestamp = FindChildValue<KaxClusterTimecode>(*cluster);
+
+  cluster->InitTimecode(m_timestamp, m_timestamp_scale);
+
+  auto add_frames = [this](KaxInternalBlock &kblock, block_t &block) {
+    auto frame_pos      = kblock.GetElementPosition() + kblock.ElementSize();
+    block.m_first_frame = m_frames.size();
+    block.m_num_frames  = kblock.NumberFrames();
+
+    for (auto idx = 0u; idx < block.m_num_frames; ++idx)
+      frame_pos -= kblock.GetBuffer(idx).Size();
+
+    for (auto idx = 0u; idx < block.m_num_frames; ++idx) {
+      auto &buffer = kblock.GetBuffer(idx);
+      m_frames.push_back({ buffer.Buffer(), buffer.Size(), frame_pos });
+      frame_pos += buffer.Size();
+    }
+
+    block.m_track_number       = kblock.TrackNum();
+    block.m_timestamp          = mtx::math::to_signed(kblock.GlobalTimecode());
+    block.m_relative_timestamp = block.m_timestamp / m_timestamp_scale - static_cast<int64_t>(m_timestamp);
+  };
+
+  for (auto element : *cluster) {
+    if (Is<KaxSimpleBlock>(element)) {
+      auto &kblock = *static_cast<KaxSimpleBlock *>(element);
+      kblock.SetParent(*cluster);
+
+      block_t block;
+      block.m_simple      = true;
+      block.m_position    = kblock.GetElementPosition();
+      block.m_key         = kblock.IsKeyframe();
+      block.m_discardable = kblock.IsDiscardable();
+
+      add_frames(kblock, block);
+      m_blocks.push_back(std::move(block));
+
+    } else if (Is<KaxBlockGroup>(element)) {
+      auto &group = *static_cast<KaxBlockGroup *>(element);
+      auto kblock = FindChild<KaxBlock>(group);
+      if (!kblock)
+        continue;
+
+      kblock->SetParent(*cluster);
+
+      block_t block;
+      block.m_position = group.GetElementPosition();
+
+      add_frames(*kblock, block);
+
+      if (auto duration = FindChild<KaxBlockDuration>(group); duration)
+        block.m_duration = duration->GetValue() * m_timestamp_scale;
+
+      if (auto discard_padding = FindChild<KaxDiscardPadding>(group); discard_padding)
+        block.m_discard_padding = discard_padding->GetValue();
+
+      if (auto codec_state = FindChild<KaxCodecState>(group); codec_state)
+        block.m_codec_state = frame_t{ codec_state->GetBuffer(), static_cast<std::size_t>(codec_state->GetSize()), codec_state->GetElementPosition() };
+
+      for (auto child : group)
+        if (Is<KaxReferenceBlock>(child))
+          block.m_references.push_back(static_cast<KaxReferenceBlock *>(child)->GetValue());
+
+      if (auto additions = FindChild<KaxBlockAdditions>(group); additions) {
+        block.m_first_addition = m_additions.size();
+
+        for (auto child : *additions) {
+          if (!Is<KaxBlockMore>(child))
+            continue;
+
+          auto &more      = *static_cast<KaxBlockMore *>(child);
+          auto additional = FindChild<KaxBlockAdditional>(more);
+          if (additional)
+            m_additions.push_back({ FindChildValue<KaxBlockAddID, uint64_t>(more, 1), additional->GetBuffer(), static_cast<std::size_t>(additional->GetSize()) });
+        }
+
+        block.m_num_additions = m_additions.size() - block.m_first_addition;
+      }
+
+      m_blocks.push_back(std::move(block));
+    }
+  }
+}
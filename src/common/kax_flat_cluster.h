@@ -0,0 +1,133 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for a lightweight cluster parser
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <boost/container/small_vector.hpp>
+
+#include <matroska/KaxCluster.h>
+
+// Parses a whole cluster into flat arrays of block descriptors instead
+// of creating one libebml object per element. The cluster's bytes are
+// read into a single buffer that is re-used for the next cluster; all
+// data pointers handed out are only valid until the next call to
+// read() or assign().
+//
+// Timestamps & durations are in nanoseconds. Reference block values
+// are in units of the timestamp scale, just as they're stored.
+class kax_flat_cluster_c {
+public:
+  struct frame_t {
+    unsigned char const *m_data{};
+    std::size_t m_size{};
+    uint64_t m_position{};
+  };
+
+  struct addition_t {
+    uint64_t m_id{};
+    unsigned char const *m_data{};
+    std::size_t m_size{};
+  };
+
+  struct block_t {
+    uint64_t m_track_number{}, m_position{}, m_element_size{};
+    int64_t m_timestamp{};
+    int16_t m_relative_timestamp{};
+    bool m_simple{}, m_key{}, m_discardable{}, m_invisible{};
+    std::optional<uint64_t> m_duration;
+    std::optional<int64_t> m_discard_padding;
+    boost::container::small_vector<int64_t, 2> m_references;
+    frame_t m_codec_state;
+    std::size_t m_first_frame{}, m_num_frames{}, m_first_addition{}, m_num_additions{};
+  };
+
+  // Larger clusters are left to libebml instead of being read into
+  // memory in one go.
+  static constexpr uint64_t MAX_BODY_SIZE = 128 * 1024 * 1024;
+
+protected:
+  std::vector<unsigned char> m_data;
+  std::vector<block_t> m_blocks;
+  std::vector<frame_t> m_frames;
+  std::vector<addition_t> m_additions;
+  std::shared_ptr<libmatroska::KaxCluster> m_tree;
+  uint64_t m_position{}, m_size{}, m_body_position{}, m_timestamp{};
+  int64_t m_timestamp_scale{TIMESTAMP_SCALE};
+  bool m_raw{};
+
+public:
+  void set_timestamp_scale(int64_t timestamp_scale);
+
+  // Reads & parses the cluster starting at the current position of
+  // 'in'. Returns false without consuming anything if the data cannot
+  // be parsed this way, e.g. for clusters with an unknown size, ones
+  // bigger than MAX_BODY_SIZE or broken structures.
+  bool read(mm_io_c &in, uint64_t max_end_position);
+
+  // Takes over a cluster that has already been read by libebml.
+  void assign(std::shared_ptr<libmatroska::KaxCluster> const &cluster);
+
+  void clear();
+
+  uint64_t get_position() const {
+    return m_position;
+  }
+
+  uint64_t get_size() const {
+    return m_size;
+  }
+
+  // The raw cluster timestamp in units of the timestamp scale.
+  uint64_t get_timestamp() const {
+    return m_timestamp;
+  }
+
+  std::vector<block_t> const &get_blocks() const {
+    return m_blocks;
+  }
+
+  frame_t const &get_frame(block_t const &block, std::size_t idx) const {
+    return m_frames[block.m_first_frame + idx];
+  }
+
+  addition_t const *get_additions(block_t const &block) const {
+    return block.m_num_additions ? &m_additions[block.m_first_addition] : nullptr;
+  }
+
+  // Whether or not the cluster was parsed from its raw bytes by
+  // read() & the blocks' elements are available via get_raw_element().
+  bool is_raw() const {
+    return m_raw;
+  }
+
+  // The SimpleBlock or BlockGroup element the block was parsed from,
+  // including its header; m_element_size bytes long.
+  unsigned char const *get_raw_element(block_t const &block) const {
+    return m_data.data() + (block.m_position - m_body_position);
+  }
+
+  // Returns a memory_c object borrowing the frame's data.
+  memory_cptr borrow_frame(block_t const &block, std::size_t idx) const {
+    auto &frame = get_frame(block, idx);
+    return memory_c::borrow(const_cast<unsigned char *>(frame.m_data), frame.m_size);
+  }
+
+protected:
+  bool parse(unsigned char const *data, std::size_t size);
+  bool parse_block_group(unsigned char const *data, std::size_t size, uint64_t position, uint64_t body_position);
+  bool parse_block_additions(unsigned char const *data, std::size_t size, block_t &block);
+  bool parse_block(unsigned char const *data, std::size_t size, uint64_t position, block_t &block);
+  void finish();
+};
@@ -905,12 +905,8 @@ kax_info_c::post_block(EbmlElement &e) {
 }
 
 void
-kax_info_c::show_frame_summary(EbmlElement &e) {
-  auto p         = p_func();
-  auto frame_pos = e.GetElementPosition() + e.ElementSize();
-
-  for (auto size : p->m_frame_sizes)
-    frame_pos -= size;
+kax_info_c::show_frame_summary(uint64_t frame_pos) {
+  auto p = p_func();
 
   for (auto fidx = 0u; fidx < p->m_frame_sizes.size(); fidx++) {
     std::string position;
@@ -959,10 +955,20 @@ kax_info_c::pre_block_group(EbmlElement &) {
 
 void
 kax_info_c::post_block_group(EbmlElement &e) {
+  auto frames_start = e.GetElementPosition() + e.ElementSize();
+
+  for (auto size : p_func()->m_frame_sizes)
+    frames_start -= size;
+
+  finish_block_group(frames_start);
+}
+
+void
+kax_info_c::finish_block_group(uint64_t frames_start) {
   auto p = p_func();
 
   if (p->m_show_summary)
-    show_frame_summary(e);
+    show_frame_summary(frames_start);
 
   auto &tinfo = p->m_track_info[p->m_lf_tnum];
 
@@ -1052,19 +1058,32 @@ kax_info_c::post_simple_block(EbmlElement &e) {
     frame_pos += data.Size();
   }
 
+  finish_simple_block(block.TrackNum(), timestamp_ns, block.IsKeyframe(), block.IsDiscardable(), frames_start);
+}
+
+void
+kax_info_c::finish_simple_block(uint64_t track_number,
+                                int64_t timestamp_ns,
+                                bool key,
+                                bool discardable,
+                                uint64_t frames_start) {
+  auto p          = p_func();
+  auto &tinfo     = p->m_track_info[track_number];
+  auto num_frames = p->m_frame_sizes.size();
+
   if (p->m_show_summary) {
     std::string position;
-    frame_pos = frames_start;
+    auto frame_pos = frames_start;
 
-    for (int idx = 0; idx < num_frames; idx++) {
+    for (auto idx = 0u; idx < num_frames; idx++) {
       if (p->m_show_positions) {
         position   = fmt::format(p->m_hex_positions ? Y(", position 0x{0:x}") : Y(", position {0}"), frame_pos);
         frame_pos += p->m_frame_sizes[idx];
       }
 
       p->m_out->puts(fmt::format(Y("{0} frame, track {1}, timestamp {2}, size {3}, adler 0x{4:08x}{5}\n"),
-                                 (block.IsKeyframe() ? 'I' : block.IsDiscardable() ? 'B' : 'P'),
-                                 block.TrackNum(),
+                                 (key ? 'I' : discardable ? 'B' : 'P'),
+                                 track_number,
                                  mtx::string::format_timestamp(timestamp_ns),
                                  p->m_frame_sizes[idx],
                                  p->m_frame_adlers[idx],
@@ -1072,12 +1091,47 @@ kax_info_c::post_simple_block(EbmlElement &e) {
     }
   }
 
-  tinfo.m_blocks                                                                    += block.NumberFrames();
-  tinfo.m_blocks_by_ref_num[block.IsKeyframe() ? 0 : block.IsDiscardable() ? 2 : 1] += block.NumberFrames();
-  tinfo.m_min_timestamp                                                              = std::min(tinfo.m_min_timestamp ? *tinfo.m_min_timestamp : static_cast<int64_t>(timestamp_ns), static_cast<int64_t>(timestamp_ns));
-  tinfo.m_max_timestamp                                                              = std::max(tinfo.m_max_timestamp ? *tinfo.m_max_timestamp : static_cast<int64_t>(timestamp_ns), static_cast<int64_t>(timestamp_ns));
-  tinfo.m_add_duration_for_n_packets                                                 = block.NumberFrames();
-  tinfo.m_size                                                                      += std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+  tinfo.m_blocks                                           += num_frames;
+  tinfo.m_blocks_by_ref_num[key ? 0 : discardable ? 2 : 1] += num_frames;
+  tinfo.m_min_timestamp                                     = std::min(tinfo.m_min_timestamp ? *tinfo.m_min_timestamp : timestamp_ns, timestamp_ns);
+  tinfo.m_max_timestamp                                     = std::max(tinfo.m_max_timestamp ? *tinfo.m_max_timestamp : timestamp_ns, timestamp_ns);
+  tinfo.m_add_duration_for_n_packets                        = num_frames;
+  tinfo.m_size                                             += std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+}
+
+void
+kax_info_c::handle_flat_cluster(kax_flat_cluster_c const &cluster) {
+  auto p = p_func();
+
+  ui_show_progress(100 * cluster.get_position() / p->m_file_size, Y("Parsing file"));
+
+  for (auto const &block : cluster.get_blocks()) {
+    p->m_frame_sizes.clear();
+    p->m_frame_adlers.clear();
+    p->m_frame_hexdumps.clear();
+
+    for (auto idx = 0u; idx < block.m_num_frames; ++idx) {
+      auto &frame = cluster.get_frame(block, idx);
+
+      p->m_frame_sizes.push_back(frame.m_size);
+      p->m_frame_adlers.push_back(mtx::checksum::calculate_as_uint(mtx::checksum::algorithm_e::adler32, frame.m_data, frame.m_size));
+      p->m_frame_hexdumps.push_back(p->m_show_hexdump ? create_hexdump(frame.m_data, frame.m_size) : std::string{});
+    }
+
+    auto frames_start = block.m_num_frames ? cluster.get_frame(block, 0).m_position : block.m_position;
+
+    if (block.m_simple) {
+      finish_simple_block(block.m_track_number, block.m_timestamp, block.m_key, block.m_discardable, frames_start);
+      continue;
+    }
+
+    p->m_num_references = block.m_references.size();
+    p->m_lf_timestamp   = block.m_timestamp;
+    p->m_lf_tnum        = block.m_track_number;
+    p->m_block_duration = block.m_duration ? std::optional<int64_t>{static_cast<int64_t>(*block.m_duration)} : std::optional<int64_t>{};
+
+    finish_block_group(frames_start);
+  }
 }
 
 kax_info_c::result_e
@@ -1094,7 +1148,27 @@ kax_info_c::handle_segment(EbmlElement *l0) {
   // Prevent reporting "first timestamp after resync":
   kax_file->set_timestamp_scale(-1);
 
-  while ((l1 = kax_file->read_next_level1_element())) {
+  auto segment_end = !l0->IsFiniteSize() ? p->m_file_size : std::min<uint64_t>(p->m_file_size, l0->GetElementPosition() + l0->HeadSize() + l0->GetSize());
+  kax_flat_cluster_c cluster;
+
+  while (true) {
+    cluster.set_timestamp_scale(p->m_ts_scale);
+
+    // The summary only needs the blocks' basic properties. Parse
+    // clusters with the lightweight parser instead of building a full
+    // element tree if possible.
+    if (p->m_show_summary && cluster.read(*p->m_in, segment_end)) {
+      handle_flat_cluster(cluster);
+
+      if (p->m_abort)
+        return result_e::aborted;
+
+      continue;
+    }
+
+    if (!(l1 = kax_file->read_next_level1_element()))
+      break;
+
     retain_element(l1);
 
     if (Is<KaxCluster>(*l1) && !p->m_continue_at_cluster && !p->m_show_summary) {
@@ -17,6 +17,8 @@
 
 #include <matroska/KaxCluster.h>
 
+#include "common/kax_flat_cluster.h"
+
 namespace mtx {
 
 namespace kax_info {
@@ -116,7 +118,9 @@ protected:
   void init_custom_element_value_formatters_and_processors();
 
   void show_element(libebml::EbmlElement *l, int level, std::string const &info, std::optional<int64_t> position = {}, std::optional<int64_t> size = {});
-  void show_frame_summary(libebml::EbmlElement &e);
+  void show_frame_summary(uint64_t frame_pos);
+  void finish_block_group(uint64_t frames_start);
+  void finish_simple_block(uint64_t track_number, int64_t timestamp_ns, bool key, bool discardable, uint64_t frames_start);
 
   void add_track(std::shared_ptr<kax_info::track_t> const &t);
   kax_info::track_t *find_track(int tnum);
@@ -125,6 +129,7 @@ protected:
 
   void handle_block_group(libebml::EbmlElement *&l2, libmatroska::KaxCluster *&cluster);
   void handle_elements_generic(libebml::EbmlElement &e);
+  void handle_flat_cluster(kax_flat_cluster_c const &cluster);
   result_e handle_segment(libebml::EbmlElement *l0);
 
   void display_track_info();
@@ -167,25 +167,24 @@ iconv_charset_converter_c::convert(iconv_t handle,
   if (s_iconv_t_error_value == handle)
     return source;
 
-  int length        = source.length() * 4;
-  char *destination = (char *)safemalloc(length + 1);
-  memset(destination, 0, length + 1);
+  // Subtitle readers convert each line separately. Re-using the
+  // buffer avoids allocating memory for each of them. It's kept per
+  // thread as files are opened from worker threads, too.
+  static thread_local std::string s_buffer;
+
+  s_buffer.assign(source.length() * 4 + 1, '\0');
 
   iconv(handle, nullptr, nullptr, nullptr, nullptr); // Reset the iconv state.
 
-  size_t length_source      = length / 4;
-  size_t length_destination = length;
-  char *source_copy         = safestrdup(source.c_str());
-  char *ptr_source          = source_copy;
-  char *ptr_destination     = destination;
+  size_t length_source      = source.length();
+  size_t length_destination = source.length() * 4;
+  auto ptr_source           = const_cast<char *>(source.c_str());
+  auto ptr_destination      = s_buffer.data();
+
   iconv(handle, (ICONV_CONST char **)&ptr_source, &length_source, &ptr_destination, &length_destination);
   iconv(handle, nullptr, nullptr, &ptr_destination, &length_destination);
 
-  safefree(source_copy);
-  std::string result = destination;
-  safefree(destination);
-
-  return result;
+  return s_buffer.c_str();
 }
 
 bool
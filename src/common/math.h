@@ -32,6 +32,16 @@ count_1_bits(uint64_t value) {
 #endif
 }
 
+// 'value' must not be 0.
+inline std::size_t
+count_leading_zero_bits(uint64_t value) {
+#if defined(COMP_MSC)
+  return __lzcnt64(value);
+#else
+  return __builtin_clzll(value);
+#endif
+}
+
 uint64_t round_to_nearest_pow2(uint64_t value);
 int int_log2(uint64_t value);
 double int_to_double(int64_t value);
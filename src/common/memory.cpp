@@ -14,8 +14,25 @@
 #include "common/common_pch.h"
 
 #include "common/memory.h"
+#include "common/memory_pool.h"
 #include "common/error.h"
 
+memory_cptr
+memory_c::alloc(std::size_t size) {
+  std::size_t capacity{};
+  auto buffer = mtx::mem::pool::acquire(size, capacity);
+
+  return std::make_shared<memory_c>(private_tag_t{}, buffer, size, true, capacity);
+}
+
+void
+memory_c::release_buffer() {
+  if (m_capacity)
+    mtx::mem::pool::release(m_ptr, m_capacity);
+  else
+    free(m_ptr);
+}
+
 void
 memory_c::resize(size_t new_size)
   noexcept
@@ -23,7 +40,22 @@ memory_c::resize(size_t new_size)
   if (new_size == m_size)
     return;
 
-  if (m_is_owned) {
+  if (m_is_owned && m_capacity) {
+    if ((new_size + m_offset) <= m_capacity) {
+      m_size = new_size + m_offset;
+      return;
+    }
+
+    std::size_t capacity{};
+    auto tmp = mtx::mem::pool::acquire(new_size + m_offset, capacity);
+    std::memcpy(tmp, m_ptr, std::min(new_size + m_offset, m_size));
+    release_buffer();
+
+    m_ptr      = tmp;
+    m_size     = new_size + m_offset;
+    m_capacity = capacity;
+
+  } else if (m_is_owned) {
     m_ptr  = static_cast<unsigned char *>(saferealloc(m_ptr, new_size + m_offset));
     m_size = new_size + m_offset;
 
@@ -33,6 +65,7 @@ memory_c::resize(size_t new_size)
     m_ptr      = tmp;
     m_is_owned = true;
     m_size     = new_size;
+    m_offset   = 0;
   }
 }
 
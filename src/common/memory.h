@@ -81,25 +81,36 @@ using memories_c  = std::vector<memory_cptr>;
 
 class memory_c {
 private:
+  struct private_tag_t {};
+
   unsigned char *m_ptr{};
   std::size_t m_size{}, m_offset{};
+  // Size of the buffer if it belongs to one of the memory pool's size
+  // classes; 0 if it was allocated with malloc() directly.
+  std::size_t m_capacity{};
   bool m_is_owned{};
 
-  explicit memory_c(void *ptr,
+public:
+  // Only public so that std::make_shared() can allocate the object
+  // together with its control block; use the static factory functions
+  // below instead.
+  explicit memory_c(private_tag_t,
+                    void *ptr,
                     std::size_t size,
-                    bool take_ownership) // allocate a new counter
+                    bool take_ownership,
+                    std::size_t capacity = 0)
     : m_ptr{static_cast<unsigned char *>(ptr)}
     , m_size{size}
+    , m_capacity{capacity}
     , m_is_owned{take_ownership}
   {
   }
 
-public:
   memory_c() {}
 
   ~memory_c() {
     if (m_is_owned && m_ptr)
-      free(m_ptr);
+      release_buffer();
   }
 
   memory_c(const memory_c &r) = delete;
@@ -143,10 +154,15 @@ public:
     m_is_owned  = true;
     m_size     -= m_offset;
     m_offset    = 0;
+    m_capacity  = 0;
   }
 
+  // Hands ownership of the buffer to someone else who'll free() it
+  // (e.g. libebml). Pooled buffers are allocated with malloc(), too,
+  // but they'll never return to the pool.
   void lock() {
     m_is_owned = false;
+    m_capacity = 0;
   }
 
   void resize(std::size_t new_size) noexcept;
@@ -180,15 +196,18 @@ public:
     return m_ptr[m_offset + idx];
   }
 
+private:
+  void release_buffer();
+
 public:
   static inline memory_cptr
   take_ownership(void *buffer, std::size_t length) {
-    return memory_cptr{ new memory_c(reinterpret_cast<unsigned char *>(buffer), length, true) };
+    return std::make_shared<memory_c>(private_tag_t{}, buffer, length, true);
   }
 
   static inline memory_cptr
   borrow(void *buffer, std::size_t length) {
-    return memory_cptr{ new memory_c(reinterpret_cast<unsigned char *>(buffer), length, false) };
+    return std::make_shared<memory_c>(private_tag_t{}, buffer, length, false);
   }
 
   static inline memory_cptr
@@ -196,15 +215,18 @@ public:
     return borrow(&buffer[0], buffer.length());
   }
 
-  static memory_cptr
-  alloc(std::size_t size) {
-    return take_ownership(safemalloc(size), size);
-  };
+  static memory_cptr alloc(std::size_t size);
 
   static inline memory_cptr
   clone(const void *buffer,
         std::size_t size) {
-    return take_ownership(safememdup(buffer, size), size);
+    if (!buffer)
+      return take_ownership(nullptr, size);
+
+    auto mem = alloc(size);
+    std::memcpy(mem->get_buffer(), buffer, size);
+
+    return mem;
   }
 
   static inline memory_cptr
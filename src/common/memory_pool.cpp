@@ -0,0 +1,207 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   size class based buffer pool for memory_c
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <atomic>
+#include <mutex>
+
+#include "common/memory_pool.h"
+
+namespace mtx::mem::pool {
+
+namespace {
+
+// Size classes are powers of two from 2^6 = 64 bytes up to 2^20 =
+// 1 MiB. Each class retains at most s_max_retained_bytes_per_class
+// worth of free buffers (but at least s_min_retained_buffers and at
+// most s_max_retained_buffers of them) so that the pool cannot grow
+// without bounds.
+constexpr auto s_min_class_shift              = 6u;
+constexpr auto s_max_class_shift              = 20u;
+constexpr auto s_num_classes                  = s_max_class_shift - s_min_class_shift + 1;
+constexpr auto s_max_retained_bytes_per_class = std::size_t{4 * 1024 * 1024};
+constexpr auto s_min_retained_buffers         = std::size_t{4};
+constexpr auto s_max_retained_buffers         = std::size_t{1024};
+
+struct size_class_t {
+  std::mutex m_mutex;
+  std::vector<unsigned char *> m_free;
+  std::size_t m_max_free{};
+};
+
+class pool_c {
+public:
+  std::array<size_class_t, s_num_classes> m_classes;
+  std::atomic<bool> m_enabled{true};
+  std::atomic<uint64_t> m_hits{}, m_misses{}, m_releases{}, m_discards{}, m_unpooled{}, m_retained_bytes{};
+
+public:
+  pool_c() {
+    for (auto idx = 0u; idx < s_num_classes; ++idx)
+      m_classes[idx].m_max_free = std::clamp(s_max_retained_bytes_per_class >> (idx + s_min_class_shift), s_min_retained_buffers, s_max_retained_buffers);
+  }
+
+  void trim() {
+    for (auto idx = 0u; idx < s_num_classes; ++idx) {
+      auto &size_class = m_classes[idx];
+      std::lock_guard<std::mutex> lock{size_class.m_mutex};
+
+      for (auto buffer : size_class.m_free)
+        free(buffer);
+
+      m_retained_bytes -= size_class.m_free.size() * class_capacity(idx);
+      size_class.m_free.clear();
+    }
+  }
+
+  static std::size_t class_capacity(unsigned int idx) {
+    return std::size_t{1} << (idx + s_min_class_shift);
+  }
+
+  static std::optional<unsigned int> class_index_for_size(std::size_t size) {
+    if (size > class_capacity(s_num_classes - 1))
+      return {};
+
+    auto idx = 0u;
+    while (class_capacity(idx) < size)
+      ++idx;
+
+    return idx;
+  }
+
+  static std::optional<unsigned int> class_index_for_capacity(std::size_t capacity) {
+    auto idx = class_index_for_size(capacity);
+    if (idx && (class_capacity(*idx) == capacity))
+      return idx;
+    return {};
+  }
+};
+
+pool_c &
+get_pool() {
+  // Intentionally never destroyed: memory_c instances held by global
+  // or static objects may still release their buffers during global
+  // destruction.
+  static auto s_pool = new pool_c;
+  return *s_pool;
+}
+
+debugging_option_c s_debug{"memory_pool"};
+
+} // anonymous namespace
+
+unsigned char *
+acquire(std::size_t size,
+        std::size_t &capacity) {
+  auto &pool = get_pool();
+  auto idx   = pool.m_enabled ? pool_c::class_index_for_size(size) : std::optional<unsigned int>{};
+
+  if (!idx) {
+    ++pool.m_unpooled;
+    capacity = 0;
+    return safemalloc(size);
+  }
+
+  capacity         = pool_c::class_capacity(*idx);
+  auto &size_class = pool.m_classes[*idx];
+
+  {
+    std::lock_guard<std::mutex> lock{size_class.m_mutex};
+
+    if (!size_class.m_free.empty()) {
+      auto buffer = size_class.m_free.back();
+      size_class.m_free.pop_back();
+
+      ++pool.m_hits;
+      pool.m_retained_bytes -= capacity;
+
+      return buffer;
+    }
+  }
+
+  ++pool.m_misses;
+
+  return safemalloc(capacity);
+}
+
+void
+release(unsigned char *buffer,
+        std::size_t capacity) {
+  if (!buffer)
+    return;
+
+  auto &pool = get_pool();
+  auto idx   = pool_c::class_index_for_capacity(capacity);
+
+  if (idx && pool.m_enabled) {
+    auto &size_class = pool.m_classes[*idx];
+    std::lock_guard<std::mutex> lock{size_class.m_mutex};
+
+    if (size_class.m_free.size() < size_class.m_max_free) {
+      size_class.m_free.push_back(buffer);
+
+      ++pool.m_releases;
+      pool.m_retained_bytes += capacity;
+
+      return;
+    }
+  }
+
+  ++pool.m_discards;
+  free(buffer);
+}
+
+void
+enable(bool enable) {
+  auto &pool = get_pool();
+
+  pool.m_enabled = enable;
+  if (!enable)
+    pool.trim();
+}
+
+void
+trim() {
+  get_pool().trim();
+}
+
+statistics_t
+statistics() {
+  auto &pool = get_pool();
+
+  statistics_t stats;
+
+  stats.m_hits           = pool.m_hits;
+  stats.m_misses         = pool.m_misses;
+  stats.m_releases       = pool.m_releases;
+  stats.m_discards       = pool.m_discards;
+  stats.m_unpooled       = pool.m_unpooled;
+  stats.m_retained_bytes = pool.m_retained_bytes;
+
+  return stats;
+}
+
+void
+dump_statistics() {
+  if (!s_debug)
+    return;
+
+  auto stats = statistics();
+  auto total = stats.m_hits + stats.m_misses;
+
+  mxdebug(fmt::format("memory pool statistics: hits {0} misses {1} hit rate {2:.1f}% releases {3} discards {4} unpooled {5} retained bytes {6}\n",
+                      stats.m_hits, stats.m_misses, total ? stats.m_hits * 100.0 / total : 0.0, stats.m_releases, stats.m_discards, stats.m_unpooled, stats.m_retained_bytes));
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   size class based buffer pool for memory_c
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+namespace mtx::mem::pool {
+
+struct statistics_t {
+  uint64_t m_hits{}, m_misses{}, m_releases{}, m_discards{}, m_unpooled{}, m_retained_bytes{};
+};
+
+// Returns a buffer of at least size bytes. capacity is set to the
+// actual size of the buffer if it was taken from or belongs to one of
+// the pool's size classes and to 0 if it was allocated with malloc()
+// directly (requests larger than the largest size class or when
+// pooling is disabled). Either way the buffer has been allocated with
+// malloc() and may be freed with free().
+unsigned char *acquire(std::size_t size, std::size_t &capacity);
+
+// Hands a buffer obtained from acquire() with a non-zero capacity
+// back to the pool. It is freed if its size class is full already.
+void release(unsigned char *buffer, std::size_t capacity);
+
+void enable(bool enable);
+void trim();
+
+statistics_t statistics();
+void dump_statistics();
+
+}
@@ -46,6 +46,11 @@ public:
 
   static void enable_flushing_on_close(bool enable);
 
+  // Asks the operating system to start reading the first 'size' bytes
+  // of the file into its cache in the background. No data is copied;
+  // does nothing where no such hint is available.
+  static void read_ahead(std::string const &path, uint64_t size);
+
 protected:
   virtual uint32_t _read(void *buffer, size_t size) override;
   virtual size_t _write(const void *buffer, size_t size) override;
@@ -20,6 +20,9 @@
 #endif
 #include <sys/stat.h>
 #include <sys/types.h>
+#if defined(HAVE_POSIX_FADVISE)
+# include <fcntl.h>
+#endif
 
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
@@ -150,3 +153,20 @@ mm_file_io_c::truncate(int64_t pos) {
   p->cached_size = -1;
   return ftruncate(fileno(p->file), pos);
 }
+
+void
+mm_file_io_c::read_ahead(std::string const &path,
+                         uint64_t size) {
+#if defined(HAVE_POSIX_FADVISE)
+  auto fd = ::open(g_cc_local_utf8->native(path).c_str(), O_RDONLY);
+  if (-1 == fd)
+    return;
+
+  posix_fadvise(fd, 0, size, POSIX_FADV_WILLNEED);
+  ::close(fd);
+
+#else
+  (void)path;
+  (void)size;
+#endif
+}
@@ -193,3 +193,8 @@ mm_file_io_c::truncate(int64_t pos) {
 
   return -1;
 }
+
+void
+mm_file_io_c::read_ahead(std::string const &,
+                         uint64_t) {
+}
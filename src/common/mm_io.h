@@ -28,6 +28,14 @@ protected:
 
   std::unique_ptr<mm_io_private_c> const p_ptr;
 
+  // Window into the read buffer of buffering implementations
+  // (e.g. mm_read_buffer_io_c). Kept outside the private class so
+  // that the inline fast path accessors below can consume data from
+  // it without any virtual call. Both are nullptr for unbuffered I/O
+  // classes in which case the accessors fall back to the regular,
+  // virtual functions.
+  unsigned char *m_window_cursor{}, *m_window_end{};
+
   explicit mm_io_c(mm_io_private_c &p);
 
 public:
@@ -95,7 +103,112 @@ public:
   virtual void enable_buffering(bool /* enable */) {
   }
 
+  // Non-virtual fast path API over the current read window. peek()
+  // returns a pointer to at least num_bytes contiguous bytes at the
+  // current position without advancing it, refilling the window only
+  // if it contains fewer bytes than requested. It returns nullptr if
+  // that many bytes cannot be provided; this happens at the end of
+  // the file, for requests larger than the window and for unbuffered
+  // I/O classes. consume() may only be called for a number of bytes
+  // previously made available by peek().
+  inline unsigned char const *peek(std::size_t num_bytes) {
+    if ((static_cast<std::size_t>(m_window_end - m_window_cursor) >= num_bytes) || refill_window(num_bytes))
+      return m_window_cursor;
+    return nullptr;
+  }
+
+  inline void consume(std::size_t num_bytes) {
+    assert(static_cast<std::size_t>(m_window_end - m_window_cursor) >= num_bytes);
+    m_window_cursor += num_bytes;
+  }
+
+  inline uint32_t fast_read(void *buffer, std::size_t size) {
+    if (static_cast<std::size_t>(m_window_end - m_window_cursor) < size)
+      return read(buffer, size);
+
+    std::memcpy(buffer, m_window_cursor, size);
+    m_window_cursor += size;
+
+    return size;
+  }
+
+  inline void fast_skip(int64_t num_bytes) {
+    if ((0 <= num_bytes) && (num_bytes <= (m_window_end - m_window_cursor)))
+      m_window_cursor += num_bytes;
+    else
+      skip(num_bytes);
+  }
+
+  inline uint8_t fast_read_uint8() {
+    return m_window_cursor != m_window_end ? *m_window_cursor++ : read_uint8();
+  }
+
+  inline uint16_t fast_read_uint16_be() {
+    auto buf = peek(2);
+    if (!buf)
+      return read_uint16_be();
+
+    m_window_cursor += 2;
+    return (static_cast<uint16_t>(buf[0]) << 8) | buf[1];
+  }
+
+  inline uint32_t fast_read_uint24_be() {
+    auto buf = peek(3);
+    if (!buf)
+      return read_uint24_be();
+
+    m_window_cursor += 3;
+    return (static_cast<uint32_t>(buf[0]) << 16) | (static_cast<uint32_t>(buf[1]) << 8) | buf[2];
+  }
+
+  inline uint32_t fast_read_uint32_be() {
+    auto buf = peek(4);
+    if (!buf)
+      return read_uint32_be();
+
+    m_window_cursor += 4;
+    return (static_cast<uint32_t>(buf[0]) << 24) | (static_cast<uint32_t>(buf[1]) << 16) | (static_cast<uint32_t>(buf[2]) << 8) | buf[3];
+  }
+
+  inline uint64_t fast_read_uint64_be() {
+    auto buf = peek(8);
+    if (!buf)
+      return read_uint64_be();
+
+    m_window_cursor += 8;
+    return (static_cast<uint64_t>(fast_get_uint32_be(buf)) << 32) | fast_get_uint32_be(buf + 4);
+  }
+
+  inline uint16_t fast_read_uint16_le() {
+    auto buf = peek(2);
+    if (!buf)
+      return read_uint16_le();
+
+    m_window_cursor += 2;
+    return (static_cast<uint16_t>(buf[1]) << 8) | buf[0];
+  }
+
+  inline uint32_t fast_read_uint32_le() {
+    auto buf = peek(4);
+    if (!buf)
+      return read_uint32_le();
+
+    m_window_cursor += 4;
+    return (static_cast<uint32_t>(buf[3]) << 24) | (static_cast<uint32_t>(buf[2]) << 16) | (static_cast<uint32_t>(buf[1]) << 8) | buf[0];
+  }
+
 protected:
+  // Called by peek() if the read window holds fewer than min_bytes
+  // bytes. Buffering implementations compact and refill their window
+  // and return whether or not min_bytes are available afterwards.
+  virtual bool refill_window(std::size_t /* min_bytes */) {
+    return false;
+  }
+
+  static inline uint32_t fast_get_uint32_be(unsigned char const *buf) {
+    return (static_cast<uint32_t>(buf[0]) << 24) | (static_cast<uint32_t>(buf[1]) << 16) | (static_cast<uint32_t>(buf[2]) << 8) | buf[3];
+  }
+
   virtual uint32_t _read(void *buffer, size_t size) = 0;
   virtual size_t _write(const void *buffer, size_t size) = 0;
 };
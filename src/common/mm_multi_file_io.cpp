@@ -15,6 +15,7 @@
 
 #include <QRegularExpression>
 
+#include "common/debugging.h"
 #include "common/id_info.h"
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
@@ -25,6 +26,22 @@
 #include "common/qt.h"
 #include "common/strings/editing.h"
 #include "common/strings/parsing.h"
+#include "common/thread_pool.h"
+
+namespace {
+
+debugging_option_c s_debug{"multi_file_io"};
+
+// Maximum number of member files kept open at the same time.
+constexpr std::size_t s_max_open_files = 8;
+
+// The next member file is opened & the beginning of it read in the
+// background once fewer than s_prefetch_distance bytes are left in the
+// current one.
+constexpr uint64_t s_prefetch_distance = 4 * 1024 * 1024;
+constexpr uint64_t s_prefetch_size     = 1024 * 1024;
+
+}
 
 mm_multi_file_io_c::mm_multi_file_io_c(std::vector<std::filesystem::path> const &file_names,
                                        std::string const &display_file_name)
@@ -66,13 +83,115 @@ mm_multi_file_io_c::setFilePointer(int64_t offset,
       continue;
     }
 
-    p->current_pos       = new_pos;
-    p->current_local_pos = new_pos - file.global_start;
-    file.file->setFilePointer(p->current_local_pos);
+    // The member file itself is only positioned once data is actually
+    // read from it.
+    p->current_pos             = new_pos;
+    p->current_local_pos       = new_pos - file.global_start;
+    p->current_file_positioned = false;
     break;
   }
 }
 
+mm_file_io_c &
+mm_multi_file_io_c::use_file(unsigned int idx) {
+  auto p     = p_func();
+  auto &file = p->files[idx];
+
+  file.last_use = ++p->use_counter;
+
+  if (!file.file) {
+    mxdebug_if(s_debug, fmt::format("opening {0}\n", file.file_name.u8string()));
+
+    file.file = std::make_shared<mm_file_io_c>(file.file_name.u8string());
+    close_least_recently_used_files();
+  }
+
+  return *file.file;
+}
+
+void
+mm_multi_file_io_c::close_least_recently_used_files() {
+  auto p = p_func();
+
+  while (static_cast<std::size_t>(std::count_if(p->files.begin(), p->files.end(), [](auto const &file) { return !!file.file; })) > s_max_open_files) {
+    mm_multi_file_io_private_c::file_t *oldest{};
+
+    for (auto idx = 0u; idx < p->files.size(); ++idx) {
+      auto &file = p->files[idx];
+      if (file.file && (idx != p->current_file) && (!oldest || (file.last_use < oldest->last_use)))
+        oldest = &file;
+    }
+
+    if (!oldest)
+      return;
+
+    mxdebug_if(s_debug, fmt::format("closing least recently used {0}\n", oldest->file_name.u8string()));
+
+    oldest->file->close();
+    oldest->file.reset();
+    oldest->head.reset();
+  }
+}
+
+void
+mm_multi_file_io_c::start_prefetch_maybe() {
+  auto p   = p_func();
+  auto idx = p->current_file + 1;
+
+  if (   (idx >= p->files.size())
+      || p->files[idx].file
+      || p->files[idx].head
+      || ((p->files[p->current_file].size - p->current_local_pos) > s_prefetch_distance))
+    return;
+
+  if (p->prefetch.valid()) {
+    if (p->prefetch_idx == idx)
+      return;
+
+    // Left over from before a seek.
+    finish_prefetch();
+  }
+
+  mxdebug_if(s_debug, fmt::format("prefetching {0}\n", p->files[idx].file_name.u8string()));
+
+  p->prefetch_idx = idx;
+  p->prefetch     = mtx::thread_pool_c::global().submit([file_name = p->files[idx].file_name, size = p->files[idx].size]() {
+    mm_multi_file_io_private_c::prefetch_t result;
+
+    result.file   = std::make_shared<mm_file_io_c>(file_name.u8string());
+    result.head   = memory_c::alloc(std::min(size, s_prefetch_size));
+    auto num_read = result.file->read(result.head->get_buffer(), result.head->get_size());
+
+    result.head->set_size(num_read);
+
+    return result;
+  });
+}
+
+void
+mm_multi_file_io_c::finish_prefetch() {
+  auto p     = p_func();
+  auto &file = p->files[p->prefetch_idx];
+
+  try {
+    auto result = p->prefetch.get();
+
+    if (!file.file) {
+      file.file     = result.file;
+      file.last_use = ++p->use_counter;
+    }
+
+    file.head = result.head;
+
+    close_least_recently_used_files();
+
+  } catch (mtx::mm_io::exception &ex) {
+    // The file will be opened again once it's actually needed, and
+    // errors will be reported then.
+    mxdebug_if(s_debug, fmt::format("prefetching {0} failed: {1}\n", file.file_name.u8string(), ex.what()));
+  }
+}
+
 uint32_t
 mm_multi_file_io_c::_read(void *buffer,
                           size_t size) {
@@ -82,24 +201,50 @@ mm_multi_file_io_c::_read(void *buffer,
   auto buffer_ptr       = static_cast<unsigned char *>(buffer);
 
   while (!eof() && (num_read_total < size)) {
+    if (p->prefetch.valid() && (p->prefetch_idx == p->current_file))
+      finish_prefetch();
+
     auto &file       = p->files[p->current_file];
     auto num_to_read = static_cast<uint64_t>(std::min(static_cast<uint64_t>(size) - static_cast<uint64_t>(num_read_total), file.size - p->current_local_pos));
 
     if (0 != num_to_read) {
-      size_t num_read       = file.file->read(buffer_ptr, num_to_read);
+      size_t num_read{};
+      auto short_read = false;
+
+      if (file.head && (p->current_local_pos < file.head->get_size())) {
+        num_read                   = std::min<uint64_t>(num_to_read, file.head->get_size() - p->current_local_pos);
+        p->current_file_positioned = false;
+        std::memcpy(buffer_ptr, file.head->get_buffer() + p->current_local_pos, num_read);
+
+      } else {
+        auto &in = use_file(p->current_file);
+
+        if (!p->current_file_positioned) {
+          in.setFilePointer(p->current_local_pos);
+          p->current_file_positioned = true;
+        }
+
+        num_read   = in.read(buffer_ptr, num_to_read);
+        short_read = num_read != num_to_read;
+      }
+
       num_read_total       += num_read;
       buffer_ptr           += num_read;
       p->current_local_pos += num_read;
       p->current_pos       += num_read;
 
-      if (num_read != num_to_read)
+      if (short_read)
         break;
     }
 
+    start_prefetch_maybe();
+
     if ((p->current_local_pos >= file.size) && (p->files.size() > (p->current_file + 1))) {
+      file.head.reset();
+
       ++p->current_file;
-      p->current_local_pos = 0;
-      p->files[p->current_file].file->setFilePointer(0);
+      p->current_local_pos       = 0;
+      p->current_file_positioned = false;
     }
   }
 
@@ -121,8 +266,13 @@ void
 mm_multi_file_io_c::close_multi_file_io() {
   auto p = p_func();
 
+  // A prefetch still running only holds its own copies of what it
+  // needs; its result is simply discarded.
+  p->prefetch = {};
+
   for (auto &file : p->files)
-    file.file->close();
+    if (file.file)
+      file.file->close();
 
   p->files.clear();
   p->total_size        = 0;
@@ -181,7 +331,8 @@ mm_multi_file_io_c::enable_buffering(bool enable) {
   auto p = p_func();
 
   for (auto &file : p->files)
-    file.file->enable_buffering(enable);
+    if (file.file)
+      file.file->enable_buffering(enable);
 }
 
 std::string
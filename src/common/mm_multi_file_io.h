@@ -50,4 +50,9 @@ protected:
   virtual size_t _write(const void *buffer, size_t size) override;
 
   void close_multi_file_io();
+
+  mm_file_io_c &use_file(unsigned int idx);
+  void close_least_recently_used_files();
+  void start_prefetch_maybe();
+  void finish_prefetch();
 };
@@ -13,6 +13,8 @@
 
 #include "common/common_pch.h"
 
+#include <future>
+
 #include "common/mm_io_p.h"
 
 class mm_multi_file_io_c;
@@ -21,32 +23,50 @@ class mm_multi_file_io_private_c : public mm_io_private_c {
 public:
   struct file_t {
     std::filesystem::path file_name;
-    uint64_t size{}, global_start{};
-    mm_file_io_cptr file;
+    uint64_t size{}, global_start{}, last_use{};
+    mm_file_io_cptr file;     // only set while the file is open
+    memory_cptr head;         // the file's beginning if it was prefetched
 
-    file_t(std::filesystem::path const &p_file_name, uint64_t p_global_start, mm_file_io_cptr const &p_file)
+    file_t(std::filesystem::path const &p_file_name, uint64_t p_size, uint64_t p_global_start, mm_file_io_cptr const &p_file)
       : file_name{p_file_name}
-      , size{static_cast<uint64_t>(p_file->get_size())}
+      , size{p_size}
       , global_start{p_global_start}
       , file{p_file}
     {
     }
   };
 
+  struct prefetch_t {
+    mm_file_io_cptr file;
+    memory_cptr head;
+  };
+
   std::string display_file_name;
-  uint64_t total_size{}, current_pos{}, current_local_pos{};
-  unsigned int current_file{};
+  uint64_t total_size{}, current_pos{}, current_local_pos{}, use_counter{};
+  unsigned int current_file{}, prefetch_idx{};
+  bool current_file_positioned{};
   std::vector<file_t> files;
+  std::future<prefetch_t> prefetch;
 
   explicit mm_multi_file_io_private_c(std::vector<std::filesystem::path> const &p_file_names,
                                       std::string const &p_display_file_name)
     : display_file_name{p_display_file_name}
   {
+    // Only the first file is opened right away. The others are opened
+    // on demand; their sizes are taken from the file system.
     for (auto &file_name : p_file_names) {
-      auto file = std::static_pointer_cast<mm_file_io_c>(mm_file_io_c::open(file_name.u8string()));
-      files.emplace_back(file_name, total_size, file);
+      std::error_code ec;
+      mm_file_io_cptr file;
+      uint64_t size = files.empty() ? 0 : std::filesystem::file_size(file_name, ec);
+
+      if (files.empty() || ec) {
+        file = std::static_pointer_cast<mm_file_io_c>(mm_file_io_c::open(file_name.u8string()));
+        size = file->get_size();
+      }
+
+      files.emplace_back(file_name, size, total_size, file);
 
-      total_size += file->get_size();
+      total_size += size;
     }
   }
 };
@@ -27,11 +27,13 @@ mm_read_buffer_io_c::mm_read_buffer_io_c(mm_io_cptr const &in,
                                          std::size_t buffer_size)
   : mm_proxy_io_c{*new mm_read_buffer_io_private_c{in, buffer_size}}
 {
+  set_window(0, 0);
 }
 
 mm_read_buffer_io_c::mm_read_buffer_io_c(mm_read_buffer_io_private_c &p)
   : mm_proxy_io_c{p}
 {
+  set_window(0, 0);
 }
 
 mm_read_buffer_io_c::~mm_read_buffer_io_c() {
@@ -42,7 +44,7 @@ uint64_t
 mm_read_buffer_io_c::getFilePointer() {
   auto p = p_func();
 
-  return p->buffering ? p->offset + p->cursor : p->proxy_io->getFilePointer();
+  return p->buffering ? p->offset + get_cursor() : p->proxy_io->getFilePointer();
 }
 
 void
@@ -68,7 +70,7 @@ mm_read_buffer_io_c::setFilePointer(int64_t offset,
 
     case libebml::seek_current:
       new_pos  = p->offset;
-      new_pos += p->cursor;
+      new_pos += get_cursor();
       new_pos += offset;
       break;
 
@@ -83,7 +85,7 @@ mm_read_buffer_io_c::setFilePointer(int64_t offset,
   // Still within the current buffer?
   int64_t in_buf = new_pos - p->offset;
   if ((0 <= in_buf) && (in_buf <= static_cast<int64_t>(p->fill))) {
-    p->cursor = in_buf;
+    set_window(in_buf, p->fill);
     return;
   }
 
@@ -97,7 +99,7 @@ mm_read_buffer_io_c::setFilePointer(int64_t offset,
   p->offset = p->proxy_io->getFilePointer();
 
   // "Drop" the buffer content
-  p->cursor = p->fill = 0;
+  set_window(0, 0);
 
   mxdebug_if(s_debug_seek, fmt::format("seek on proxy from {0} to {1} relative {2}\n", previous_pos, p->offset, p->offset - previous_pos));
 }
@@ -120,19 +122,18 @@ mm_read_buffer_io_c::_read(void *buffer,
 
   while (0 < size) {
     // TODO Directly write full blocks into the output buffer when size > p->size
-    size_t avail = std::min(size, p->fill - p->cursor);
+    size_t avail = std::min<size_t>(size, m_window_end - m_window_cursor);
     if (avail) {
-      memcpy(buf, p->buffer + p->cursor, avail);
-      buf      += avail;
-      res      += avail;
-      size     -= avail;
-      p->cursor += avail;
+      memcpy(buf, m_window_cursor, avail);
+      buf             += avail;
+      res             += avail;
+      size            -= avail;
+      m_window_cursor += avail;
 
     } else {
       // Refill the buffer
-      p->offset += p->cursor;
-      p->cursor  = 0;
-      p->fill    = 0;
+      p->offset += get_cursor();
+      set_window(0, 0);
       avail     = std::min(get_size() - p->offset, static_cast<int64_t>(p->af_buffer->get_size()));
 
       if (!avail) {
@@ -144,7 +145,7 @@ mm_read_buffer_io_c::_read(void *buffer,
 
       int64_t previous_pos = p->proxy_io->getFilePointer();
 
-      p->fill = p->proxy_io->read(p->buffer, avail);
+      set_window(0, p->proxy_io->read(p->buffer, avail));
       mxdebug_if(s_debug_read, fmt::format("physical read from position {2} for {0} returned {1}\n", avail, p->fill, previous_pos));
       if (p->fill != avail) {
         p->eof = true;
@@ -157,6 +158,50 @@ mm_read_buffer_io_c::_read(void *buffer,
   return res;
 }
 
+bool
+mm_read_buffer_io_c::refill_window(std::size_t min_bytes) {
+  auto p = p_func();
+
+  if (!p->buffering || (min_bytes > p->af_buffer->get_size()))
+    return false;
+
+  // Move the unconsumed rest to the start of the buffer. The proxy's
+  // file pointer is always located at offset + fill, therefore the
+  // following read continues right after the data kept.
+  auto cursor    = get_cursor();
+  auto remaining = p->fill - cursor;
+
+  if (cursor && remaining)
+    std::memmove(p->buffer, p->buffer + cursor, remaining);
+
+  p->offset += cursor;
+  set_window(0, remaining);
+
+  auto to_read = std::min<int64_t>(get_size() - p->offset - remaining, p->af_buffer->get_size() - remaining);
+  if (0 < to_read) {
+    auto num_read = p->proxy_io->read(p->buffer + remaining, to_read);
+    mxdebug_if(s_debug_read, fmt::format("physical window refill from position {2} for {0} returned {1}\n", to_read, num_read, p->offset + remaining));
+    set_window(0, remaining + num_read);
+  }
+
+  return p->fill >= min_bytes;
+}
+
+std::size_t
+mm_read_buffer_io_c::get_cursor()
+  const {
+  return m_window_cursor - p_func()->buffer;
+}
+
+void
+mm_read_buffer_io_c::set_window(std::size_t cursor,
+                                std::size_t fill) {
+  auto p          = p_func();
+  p->fill         = fill;
+  m_window_cursor = p->buffer + cursor;
+  m_window_end    = p->buffer + fill;
+}
+
 size_t
 mm_read_buffer_io_c::_write(const void *,
                             size_t) {
@@ -171,8 +216,7 @@ mm_read_buffer_io_c::enable_buffering(bool enable) {
   p->buffering = enable;
   if (!p->buffering) {
     p->offset = 0;
-    p->cursor = 0;
-    p->fill   = 0;
+    set_window(0, 0);
   }
 }
 
@@ -183,16 +227,17 @@ mm_read_buffer_io_c::set_buffer_size(std::size_t new_buffer_size) {
   if (new_buffer_size == p->af_buffer->get_size())
     return;
 
+  auto previous_pos = getFilePointer();
+
   p->af_buffer->resize(new_buffer_size);
   p->buffer = p->af_buffer->get_buffer();
 
+  set_window(0, 0);
+
   if (!p->buffering)
     return;
 
-  auto previous_pos = getFilePointer();
-  p->offset         = previous_pos;
-  p->cursor         = 0;
-  p->fill           = 0;
+  p->offset = previous_pos;
 
   p->proxy_io->setFilePointer(previous_pos);
 }
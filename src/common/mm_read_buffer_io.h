@@ -40,4 +40,8 @@ public:
 protected:
   virtual uint32_t _read(void *buffer, size_t size) override;
   virtual size_t _write(const void *buffer, size_t size) override;
+  virtual bool refill_window(std::size_t min_bytes) override;
+
+  std::size_t get_cursor() const;
+  void set_window(std::size_t cursor, std::size_t fill);
 };
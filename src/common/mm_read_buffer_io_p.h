@@ -21,7 +21,6 @@ class mm_read_buffer_io_private_c : public mm_proxy_io_private_c {
 public:
   memory_cptr af_buffer;
   unsigned char *buffer{};
-  std::size_t cursor{};
   bool eof{};
   size_t fill{};
   int64_t offset{};
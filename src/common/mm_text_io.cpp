@@ -14,6 +14,7 @@
 
 #include "common/common_pch.h"
 
+#include "common/endian.h"
 #include "common/mm_io_x.h"
 #include "common/mm_proxy_io.h"
 #include "common/mm_text_io.h"
@@ -23,6 +24,107 @@
    Class for handling UTF-8/UTF-16/UTF-32 text files.
 */
 
+namespace {
+
+constexpr int64_t s_max_window_size = 64 * 1024;
+
+std::size_t
+find_end_of_line(unsigned char const *data,
+                 std::size_t size) {
+  auto lf = static_cast<unsigned char const *>(std::memchr(data, '\n', size));
+  auto cr = static_cast<unsigned char const *>(std::memchr(data, '\r', lf ? lf - data : size));
+
+  return cr ? cr - data : lf ? lf - data : size;
+}
+
+std::size_t
+get_utf8_sequence_length(unsigned char c) {
+  return ((c & 0x80) == 0x00) ? 1
+       : ((c & 0xe0) == 0xc0) ? 2
+       : ((c & 0xf0) == 0xe0) ? 3
+       : ((c & 0xf8) == 0xf0) ? 4
+       : ((c & 0xfc) == 0xf8) ? 5
+       : ((c & 0xfe) == 0xfc) ? 6
+       :                        0;
+}
+
+// Decodes a run of code points from the read window & appends them
+// to 'dest' as UTF-8. Stops in front of carriage returns & newlines,
+// after 'max_chars' code points and in front of code points that
+// aren't completely contained in the window or that cannot be
+// decoded. The caller handles all of those by reading single code
+// points via read_next_codepoint(). Returns the number of bytes &
+// code points consumed.
+std::pair<std::size_t, std::size_t>
+decode_run(byte_order_mark_e byte_order_mark,
+           unsigned char const *data,
+           std::size_t size,
+           std::size_t max_chars,
+           std::string &dest) {
+  if (byte_order_mark_e::none == byte_order_mark) {
+    auto num_bytes = std::min(find_end_of_line(data, size), max_chars);
+    dest.append(reinterpret_cast<char const *>(data), num_bytes);
+    return { num_bytes, num_bytes };
+  }
+
+  std::size_t num_bytes{}, num_chars{};
+
+  if (byte_order_mark_e::utf8 == byte_order_mark) {
+    // Line breaks can only be the first byte of a sequence. Sequences
+    // are consumed as a whole even if they contain one, just like
+    // read_next_codepoint() does.
+    auto end_of_line = find_end_of_line(data, size);
+
+    while ((num_bytes < end_of_line) && (num_chars < max_chars)) {
+      auto length = get_utf8_sequence_length(data[num_bytes]);
+      if (!length || ((num_bytes + length) > size))
+        break;
+
+      num_bytes += length;
+      ++num_chars;
+
+      if (num_bytes > end_of_line)
+        end_of_line = num_bytes + find_end_of_line(&data[num_bytes], size - num_bytes);
+    }
+
+    dest.append(reinterpret_cast<char const *>(data), num_bytes);
+
+    return { num_bytes, num_chars };
+  }
+
+  auto unit_size     = ((byte_order_mark_e::utf16_le == byte_order_mark) || (byte_order_mark_e::utf16_be == byte_order_mark)) ? 2u : 4u;
+  auto little_endian = ((byte_order_mark_e::utf16_le == byte_order_mark) || (byte_order_mark_e::utf32_le == byte_order_mark));
+
+  while (((num_bytes + unit_size) <= size) && (num_chars < max_chars)) {
+    auto unit = &data[num_bytes];
+    auto code_point =  2 == unit_size ? static_cast<uint32_t>(little_endian ? get_uint16_le(unit) : get_uint16_be(unit))
+                    :                                         little_endian ? get_uint32_le(unit) : get_uint32_be(unit);
+
+    if ((code_point == '\r') || (code_point == '\n') || (code_point >= 0x10000))
+      break;
+
+    if (code_point < 0x80)
+      dest += static_cast<char>(code_point);
+
+    else if (code_point < 0x800) {
+      dest += static_cast<char>(0xc0 |  (code_point >> 6));
+      dest += static_cast<char>(0x80 |  (code_point       & 0x3f));
+
+    } else {
+      dest += static_cast<char>(0xe0 |  (code_point >> 12));
+      dest += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+      dest += static_cast<char>(0x80 |  (code_point       & 0x3f));
+    }
+
+    num_bytes += unit_size;
+    ++num_chars;
+  }
+
+  return { num_bytes, num_chars };
+}
+
+} // anonymous namespace
+
 mm_text_io_private_c::mm_text_io_private_c(mm_io_cptr const &in)
   : mm_proxy_io_private_c{in}
 {
@@ -161,15 +263,9 @@ mm_text_io_c::read_next_codepoint() {
     if (read(buffer, 1) != 1)
       return {};
 
-    size = ((buffer[0] & 0x80) == 0x00) ?  1
-         : ((buffer[0] & 0xe0) == 0xc0) ?  2
-         : ((buffer[0] & 0xf0) == 0xe0) ?  3
-         : ((buffer[0] & 0xf8) == 0xf0) ?  4
-         : ((buffer[0] & 0xfc) == 0xf8) ?  5
-         : ((buffer[0] & 0xfe) == 0xfc) ?  6
-         :                                99;
+    size = get_utf8_sequence_length(buffer[0]);
 
-    if (99 == size)
+    if (!size)
       throw mtx::mm_io::text::invalid_utf8_char_x(buffer[0]);
 
     if ((1 < size) && (read(&buffer[1], size - 1) != (size - 1)))
@@ -229,6 +325,24 @@ mm_text_io_c::getline(std::optional<std::size_t> max_chars) {
   std::size_t num_chars_read{};
 
   while (true) {
+    // Runs of regular code points are decoded directly from the read
+    // window. Line breaks & everything unusual are handled one code
+    // point at a time below.
+    if (!previous_was_carriage_return && ((m_window_cursor != m_window_end) || refill_window(1))) {
+      auto max_run_chars                  = max_chars ? *max_chars - num_chars_read : std::numeric_limits<std::size_t>::max();
+      auto [num_run_bytes, num_run_chars] = decode_run(p->byte_order_mark, m_window_cursor, m_window_end - m_window_cursor, max_run_chars, s);
+
+      if (num_run_chars) {
+        m_window_cursor += num_run_bytes;
+        num_chars_read  += num_run_chars;
+
+        if (max_chars && (num_chars_read >= *max_chars))
+          return s;
+
+        continue;
+      }
+    }
+
     auto previous_pos = getFilePointer();
     auto utf8char     = read_next_codepoint();
     auto len          = utf8char.length();
@@ -266,7 +380,122 @@ mm_text_io_c::getline(std::optional<std::size_t> max_chars) {
 void
 mm_text_io_c::setFilePointer(int64_t offset,
                              libebml::seek_mode mode) {
-  mm_proxy_io_c::setFilePointer(((0 == offset) && (libebml::seek_beginning == mode)) ? p_func()->bom_len : offset, mode);
+  auto p = p_func();
+
+  if ((0 == offset) && (libebml::seek_beginning == mode))
+    offset = p->bom_len;
+
+  if (m_window_end) {
+    auto window_start = p->window_buffer->get_buffer();
+    auto new_pos      = libebml::seek_current   == mode ? static_cast<int64_t>(getFilePointer()) + offset
+                      : libebml::seek_beginning == mode ? offset
+                      :                                   int64_t{-1};
+
+    if ((new_pos >= p->window_offset) && (new_pos <= (p->window_offset + (m_window_end - window_start)))) {
+      m_window_cursor = window_start + (new_pos - p->window_offset);
+      // Seeking resets the end-of-file state just like seeking in the
+      // proxied I/O does.
+      p->proxy_io->clear_eof();
+      return;
+    }
+
+    drop_window();
+  }
+
+  mm_proxy_io_c::setFilePointer(offset, mode);
+}
+
+uint64_t
+mm_text_io_c::getFilePointer() {
+  auto p = p_func();
+
+  return m_window_end ? p->window_offset + (m_window_cursor - p->window_buffer->get_buffer()) : p->proxy_io->getFilePointer();
+}
+
+bool
+mm_text_io_c::eof() {
+  return (m_window_cursor == m_window_end) && mm_proxy_io_c::eof();
+}
+
+int64_t
+mm_text_io_c::get_size() {
+  return p_func()->proxy_io->get_size();
+}
+
+uint32_t
+mm_text_io_c::_read(void *buffer,
+                    size_t size) {
+  auto num_buffered = std::min<std::size_t>(size, m_window_end - m_window_cursor);
+
+  if (num_buffered) {
+    std::memcpy(buffer, m_window_cursor, num_buffered);
+    m_window_cursor += num_buffered;
+  }
+
+  if (num_buffered == size)
+    return size;
+
+  // The window is exhausted & the proxy's file pointer is located
+  // right after it. Continue reading from the proxy directly.
+  m_window_cursor = nullptr;
+  m_window_end    = nullptr;
+
+  return num_buffered + mm_proxy_io_c::_read(static_cast<unsigned char *>(buffer) + num_buffered, size - num_buffered);
+}
+
+size_t
+mm_text_io_c::_write(const void *buffer,
+                     size_t size) {
+  drop_window();
+
+  return mm_proxy_io_c::_write(buffer, size);
+}
+
+bool
+mm_text_io_c::refill_window(std::size_t min_bytes) {
+  auto p = p_func();
+
+  if (!p->window_buffer)
+    p->window_buffer = memory_c::alloc(std::clamp<int64_t>(p->proxy_io->get_size(), 16, s_max_window_size));
+
+  auto window_start = p->window_buffer->get_buffer();
+  auto window_size  = p->window_buffer->get_size();
+
+  if (min_bytes > window_size)
+    return false;
+
+  std::size_t remaining = m_window_end - m_window_cursor;
+
+  if (m_window_end) {
+    if (remaining && (m_window_cursor != window_start))
+      std::memmove(window_start, m_window_cursor, remaining);
+    p->window_offset += m_window_cursor - window_start;
+
+  } else
+    p->window_offset = p->proxy_io->getFilePointer();
+
+  m_window_cursor = window_start;
+  m_window_end    = window_start + remaining;
+
+  // Never read beyond the end of the file so that the proxy's
+  // end-of-file state is only changed by the caller's own reads.
+  auto to_read = std::min<int64_t>(p->proxy_io->get_size() - p->window_offset - remaining, window_size - remaining);
+  if (0 < to_read)
+    m_window_end += p->proxy_io->read(window_start + remaining, to_read);
+
+  return static_cast<std::size_t>(m_window_end - m_window_cursor) >= min_bytes;
+}
+
+void
+mm_text_io_c::drop_window() {
+  if (!m_window_end)
+    return;
+
+  auto position   = getFilePointer();
+  m_window_cursor = nullptr;
+  m_window_end    = nullptr;
+
+  p_func()->proxy_io->setFilePointer(position);
 }
 
 byte_order_mark_e
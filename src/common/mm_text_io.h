@@ -26,6 +26,9 @@ public:
   mm_text_io_c(mm_io_cptr const &in);
 
   virtual void setFilePointer(int64_t offset, libebml::seek_mode mode=libebml::seek_beginning) override;
+  virtual uint64_t getFilePointer() override;
+  virtual bool eof() override;
+  virtual int64_t get_size() override;
   virtual std::string getline(std::optional<std::size_t> max_chars = std::nullopt) override;
   virtual std::string read_next_codepoint();
   virtual byte_order_mark_e get_byte_order_mark() const;
@@ -35,6 +38,11 @@ public:
 
 protected:
   virtual void detect_eol_style();
+  virtual uint32_t _read(void *buffer, size_t size) override;
+  virtual size_t _write(const void *buffer, size_t size) override;
+  virtual bool refill_window(std::size_t min_bytes) override;
+
+  void drop_window();
 
 public:
   static bool has_byte_order_marker(const std::string &string);
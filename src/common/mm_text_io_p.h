@@ -23,5 +23,11 @@ public:
   unsigned int bom_len{};
   bool uses_carriage_returns{}, uses_newlines{}, eol_style_detected{};
 
+  // Raw, undecoded bytes read ahead from the proxied I/O. The proxy's
+  // file pointer is always located at window_offset + the number of
+  // bytes in the window.
+  memory_cptr window_buffer;
+  int64_t window_offset{};
+
   explicit mm_text_io_private_c(mm_io_cptr const &in);
 };
@@ -19,6 +19,31 @@
 
 namespace mtx::mpeg {
 
+std::size_t
+find_start_code(unsigned char const *buffer,
+                std::size_t size) {
+  if (size < 3)
+    return size;
+
+  auto end = buffer + size;
+  auto pos = buffer + 2;
+
+  while (pos < end) {
+    pos = static_cast<unsigned char const *>(std::memchr(pos, 0x01, end - pos));
+    if (!pos)
+      break;
+
+    if (!pos[-1] && !pos[-2])
+      return pos - 2 - buffer;
+
+    // The two bytes preceding the next candidate must both be 0, so it
+    // cannot be closer than three bytes.
+    pos += 3;
+  }
+
+  return size;
+}
+
 memory_cptr
 nalu_to_rbsp(memory_cptr const &buffer) {
   mm_mem_io_cptr d;
@@ -22,6 +22,12 @@ constexpr auto is_start_code(uint32_t v) {
   return ((v >> 8) & 0xffffff) == START_CODE_PREFIX;
 }
 
+// Returns the offset of the first start code prefix (00 00 01) in the
+// buffer or 'size' if there's none. memchr() is used for skipping to
+// candidate positions as the C libraries implement it with vector
+// instructions.
+std::size_t find_start_code(unsigned char const *buffer, std::size_t size);
+
 memory_cptr nalu_to_rbsp(memory_cptr const &buffer);
 memory_cptr rbsp_to_nalu(memory_cptr const &buffer);
 
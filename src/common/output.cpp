@@ -94,17 +94,19 @@ stdio_redirected() {
   return s_mm_stdio_redirected;
 }
 
-void
+mxmsg_handler_t
 set_mxmsg_handler(unsigned int level,
                   mxmsg_handler_t const &handler) {
-  if (MXMSG_INFO == level)
-    s_mxmsg_info_handler = handler;
-  else if (MXMSG_WARNING == level)
-    s_mxmsg_warning_handler = handler;
-  else if (MXMSG_ERROR == level)
-    s_mxmsg_error_handler = handler;
-  else
-    assert(false);
+  auto &current = MXMSG_INFO    == level ? s_mxmsg_info_handler
+                : MXMSG_WARNING == level ? s_mxmsg_warning_handler
+                :                          s_mxmsg_error_handler;
+
+  assert((MXMSG_INFO == level) || (MXMSG_WARNING == level) || (MXMSG_ERROR == level));
+
+  auto previous = current;
+  current       = handler;
+
+  return previous;
 }
 
 void
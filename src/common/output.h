@@ -28,7 +28,8 @@ constexpr auto MXMSG_WARNING = 10;
 constexpr auto MXMSG_INFO    = 15;
 
 using mxmsg_handler_t = std::function<void(unsigned int level, std::string const &)>;
-void set_mxmsg_handler(unsigned int level, mxmsg_handler_t const &handler);
+// Returns the handler previously installed for that level.
+mxmsg_handler_t set_mxmsg_handler(unsigned int level, mxmsg_handler_t const &handler);
 
 extern bool g_suppress_info, g_suppress_warnings;
 extern std::string g_stdio_charset;
@@ -0,0 +1,107 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   an allocator recycling fixed-size blocks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <mutex>
+
+namespace mtx::mem {
+
+// Keeps a bounded, thread-safe list of freed blocks of a single size
+// & alignment for reuse.
+template<std::size_t BlockSize, std::size_t Alignment>
+class block_free_list_c {
+private:
+  static constexpr std::size_t s_max_free_blocks = 4096;
+
+  std::mutex m_mutex;
+  std::vector<void *> m_free;
+
+public:
+  void *acquire() {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+
+      if (!m_free.empty()) {
+        auto block = m_free.back();
+        m_free.pop_back();
+        return block;
+      }
+    }
+
+    return ::operator new(BlockSize, std::align_val_t{Alignment});
+  }
+
+  void release(void *block) {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+
+      if (m_free.size() < s_max_free_blocks) {
+        m_free.push_back(block);
+        return;
+      }
+    }
+
+    ::operator delete(block, std::align_val_t{Alignment});
+  }
+
+  static block_free_list_c &get() {
+    // Intentionally never destroyed as objects held by static or
+    // global variables may still be released during global
+    // destruction.
+    static auto s_free_list = new block_free_list_c;
+    return *s_free_list;
+  }
+};
+
+// Allocator for use with std::allocate_shared() & containers. Single
+// object allocations are recycled via a free list per block size;
+// everything else is passed through to the global operator new.
+template<typename T>
+class recycling_allocator_t {
+public:
+  using value_type = T;
+
+  recycling_allocator_t() noexcept = default;
+
+  template<typename U>
+  recycling_allocator_t(recycling_allocator_t<U> const &) noexcept {
+  }
+
+  T *allocate(std::size_t n) {
+    if (n == 1)
+      return static_cast<T *>(block_free_list_c<sizeof(T), alignof(T)>::get().acquire());
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (n == 1)
+      block_free_list_c<sizeof(T), alignof(T)>::get().release(p);
+    else
+      ::operator delete(p, std::align_val_t{alignof(T)});
+  }
+
+  template<typename U>
+  bool operator ==(recycling_allocator_t<U> const &) const noexcept {
+    return true;
+  }
+
+  template<typename U>
+  bool operator !=(recycling_allocator_t<U> const &) const noexcept {
+    return false;
+  }
+};
+
+}
@@ -0,0 +1,179 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for a growable ring buffer
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <iterator>
+
+namespace mtx {
+
+// A FIFO queue with random access backed by a single contiguous
+// allocation whose size is a power of two. Contrary to std::deque
+// it never frees storage while elements are pushed & popped at the
+// ends, meaning that a queue in steady state doesn't allocate at
+// all.
+template<typename T>
+class ring_buffer_c {
+public:
+  using value_type      = T;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T &;
+  using const_reference = T const &;
+
+  template<typename Container, typename Value>
+  class iterator_t {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = Value *;
+    using reference         = Value &;
+
+  private:
+    Container *m_container{};
+    difference_type m_index{};
+
+  public:
+    iterator_t() = default;
+    iterator_t(Container *container, difference_type index)
+      : m_container{container}
+      , m_index{index}
+    {
+    }
+
+    reference operator *() const { return (*m_container)[m_index]; }
+    pointer operator ->() const { return &(*m_container)[m_index]; }
+    reference operator [](difference_type offset) const { return (*m_container)[m_index + offset]; }
+
+    iterator_t &operator ++() { ++m_index; return *this; }
+    iterator_t &operator --() { --m_index; return *this; }
+    iterator_t operator ++(int) { auto copy = *this; ++m_index; return copy; }
+    iterator_t operator --(int) { auto copy = *this; --m_index; return copy; }
+    iterator_t &operator +=(difference_type offset) { m_index += offset; return *this; }
+    iterator_t &operator -=(difference_type offset) { m_index -= offset; return *this; }
+    iterator_t operator +(difference_type offset) const { return { m_container, m_index + offset }; }
+    iterator_t operator -(difference_type offset) const { return { m_container, m_index - offset }; }
+    difference_type operator -(iterator_t const &other) const { return m_index - other.m_index; }
+
+    bool operator ==(iterator_t const &other) const { return m_index == other.m_index; }
+    bool operator !=(iterator_t const &other) const { return m_index != other.m_index; }
+    bool operator <(iterator_t const &other) const  { return m_index <  other.m_index; }
+    bool operator >(iterator_t const &other) const  { return m_index >  other.m_index; }
+    bool operator <=(iterator_t const &other) const { return m_index <= other.m_index; }
+    bool operator >=(iterator_t const &other) const { return m_index >= other.m_index; }
+  };
+
+  using iterator       = iterator_t<ring_buffer_c, T>;
+  using const_iterator = iterator_t<ring_buffer_c const, T const>;
+
+private:
+  std::vector<T> m_storage;
+  size_type m_head{}, m_size{}, m_mask{};
+
+public:
+  ring_buffer_c() = default;
+
+  bool empty() const {
+    return !m_size;
+  }
+
+  size_type size() const {
+    return m_size;
+  }
+
+  size_type capacity() const {
+    return m_storage.size();
+  }
+
+  reference operator [](size_type idx) {
+    return m_storage[(m_head + idx) & m_mask];
+  }
+
+  const_reference operator [](size_type idx) const {
+    return m_storage[(m_head + idx) & m_mask];
+  }
+
+  reference front() {
+    assert(m_size);
+    return m_storage[m_head];
+  }
+
+  const_reference front() const {
+    assert(m_size);
+    return m_storage[m_head];
+  }
+
+  reference back() {
+    assert(m_size);
+    return (*this)[m_size - 1];
+  }
+
+  const_reference back() const {
+    assert(m_size);
+    return (*this)[m_size - 1];
+  }
+
+  iterator begin() { return { this, 0 }; }
+  iterator end() { return { this, static_cast<difference_type>(m_size) }; }
+  const_iterator begin() const { return { this, 0 }; }
+  const_iterator end() const { return { this, static_cast<difference_type>(m_size) }; }
+
+  void push_back(T const &value) {
+    if (m_size == m_storage.size())
+      grow();
+
+    (*this)[m_size] = value;
+    ++m_size;
+  }
+
+  void push_back(T &&value) {
+    if (m_size == m_storage.size())
+      grow();
+
+    (*this)[m_size] = std::move(value);
+    ++m_size;
+  }
+
+  void pop_front() {
+    assert(m_size);
+
+    // Reset the slot so that e.g. shared pointers release their
+    // objects right away and not only when the slot is reused.
+    m_storage[m_head] = T{};
+    m_head            = (m_head + 1) & m_mask;
+    --m_size;
+  }
+
+  void clear() {
+    while (m_size)
+      pop_front();
+    m_head = 0;
+  }
+
+private:
+  void grow() {
+    std::vector<T> new_storage(std::max<size_type>(m_storage.size() * 2, 16));
+
+    for (auto idx = 0u; idx < m_size; ++idx)
+      new_storage[idx] = std::move((*this)[idx]);
+
+    m_storage.swap(new_storage);
+    m_head = 0;
+    m_mask = m_storage.size() - 1;
+  }
+};
+
+}
@@ -341,6 +341,39 @@ parse_duration_number_with_unit(const std::string &s,
   return true;
 }
 
+/** \brief Parse a number of bytes optionally postfixed with a size unit
+
+   This function parses a non-negative number that is optionally
+   postfixed with one of the units 'k', 'm' or 'g' (case insensitive)
+   denoting kilobytes, megabytes or gigabytes. It fails for results
+   that don't fit into \c value.
+*/
+bool
+parse_size_number_with_unit(std::string s,
+                            int64_t &value) {
+  if (s.empty())
+    return false;
+
+  auto unit          = std::tolower(static_cast<unsigned char>(s.back()));
+  int64_t multiplier = 'k' == unit ? 1024ll
+                     : 'm' == unit ? 1024ll * 1024
+                     : 'g' == unit ? 1024ll * 1024 * 1024
+                     :               1;
+
+  if (1 != multiplier)
+    s.erase(s.size() - 1);
+
+  int64_t number{};
+  if (   !parse_number(s, number)
+      || (0 > number)
+      || (number > (std::numeric_limits<int64_t>::max() / multiplier)))
+    return false;
+
+  value = number * multiplier;
+
+  return true;
+}
+
 uint64_t
 from_hex(const std::string &data) {
   const char *s = data.c_str();
@@ -0,0 +1,124 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   scanner for simple line-based text formats
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <string_view>
+
+namespace mtx::string {
+
+// Character classes as used by regular expressions without Unicode
+// properties: only ASCII characters are considered to be white space
+// or digits.
+constexpr auto is_ascii_space(char c) { return (c == ' ') || ((c >= '\t') && (c <= '\r')); }
+constexpr auto is_ascii_digit(char c) { return (c >= '0') && (c <= '9'); }
+constexpr auto to_ascii_lower(char c) { return (c >= 'A') && (c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+// A cursor over a line of UTF-8 encoded text used by the hand-written
+// parsers for timestamp lines, section headers and the like. Nothing
+// is copied; all returned views point into the scanned text.
+class scanner_c {
+protected:
+  std::string_view m_text;
+  std::size_t m_position{};
+
+public:
+  explicit scanner_c(std::string_view text)
+    : m_text{text}
+  {
+  }
+
+  bool at_end() const {
+    return m_position >= m_text.size();
+  }
+
+  std::size_t get_position() const {
+    return m_position;
+  }
+
+  void set_position(std::size_t position) {
+    m_position = std::min(position, m_text.size());
+  }
+
+  char peek() const {
+    return at_end() ? '\0' : m_text[m_position];
+  }
+
+  std::string_view rest() const {
+    return m_text.substr(m_position);
+  }
+
+  template<typename Tpredicate>
+  std::string_view
+  skip_while(Tpredicate predicate) {
+    auto start = m_position;
+
+    while (!at_end() && predicate(m_text[m_position]))
+      ++m_position;
+
+    return m_text.substr(start, m_position - start);
+  }
+
+  std::size_t skip_spaces() {
+    return skip_while(is_ascii_space).size();
+  }
+
+  std::size_t skip_blanks_and_tabs() {
+    return skip_while([](char c) { return (c == ' ') || (c == '\t'); }).size();
+  }
+
+  std::string_view digits() {
+    return skip_while(is_ascii_digit);
+  }
+
+  bool skip(char c) {
+    if (peek() != c)
+      return false;
+
+    ++m_position;
+    return true;
+  }
+
+  bool skip_any_of(std::string_view chars) {
+    if (at_end() || (chars.find(m_text[m_position]) == std::string_view::npos))
+      return false;
+
+    ++m_position;
+    return true;
+  }
+
+  bool skip_string(std::string_view s) {
+    if (rest().substr(0, s.size()) != s)
+      return false;
+
+    m_position += s.size();
+    return true;
+  }
+
+  // Case-insensitive for ASCII letters.
+  bool skip_istring(std::string_view s) {
+    if (m_text.size() - m_position < s.size())
+      return false;
+
+    for (auto idx = 0u; idx < s.size(); ++idx)
+      if (to_ascii_lower(m_text[m_position + idx]) != to_ascii_lower(s[idx]))
+        return false;
+
+    m_position += s.size();
+    return true;
+  }
+};
+
+} // namespace mtx::string
@@ -0,0 +1,178 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   a work-stealing thread pool
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "common/thread_pool.h"
+
+namespace mtx {
+
+namespace {
+
+struct worker_queue_t {
+  std::mutex m_mutex;
+  std::deque<thread_pool_c::task_t> m_tasks;
+};
+
+}
+
+class thread_pool_private_c {
+public:
+  std::vector<std::unique_ptr<worker_queue_t>> m_queues;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available, m_idle;
+  std::size_t m_num_queued{}, m_num_running{};
+  std::atomic<unsigned int> m_next_queue{};
+  bool m_stopping{};
+};
+
+thread_pool_c::thread_pool_c(unsigned int num_threads)
+  : p_ptr{new thread_pool_private_c}
+{
+  auto p = p_func();
+
+  if (!num_threads)
+    num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  for (auto idx = 0u; idx < num_threads; ++idx)
+    p->m_queues.emplace_back(std::make_unique<worker_queue_t>());
+
+  for (auto idx = 0u; idx < num_threads; ++idx)
+    p->m_threads.emplace_back([this, idx]() { run_worker(idx); });
+}
+
+thread_pool_c::~thread_pool_c() {
+  auto p = p_func();
+
+  {
+    std::lock_guard<std::mutex> lock{p->m_mutex};
+    p->m_stopping = true;
+  }
+
+  p->m_work_available.notify_all();
+
+  for (auto &thread : p->m_threads)
+    thread.join();
+}
+
+unsigned int
+thread_pool_c::get_num_threads()
+  const {
+  return p_func()->m_threads.size();
+}
+
+void
+thread_pool_c::enqueue(task_t task) {
+  auto p   = p_func();
+  auto idx = p->m_next_queue++ % p->m_queues.size();
+
+  {
+    std::lock_guard<std::mutex> lock{p->m_queues[idx]->m_mutex};
+    p->m_queues[idx]->m_tasks.emplace_back(std::move(task));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{p->m_mutex};
+    ++p->m_num_queued;
+  }
+
+  p->m_work_available.notify_one();
+}
+
+bool
+thread_pool_c::try_pop(unsigned int idx,
+                       task_t &task) {
+  auto p          = p_func();
+  auto num_queues = p->m_queues.size();
+
+  // Take tasks from the front of the own queue in order to process
+  // them in roughly the order they were submitted in. Steal from the
+  // back of the other workers' queues.
+  for (auto offset = 0u; offset < num_queues; ++offset) {
+    auto &queue = *p->m_queues[(idx + offset) % num_queues];
+    std::lock_guard<std::mutex> lock{queue.m_mutex};
+
+    if (queue.m_tasks.empty())
+      continue;
+
+    if (!offset) {
+      task = std::move(queue.m_tasks.front());
+      queue.m_tasks.pop_front();
+
+    } else {
+      task = std::move(queue.m_tasks.back());
+      queue.m_tasks.pop_back();
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void
+thread_pool_c::run_worker(unsigned int idx) {
+  auto p = p_func();
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock{p->m_mutex};
+      p->m_work_available.wait(lock, [p]() { return p->m_stopping || p->m_num_queued; });
+
+      if (!p->m_num_queued)
+        return;
+
+      --p->m_num_queued;
+      ++p->m_num_running;
+    }
+
+    // m_num_queued was decremented on behalf of exactly one queued
+    // task, therefore a task is guaranteed to be found.
+    task_t task;
+    while (!try_pop(idx, task))
+      std::this_thread::yield();
+
+    task();
+
+    {
+      std::lock_guard<std::mutex> lock{p->m_mutex};
+      --p->m_num_running;
+
+      if (!p->m_num_queued && !p->m_num_running)
+        p->m_idle.notify_all();
+    }
+  }
+}
+
+void
+thread_pool_c::wait_for_idle() {
+  auto p = p_func();
+
+  std::unique_lock<std::mutex> lock{p->m_mutex};
+  p->m_idle.wait(lock, [p]() { return !p->m_num_queued && !p->m_num_running; });
+}
+
+thread_pool_c &
+thread_pool_c::global() {
+  static auto s_pool = new thread_pool_c;
+  return *s_pool;
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for a work-stealing thread pool
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <future>
+
+namespace mtx {
+
+class thread_pool_private_c;
+class thread_pool_c {
+protected:
+  MTX_DECLARE_PRIVATE(thread_pool_private_c)
+
+  std::unique_ptr<thread_pool_private_c> const p_ptr;
+
+public:
+  using task_t = std::function<void()>;
+
+public:
+  // num_threads == 0 means one thread per hardware thread.
+  explicit thread_pool_c(unsigned int num_threads = 0);
+  ~thread_pool_c();
+
+  thread_pool_c(thread_pool_c const &) = delete;
+  thread_pool_c &operator =(thread_pool_c const &) = delete;
+
+  unsigned int get_num_threads() const;
+
+  // Runs function on one of the pool's threads. Exceptions thrown by
+  // it are re-thrown by the returned future's get().
+  template<typename Function>
+  auto
+  submit(Function &&function)
+    -> std::future<std::invoke_result_t<Function>> {
+    using result_t = std::invoke_result_t<Function>;
+
+    auto task   = std::make_shared<std::packaged_task<result_t()>>(std::forward<Function>(function));
+    auto result = task->get_future();
+
+    enqueue([task]() { (*task)(); });
+
+    return result;
+  }
+
+  // Blocks until all tasks submitted so far have been run.
+  void wait_for_idle();
+
+  // A pool shared by all users within the process. It is created on
+  // first use & never destroyed.
+  static thread_pool_c &global();
+
+protected:
+  void enqueue(task_t task);
+  void run_worker(unsigned int idx);
+  bool try_pop(unsigned int idx, task_t &task);
+};
+
+}
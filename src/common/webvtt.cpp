@@ -17,11 +17,100 @@
 #include "common/strings/editing.h"
 #include "common/strings/formatting.h"
 #include "common/strings/parsing.h"
+#include "common/strings/scanner.h"
 #include "common/webvtt.h"
 
 namespace mtx::webvtt {
 
-constexpr auto RE_TIMESTAMP = "((?:\\d+:)?\\d{2}:\\d{2}\\.\\d{3})";
+namespace {
+
+struct timestamp_line_t {
+  timestamp_c start, end;
+  std::string_view start_text, end_text, settings_list;
+};
+
+// Timestamps look like "hh:mm:ss.ttt" with any number of digits for
+// the hours, or "mm:ss.ttt". Timestamps with more than 59 minutes or
+// seconds are recognized but not set.
+bool
+scan_timestamp(mtx::string::scanner_c &scanner,
+               std::string_view line,
+               std::string_view &text,
+               timestamp_c &timestamp) {
+  auto start = scanner.get_position();
+  auto first = scanner.digits();
+
+  if (first.empty() || !scanner.skip(':'))
+    return false;
+
+  auto second = scanner.digits();
+  std::string_view hours, minutes, seconds;
+
+  if (scanner.skip(':')) {
+    hours   = first;
+    minutes = second;
+    seconds = scanner.digits();
+
+  } else {
+    minutes = first;
+    seconds = second;
+  }
+
+  if ((minutes.size() != 2) || (seconds.size() != 2) || !scanner.skip('.') || (scanner.digits().size() != 3))
+    return false;
+
+  text = line.substr(start, scanner.get_position() - start);
+
+  auto to_number = [](std::string_view digits) {
+    return std::accumulate(digits.begin(), digits.end(), int64_t{}, [](int64_t value, char c) { return value * 10 + c - '0'; });
+  };
+
+  auto m = to_number(minutes), s = to_number(seconds);
+
+  if ((m <= 59) && (s <= 59))
+    timestamp = timestamp_c::ms(((to_number(hours) * 60 + m) * 60 + s) * 1'000 + to_number(text.substr(text.size() - 3)));
+
+  return true;
+}
+
+// "start --> end" optionally followed by a list of settings, all of
+// them separated by spaces or tabs.
+std::optional<timestamp_line_t>
+parse_timestamp_line(std::string_view line) {
+  mtx::string::scanner_c scanner{line};
+  timestamp_line_t result;
+
+  scanner.skip_blanks_and_tabs();
+
+  if (   !scan_timestamp(scanner, line, result.start_text, result.start)
+      || !scanner.skip_blanks_and_tabs()
+      || !scanner.skip_string("-->")
+      || !scanner.skip_blanks_and_tabs()
+      || !scan_timestamp(scanner, line, result.end_text, result.end))
+    return {};
+
+  if (scanner.at_end())
+    return result;
+
+  auto num_blanks = scanner.skip_blanks_and_tabs();
+  if (!num_blanks)
+    return {};
+
+  // Trailing white space is kept as a settings list consisting of the
+  // last white space character if there's more than one of them.
+  if (!scanner.at_end())
+    result.settings_list = scanner.rest();
+
+  else if (num_blanks > 1)
+    result.settings_list = line.substr(line.size() - 1);
+
+  if (result.settings_list.empty() || (result.settings_list.find('\n') != std::string_view::npos))
+    return {};
+
+  return result;
+}
+
+} // anonymous namespace
 
 struct parser_c::impl_t {
 public:
@@ -30,8 +119,6 @@ public:
   std::deque<parser_c::cue_cptr> cues;
   unsigned int current_cue_number{}, total_number_of_cues{}, total_number_of_bytes{};
   debugging_option_c debug{"parser"};
-
-  QRegularExpression timestamp_line_re{Q(fmt::format("^[ \\t]*{0}[ \\t]+-->[ \\t]+{0}(?:[ \\t]+([^\\n]+))?$", RE_TIMESTAMP))};
 };
 
 parser_c::parser_c()
@@ -83,15 +170,15 @@ parser_c::add_block() {
   std::string label, additional;
   auto timestamp_line = -1;
   auto is_other       = false;
-  QRegularExpressionMatch matches;
+  std::optional<timestamp_line_t> timestamps;
 
-  if (matches = m->timestamp_line_re.match(Q(m->current_block[0])); matches.hasMatch())
+  if (timestamps = parse_timestamp_line(m->current_block[0]); timestamps)
     timestamp_line = 0;
 
   else if (m->current_block.size() <= 1)
     is_other = true;
 
-  else if (matches = m->timestamp_line_re.match(Q(m->current_block[1])); matches.hasMatch()) {
+  else if (timestamps = parse_timestamp_line(m->current_block[1]); timestamps) {
     timestamp_line = 1;
     label          = std::move(m->current_block[0]);
 
@@ -109,17 +196,15 @@ parser_c::add_block() {
 
   m->parsing_global_data = false;
 
-  timestamp_c start, end;
-  mtx::string::parse_timestamp(to_utf8(matches.captured(1)), start);
-  mtx::string::parse_timestamp(to_utf8(matches.captured(2)), end);
-
+  auto const &start  = timestamps->start;
+  auto const &end    = timestamps->end;
   auto content       = mtx::string::join(m->current_block.begin() + timestamp_line + 1, m->current_block.end(), "\n");
   content            = adjust_embedded_timestamps(content, start.negate());
   auto cue           = std::make_shared<cue_t>();
   cue->m_start       = start;
   cue->m_duration    = end - start;
   cue->m_content     = memory_c::clone(content);
-  auto settings_list = to_utf8(matches.captured(3));
+  auto settings_list = std::string{timestamps->settings_list};
 
   if (! (label.empty() && settings_list.empty() && m->local_blocks.empty())) {
     additional = settings_list + "\n" + label + "\n" + mtx::string::join(m->local_blocks, "\n");
@@ -128,7 +213,7 @@ parser_c::add_block() {
 
   mxdebug_if(m->debug,
              fmt::format("label «{0}» start «{1}» end «{2}» settings list «{3}» additional «{4}» content «{5}»\n",
-                         label, to_utf8(matches.captured(1)), to_utf8(matches.captured(2)), to_utf8(matches.captured(3)),
+                         label, timestamps->start_text, timestamps->end_text, timestamps->settings_list,
                          to_utf8(Q(additional).replace(QRegularExpression{"\n+"}, "–")),
                          to_utf8(Q(content)   .replace(QRegularExpression{"\n+"}, "–"))));
 
@@ -186,16 +271,31 @@ parser_c::get_total_number_of_bytes()
 std::string
 parser_c::adjust_embedded_timestamps(std::string const &text,
                                             timestamp_c const &offset) {
-  static std::optional<QRegularExpression> s_embedded_timestamp_re;
+  std::string result;
+  std::size_t copied_up_to = 0;
 
-  if (!s_embedded_timestamp_re)
-    s_embedded_timestamp_re = QRegularExpression{Q(fmt::format("<{0}>", RE_TIMESTAMP))};
-
-  return mtx::string::replace(text, *s_embedded_timestamp_re, [&offset](auto const &match) {
+  for (auto idx = text.find('<'); idx != std::string::npos; idx = text.find('<', idx + 1)) {
+    mtx::string::scanner_c scanner{text};
+    std::string_view timestamp_text;
     timestamp_c timestamp;
-    mtx::string::parse_timestamp(to_utf8(match.captured(1)), timestamp);
-    return Q(fmt::format("<{0}>", mtx::string::format_timestamp(timestamp + offset, 3)));
-  });
+
+    scanner.set_position(idx + 1);
+
+    if (!scan_timestamp(scanner, text, timestamp_text, timestamp) || !scanner.skip('>'))
+      continue;
+
+    result.append(text, copied_up_to, idx - copied_up_to);
+    result       += fmt::format("<{0}>", mtx::string::format_timestamp(timestamp + offset, 3));
+    copied_up_to  = scanner.get_position();
+    idx           = copied_up_to - 1;
+  }
+
+  if (!copied_up_to)
+    return text;
+
+  result.append(text, copied_up_to);
+
+  return result;
 }
 
 } // namespace mtx::webvtt
@@ -200,106 +200,85 @@ create_timestamp_files(KaxTracks &kax_tracks,
 }
 
 static void
-handle_blockgroup_timestamps(KaxBlockGroup &blockgroup,
-                             int64_t tc_scale) {
-  auto block = FindChild<KaxBlock>(blockgroup);
-  if (!block)
-    return;
-
+handle_blockgroup_timestamps(kax_flat_cluster_c::block_t const &block) {
   // Do we need this block group?
-  auto extractor = timestamp_extractors.find(block->TrackNum());
+  auto extractor = timestamp_extractors.find(block.m_track_number);
   if (timestamp_extractors.end() == extractor)
     return;
 
   // Next find the block duration if there is one.
-  auto kduration   = FindChild<KaxBlockDuration>(blockgroup);
-  int64_t duration = !kduration ? extractor->second->m_default_duration * block->NumberFrames() : kduration->GetValue() * tc_scale;
+  int64_t duration = !block.m_duration ? extractor->second->m_default_duration * block.m_num_frames : static_cast<int64_t>(*block.m_duration);
 
   // Pass the block to the extractor.
-  for (auto idx = 0u, end = block->NumberFrames(); idx < end; ++idx)
-    extractor->second->m_timestamps.push_back(timestamp_t(block->GlobalTimecode() + idx * duration / block->NumberFrames(), duration / block->NumberFrames()));
+  for (auto idx = 0u, end = static_cast<unsigned int>(block.m_num_frames); idx < end; ++idx)
+    extractor->second->m_timestamps.push_back(timestamp_t(block.m_timestamp + idx * duration / static_cast<int64_t>(block.m_num_frames), duration / static_cast<int64_t>(block.m_num_frames)));
 }
 
 static void
-handle_simpleblock_timestamps(KaxSimpleBlock &simpleblock) {
-  auto itr = timestamp_extractors.find(simpleblock.TrackNum());
+handle_simpleblock_timestamps(kax_flat_cluster_c::block_t const &block) {
+  auto itr = timestamp_extractors.find(block.m_track_number);
   if (timestamp_extractors.end() == itr)
     return;
 
   // Pass the block to the extractor.
   auto &extractor = *itr->second;
-  for (auto idx = 0u, end = simpleblock.NumberFrames(); idx < end; ++idx)
-    extractor.m_timestamps.emplace_back(simpleblock.GlobalTimecode() + idx * extractor.m_default_duration, extractor.m_default_duration);
+  for (auto idx = 0u, end = static_cast<unsigned int>(block.m_num_frames); idx < end; ++idx)
+    extractor.m_timestamps.emplace_back(block.m_timestamp + idx * extractor.m_default_duration, extractor.m_default_duration);
 }
 
 static int64_t
-handle_blockgroup(KaxBlockGroup &blockgroup,
-                  KaxCluster &cluster,
-                  int64_t tc_scale) {
+handle_blockgroup(kax_flat_cluster_c const &cluster,
+                  kax_flat_cluster_c::block_t const &block) {
   // Only continue if this block group actually contains a block.
-  KaxBlock *block = FindChild<KaxBlock>(&blockgroup);
-  if (!block || (0 == block->NumberFrames()))
+  if (0 == block.m_num_frames)
     return -1;
 
-  block->SetParent(cluster);
-
-  handle_blockgroup_timestamps(blockgroup, tc_scale);
+  handle_blockgroup_timestamps(block);
 
   // Do we need this block group?
-  auto extractor_itr = track_extractors_by_track_number.find(block->TrackNum());
+  auto extractor_itr = track_extractors_by_track_number.find(block.m_track_number);
   if (extractor_itr == track_extractors_by_track_number.end())
     return -1;
 
   // Next find the block duration if there is one.
-  auto &extractor               = *extractor_itr->second;
-  KaxBlockDuration *kduration   = FindChild<KaxBlockDuration>(&blockgroup);
-  int64_t duration              = !kduration ? -1 : static_cast<int64_t>(kduration->GetValue() * tc_scale);
-  int64_t max_timestamp         = 0;
+  auto &extractor       = *extractor_itr->second;
+  int64_t num_frames    = block.m_num_frames;
+  int64_t duration      = !block.m_duration ? -1 : static_cast<int64_t>(*block.m_duration);
+  int64_t max_timestamp = 0;
 
   // Now find backward and forward references.
-  int64_t bref    = 0;
-  int64_t fref    = 0;
-  auto kreference = FindChild<KaxReferenceBlock>(&blockgroup);
-  for (int i = 0; (2 > i) && kreference; i++) {
-    if (0 > kreference->GetValue())
-      bref = kreference->GetValue();
+  int64_t bref = 0;
+  int64_t fref = 0;
+  for (auto i = 0u; (2 > i) && (i < block.m_references.size()); i++) {
+    if (0 > block.m_references[i])
+      bref = block.m_references[i];
     else
-      fref = kreference->GetValue();
-    kreference = FindNextChild(blockgroup, *kreference);
+      fref = block.m_references[i];
   }
 
-  // Any block additions present?
-  KaxBlockAdditions *kadditions = FindChild<KaxBlockAdditions>(&blockgroup);
-
   if (0 > duration)
-    duration = extractor.m_default_duration * block->NumberFrames();
+    duration = extractor.m_default_duration * num_frames;
 
-  KaxCodecState *kcstate = FindChild<KaxCodecState>(&blockgroup);
-  if (kcstate) {
-    auto ctstate = memory_c::borrow(kcstate->GetBuffer(), kcstate->GetSize());
+  if (block.m_codec_state.m_data) {
+    auto ctstate = memory_c::borrow(const_cast<unsigned char *>(block.m_codec_state.m_data), block.m_codec_state.m_size);
     extractor.handle_codec_state(ctstate);
   }
 
-  for (int i = 0, num_frames = block->NumberFrames(); i < num_frames; i++) {
+  auto discard_padding = timestamp_c::ns(block.m_discard_padding ? *block.m_discard_padding : 0);
+
+  for (int64_t i = 0; i < num_frames; i++) {
     int64_t this_timestamp, this_duration;
 
     if (0 > duration) {
-      this_timestamp = block->GlobalTimecode();
-      this_duration = duration;
+      this_timestamp = block.m_timestamp;
+      this_duration  = duration;
     } else {
-      this_timestamp = block->GlobalTimecode() + i * duration /
-        block->NumberFrames();
-      this_duration = duration / block->NumberFrames();
+      this_timestamp = block.m_timestamp + i * duration / num_frames;
+      this_duration  = duration / num_frames;
     }
 
-    auto discard_padding  = timestamp_c::ns(0);
-    auto kdiscard_padding = FindChild<KaxDiscardPadding>(blockgroup);
-    if (kdiscard_padding)
-      discard_padding = timestamp_c::ns(kdiscard_padding->GetValue());
-
-    auto &data = block->GetBuffer(i);
-    auto frame = memory_c::borrow(data.Buffer(), data.Size());
-    auto f     = xtr_frame_t{frame, kadditions, this_timestamp, this_duration, bref, fref, (!bref && !fref), false, discard_padding};
+    auto frame = cluster.borrow_frame(block, i);
+    auto f     = xtr_frame_t{frame, cluster.get_additions(block), block.m_num_additions, this_timestamp, this_duration, bref, fref, (!bref && !fref), false, discard_padding};
     extractor.decode_and_handle_frame(f);
 
     max_timestamp = std::max(max_timestamp, this_timestamp);
@@ -309,38 +288,36 @@ handle_blockgroup(KaxBlockGroup &blockgroup,
 }
 
 static int64_t
-handle_simpleblock(KaxSimpleBlock &simpleblock,
-                   KaxCluster &cluster) {
-  if (0 == simpleblock.NumberFrames())
+handle_simpleblock(kax_flat_cluster_c const &cluster,
+                   kax_flat_cluster_c::block_t const &block) {
+  if (0 == block.m_num_frames)
     return -1;
 
-  simpleblock.SetParent(cluster);
-
-  handle_simpleblock_timestamps(simpleblock);
+  handle_simpleblock_timestamps(block);
 
   // Do we need this block group?
-  auto extractor_itr = track_extractors_by_track_number.find(simpleblock.TrackNum());
+  auto extractor_itr = track_extractors_by_track_number.find(block.m_track_number);
   if (extractor_itr == track_extractors_by_track_number.end())
     return - 1;
 
   auto &extractor       = *extractor_itr->second;
-  int64_t duration      = extractor.m_default_duration * simpleblock.NumberFrames();
+  int64_t num_frames    = block.m_num_frames;
+  int64_t duration      = extractor.m_default_duration * num_frames;
   int64_t max_timestamp = 0;
 
-  for (int i = 0, num_frames = simpleblock.NumberFrames(); i < num_frames; i++) {
+  for (int64_t i = 0; i < num_frames; i++) {
     int64_t this_timestamp, this_duration;
 
     if (0 > duration) {
-      this_timestamp = simpleblock.GlobalTimecode();
-      this_duration = duration;
+      this_timestamp = block.m_timestamp;
+      this_duration  = duration;
     } else {
-      this_timestamp = simpleblock.GlobalTimecode() + i * duration / simpleblock.NumberFrames();
-      this_duration = duration / simpleblock.NumberFrames();
+      this_timestamp = block.m_timestamp + i * duration / num_frames;
+      this_duration  = duration / num_frames;
     }
 
-    auto &data = simpleblock.GetBuffer(i);
-    auto frame = memory_c::borrow(data.Buffer(), data.Size());
-    auto f     = xtr_frame_t{frame, nullptr, this_timestamp, this_duration, 0, 0, simpleblock.IsKeyframe(), simpleblock.IsDiscardable(), timestamp_c::ns(0)};
+    auto frame = cluster.borrow_frame(block, i);
+    auto f     = xtr_frame_t{frame, nullptr, 0, this_timestamp, this_duration, 0, 0, block.m_key, block.m_discardable, timestamp_c::ns(0)};
     extractor.decode_and_handle_frame(f);
 
     max_timestamp = std::max(max_timestamp, this_timestamp);
@@ -494,14 +471,13 @@ extract_tracks(kax_analyzer_c &analyzer,
     file->set_timestamp_scale(tc_scale);
     file->set_segment_end(*l0);
 
+    kax_flat_cluster_c cluster;
+    cluster.set_timestamp_scale(tc_scale);
+
     while (true) {
-      auto cluster = file->read_next_cluster();
-      if (!cluster)
+      if (!file->read_next_cluster(cluster))
         break;
 
-      auto ctc = static_cast<KaxClusterTimecode *> (cluster->FindFirstElt(EBML_INFO(KaxClusterTimecode), false));
-      cluster->InitTimecode(ctc ? ctc->GetValue() : 0, tc_scale);
-
       if (0 == verbose) {
         auto current_percentage = in.getFilePointer() * 100 / file_size;
 
@@ -515,20 +491,11 @@ extract_tracks(kax_analyzer_c &analyzer,
         }
       }
 
-      size_t i;
       int64_t max_timestamp = -1;
 
-      for (i = 0; cluster->ListSize() > i; ++i) {
-        int64_t max_bg_timestamp = -1;
-        EbmlElement *el          = (*cluster)[i];
-
-        if (Is<KaxBlockGroup>(el))
-          max_bg_timestamp = handle_blockgroup(*static_cast<KaxBlockGroup *>(el), *cluster, tc_scale);
-
-        else if (Is<KaxSimpleBlock>(el))
-          max_bg_timestamp = handle_simpleblock(*static_cast<KaxSimpleBlock *>(el), *cluster);
-
-        max_timestamp = std::max(max_timestamp, max_bg_timestamp);
+      for (auto const &block : cluster.get_blocks()) {
+        auto max_bg_timestamp = block.m_simple ? handle_simpleblock(cluster, block) : handle_blockgroup(cluster, block);
+        max_timestamp         = std::max(max_timestamp, max_bg_timestamp);
       }
 
       if (-1 != max_timestamp)
@@ -18,13 +18,15 @@
 #include <matroska/KaxTracks.h>
 
 #include "common/content_decoder.h"
+#include "common/kax_flat_cluster.h"
 #include "common/path.h"
 #include "common/timestamp.h"
 #include "extract/mkvextract.h"
 
 struct xtr_frame_t {
   memory_cptr &frame;
-  libmatroska::KaxBlockAdditions *additions;
+  kax_flat_cluster_c::addition_t const *additions;
+  std::size_t num_additions;
   int64_t timestamp, duration, bref, fref;
   bool keyframe, discardable;
   timestamp_c discard_duration;
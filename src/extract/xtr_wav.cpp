@@ -270,18 +270,9 @@ xtr_wavpack4_c::handle_frame(xtr_frame_t &f) {
   }
 
   // support hybrid mode data
-  if (m_corr_out && (f.additions)) {
-    auto block_more = FindChild<libmatroska::KaxBlockMore>(f.additions);
-
-    if (!block_more)
-      return;
-
-    auto block_addition = FindChild<libmatroska::KaxBlockAdditional>(block_more);
-    if (!block_addition)
-      return;
-
-    data_size = block_addition->GetSize();
-    mybuffer  = block_addition->GetBuffer();
+  if (m_corr_out && f.num_additions) {
+    data_size = f.additions[0].m_size;
+    mybuffer  = f.additions[0].m_data;
 
     if (2 < m_channels) {
       size_t flags_index = 0;
@@ -54,23 +54,18 @@ xtr_webvtt_c::handle_frame(xtr_frame_t &f) {
 
   std::string label, settings_list, local_blocks;
 
-  if (f.additions) {
-    auto &block_more    = GetChild<KaxBlockMore>(f.additions);
-    auto block_addition = FindChild<KaxBlockAdditional>(block_more);
+  if (f.num_additions) {
+    auto content = std::string{reinterpret_cast<char const *>(f.additions[0].m_data), f.additions[0].m_size};
+    auto lines   = mtx::string::split(mtx::string::chomp(mtx::string::normalize_line_endings(content)), "\n", 3);
 
-    if (block_addition) {
-      auto content = std::string{reinterpret_cast<char const *>(block_addition->GetBuffer()), static_cast<std::string::size_type>(block_addition->GetSize())};
-      auto lines   = mtx::string::split(mtx::string::chomp(mtx::string::normalize_line_endings(content)), "\n", 3);
+    if ((lines.size() > 0) && !lines[0].empty())
+      settings_list = " "s + mtx::string::strip_copy(lines[0]);
 
-      if ((lines.size() > 0) && !lines[0].empty())
-        settings_list = " "s + mtx::string::strip_copy(lines[0]);
+    if ((lines.size() > 1) && !lines[1].empty())
+      label = mtx::string::strip_copy(lines[1]) + "\n";
 
-      if ((lines.size() > 1) && !lines[1].empty())
-        label = mtx::string::strip_copy(lines[1]) + "\n";
-
-      if ((lines.size() > 2) && !lines[2].empty())
-        local_blocks = mtx::string::chomp(lines[2]) + "\n\n";
-    }
+    if ((lines.size() > 2) && !lines[2].empty())
+      local_blocks = mtx::string::chomp(lines[2]) + "\n\n";
   }
 
   auto content = mtx::string::chomp(mtx::string::normalize_line_endings(f.frame->to_string())) + "\n";
@@ -34,7 +34,7 @@ aac_framing_packet_converter_c::convert(packet_cptr const &packet) {
 
   while (m_parser.frames_available()) {
     auto frame      = m_parser.get_frame();
-    auto packet_out = std::make_shared<packet_t>(frame.m_data, frame.m_timestamp.to_ns(-1));
+    auto packet_out = packet_t::create(frame.m_data, frame.m_timestamp.to_ns(-1));
     m_ptzr->process(packet_out);
   }
 
@@ -0,0 +1,360 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   on-demand AVI chunk index
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/endian.h"
+#include "common/mm_io_x.h"
+#include "input/avi_chunk_index.h"
+
+namespace {
+
+constexpr auto IDX1_ENTRY_SIZE         = 16u;
+constexpr auto IDX1_BLOCK_SIZE         = 4096u * IDX1_ENTRY_SIZE;
+constexpr auto STANDARD_INDEX_HEADER   = 32u;
+constexpr auto AVIIF_KEYFRAME          = 0x10u;
+
+std::optional<unsigned int>
+stream_number_from_chunk_id(unsigned char const *chunk_id) {
+  if (   (chunk_id[0] < '0') || (chunk_id[0] > '9')
+      || (chunk_id[1] < '0') || (chunk_id[1] > '9'))
+    return {};
+
+  return (chunk_id[0] - '0') * 10 + (chunk_id[1] - '0');
+}
+
+bool
+is_fourcc(unsigned char const *data,
+          char const *fourcc) {
+  return !strncasecmp(reinterpret_cast<char const *>(data), fourcc, 4);
+}
+
+}
+
+avi_chunk_index_c::avi_chunk_index_c(mm_io_c &in,
+                                     avi_t &avi)
+  : m_in{in}
+  , m_avi{avi}
+{
+}
+
+avisuperindex_chunk *
+avi_chunk_index_c::find_super_index(unsigned int stream_number)
+  const {
+  // Just like avilib only use the OpenDML indexes if the video track
+  // has one.
+  if (!m_avi.is_opendml)
+    return nullptr;
+
+  auto usable = [](avisuperindex_chunk *super_index) {
+    return super_index && super_index->aIndex && super_index->nEntriesInUse ? super_index : nullptr;
+  };
+
+  if (static_cast<unsigned int>(m_avi.video_strn) == stream_number)
+    return usable(m_avi.video_superindex);
+
+  for (auto idx = 0; idx < m_avi.anum; ++idx)
+    if (static_cast<unsigned int>(m_avi.track[idx].audio_strn) == stream_number)
+      return usable(m_avi.track[idx].audio_superindex);
+
+  for (auto idx = 0; idx < m_avi.tnum; ++idx)
+    if (static_cast<unsigned int>(m_avi.ttrack[idx].audio_strn) == stream_number)
+      return usable(m_avi.ttrack[idx].audio_superindex);
+
+  return nullptr;
+}
+
+void
+avi_chunk_index_c::add_stream(unsigned int stream_number) {
+  if (m_streams.count(stream_number))
+    return;
+
+  auto &stream         = m_streams[stream_number];
+  stream.m_super_index = find_super_index(stream_number);
+
+  if (!stream.m_super_index)
+    return;
+
+  // Broken OpenDML files may come with super indexes that don't lead
+  // to any chunk. Find out right away so that the stream can fall
+  // back to the shared sources before those have moved past its
+  // chunks.
+  while (stream.m_chunks.empty() && (stream.m_next_super_index_entry < stream.m_super_index->nEntriesInUse))
+    read_standard_index(stream);
+
+  if (stream.m_chunks.empty()) {
+    mxdebug_if(m_debug, fmt::format("stream {0}: OpenDML super index doesn't reference any chunk; falling back\n", stream_number));
+    stream.m_super_index = nullptr;
+  }
+}
+
+void
+avi_chunk_index_c::remove_stream(unsigned int stream_number) {
+  m_streams.erase(stream_number);
+}
+
+avi_chunk_index_c::chunk_t const *
+avi_chunk_index_c::peek(unsigned int stream_number) {
+  auto itr = m_streams.find(stream_number);
+  if ((itr == m_streams.end()) || !fill(itr->second))
+    return nullptr;
+
+  return &itr->second.m_chunks.front();
+}
+
+std::optional<avi_chunk_index_c::chunk_t>
+avi_chunk_index_c::next(unsigned int stream_number) {
+  auto itr = m_streams.find(stream_number);
+  if ((itr == m_streams.end()) || !fill(itr->second))
+    return {};
+
+  auto chunk = itr->second.m_chunks.front();
+  itr->second.m_chunks.pop_front();
+
+  return chunk;
+}
+
+memory_cptr
+avi_chunk_index_c::read(chunk_t const &chunk) {
+  // The buffered I/O classes handle seeking within their buffer
+  // without touching the file. Chunks of interleaved streams are
+  // therefore read sequentially.
+  try {
+    if (m_in.getFilePointer() != chunk.m_position)
+      m_in.setFilePointer(chunk.m_position);
+
+    auto data = memory_c::alloc(chunk.m_size);
+    if (m_in.read(data->get_buffer(), chunk.m_size) != chunk.m_size)
+      return {};
+
+    return data;
+
+  } catch (mtx::mm_io::exception &) {
+    return {};
+  }
+}
+
+bool
+avi_chunk_index_c::fill(stream_t &stream) {
+  while (stream.m_chunks.empty()) {
+    if (stream.m_super_index) {
+      if (stream.m_next_super_index_entry >= stream.m_super_index->nEntriesInUse)
+        return false;
+
+      read_standard_index(stream);
+
+    } else if (!advance_shared_source())
+      return false;
+  }
+
+  return true;
+}
+
+bool
+avi_chunk_index_c::read_standard_index(stream_t &stream) {
+  auto &entry = stream.m_super_index->aIndex[stream.m_next_super_index_entry++];
+
+  try {
+    m_in.setFilePointer(entry.qwOffset);
+
+    unsigned char header[STANDARD_INDEX_HEADER];
+    if (m_in.read(header, STANDARD_INDEX_HEADER) != STANDARD_INDEX_HEADER)
+      return false;
+
+    // 'ix##' chunk header followed by the standard index header.
+    // All fields are untrusted: never read beyond the chunk or the file.
+    auto chunk_size       = get_uint32_le(&header[4]);
+    auto entry_size       = uint64_t{std::max<unsigned int>(get_uint16_le(&header[8]), 2) * 4};
+    auto num_entries      = uint64_t{get_uint32_le(&header[12])};
+    auto base_offset      = get_uint64_le(&header[20]);
+    auto file_size        = static_cast<uint64_t>(m_in.get_size());
+    auto position         = m_in.getFilePointer();
+
+    if (chunk_size >= (STANDARD_INDEX_HEADER - 8))
+      num_entries         = std::min<uint64_t>(num_entries, (chunk_size - (STANDARD_INDEX_HEADER - 8)) / entry_size);
+
+    num_entries           = std::min<uint64_t>(num_entries, file_size > position ? (file_size - position) / entry_size : 0);
+
+    m_buffer.resize(num_entries * entry_size);
+    num_entries           = m_in.read(m_buffer.data(), m_buffer.size()) / entry_size;
+
+    mxdebug_if(m_debug, fmt::format("standard index at {0}: {1} entries, base offset {2}\n", entry.qwOffset, num_entries, base_offset));
+
+    for (auto idx = 0u; idx < num_entries; ++idx) {
+      auto ptr    = &m_buffer[idx * entry_size];
+      auto offset = get_uint32_le(ptr);
+      auto size   = get_uint32_le(ptr + 4);
+
+      // Completely empty chunk
+      if (!offset && !(size & 0x7fffffff))
+        continue;
+
+      // Bit 31 of the size is set for non-key frames.
+      stream.m_chunks.push_back({ base_offset + offset, size & 0x7fffffff, !(size & 0x80000000) });
+    }
+
+    return true;
+
+  } catch (mtx::mm_io::exception &) {
+    return false;
+  }
+}
+
+bool
+avi_chunk_index_c::advance_shared_source() {
+  if (shared_source_e::unknown == m_shared_source)
+    determine_shared_source();
+
+  if (shared_source_e::idx1 == m_shared_source)
+    return read_idx1_block();
+
+  if (shared_source_e::movi == m_shared_source)
+    return scan_movi_chunk();
+
+  return false;
+}
+
+void
+avi_chunk_index_c::determine_shared_source() {
+  m_shared_source = shared_source_e::movi;
+
+  if (m_avi.idx1_len >= IDX1_ENTRY_SIZE) {
+    // Offsets in 'idx1' are either relative to the start of the file
+    // or to the 'movi' list. Determine which by looking at the first
+    // data chunk they refer to.
+    try {
+      unsigned char entry[IDX1_ENTRY_SIZE], chunk_header[8];
+      auto num_entries = m_avi.idx1_len / IDX1_ENTRY_SIZE;
+
+      for (auto idx = 0; idx < std::min<int64_t>(num_entries, 256); ++idx) {
+        m_in.setFilePointer(m_avi.idx1_start + idx * IDX1_ENTRY_SIZE);
+        if (m_in.read(entry, IDX1_ENTRY_SIZE) != IDX1_ENTRY_SIZE)
+          break;
+
+        if (!stream_number_from_chunk_id(entry))
+          continue;
+
+        auto position = static_cast<uint64_t>(get_uint32_le(&entry[8]));
+        auto size     = get_uint32_le(&entry[12]);
+
+        for (auto offset : { uint64_t{0}, static_cast<uint64_t>(m_avi.movi_start) - 4 }) {
+          m_in.setFilePointer(position + offset);
+          if (   (m_in.read(chunk_header, 8) == 8)
+              && !memcmp(chunk_header, entry, 4)
+              && (get_uint32_le(&chunk_header[4]) == size)) {
+            m_shared_source   = shared_source_e::idx1;
+            m_shared_position = m_avi.idx1_start;
+            m_shared_end      = m_avi.idx1_start + num_entries * IDX1_ENTRY_SIZE;
+            m_idx1_offset     = offset + 8;
+            break;
+          }
+        }
+
+        break;
+      }
+
+    } catch (mtx::mm_io::exception &) {
+    }
+  }
+
+  if (shared_source_e::movi == m_shared_source) {
+    m_shared_position = m_avi.movi_start;
+    m_shared_end      = m_in.get_size();
+  }
+
+  mxdebug_if(m_debug,
+             fmt::format("shared source: {0}; range {1}-{2}, idx1 offset {3}\n",
+                         shared_source_e::idx1 == m_shared_source ? "idx1" : "movi scan", m_shared_position, m_shared_end, m_idx1_offset));
+}
+
+bool
+avi_chunk_index_c::read_idx1_block() {
+  if (m_shared_position >= m_shared_end) {
+    m_shared_source = shared_source_e::exhausted;
+    return false;
+  }
+
+  try {
+    m_buffer.resize(std::min<uint64_t>(IDX1_BLOCK_SIZE, m_shared_end - m_shared_position));
+
+    m_in.setFilePointer(m_shared_position);
+    auto num_entries   = m_in.read(m_buffer.data(), m_buffer.size()) / IDX1_ENTRY_SIZE;
+    m_shared_position += m_buffer.size();
+
+    if (!num_entries)
+      m_shared_position = m_shared_end;
+
+    for (auto idx = 0u; idx < num_entries; ++idx) {
+      auto entry = &m_buffer[idx * IDX1_ENTRY_SIZE];
+      queue(entry, { get_uint32_le(&entry[8]) + m_idx1_offset, get_uint32_le(&entry[12]), !!(get_uint32_le(&entry[4]) & AVIIF_KEYFRAME) });
+    }
+
+    return true;
+
+  } catch (mtx::mm_io::exception &) {
+    m_shared_source = shared_source_e::exhausted;
+    return false;
+  }
+}
+
+bool
+avi_chunk_index_c::scan_movi_chunk() {
+  // Walks all chunks following the start of the first 'movi' list,
+  // descending into lists ('movi', 'rec ') and into the 'RIFF' 'AVIX'
+  // extensions of OpenDML files. There are no key frame flags without
+  // an index.
+  try {
+    unsigned char header[8];
+
+    while ((m_shared_position + 8) <= m_shared_end) {
+      m_in.setFilePointer(m_shared_position);
+      if (m_in.read(header, 8) != 8)
+        break;
+
+      auto size          = get_uint32_le(&header[4]);
+      m_shared_position += 8;
+
+      if (is_fourcc(header, "LIST") || is_fourcc(header, "RIFF")) {
+        m_shared_position += 4;
+        continue;
+      }
+
+      auto payload_position  = m_shared_position;
+      m_shared_position     += size + (size & 1);
+
+      if (!stream_number_from_chunk_id(header))
+        continue;
+
+      queue(header, { payload_position, size, false });
+
+      return true;
+    }
+
+  } catch (mtx::mm_io::exception &) {
+  }
+
+  m_shared_source = shared_source_e::exhausted;
+  return false;
+}
+
+void
+avi_chunk_index_c::queue(unsigned char const *chunk_id,
+                         chunk_t const &chunk) {
+  auto stream_number = stream_number_from_chunk_id(chunk_id);
+  if (!stream_number)
+    return;
+
+  auto itr = m_streams.find(*stream_number);
+  if ((itr != m_streams.end()) && !itr->second.m_super_index)
+    itr->second.m_chunks.push_back(chunk);
+}
@@ -0,0 +1,94 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for the on-demand AVI chunk index
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include "avilib.h"
+
+// Hands out the positions & sizes of the chunks of an AVI file's
+// streams without reading the whole index up front. The sources are,
+// in order of preference:
+//
+//   1. the OpenDML standard index chunks referenced by a stream's
+//      super index; they're read one at a time,
+//   2. the 'idx1' index; it's read in blocks,
+//   3. a sequential scan of the 'movi' lists for files without any
+//      usable index.
+//
+// The 'idx1' index and the 'movi' scan are shared by all streams.
+// Their chunks are only queued for streams added with add_stream(),
+// and only as far as needed for the stream that asked for more. As
+// long as the streams are interleaved and read roughly in parallel,
+// the queues stay short.
+class avi_chunk_index_c {
+public:
+  struct chunk_t {
+    uint64_t m_position{}; // of the payload, not of the chunk header
+    uint32_t m_size{};
+    bool m_key{};
+  };
+
+protected:
+  struct stream_t {
+    std::deque<chunk_t> m_chunks;
+    avisuperindex_chunk *m_super_index{};
+    unsigned int m_next_super_index_entry{};
+  };
+
+  enum class shared_source_e {
+    unknown,
+    idx1,
+    movi,
+    exhausted,
+  };
+
+  mm_io_c &m_in;
+  avi_t &m_avi;
+  std::unordered_map<unsigned int, stream_t> m_streams;
+
+  shared_source_e m_shared_source{shared_source_e::unknown};
+  uint64_t m_shared_position{}, m_shared_end{}, m_idx1_offset{};
+  std::vector<unsigned char> m_buffer;
+
+  debugging_option_c m_debug{"avi|avi_chunk_index"};
+
+public:
+  avi_chunk_index_c(mm_io_c &in, avi_t &avi);
+
+  // Chunks are only collected for streams added here. The stream
+  // number is the one from the chunk IDs, e.g. 1 for '01wb'.
+  void add_stream(unsigned int stream_number);
+  void remove_stream(unsigned int stream_number);
+
+  // Returns nullptr if there are no more chunks for the stream.
+  chunk_t const *peek(unsigned int stream_number);
+  std::optional<chunk_t> next(unsigned int stream_number);
+
+  // Reads a chunk's payload. Returns an empty pointer if the file is
+  // truncated.
+  memory_cptr read(chunk_t const &chunk);
+
+protected:
+  bool fill(stream_t &stream);
+  bool read_standard_index(stream_t &stream);
+
+  bool advance_shared_source();
+  void determine_shared_source();
+  bool read_idx1_block();
+  bool scan_movi_chunk();
+  void queue(unsigned char const *chunk_id, chunk_t const &chunk);
+
+  avisuperindex_chunk *find_super_index(unsigned int stream_number) const;
+};
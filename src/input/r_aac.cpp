@@ -114,7 +114,7 @@ aac_reader_c::read(generic_packetizer_c *,
 
     while (m_parser.frames_available()) {
       auto frame = m_parser.get_frame();
-      ptzr(0).process(std::make_shared<packet_t>(frame.m_data));
+      ptzr(0).process(packet_t::create(frame.m_data));
     }
   }
 
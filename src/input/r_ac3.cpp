@@ -81,7 +81,7 @@ ac3_reader_c::read(generic_packetizer_c *,
   int num_read             = m_in->read(m_chunk->get_buffer(), read_len);
 
   if (0 < num_read)
-    ptzr(0).process(std::make_shared<packet_t>(memory_c::borrow(m_chunk->get_buffer(), num_read)));
+    ptzr(0).process(packet_t::create(memory_c::borrow(m_chunk->get_buffer(), num_read)));
 
   return (0 != num_read) && (0 < (remaining_bytes - num_read)) ? FILE_STATUS_MOREDATA : flush_packetizers();
 }
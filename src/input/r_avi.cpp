@@ -70,7 +70,7 @@ avi_reader_c::probe_file() {
   if ((data.substr(0, 4) != "riff") || (data.substr(8, 4) != "avi "))
     return false;
 
-  auto avi       = AVI_open_input_file(&in, 1);
+  auto avi       = AVI_open_input_file(&in, 0);
   auto const err = AVI_errno;
 
   if (avi)
@@ -86,12 +86,15 @@ void
 avi_reader_c::read_headers() {
   show_demuxer_info();
 
-  if (!(m_avi = AVI_open_input_file(m_in.get(), 1)))
+  // Don't let avilib read the whole index. The chunk index reads it
+  // on demand instead.
+  if (!(m_avi = AVI_open_input_file(m_in.get(), 0)))
     throw mtx::input::invalid_format_x();
 
+  m_chunk_index      = std::make_unique<avi_chunk_index_c>(*m_in, *m_avi);
+
   auto frame_rate    = AVI_frame_rate(m_avi);
   m_default_duration = mtx::rational(1'000'000'000.0, frame_rate ? frame_rate : 25);
-  m_max_video_frames = AVI_video_frames(m_avi);
   m_video_width      = std::abs(AVI_video_width(m_avi));
   m_video_height     = std::abs(AVI_video_height(m_avi));
 
@@ -105,12 +108,42 @@ avi_reader_c::read_headers() {
 }
 
 avi_reader_c::~avi_reader_c() {
+  // The chunk index refers to avilib's super indexes.
+  m_chunk_index.reset();
+
   if (m_avi)
     AVI_close(m_avi);
 
   mxdebug_if(m_debug, fmt::format("avi_reader_c: Dropped video frames: {0}\n", m_dropped_video_frames));
 }
 
+unsigned int
+avi_reader_c::video_stream_number()
+  const {
+  return m_avi->video_strn;
+}
+
+// Setting up the packetizers requires looking at the first chunks of
+// a stream. Those lookups use their own index so that the one used
+// for demuxing only ever moves forward.
+std::unique_ptr<avi_chunk_index_c>
+avi_reader_c::create_probe_index(unsigned int stream_number) {
+  auto index = std::make_unique<avi_chunk_index_c>(*m_in, *m_avi);
+  index->add_stream(stream_number);
+
+  return index;
+}
+
+memory_cptr
+avi_reader_c::read_chunk(avi_chunk_index_c::chunk_t const &chunk) {
+  auto data = m_chunk_index->read(chunk);
+
+  if (data)
+    m_bytes_processed = std::max<uint64_t>(m_bytes_processed, chunk.m_position + chunk.m_size);
+
+  return data;
+}
+
 void
 avi_reader_c::verify_video_track() {
   auto size        = get_uint32_le(&m_avi->bitmap_info_header->bi_size);
@@ -121,20 +154,17 @@ void
 avi_reader_c::parse_subtitle_chunks() {
   int i;
   for (i = 0; AVI_text_tracks(m_avi) > i; ++i) {
-    AVI_set_text_track(m_avi, i);
+    auto index = create_probe_index(m_avi->ttrack[i].audio_strn);
+    auto entry = index->next(m_avi->ttrack[i].audio_strn);
 
-    if (AVI_text_chunks(m_avi) == 0)
+    if (!entry || !entry->m_size)
       continue;
 
-    int chunk_size = AVI_read_text_chunk(m_avi, nullptr);
-    if (0 >= chunk_size)
+    auto chunk = index->read(*entry);
+    if (!chunk)
       continue;
 
-    memory_cptr chunk(memory_c::alloc(chunk_size));
-    chunk_size = AVI_read_text_chunk(m_avi, reinterpret_cast<char *>(chunk->get_buffer()));
-
-    if (0 >= chunk_size)
-      continue;
+    int chunk_size = chunk->get_size();
 
     avi_subs_demuxer_t demuxer;
 
@@ -190,14 +220,7 @@ avi_reader_c::create_packetizer(int64_t tid) {
 
 void
 avi_reader_c::create_video_packetizer() {
-  size_t i;
-
-  mxdebug_if(m_debug, fmt::format("'{0}' track {1}: frame sizes:\n", m_ti.m_fname, 0));
-
-  for (i = 0; i < m_max_video_frames; i++) {
-    m_bytes_to_process += AVI_frame_size(m_avi, i);
-    mxdebug_if(m_debug, fmt::format("  {0}: {1}\n", i, AVI_frame_size(m_avi, i)));
-  }
+  m_chunk_index->add_stream(video_stream_number());
 
   if (m_avi->bitmap_info_header) {
     m_ti.m_private_data = memory_c::clone(m_avi->bitmap_info_header, sizeof(alBITMAPINFOHEADER) + m_avi->extradata_size);
@@ -283,31 +306,28 @@ avi_reader_c::create_mpeg1_2_packetizer() {
   if (m_ti.m_private_data && (m_ti.m_private_data->get_size() < sizeof(alBITMAPINFOHEADER)))
     m2v_parser->WriteData(m_ti.m_private_data->get_buffer() + sizeof(alBITMAPINFOHEADER), m_ti.m_private_data->get_size() - sizeof(alBITMAPINFOHEADER));
 
+  auto index                = create_probe_index(video_stream_number());
   unsigned int frame_number = 0;
   unsigned int state        = m2v_parser->GetState();
-  while ((frame_number < std::min(m_max_video_frames, 100u)) && (MPV_PARSER_STATE_FRAME != state)) {
+  while ((frame_number < 100) && (MPV_PARSER_STATE_FRAME != state)) {
     ++frame_number;
 
-    int size = AVI_frame_size(m_avi, frame_number - 1);
-    if (0 == size)
-      continue;
-
-    AVI_set_video_position(m_avi, frame_number - 1);
-
-    memory_cptr buffer = memory_c::alloc(size);
-    int key      = 0;
-    int num_read = AVI_read_frame(m_avi, reinterpret_cast<char *>(buffer->get_buffer()), &key);
+    auto entry = index->next(video_stream_number());
+    if (!entry)
+      break;
 
-    if (0 >= num_read)
+    if (0 == entry->m_size)
       continue;
 
-    m2v_parser->WriteData(buffer->get_buffer(), num_read);
+    auto buffer = index->read(*entry);
+    if (!buffer)
+      break;
+
+    m2v_parser->WriteData(buffer->get_buffer(), buffer->get_size());
 
     state = m2v_parser->GetState();
   }
 
-  AVI_set_video_position(m_avi, 0);
-
   if (MPV_PARSER_STATE_FRAME != state)
     mxerror_tid(m_ti.m_fname, 0, Y("Could not extract the sequence header from this MPEG-1/2 track.\n"));
 
@@ -453,8 +473,8 @@ avi_reader_c::add_audio_demuxer(int aid) {
       return;
 
   AVI_set_audio_track(m_avi, aid);
-  if (AVI_read_audio_chunk(m_avi, nullptr) < 0) {
-    mxwarn(fmt::format(Y("Could not find an index for audio track {0} (avilib error message: {1}). Skipping track.\n"), aid + 1, AVI_strerror()));
+  if (!create_probe_index(m_avi->track[aid].audio_strn)->peek(m_avi->track[aid].audio_strn)) {
+    mxwarn(fmt::format(Y("Could not find any data for audio track {0}. Skipping track.\n"), aid + 1));
     return;
   }
 
@@ -464,6 +484,7 @@ avi_reader_c::add_audio_demuxer(int aid) {
   uint32_t audio_format            = AVI_audio_format(m_avi);
 
   demuxer.m_aid                    = aid;
+  demuxer.m_stream_number          = m_avi->track[aid].audio_strn;
   demuxer.m_ptzr                   = -1;
   demuxer.m_samples_per_second     = AVI_audio_rate(m_avi);
   demuxer.m_channels               = AVI_audio_channels(m_avi);
@@ -518,12 +539,7 @@ avi_reader_c::add_audio_demuxer(int aid) {
 
   m_audio_demuxers.push_back(demuxer);
 
-  int i, maxchunks = AVI_audio_chunks(m_avi);
-  for (i = 0; i < maxchunks; i++) {
-    auto size = AVI_audio_size(m_avi, i);
-    if (size < AVI_MAX_AUDIO_CHUNK_SIZE)
-      m_bytes_to_process += size;
-  }
+  m_chunk_index->add_stream(demuxer.m_stream_number);
 }
 
 generic_packetizer_c *
@@ -575,21 +591,17 @@ avi_reader_c::create_aac_packetizer(int aid,
 generic_packetizer_c *
 avi_reader_c::create_dts_packetizer(int aid) {
   try {
-    AVI_set_audio_track(m_avi, aid);
-
-    long audio_position   = AVI_get_audio_position_index(m_avi);
-    unsigned int num_read = 0;
-    int dts_position      = -1;
+    auto stream_number = m_avi->track[aid].audio_strn;
+    auto index         = create_probe_index(stream_number);
+    int dts_position   = -1;
     mtx::bytes::buffer_c buffer;
     mtx::dts::header_t dtsheader;
 
-    while ((-1 == dts_position) && (10 > num_read)) {
-      int chunk_size = AVI_read_audio_chunk(m_avi, nullptr);
-
-      if (0 < chunk_size) {
-        memory_cptr chunk = memory_c::alloc(chunk_size);
-        AVI_read_audio_chunk(m_avi, reinterpret_cast<char *>(chunk->get_buffer()));
+    while (-1 == dts_position) {
+      auto entry = index->next(stream_number);
+      auto chunk = entry ? index->read(*entry) : memory_cptr{};
 
+      if (chunk) {
         buffer.add(*chunk);
         dts_position = mtx::dts::find_header(buffer.get_buffer(), buffer.get_size(), dtsheader);
 
@@ -602,8 +614,6 @@ avi_reader_c::create_dts_packetizer(int aid) {
     if (-1 == dts_position)
       throw false;
 
-    AVI_set_audio_position_index(m_avi, audio_position);
-
     return new dts_packetizer_c(this, m_ti, dtsheader);
 
   } catch (...) {
@@ -667,69 +677,63 @@ void
 avi_reader_c::set_avc_nal_size_size(avc_es_video_packetizer_c *packetizer) {
   m_avc_nal_size_size = packetizer->get_nalu_size_length();
 
-  for (int i = 0; i < static_cast<int>(m_max_video_frames); ++i) {
-    int size = AVI_frame_size(m_avi, i);
-    if (0 == size)
-      continue;
+  auto index           = create_probe_index(video_stream_number());
 
-    memory_cptr buffer = memory_c::alloc(size);
+  while (auto entry = index->next(video_stream_number())) {
+    if (0 == entry->m_size)
+      continue;
 
-    AVI_set_video_position(m_avi, i);
-    int key = 0;
-    size    = AVI_read_frame(m_avi, reinterpret_cast<char *>(buffer->get_buffer()), &key);
+    auto buffer = index->read(*entry);
 
-    if (   (4 <= size)
+    if (   buffer
+        && (4 <= buffer->get_size())
         && (   (get_uint32_be(buffer->get_buffer()) == mtx::avc_hevc::NALU_START_CODE)
             || (get_uint24_be(buffer->get_buffer()) == mtx::avc_hevc::NALU_START_CODE)))
       m_avc_nal_size_size = -1;
 
     break;
   }
-
-  AVI_set_video_position(m_avi, 0);
 }
 
 file_status_e
 avi_reader_c::read_video() {
-  if (m_video_frames_read >= m_max_video_frames)
-    return flush_packetizer(m_vptzr);
-
   memory_cptr chunk;
-  int key                   = 0;
+  bool key                  = false;
   int old_video_frames_read = m_video_frames_read;
-
-  int size, num_read;
-
   int dropped_frames_here   = 0;
 
-  do {
-    size  = AVI_frame_size(m_avi, m_video_frames_read);
-    chunk = memory_c::alloc(size);
-    num_read = AVI_read_frame(m_avi, reinterpret_cast<char *>(chunk->get_buffer()), &key);
+  while (!chunk) {
+    auto entry = m_chunk_index->next(video_stream_number());
 
-    ++m_video_frames_read;
-
-    if (0 > num_read) {
-      // Error reading the frame: abort
-      m_video_frames_read = m_max_video_frames;
+    // No more frames or only dropped ones left.
+    if (!entry)
       return flush_packetizer(m_vptzr);
 
-    } else if (0 == num_read)
+    ++m_video_frames_read;
+
+    if (0 == entry->m_size) {
       ++dropped_frames_here;
+      continue;
+    }
 
-  } while ((0 == num_read) && (m_video_frames_read < m_max_video_frames));
+    chunk = read_chunk(*entry);
+    key   = entry->m_key;
 
-  if (0 == num_read)
-    // This is only the case if the AVI contains dropped frames only.
-    return flush_packetizer(m_vptzr);
+    if (!chunk) {
+      // Error reading the frame: abort
+      m_chunk_index->remove_stream(video_stream_number());
+      return flush_packetizer(m_vptzr);
+    }
+  }
 
-  size_t i;
-  for (i = m_video_frames_read; i < m_max_video_frames; ++i) {
-    if (0 != AVI_frame_size(m_avi, i))
+  int num_read = chunk->get_size();
+
+  while (true) {
+    auto entry = m_chunk_index->peek(video_stream_number());
+    if (!entry || (0 != entry->m_size))
       break;
 
-    int dummy_key;
-    AVI_read_frame(m_avi, nullptr, &dummy_key);
+    m_chunk_index->next(video_stream_number());
     ++dropped_frames_here;
     ++m_video_frames_read;
   }
@@ -742,7 +746,7 @@ avi_reader_c::read_video() {
   // AVC with framed packets (without NALU start codes but with length fields)
   // or non-AVC video track?
   if (0 >= m_avc_nal_size_size)
-    ptzr(m_vptzr).process(std::make_shared<packet_t>(chunk, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+    ptzr(m_vptzr).process(packet_t::create(chunk, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
 
   else {
     // AVC video track without NALU start codes. Re-frame with NALU start codes.
@@ -760,48 +764,37 @@ avi_reader_c::read_video() {
       memcpy(nalu->get_buffer() + 4, chunk->get_buffer() + offset, nalu_size);
       offset += nalu_size;
 
-      ptzr(m_vptzr).process(std::make_shared<packet_t>(nalu, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+      ptzr(m_vptzr).process(packet_t::create(nalu, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
     }
   }
 
-  m_bytes_processed += num_read;
-
-  return m_video_frames_read >= m_max_video_frames ? flush_packetizer(m_vptzr) :  FILE_STATUS_MOREDATA;
+  return FILE_STATUS_MOREDATA;
 }
 
 file_status_e
 avi_reader_c::read_audio(avi_demuxer_t &demuxer) {
-  AVI_set_audio_track(m_avi, demuxer.m_aid);
-
   while (true) {
-    int size = AVI_audio_size(m_avi, AVI_get_audio_position_index(m_avi));
+    auto entry = m_chunk_index->next(demuxer.m_stream_number);
 
-    // -1 indicates the last chunk.
-    if (-1 == size)
+    if (!entry)
       return flush_packetizer(demuxer.m_ptzr);
 
     // Sanity check. Ignore chunks with obvious wrong size information
     // (> 10 MB). Also skip 0-sized blocks. Those are officially
     // skipped.
-    if (!size || (size > AVI_MAX_AUDIO_CHUNK_SIZE)) {
-      AVI_set_audio_position_index(m_avi, AVI_get_audio_position_index(m_avi) + 1);
+    if (!entry->m_size || (entry->m_size > AVI_MAX_AUDIO_CHUNK_SIZE))
       continue;
-    }
 
-    auto chunk = memory_c::alloc(size);
-    size       = AVI_read_audio_chunk(m_avi, reinterpret_cast<char *>(chunk->get_buffer()));
+    auto chunk = read_chunk(*entry);
 
-    if (0 > size)
+    if (!chunk) {
+      m_chunk_index->remove_stream(demuxer.m_stream_number);
       return flush_packetizer(demuxer.m_ptzr);
+    }
 
-    if (!size)
-      continue;
-
-    ptzr(demuxer.m_ptzr).process(std::make_shared<packet_t>(chunk));
-
-    m_bytes_processed += size;
+    ptzr(demuxer.m_ptzr).process(packet_t::create(chunk));
 
-    return AVI_get_audio_position_index(m_avi) < AVI_max_audio_chunk(m_avi) ? FILE_STATUS_MOREDATA : flush_packetizer(demuxer.m_ptzr);
+    return FILE_STATUS_MOREDATA;
   }
 }
 
@@ -830,27 +823,31 @@ avi_reader_c::read(generic_packetizer_c *packetizer,
   return flush_packetizers();
 }
 
+// The index isn't read up front, meaning the total amount of data
+// isn't known. Use the position of the furthest chunk read instead.
 int64_t
 avi_reader_c::get_progress() {
-  return 0 == m_bytes_to_process ? m_in->getFilePointer() : m_bytes_processed;
+  return m_bytes_processed;
 }
 
 int64_t
 avi_reader_c::get_maximum_progress() {
-  return 0 == m_bytes_to_process ? m_in->get_size() : m_bytes_to_process;
+  return m_in->get_size();
 }
 
 void
 avi_reader_c::extended_identify_mpeg4_l2(mtx::id::info_c &info) {
-  int size = AVI_frame_size(m_avi, 0);
-  if (0 >= size)
+  auto index = create_probe_index(video_stream_number());
+  auto entry = index->next(video_stream_number());
+  if (!entry || !entry->m_size)
     return;
 
-  memory_cptr af_buffer = memory_c::alloc(size);
-  unsigned char *buffer = af_buffer->get_buffer();
-  int dummy_key;
+  auto af_buffer = index->read(*entry);
+  if (!af_buffer)
+    return;
 
-  AVI_read_frame(m_avi, reinterpret_cast<char *>(buffer), &dummy_key);
+  unsigned char *buffer = af_buffer->get_buffer();
+  int size              = af_buffer->get_size();
 
   uint32_t par_num, par_den;
   if (mtx::mpeg4_p2::extract_par(buffer, size, par_num, par_den)) {
@@ -973,14 +970,12 @@ avi_reader_c::add_available_track_ids() {
 
 void
 avi_reader_c::debug_dump_video_index() {
-  int num_video_frames = AVI_video_frames(m_avi), i;
+  auto index = create_probe_index(video_stream_number());
+  auto idx   = 0u;
 
-  mxinfo(fmt::format("AVI video index dump: {0} entries; default duration: {1}\n", num_video_frames, m_default_duration));
-  for (i = 0; num_video_frames > i; ++i) {
-    int key = 0;
-    AVI_read_frame(m_avi, nullptr, &key);
-    mxinfo(fmt::format("  {0}: {1} bytes; key: {2}\n", i, AVI_frame_size(m_avi, i), key));
-  }
+  mxinfo(fmt::format("AVI video index dump; default duration: {0}\n", m_default_duration));
+  while (auto entry = index->next(video_stream_number()))
+    mxinfo(fmt::format("  {0}: {1} bytes at {2}; key: {3}\n", idx++, entry->m_size, entry->m_position, entry->m_key));
 
-  AVI_set_video_position(m_avi, 0);
+  mxinfo(fmt::format("AVI video index dump: {0} entries\n", idx));
 }
@@ -19,6 +19,7 @@
 #include "common/codec.h"
 #include "merge/generic_reader.h"
 #include "common/error.h"
+#include "input/avi_chunk_index.h"
 #include "input/subtitles.h"
 
 namespace mtx::id {
@@ -30,7 +31,7 @@ class avc_es_video_packetizer_c;
 struct avi_demuxer_t {
   int m_ptzr{-1};
   int m_channels{}, m_bits_per_sample{}, m_samples_per_second{}, m_aid{};
-  int64_t m_bytes_processed{};
+  unsigned int m_stream_number{};
   codec_c m_codec;
 };
 
@@ -60,15 +61,16 @@ private:
 
   divx_type_e m_divx_type{DIVX_TYPE_NONE};
   avi_t *m_avi{};
+  std::unique_ptr<avi_chunk_index_c> m_chunk_index;
   int m_vptzr{-1};
   std::vector<avi_demuxer_t> m_audio_demuxers;
   std::vector<avi_subs_demuxer_t> m_subtitle_demuxers;
   mtx_mp_rational_t m_default_duration;
-  unsigned int m_video_frames_read{}, m_max_video_frames{}, m_dropped_video_frames{};
+  unsigned int m_video_frames_read{}, m_dropped_video_frames{};
   unsigned int m_video_width{}, m_video_height{}, m_video_display_width{}, m_video_display_height;
   int m_avc_nal_size_size{-1};
 
-  uint64_t m_bytes_to_process{}, m_bytes_processed{};
+  uint64_t m_bytes_processed{};
   bool m_video_track_ok{};
 
   debugging_option_c m_debug_aspect_ratio{"avi|avi_aspect_ratio"}, m_debug{"avi|avi_reader"};
@@ -96,6 +98,10 @@ protected:
   virtual file_status_e read_video();
   virtual file_status_e read_audio(avi_demuxer_t &demuxer);
   virtual file_status_e read_subtitles(avi_subs_demuxer_t &demuxer);
+  memory_cptr read_chunk(avi_chunk_index_c::chunk_t const &chunk);
+
+  unsigned int video_stream_number() const;
+  std::unique_ptr<avi_chunk_index_c> create_probe_index(unsigned int stream_number);
 
   virtual void handle_video_aspect_ratio();
 
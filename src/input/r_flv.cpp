@@ -116,12 +116,12 @@ flv_tag_c::read(mm_io_cptr const &in) {
   try {
     auto position        = in->getFilePointer();
     m_ok                 = false;
-    m_previous_tag_size  = in->read_uint32_be();
-    m_flags              = in->read_uint8();
-    m_data_size          = in->read_uint24_be();
-    m_timestamp          = in->read_uint24_be();
-    m_timestamp_extended = in->read_uint8();
-    in->skip(3);
+    m_previous_tag_size  = in->fast_read_uint32_be();
+    m_flags              = in->fast_read_uint8();
+    m_data_size          = in->fast_read_uint24_be();
+    m_timestamp          = in->fast_read_uint24_be();
+    m_timestamp_extended = in->fast_read_uint8();
+    in->fast_skip(3);
     m_next_position      = in->getFilePointer() + m_data_size;
     m_ok                 = true;
 
@@ -470,7 +470,7 @@ flv_reader_c::process_audio_tag_sound_format(flv_track_cptr &track,
       return false;
 
     track->m_fourcc = "AAC ";
-    uint8_t aac_packet_type = m_in->read_uint8();
+    uint8_t aac_packet_type = m_in->fast_read_uint8();
     m_tag.m_data_size--;
     if (aac_packet_type != 0) {
       // Raw AAC
@@ -513,7 +513,7 @@ flv_reader_c::process_audio_tag_sound_format(flv_track_cptr &track,
 
 bool
 flv_reader_c::process_audio_tag(flv_track_cptr &track) {
-  uint8_t audiotag_header = m_in->read_uint8();
+  uint8_t audiotag_header = m_in->fast_read_uint8();
   uint8_t format          = (audiotag_header & 0xf0) >> 4;
   uint8_t rate            = (audiotag_header & 0x0c) >> 2;
   uint8_t size            = (audiotag_header & 0x02) >> 1;
@@ -548,7 +548,7 @@ flv_reader_c::process_video_tag_avc(flv_track_cptr &track) {
     return false;
 
   track->m_fourcc          = "AVC1";
-  uint8_t avc_packet_type  = m_in->read_uint8();
+  uint8_t avc_packet_type  = m_in->fast_read_uint8();
   track->m_v_cts_offset    = m_in->read_int24_be();
   m_tag.m_data_size       -= 4;
 
@@ -591,7 +591,7 @@ flv_reader_c::process_video_tag_generic(flv_track_cptr &track,
     if (!m_tag.m_data_size)
       return false;
     m_tag.m_data_size--;
-    m_in->skip(1);
+    m_in->fast_skip(1);
     track->m_headers_read = true;
 
   } else if (track->m_fourcc == "FLV1")
@@ -619,7 +619,7 @@ flv_reader_c::process_video_tag(flv_track_cptr &track) {
   if (!m_tag.m_data_size)
     return false;
 
-  uint8_t video_tag_header = m_in->read_uint8();
+  uint8_t video_tag_header = m_in->fast_read_uint8();
   m_tag.m_data_size--;
 
   uint8_t frame_type = (video_tag_header >> 4) & 0x0f;
@@ -798,7 +798,7 @@ flv_reader_c::read(generic_packetizer_c *,
     if (track->m_v_frame_rate && track->m_fourcc.equiv("AVC1"))
       duration = mtx::to_int(mtx::rational(1'000'000'000, track->m_v_frame_rate));
 
-    auto packet = std::make_shared<packet_t>(track->m_payload, track->m_timestamp, duration, 'I' == track->m_v_frame_type ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME);
+    auto packet = packet_t::create(track->m_payload, track->m_timestamp, duration, 'I' == track->m_v_frame_type ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME);
 
     if (track->m_extra_data)
       packet->codec_state = track->m_extra_data;
@@ -90,7 +90,7 @@ hdmv_textst_reader_c::read(generic_packetizer_c *,
     auto buf    = segment->get_buffer();
     auto start  = mtx::hdmv_textst::get_timestamp(&buf[3]);
     auto end    = mtx::hdmv_textst::get_timestamp(&buf[8]);
-    auto packet = std::make_shared<packet_t>(segment, std::min(start, end).to_ns(), (start - end).abs().to_ns());
+    auto packet = packet_t::create(segment, std::min(start, end).to_ns(), (start - end).abs().to_ns());
 
     ptzr(0).process(packet);
 
@@ -60,6 +60,7 @@
 #include "common/kax_analyzer.h"
 #include "common/math.h"
 #include "common/mime.h"
+#include "common/mm_file_io.h"
 #include "common/mm_io.h"
 #include "common/qt.h"
 #include "common/strings/formatting.h"
@@ -70,6 +71,7 @@
 #include "common/id_info.h"
 #include "common/vobsub.h"
 #include "input/r_matroska.h"
+#include "merge/cluster_helper.h"
 #include "merge/file_status.h"
 #include "merge/input_x.h"
 #include "merge/output_control.h"
@@ -861,6 +863,10 @@ kax_reader_c::handle_attachments(mm_io_c *io,
   if (!found_in(*atts, element_found))
     delete element_found;
 
+  // Attachments read from a single file are copied from it when
+  // they're written instead of being kept in memory.
+  auto file_io = dynamic_cast<mm_file_io_c *>(get_underlying_input(io));
+
   for (auto l1_att : *atts) {
     auto att = dynamic_cast<KaxAttached *>(l1_att);
     if (!att)
@@ -877,11 +883,18 @@ kax_reader_c::handle_attachments(mm_io_c *io,
     matt->description = to_utf8(FindChildValue<KaxFileDescription>(att));
     matt->mime_type   = ::mtx::mime::maybe_map_to_legacy_font_mime_type(FindChildValue<KaxMimeType>(att), g_use_legacy_font_mime_types);
     matt->id          = FindChildValue<KaxFileUID>(att);
-    matt->data        = memory_c::clone(static_cast<unsigned char *>(fdata->GetBuffer()), fdata->GetSize());
+
+    if (file_io) {
+      matt->data_file_name = file_io->get_file_name();
+      matt->data_position  = fdata->GetElementPosition() + fdata->HeadSize();
+      matt->data_size      = fdata->GetSize();
+
+    } else
+      matt->data = memory_c::clone(static_cast<unsigned char *>(fdata->GetBuffer()), fdata->GetSize());
 
     auto attach_mode  = attachment_requested(m_attachment_id);
 
-    if (   !matt->data->get_size()
+    if (   !matt->get_size()
         || matt->mime_type.empty()
         || (ATTACH_MODE_SKIP == attach_mode))
       continue;
@@ -2240,7 +2253,7 @@ kax_reader_c::create_vc1_video_packetizer(kax_track_t *t,
   show_packetizer_info(t->tnum, *t->ptzr_ptr);
 
   if (t->private_data && (sizeof(alBITMAPINFOHEADER) < t->private_data->get_size()))
-    t->ptzr_ptr->process(std::make_shared<packet_t>(memory_c::borrow(t->private_data->get_buffer() + sizeof(alBITMAPINFOHEADER), t->private_data->get_size() - sizeof(alBITMAPINFOHEADER))));
+    t->ptzr_ptr->process(packet_t::create(memory_c::borrow(t->private_data->get_buffer() + sizeof(alBITMAPINFOHEADER), t->private_data->get_size() - sizeof(alBITMAPINFOHEADER))));
 }
 
 void
@@ -2250,64 +2263,30 @@ kax_reader_c::read_first_frames(kax_track_t *t,
     return;
 
   std::map<int64_t, unsigned int> frames_by_track_id;
+  kax_flat_cluster_c cluster;
+
+  cluster.set_timestamp_scale(m_tc_scale);
 
   try {
     while (true) {
-      auto cluster = m_in_file->read_next_cluster();
-      if (!cluster)
+      if (!m_in_file->read_next_cluster(cluster))
         return;
 
-      KaxClusterTimecode *ctc = static_cast<KaxClusterTimecode *> (cluster->FindFirstElt(EBML_INFO(KaxClusterTimecode), false));
-      if (ctc)
-        cluster->InitTimecode(ctc->GetValue(), m_tc_scale);
-
-      size_t bgidx;
-      for (bgidx = 0; bgidx < cluster->ListSize(); bgidx++) {
-        if (Is<KaxSimpleBlock>((*cluster)[bgidx])) {
-          KaxSimpleBlock *block_simple = static_cast<KaxSimpleBlock *>((*cluster)[bgidx]);
-
-          block_simple->SetParent(*cluster);
-          kax_track_t *block_track = find_track_by_num(block_simple->TrackNum());
-
-          if (!block_track || (0 == block_simple->NumberFrames()))
-            continue;
-
-          for (int frame_idx = 0, num_frames = block_simple->NumberFrames(); frame_idx < num_frames; ++frame_idx) {
-            frames_by_track_id[ block_simple->TrackNum() ]++;
-
-            if (frames_by_track_id[ block_simple->TrackNum() ] <= block_track->first_frames_data.size())
-              continue;
-
-            DataBuffer &data_buffer = block_simple->GetBuffer(frame_idx);
-            block_track->first_frames_data.push_back(memory_c::borrow(data_buffer.Buffer(), data_buffer.Size()));
-            block_track->content_decoder.reverse(block_track->first_frames_data.back(), CONTENT_ENCODING_SCOPE_BLOCK);
-            block_track->first_frames_data.back()->take_ownership();
-          }
-
-        } else if (Is<KaxBlockGroup>((*cluster)[bgidx])) {
-          KaxBlockGroup *block_group = static_cast<KaxBlockGroup *>((*cluster)[bgidx]);
-          KaxBlock *block            = static_cast<KaxBlock *>(block_group->FindFirstElt(EBML_INFO(KaxBlock), false));
+      for (auto const &block : cluster.get_blocks()) {
+        auto block_track = find_track_by_num(block.m_track_number);
 
-          if (!block)
-            continue;
+        if (!block_track || (0 == block.m_num_frames))
+          continue;
 
-          block->SetParent(*cluster);
-          kax_track_t *block_track = find_track_by_num(block->TrackNum());
+        for (auto frame_idx = 0u; frame_idx < block.m_num_frames; ++frame_idx) {
+          frames_by_track_id[ block.m_track_number ]++;
 
-          if (!block_track || (0 == block->NumberFrames()))
+          if (frames_by_track_id[ block.m_track_number ] <= block_track->first_frames_data.size())
             continue;
 
-          for (int frame_idx = 0, num_frames = block->NumberFrames(); frame_idx < num_frames; ++frame_idx) {
-            frames_by_track_id[ block->TrackNum() ]++;
-
-            if (frames_by_track_id[ block->TrackNum() ] <= block_track->first_frames_data.size())
-              continue;
-
-            DataBuffer &data_buffer = block->GetBuffer(frame_idx);
-            block_track->first_frames_data.push_back(memory_cptr(memory_c::borrow(data_buffer.Buffer(), data_buffer.Size())));
-            block_track->content_decoder.reverse(block_track->first_frames_data.back(), CONTENT_ENCODING_SCOPE_BLOCK);
-            block_track->first_frames_data.back()->take_ownership();
-          }
+          block_track->first_frames_data.push_back(cluster.borrow_frame(block, frame_idx));
+          block_track->content_decoder.reverse(block_track->first_frames_data.back(), CONTENT_ENCODING_SCOPE_BLOCK);
+          block_track->first_frames_data.back()->take_ownership();
         }
       }
 
@@ -2335,22 +2314,16 @@ kax_reader_c::read(generic_packetizer_c *requested_ptzr,
   }
 
   try {
-    auto cluster = m_in_file->read_next_cluster();
-    if (!cluster)
-      return finish_file();
-
-    auto cluster_ts = FindChildValue<KaxClusterTimecode>(*cluster);
-    cluster->InitTimecode(cluster_ts, m_tc_scale);
+    m_cluster.set_timestamp_scale(m_tc_scale);
 
-    size_t bgidx;
-    for (bgidx = 0; bgidx < cluster->ListSize(); bgidx++) {
-      EbmlElement *element = (*cluster)[bgidx];
-
-      if (Is<KaxSimpleBlock>(element))
-        process_simple_block(cluster.get(), static_cast<KaxSimpleBlock *>(element));
+    if (!m_in_file->read_next_cluster(m_cluster))
+      return finish_file();
 
-      else if (Is<KaxBlockGroup>(element))
-        process_block_group(cluster.get(), static_cast<KaxBlockGroup *>(element));
+    for (auto const &block : m_cluster.get_blocks()) {
+      if (block.m_simple)
+        process_simple_block(block);
+      else
+        process_block_group(block);
     }
 
   } catch (...) {
@@ -2363,6 +2336,103 @@ kax_reader_c::read(generic_packetizer_c *requested_ptzr,
   return FILE_STATUS_MOREDATA;
 }
 
+// Copying clusters as they are requires that the frames are neither
+// modified by the packetizers nor by this reader, and that the block
+// structure written by mkvmerge would be the same as in the source
+// file.
+bool
+kax_reader_c::is_cluster_copy_possible() {
+  if (!m_cluster_copy_possible) {
+    m_cluster_copy_possible = !m_appending
+                           && (m_tc_scale == static_cast<int64_t>(g_timestamp_scale))
+                           && !m_global_timestamp_offset
+                           && !m_restricted_timestamps_min.valid()
+                           && !m_restricted_timestamps_max.valid();
+
+    for (auto const &track : m_tracks) {
+      if (-1 == track->ptzr) {
+        m_cluster_copy_packetizers[track->track_number] = nullptr;
+        continue;
+      }
+
+      auto &packetizer = ptzr(track->ptzr);
+
+      if (   !track->passthrough
+          || track->content_decoder.has_encodings()
+          || track->ignore_duration_hack
+          || (static_cast<uint64_t>(packetizer.get_track_num()) != track->track_number)
+          || (std::max<int64_t>(packetizer.get_track_default_duration(), 0) != std::max<int64_t>(track->default_duration, 0)))
+        m_cluster_copy_possible = false;
+
+      m_cluster_copy_packetizers[track->track_number] = &packetizer;
+    }
+
+    mxdebug_if(m_debug_cluster_copy, fmt::format("is_cluster_copy_possible: {0}\n", *m_cluster_copy_possible));
+  }
+
+  if (!*m_cluster_copy_possible)
+    return false;
+
+  for (auto const &[track_number, packetizer] : m_cluster_copy_packetizers)
+    if (packetizer && !packetizer->is_stream_copy_possible())
+      return false;
+
+  return true;
+}
+
+bool
+kax_reader_c::copy_next_cluster() {
+  if (m_tracks.empty() || (FILE_STATUS_DONE == m_file_status) || !is_cluster_copy_possible())
+    return false;
+
+  try {
+    m_cluster.set_timestamp_scale(m_tc_scale);
+
+    if (!m_in_file->read_next_cluster(m_cluster))
+      return false;
+
+    if (!g_cluster_helper->copy_cluster(m_cluster, m_cluster_copy_packetizers)) {
+      mxdebug_if(m_debug_cluster_copy, fmt::format("copy_next_cluster: cluster at {0} processed normally\n", m_cluster.get_position()));
+
+      for (auto const &block : m_cluster.get_blocks()) {
+        if (block.m_simple)
+          process_simple_block(block);
+        else
+          process_block_group(block);
+      }
+
+      return false;
+    }
+
+    for (auto const &block : m_cluster.get_blocks()) {
+      auto track = find_track_by_num(block.m_track_number);
+      if (!track)
+        continue;
+
+      auto frame_duration = !block.m_simple && block.m_duration ? static_cast<int64_t>(*block.m_duration / std::max<std::size_t>(block.m_num_frames, 1))
+                          :                                       std::max<int64_t>(track->default_duration, 0);
+
+      m_last_timestamp = block.m_timestamp;
+      if (0 < block.m_num_frames)
+        m_in_file->set_last_timestamp(m_last_timestamp + (block.m_num_frames - 1) * frame_duration);
+
+      if (block.m_simple) {
+        track->previous_timestamp  = m_last_timestamp;
+        track->units_processed    += block.m_num_frames;
+      }
+    }
+
+  } catch (...) {
+    mxwarn(fmt::format("{0} {1} {2}\n",
+                       fmt::format(Y("{0}: an unknown exception occurred."), "kax_reader_c::copy_next_cluster()"),
+                       Y("This usually indicates a damaged file structure."), Y("The file will not be processed further.")));
+    finish_file();
+    return false;
+  }
+
+  return true;
+}
+
 file_status_e
 kax_reader_c::finish_file() {
   flush_packetizers();
@@ -2374,21 +2444,19 @@ kax_reader_c::finish_file() {
 }
 
 void
-kax_reader_c::process_simple_block(KaxCluster *cluster,
-                                   KaxSimpleBlock *block_simple) {
+kax_reader_c::process_simple_block(kax_flat_cluster_c::block_t const &block) {
   int64_t block_duration = -1;
   int64_t block_bref     = VFT_IFRAME;
   int64_t block_fref     = VFT_NOBFRAME;
 
-  block_simple->SetParent(*cluster);
-  auto block_track     = find_track_by_num(block_simple->TrackNum());
-  auto block_timestamp = mtx::math::to_signed(block_simple->GlobalTimecode()) - m_global_timestamp_offset;
+  auto block_track     = find_track_by_num(block.m_track_number);
+  auto block_timestamp = block.m_timestamp - m_global_timestamp_offset;
 
   if (!block_track) {
-    if (!m_known_bad_track_numbers[block_simple->TrackNum()])
+    if (!m_known_bad_track_numbers[block.m_track_number])
       mxwarn_fn(m_ti.m_fname,
                 fmt::format(Y("A block was found at timestamp {0} for track number {1}. However, no headers were found for that track number. "
-                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block_simple->TrackNum()));
+                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block.m_track_number));
     return;
   }
 
@@ -2402,8 +2470,8 @@ kax_reader_c::process_simple_block(KaxCluster *cluster,
       block_duration = 0;
   }
 
-  auto key_flag         = block_simple->IsKeyframe();
-  auto discardable_flag = block_simple->IsDiscardable();
+  auto key_flag         = block.m_key;
+  auto discardable_flag = block.m_discardable;
 
   if (!key_flag) {
     if (discardable_flag)
@@ -2413,34 +2481,18 @@ kax_reader_c::process_simple_block(KaxCluster *cluster,
   }
 
   m_last_timestamp = block_timestamp;
-  if (0 < block_simple->NumberFrames())
-    m_in_file->set_last_timestamp(m_last_timestamp + (block_simple->NumberFrames() - 1) * frame_duration);
-
-  if ((-1 != block_track->ptzr) && block_track->passthrough) {
-    // The handling for passthrough is a bit different. We don't have
-    // any special cases, e.g. 0 terminating a string for the subs
-    // and stuff. Just pass everything through as it is.
-    size_t i;
-    for (i = 0; block_simple->NumberFrames() > i; ++i) {
-      DataBuffer &data_buffer = block_simple->GetBuffer(i);
-      auto data = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
-      block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
-
-      packet_cptr packet(new packet_t(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref));
-      packet->key_flag         = key_flag;
-      packet->discardable_flag = discardable_flag;
-
-      ptzr(block_track->ptzr).process(packet);
-    }
-
-  } else if (-1 != block_track->ptzr) {
-    size_t i;
-    for (i = 0; i < block_simple->NumberFrames(); i++) {
-      DataBuffer &data_buffer = block_simple->GetBuffer(i);
-      auto data = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
+  if (0 < block.m_num_frames)
+    m_in_file->set_last_timestamp(m_last_timestamp + (block.m_num_frames - 1) * frame_duration);
+
+  if (-1 != block_track->ptzr) {
+    // Passthrough tracks don't have any special cases, e.g. 0
+    // terminating a string for the subs and stuff. Everything is
+    // passed through as it is.
+    for (auto i = 0u; i < block.m_num_frames; ++i) {
+      auto data = m_cluster.borrow_frame(block, i);
       block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
 
-      auto packet              = std::make_shared<packet_t>(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
+      auto packet              = packet_t::create(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
       packet->key_flag         = key_flag;
       packet->discardable_flag = discardable_flag;
 
@@ -2449,33 +2501,23 @@ kax_reader_c::process_simple_block(KaxCluster *cluster,
   }
 
   block_track->previous_timestamp  = m_last_timestamp;
-  block_track->units_processed    += block_simple->NumberFrames();
+  block_track->units_processed    += block.m_num_frames;
 }
 
 void
-kax_reader_c::process_block_group_common(KaxBlockGroup *block_group,
+kax_reader_c::process_block_group_common(kax_flat_cluster_c::block_t const &block,
                                          packet_t *packet,
                                          kax_track_t &block_track) {
-  auto codec_state     = FindChild<KaxCodecState>(block_group);
-  auto discard_padding = FindChild<KaxDiscardPadding>(block_group);
-  auto blockadd        = FindChild<KaxBlockAdditions>(block_group);
+  if (block.m_codec_state.m_data)
+    packet->codec_state = memory_c::clone(block.m_codec_state.m_data, block.m_codec_state.m_size);
 
-  if (codec_state)
-    packet->codec_state = memory_c::clone(codec_state->GetBuffer(), codec_state->GetSize());
+  if (block.m_discard_padding)
+    packet->discard_padding = timestamp_c::ns(*block.m_discard_padding);
 
-  if (discard_padding)
-    packet->discard_padding = timestamp_c::ns(discard_padding->GetValue());
+  auto additions = m_cluster.get_additions(block);
 
-  if (!blockadd)
-    return;
-
-  for (auto &child : *blockadd) {
-    if (!(Is<KaxBlockMore>(child)))
-      continue;
-
-    auto blockmore     = static_cast<KaxBlockMore *>(child);
-    auto blockadd_data = &GetChild<KaxBlockAdditional>(*blockmore);
-    auto blockadded    = memory_c::borrow(blockadd_data->GetBuffer(), blockadd_data->GetSize());
+  for (auto idx = 0u; idx < block.m_num_additions; ++idx) {
+    auto blockadded = memory_c::borrow(const_cast<unsigned char *>(additions[idx].m_data), additions[idx].m_size);
     block_track.content_decoder.reverse(blockadded, CONTENT_ENCODING_SCOPE_BLOCK);
 
     packet->data_adds.push_back(blockadded);
@@ -2483,33 +2525,26 @@ kax_reader_c::process_block_group_common(KaxBlockGroup *block_group,
 }
 
 void
-kax_reader_c::process_block_group(KaxCluster *cluster,
-                                  KaxBlockGroup *block_group) {
-  auto block = FindChild<KaxBlock>(block_group);
-  if (!block)
-    return;
-
-  block->SetParent(*cluster);
-  auto block_track     = find_track_by_num(block->TrackNum());
-  auto block_timestamp = mtx::math::to_signed(block->GlobalTimecode()) - m_global_timestamp_offset;
+kax_reader_c::process_block_group(kax_flat_cluster_c::block_t const &block) {
+  auto block_track     = find_track_by_num(block.m_track_number);
+  auto block_timestamp = block.m_timestamp - m_global_timestamp_offset;
 
   if (!block_track) {
-    if (!m_known_bad_track_numbers[block->TrackNum()])
+    if (!m_known_bad_track_numbers[block.m_track_number])
       mxwarn_fn(m_ti.m_fname,
                 fmt::format(Y("A block was found at timestamp {0} for track number {1}. However, no headers were found for that track number. "
-                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block->TrackNum()));
+                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block.m_track_number));
     return;
   }
 
-  auto duration       = FindChild<KaxBlockDuration>(block_group);
-  auto block_duration = duration                      ? static_cast<int64_t>(duration->GetValue() * m_tc_scale / block->NumberFrames())
+  auto block_duration = block.m_duration              ? static_cast<int64_t>(*block.m_duration / std::max<std::size_t>(block.m_num_frames, 1))
                       : block_track->default_duration ? block_track->default_duration
                       :                                 int64_t{-1};
   auto frame_duration = -1 == block_duration          ? int64_t{0} : block_duration;
   m_last_timestamp    = block_timestamp;
 
-  if (0 < block->NumberFrames())
-    m_in_file->set_last_timestamp(m_last_timestamp + (block->NumberFrames() - 1) * frame_duration);
+  if (0 < block.m_num_frames)
+    m_in_file->set_last_timestamp(m_last_timestamp + (block.m_num_frames - 1) * frame_duration);
 
   if (-1 == block_track->ptzr)
     return;
@@ -2518,18 +2553,15 @@ kax_reader_c::process_block_group(KaxCluster *cluster,
   auto block_fref = int64_t{VFT_NOBFRAME};
   bool bref_found = false;
   bool fref_found = false;
-  auto ref_block  = FindChild<KaxReferenceBlock>(block_group);
 
-  while (ref_block) {
-    if (0 >= ref_block->GetValue()) {
-      block_bref = ref_block->GetValue() * m_tc_scale;
+  for (auto reference : block.m_references) {
+    if (0 >= reference) {
+      block_bref = reference * m_tc_scale;
       bref_found = true;
     } else {
-      block_fref = ref_block->GetValue() * m_tc_scale;
+      block_fref = reference * m_tc_scale;
       fref_found = true;
     }
-
-    ref_block = FindNextChild(*block_group, *ref_block);
   }
 
   if (block_track->ignore_duration_hack) {
@@ -2538,25 +2570,23 @@ kax_reader_c::process_block_group(KaxCluster *cluster,
       block_duration = 0;
   }
 
+  if (bref_found)
+    block_bref += m_last_timestamp;
+  if (fref_found)
+    block_fref += m_last_timestamp;
+
   if (block_track->passthrough) {
     // The handling for passthrough is a bit different. We don't have
     // any special cases, e.g. 0 terminating a string for the subs
     // and stuff. Just pass everything through as it is.
-    if (bref_found)
-      block_bref += m_last_timestamp;
-    if (fref_found)
-      block_fref += m_last_timestamp;
-
-    size_t i;
-    for (i = 0; i < block->NumberFrames(); i++) {
-      auto &data_buffer = block->GetBuffer(i);
-      auto data         = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
+    for (auto i = 0u; i < block.m_num_frames; i++) {
+      auto data = m_cluster.borrow_frame(block, i);
       block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
 
-      auto packet                = std::make_shared<packet_t>(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
-      packet->duration_mandatory = duration;
+      auto packet                = packet_t::create(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
+      packet->duration_mandatory = !!block.m_duration;
 
-      process_block_group_common(block_group, packet.get(), *block_track);
+      process_block_group_common(block, packet.get(), *block_track);
 
       ptzr(block_track->ptzr).process(packet);
     }
@@ -2564,28 +2594,22 @@ kax_reader_c::process_block_group(KaxCluster *cluster,
     return;
   }
 
-  if (bref_found)
-    block_bref += m_last_timestamp;
-  if (fref_found)
-    block_fref += m_last_timestamp;
-
-  for (auto block_idx = 0u, num_frames = block->NumberFrames(); block_idx < num_frames; ++block_idx) {
-    auto &data_buffer = block->GetBuffer(block_idx);
-    auto data         = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
+  for (auto block_idx = 0u; block_idx < block.m_num_frames; ++block_idx) {
+    auto data = m_cluster.borrow_frame(block, block_idx);
     block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
 
-    auto packet = std::make_shared<packet_t>(data, m_last_timestamp + block_idx * frame_duration, block_duration, block_bref, block_fref);
+    auto packet = packet_t::create(data, m_last_timestamp + block_idx * frame_duration, block_duration, block_bref, block_fref);
 
-    if (duration && !duration->GetValue())
+    if (block.m_duration && !*block.m_duration)
       packet->duration_mandatory = true;
 
-    process_block_group_common(block_group, packet.get(), *block_track);
+    process_block_group_common(block, packet.get(), *block_track);
 
     ptzr(block_track->ptzr).process(packet);
   }
 
   block_track->previous_timestamp  = m_last_timestamp;
-  block_track->units_processed    += block->NumberFrames();
+  block_track->units_processed    += block.m_num_frames;
 }
 
 void
@@ -2615,37 +2639,17 @@ kax_reader_c::determine_minimum_timestamps() {
   for (auto &track : m_tracks)
     tracks_by_number[track->track_number] = track;
 
+  kax_flat_cluster_c cluster;
+  cluster.set_timestamp_scale(m_tc_scale);
+
   while (!done) {
     try {
-      auto cluster = m_in_file->read_next_cluster();
-      if (!cluster)
+      if (!m_in_file->read_next_cluster(cluster))
         break;
 
-      auto cluster_ts = FindChildValue<KaxClusterTimecode>(*cluster);
-      cluster->InitTimecode(cluster_ts, m_tc_scale);
-
-      for (auto const &element : *cluster) {
-        uint64_t track_number{};
-
-        if (Is<KaxSimpleBlock>(element)) {
-          auto block = static_cast<KaxSimpleBlock *>(element);
-          block->SetParent(*cluster);
-
-          last_timestamp = timestamp_c::ns(mtx::math::to_signed(block->GlobalTimecode()));
-          track_number   = block->TrackNum();
-
-        } else if (Is<KaxBlockGroup>(element)) {
-          auto block = FindChild<KaxBlock>(static_cast<KaxBlockGroup *>(element));
-          if (!block)
-            continue;
-
-          block->SetParent(*cluster);
-
-          last_timestamp = timestamp_c::ns(mtx::math::to_signed(block->GlobalTimecode()));
-          track_number   = block->TrackNum();
-
-        } else
-          continue;
+      for (auto const &block : cluster.get_blocks()) {
+        auto track_number = block.m_track_number;
+        last_timestamp    = timestamp_c::ns(block.m_timestamp);
 
         if (!first_timestamp.valid())
           first_timestamp = last_timestamp;
@@ -2859,7 +2863,7 @@ kax_reader_c::identify() {
   }
 
   for (auto &attachment : g_attachments)
-    id_result_attachment(attachment->ui_id, attachment->mime_type, attachment->data->get_size(), attachment->name, attachment->description, attachment->id);
+    id_result_attachment(attachment->ui_id, attachment->mime_type, attachment->get_size(), attachment->name, attachment->description, attachment->id);
 
   if (m_chapters)
     id_result_chapters(mtx::chapters::count_atoms(*m_chapters));
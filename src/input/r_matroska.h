@@ -196,6 +196,9 @@ private:
   int64_t m_tc_scale;
 
   kax_file_cptr m_in_file;
+  kax_flat_cluster_c m_cluster;
+  std::optional<bool> m_cluster_copy_possible;
+  std::unordered_map<uint64_t, generic_packetizer_c *> m_cluster_copy_packetizers;
 
   std::shared_ptr<libebml::EbmlStream> m_es;
 
@@ -219,7 +222,7 @@ private:
 
   bool m_opus_experimental_warning_shown{}, m_regenerate_chapter_uids{};
 
-  debugging_option_c m_debug_minimum_timestamp{"kax_reader|kax_reader_minimum_timestamp"}, m_debug_track_headers{"kax_reader|kax_reader_track_headers"};
+  debugging_option_c m_debug_minimum_timestamp{"kax_reader|kax_reader_minimum_timestamp"}, m_debug_track_headers{"kax_reader|kax_reader_track_headers"}, m_debug_cluster_copy{"kax_reader|kax_reader_cluster_copy"};
 
 public:
   kax_reader_c();
@@ -241,6 +244,8 @@ public:
 protected:
   virtual file_status_e read(generic_packetizer_c *packetizer, bool force = false) override;
   virtual file_status_e finish_file();
+  virtual bool copy_next_cluster() override;
+  virtual bool is_cluster_copy_possible();
 
   virtual void set_track_packetizer(kax_track_t *t, generic_packetizer_c *packetizer);
   virtual void init_passthrough_packetizer(kax_track_t *t, track_info_c &nti);
@@ -318,9 +323,9 @@ protected:
   virtual void read_deferred_level1_elements(libmatroska::KaxSegment &segment);
   virtual void find_level1_elements_via_analyzer();
 
-  virtual void process_simple_block(libmatroska::KaxCluster *cluster, libmatroska::KaxSimpleBlock *block_simple);
-  virtual void process_block_group(libmatroska::KaxCluster *cluster, libmatroska::KaxBlockGroup *block_group);
-  virtual void process_block_group_common(libmatroska::KaxBlockGroup *block_group, packet_t *packet, kax_track_t &track);
+  virtual void process_simple_block(kax_flat_cluster_c::block_t const &block);
+  virtual void process_block_group(kax_flat_cluster_c::block_t const &block);
+  virtual void process_block_group_common(kax_flat_cluster_c::block_t const &block, packet_t *packet, kax_track_t &track);
 
   void init_l1_position_storage(deferred_positions_t &storage);
   virtual bool has_deferred_element_been_processed(deferred_l1_type_e type, int64_t position);
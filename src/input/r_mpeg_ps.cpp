@@ -24,6 +24,7 @@
 #include "common/mp3.h"
 #include "common/mpeg.h"
 #include "common/mpeg1_2.h"
+#include "common/mm_read_buffer_io.h"
 #include "common/path.h"
 #include "common/qt.h"
 #include "common/strings/formatting.h"
@@ -40,6 +41,10 @@
 #include "output/p_truehd.h"
 #include "output/p_vc1.h"
 
+// Pack & PES headers are parsed directly from the read buffer. A large
+// buffer lets most of them be handled without refilling it.
+constexpr auto PS_READ_BUFFER_SIZE = 4 * 1024 * 1024;
+
 bool
 mpeg_ps_reader_c::probe_file() {
   unsigned char buf[4];
@@ -86,52 +91,57 @@ mpeg_ps_reader_c::read_headers() {
 
     if (!m_ti.m_disable_multi_file && Q(mtx::fs::to_path(m_ti.m_fname).filename()).contains(QRegularExpression{"^vts_\\d+_\\d+", QRegularExpression::CaseInsensitiveOption})) {
       m_in.reset();               // Close the source file first before opening it a second time.
-      m_in = mm_multi_file_io_c::open_multi(m_ti.m_fname, false);
-    }
+      m_in = std::make_shared<mm_read_buffer_io_c>(mm_multi_file_io_c::open_multi(m_ti.m_fname, false), PS_READ_BUFFER_SIZE);
+
+    } else if (auto buffered_in = dynamic_cast<mm_read_buffer_io_c *>(m_in.get()); buffered_in)
+      buffered_in->set_buffer_size(PS_READ_BUFFER_SIZE);
 
     m_size          = m_in->get_size();
     m_probe_range   = calculate_probe_range(m_size, 10 * 1024 * 1024);
-    uint32_t header = m_in->read_uint32_be();
+    uint32_t header = m_in->fast_read_uint32_be();
     bool done       = m_in->eof();
     version         = -1;
 
+    // Walk the probe range once, remembering where the PES packets of
+    // each stream are. The streams' types are determined afterwards.
     while (!done) {
       uint8_t stream_id;
       uint16_t pes_packet_length;
+      uint64_t packet_pos;
 
       switch (header) {
         case mtx::mpeg1_2::PACKET_START_CODE:
           mxdebug_if(m_debug_headers, fmt::format("mpeg_ps: packet start at {0}\n", m_in->getFilePointer() - 4));
 
           if (-1 == version) {
-            byte = m_in->read_uint8();
+            byte = m_in->fast_read_uint8();
             if ((byte & 0xc0) != 0)
               version = 2;      // MPEG-2 PS
             else
               version = 1;
-            m_in->skip(-1);
+            m_in->fast_skip(-1);
           }
 
-          m_in->skip(2 * 4);   // pack header
+          m_in->fast_skip(2 * 4);   // pack header
           if (2 == version) {
-            m_in->skip(1);
-            byte = m_in->read_uint8() & 0x07;
-            m_in->skip(byte);  // stuffing bytes
+            m_in->fast_skip(1);
+            byte = m_in->fast_read_uint8() & 0x07;
+            m_in->fast_skip(byte);  // stuffing bytes
           }
-          header = m_in->read_uint32_be();
+          header = m_in->fast_read_uint32_be();
           break;
 
         case mtx::mpeg1_2::SYSTEM_HEADER_START_CODE:
           mxdebug_if(m_debug_headers, fmt::format("mpeg_ps: system header start code at {0}\n", m_in->getFilePointer() - 4));
 
-          m_in->skip(2 * 4);   // system header
-          byte = m_in->read_uint8();
+          m_in->fast_skip(2 * 4);   // system header
+          byte = m_in->fast_read_uint8();
           while ((byte & 0x80) == 0x80) {
-            m_in->skip(2);     // P-STD info
-            byte = m_in->read_uint8();
+            m_in->fast_skip(2);     // P-STD info
+            byte = m_in->fast_read_uint8();
           }
-          m_in->skip(-1);
-          header = m_in->read_uint32_be();
+          m_in->fast_skip(-1);
+          header = m_in->fast_read_uint32_be();
           break;
 
         case mtx::mpeg1_2::MPEG_PROGRAM_END_CODE:
@@ -150,17 +160,21 @@ mpeg_ps_reader_c::read_headers() {
             break;
           }
 
-          stream_id = header & 0xff;
-          m_in->save_pos();
-          found_new_stream(stream_id);
-          m_in->restore_pos();
-          pes_packet_length = m_in->read_uint16_be();
+          stream_id         = header & 0xff;
+          packet_pos        = m_in->getFilePointer() - 4;
+          pes_packet_length = m_in->fast_read_uint16_be();
+
+          mxdebug_if(m_debug_headers, fmt::format("mpeg_ps: id 0x{0:02x} len {1} at {2}\n", static_cast<unsigned int>(stream_id), pes_packet_length, packet_pos));
 
-          mxdebug_if(m_debug_headers, fmt::format("mpeg_ps: id 0x{0:02x} len {1} at {2}\n", static_cast<unsigned int>(stream_id), pes_packet_length, m_in->getFilePointer() - 4 - 2));
+          if (((0xc0 <= stream_id) && (0xef >= stream_id)) || (0xbd == stream_id) || (0xfd == stream_id)) {
+            m_in->fast_skip(-2);
+            add_probe_packet(stream_id);
+            m_in->setFilePointer(packet_pos + 4 + 2 + pes_packet_length);
 
-          m_in->skip(pes_packet_length);
+          } else
+            m_in->fast_skip(pes_packet_length);
 
-          header = m_in->read_uint32_be();
+          header = m_in->fast_read_uint32_be();
 
           break;
       }
@@ -171,6 +185,12 @@ mpeg_ps_reader_c::read_headers() {
   } catch (...) {
   }
 
+  for (auto idx : m_probe_stream_order)
+    found_new_stream(m_probe_streams[idx].m_id);
+
+  m_probe_streams.clear();
+  m_probe_stream_order.clear();
+
   sort_tracks();
   calculate_global_timestamp_offset();
 
@@ -237,8 +257,8 @@ mpeg_ps_reader_c::calculate_global_timestamp_offset() {
 bool
 mpeg_ps_reader_c::read_timestamp(int c,
                                  int64_t &timestamp) {
-  int d = m_in->read_uint16_be();
-  int e = m_in->read_uint16_be();
+  int d = m_in->fast_read_uint16_be();
+  int e = m_in->fast_read_uint16_be();
 
   if (((c & 1) != 1) || ((d & 1) != 1) || ((e & 1) != 1))
     return false;
@@ -273,27 +293,27 @@ mpeg_ps_reader_c::parse_program_stream_map() {
   int64_t pos = m_in->getFilePointer();
 
   try {
-    len = m_in->read_uint16_be();
+    len = m_in->fast_read_uint16_be();
 
     if (!len || (1018 < len))
       throw false;
 
-    m_in->skip(2);
+    m_in->fast_skip(2);
 
-    int prog_len = m_in->read_uint16_be();
-    m_in->skip(prog_len);
+    int prog_len = m_in->fast_read_uint16_be();
+    m_in->fast_skip(prog_len);
 
-    int es_map_len = m_in->read_uint16_be();
+    int es_map_len = m_in->fast_read_uint16_be();
     es_map_len     = std::min(es_map_len, len - prog_len - 8);
 
     while (4 <= es_map_len) {
-      int type   = m_in->read_uint8();
-      int id     = m_in->read_uint8();
+      int type   = m_in->fast_read_uint8();
+      int id     = m_in->fast_read_uint8();
       es_map[id] = type;
 
-      int plen = m_in->read_uint16_be();
+      int plen = m_in->fast_read_uint16_be();
       plen     = std::min(plen, es_map_len);
-      m_in->skip(plen);
+      m_in->fast_skip(plen);
       es_map_len -= 4 + plen;
     }
 
@@ -309,20 +329,20 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
   mpeg_ps_packet_c packet{id};
 
   packet.m_id.sub_id   = 0;
-  packet.m_length      = m_in->read_uint16_be();
+  packet.m_length      = m_in->fast_read_uint16_be();
   packet.m_full_length = packet.m_length;
 
   if (    (0xbc >  packet.m_id.id)
       || ((0xf0 <= packet.m_id.id) && (0xfd != packet.m_id.id))
       ||  (0xbf == packet.m_id.id)) {        // private 2 stream
-    m_in->skip(packet.m_length);
+    m_in->fast_skip(packet.m_length);
     return packet;
   }
 
   if (0xbe == packet.m_id.id) {        // padding stream
     int64_t pos = m_in->getFilePointer();
-    m_in->skip(packet.m_length);
-    uint32_t header = m_in->read_uint32_be();
+    m_in->fast_skip(packet.m_length);
+    uint32_t header = m_in->fast_read_uint32_be();
     if (mtx::mpeg::is_start_code(header))
       m_in->setFilePointer(pos + packet.m_length);
 
@@ -346,7 +366,7 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
   uint8_t c = 0;
   // Skip stuFFing bytes
   while (0 < packet.m_length) {
-    c = m_in->read_uint8();
+    c = m_in->fast_read_uint8();
     packet.m_length--;
     if (c != 0xff)
       break;
@@ -357,8 +377,8 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
     if (2 > packet.m_length)
       return packet;
     packet.m_length -= 2;
-    m_in->skip(1);
-    c = m_in->read_uint8();
+    m_in->fast_skip(1);
+    c = m_in->fast_read_uint8();
   }
 
   // Presentation time stamp
@@ -368,7 +388,7 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
     packet.m_length -= 4;
 
   } else if ((c & 0xf0) == 0x30) {
-    if ((9 > packet.m_length) || !read_timestamp(c, packet.m_pts) || !read_timestamp(m_in->read_uint8(), packet.m_dts))
+    if ((9 > packet.m_length) || !read_timestamp(c, packet.m_pts) || !read_timestamp(m_in->fast_read_uint8(), packet.m_dts))
       return packet;
     packet.m_length -= 4 + 5;
 
@@ -379,8 +399,8 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
     if (2 > packet.m_length)
       return packet;
 
-    unsigned int flags   = m_in->read_uint8();
-    unsigned int hdrlen  = m_in->read_uint8();
+    unsigned int flags   = m_in->fast_read_uint8();
+    unsigned int hdrlen  = m_in->fast_read_uint8();
     packet.m_length     -= 2;
 
     if (hdrlen > packet.m_length)
@@ -442,7 +462,7 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
     if (0xbd == packet.m_id.id) {        // DVD audio substream
       if (4 > packet.m_length)
         return packet;
-      packet.m_id.sub_id = m_in->read_uint8();
+      packet.m_id.sub_id = m_in->fast_read_uint8();
       packet.m_length--;
 
       if ((packet.m_id.sub_id & 0xe0) == 0x20)
@@ -456,7 +476,7 @@ mpeg_ps_reader_c::parse_packet(mpeg_ps_id_t id,
         if (audio_header_len > packet.m_length)
           return packet;
 
-        m_in->skip(audio_header_len);
+        m_in->fast_skip(audio_header_len);
         packet.m_length -= audio_header_len;
       }
     }
@@ -484,9 +504,10 @@ mpeg_ps_reader_c::new_stream_v_avc_or_mpeg_1_2(mpeg_ps_id_t id,
                                                unsigned char *buf,
                                                unsigned int length,
                                                mpeg_ps_track_ptr &track) {
-  try {
-    m_in->save_pos();
+  auto &probe_stream = m_probe_streams[id.idx()];
+  auto first_packet  = probe_stream.m_next_packet;
 
+  try {
     mtx::bytes::buffer_c buffer;
     buffer.add(buf, length);
 
@@ -502,19 +523,16 @@ mpeg_ps_reader_c::new_stream_v_avc_or_mpeg_1_2(mpeg_ps_id_t id,
     int pos                    = 0;
 
     while (4 > buffer.get_size()) {
-      if (!find_next_packet_for_id(id, m_probe_range))
-        throw false;
-
-      auto packet = parse_packet(id);
+      auto packet = read_probe_packet(id);
       if (!packet)
-        continue;
+        throw false;
 
       buffer.add(packet.m_buffer->get_buffer(), packet.m_length);
     }
 
     marker = get_uint32_be(buffer.get_buffer());
     if (mtx::avc_hevc::NALU_START_CODE == marker) {
-      m_in->restore_pos();
+      probe_stream.m_next_packet = first_packet;
       new_stream_v_avc(id, buf, length, track);
       return;
     }
@@ -568,25 +586,22 @@ mpeg_ps_reader_c::new_stream_v_avc_or_mpeg_1_2(mpeg_ps_id_t id,
           }
 
           if (mpeg_12_seqhdr_found && mpeg_12_picture_found) {
-            m_in->restore_pos();
+            probe_stream.m_next_packet = first_packet;
             new_stream_v_mpeg_1_2(id, buf, length, track);
             return;
           }
         }
       }
 
-      if (!find_next_packet_for_id(id, m_probe_range))
-        break;
-
-      auto packet = parse_packet(id);
+      auto packet = read_probe_packet(id);
       if (!packet)
-        continue;
+        break;
 
       buffer.add(packet.m_buffer->get_buffer(), packet.m_length);
     }
 
     if (avc_seq_param_found && avc_pic_param_found && (avc_access_unit_found || avc_slice_found)) {
-      m_in->restore_pos();
+      probe_stream.m_next_packet = first_packet;
       new_stream_v_avc(id, buf, length, track);
       return;
     }
@@ -594,7 +609,6 @@ mpeg_ps_reader_c::new_stream_v_avc_or_mpeg_1_2(mpeg_ps_id_t id,
   } catch (...) {
   }
 
-  m_in->restore_pos();
   throw false;
 }
 
@@ -618,16 +632,11 @@ mpeg_ps_reader_c::new_stream_v_mpeg_1_2(mpeg_ps_id_t id,
   MPEG2SequenceHeader seq_hdr;
 
   while (   (MPV_PARSER_STATE_EOS   != state)
-         && (MPV_PARSER_STATE_ERROR != state)
-         && (m_probe_range >= m_in->getFilePointer())) {
-    if (find_next_packet_for_id(id, m_probe_range)) {
-      auto packet = parse_packet(id);
-      if (!packet)
-        break;
-
+         && (MPV_PARSER_STATE_ERROR != state)) {
+    if (auto packet = read_probe_packet(id); packet)
       m2v_parser->WriteData(packet.m_buffer->get_buffer(), packet.m_length);
 
-    } else if (flushed)
+    else if (flushed)
       break;
 
     else {
@@ -702,11 +711,8 @@ mpeg_ps_reader_c::new_stream_v_avc(mpeg_ps_id_t id,
 
   parser.add_bytes(buf, length);
 
-  while (!parser.headers_parsed() && (m_probe_range >= m_in->getFilePointer())) {
-    if (!find_next_packet_for_id(id, m_probe_range))
-      break;
-
-    auto packet = parse_packet(id);
+  while (!parser.headers_parsed()) {
+    auto packet = read_probe_packet(id);
     if (!packet)
       break;
 
@@ -736,11 +742,8 @@ mpeg_ps_reader_c::new_stream_v_vc1(mpeg_ps_id_t id,
 
   parser.add_bytes(buf, length);
 
-  while (!parser.is_sequence_header_available() && (m_probe_range >= m_in->getFilePointer())) {
-    if (!find_next_packet_for_id(id, m_probe_range))
-      break;
-
-    auto packet = parse_packet(id);
+  while (!parser.is_sequence_header_available()) {
+    auto packet = read_probe_packet(id);
     if (!packet)
       break;
 
@@ -787,7 +790,7 @@ mpeg_ps_reader_c::new_stream_a_ac3(mpeg_ps_id_t id,
 
   buffer.add(buf, length);
 
-  while (m_probe_range >= m_in->getFilePointer()) {
+  while (true) {
     mtx::ac3::frame_c header;
 
     if (-1 != header.find_in(buffer.get_buffer(), buffer.get_size())) {
@@ -803,17 +806,12 @@ mpeg_ps_reader_c::new_stream_a_ac3(mpeg_ps_id_t id,
       return;
     }
 
-    if (!find_next_packet_for_id(id, m_probe_range))
+    auto packet = read_probe_packet(id);
+    if (!packet)
       throw false;
 
-    auto packet = parse_packet(id);
-    if (!packet || (id.sub_id != packet.m_id.sub_id))
-      continue;
-
     buffer.add(packet.m_buffer->get_buffer(), packet.m_length);
   }
-
-  throw false;
 }
 
 void
@@ -825,14 +823,11 @@ mpeg_ps_reader_c::new_stream_a_dts(mpeg_ps_id_t id,
 
   buffer.add(buf, length);
 
-  while ((-1 == mtx::dts::find_header(buffer.get_buffer(), buffer.get_size(), track->dts_header, false)) && (m_probe_range >= m_in->getFilePointer())) {
-    if (!find_next_packet_for_id(id, m_probe_range))
+  while (-1 == mtx::dts::find_header(buffer.get_buffer(), buffer.get_size(), track->dts_header, false)) {
+    auto packet = read_probe_packet(id);
+    if (!packet)
       throw false;
 
-    auto packet = parse_packet(id);
-    if (!packet || (id.sub_id != packet.m_id.sub_id))
-      continue;
-
     buffer.add(packet.m_buffer->get_buffer(), packet.m_length);
   }
 
@@ -868,16 +863,10 @@ mpeg_ps_reader_c::new_stream_a_truehd(mpeg_ps_id_t id,
       return;
     }
 
-    if (m_probe_range < m_in->getFilePointer())
-      throw false;
-
-    if (!find_next_packet_for_id(id, m_probe_range))
+    auto packet = read_probe_packet(id);
+    if (!packet)
       throw false;
 
-    auto packet = parse_packet(id);
-    if (!packet || (id.sub_id != packet.m_id.sub_id))
-      continue;
-
     parser.add_data(packet.m_buffer->get_buffer(), packet.m_length);
   }
 }
@@ -933,12 +922,10 @@ mpeg_ps_reader_c::found_new_stream(mpeg_ps_id_t id) {
     return;
 
   try {
-    auto packet = parse_packet(id);
+    auto packet = read_probe_packet(id);
     if (!packet)
       throw false;
 
-    id = packet.m_id;
-
     if (0xbd == id.id) {        // DVD audio substream
       mxdebug_if(m_debug_headers, fmt::format("MPEG PS:   audio substream id 0x{0:02x}\n", id.sub_id));
       if (0 == id.sub_id)
@@ -953,16 +940,16 @@ mpeg_ps_reader_c::found_new_stream(mpeg_ps_id_t id) {
     if (mtx::includes(m_blocked_ids, id.idx()))
       return;
 
-    int64_t timestamp_for_offset = packet.pts();
-    if (std::numeric_limits<int64_t>::max() == timestamp_for_offset)
-      timestamp_for_offset = -1;
+    // The first timestamp found for the stream within the probe range.
+    int64_t timestamp_for_offset = -1;
+    for (auto const &probe_packet : m_probe_streams[id.idx()].m_packets)
+      if (-1 != probe_packet.m_pts) {
+        timestamp_for_offset = probe_packet.m_pts;
+        break;
+      }
 
-    if (mtx::includes(id2idx, id.idx())) {
-      mpeg_ps_track_ptr &track = tracks[id2idx[id.idx()]];
-      if ((-1 != timestamp_for_offset) && (-1 == track->timestamp_offset))
-        track->timestamp_offset = timestamp_for_offset;
+    if (mtx::includes(id2idx, id.idx()))
       return;
-    }
 
     mpeg_ps_track_ptr track(new mpeg_ps_track_t);
     track->timestamp_offset = timestamp_for_offset;
@@ -1089,7 +1076,7 @@ mpeg_ps_reader_c::find_next_packet(mpeg_ps_id_t &id,
   try {
     uint32_t header;
 
-    header = m_in->read_uint32_be();
+    header = m_in->fast_read_uint32_be();
     while (1) {
       uint8_t byte;
 
@@ -1099,32 +1086,32 @@ mpeg_ps_reader_c::find_next_packet(mpeg_ps_id_t &id,
       switch (header) {
         case mtx::mpeg1_2::PACKET_START_CODE:
           if (-1 == version) {
-            byte = m_in->read_uint8();
+            byte = m_in->fast_read_uint8();
             if ((byte & 0xc0) != 0)
               version = 2;      // MPEG-2 PS
             else
               version = 1;
-            m_in->skip(-1);
+            m_in->fast_skip(-1);
           }
 
-          m_in->skip(2 * 4);   // pack header
+          m_in->fast_skip(2 * 4);   // pack header
           if (2 == version) {
-            m_in->skip(1);
-            byte = m_in->read_uint8() & 0x07;
-            m_in->skip(byte);  // stuffing bytes
+            m_in->fast_skip(1);
+            byte = m_in->fast_read_uint8() & 0x07;
+            m_in->fast_skip(byte);  // stuffing bytes
           }
-          header = m_in->read_uint32_be();
+          header = m_in->fast_read_uint32_be();
           break;
 
         case mtx::mpeg1_2::SYSTEM_HEADER_START_CODE:
-          m_in->skip(2 * 4);   // system header
-          byte = m_in->read_uint8();
+          m_in->fast_skip(2 * 4);   // system header
+          byte = m_in->fast_read_uint8();
           while ((byte & 0x80) == 0x80) {
-            m_in->skip(2);     // P-STD info
-            byte = m_in->read_uint8();
+            m_in->fast_skip(2);     // P-STD info
+            byte = m_in->fast_read_uint8();
           }
-          m_in->skip(-1);
-          header = m_in->read_uint32_be();
+          m_in->fast_skip(-1);
+          header = m_in->fast_read_uint32_be();
           break;
 
         case mtx::mpeg1_2::MPEG_PROGRAM_END_CODE:
@@ -1156,19 +1143,47 @@ mpeg_ps_reader_c::find_next_packet(mpeg_ps_id_t &id,
   }
 }
 
-bool
-mpeg_ps_reader_c::find_next_packet_for_id(mpeg_ps_id_t id,
-                                          int64_t max_file_pos) {
+void
+mpeg_ps_reader_c::add_probe_packet(mpeg_ps_id_t id) {
+  auto packet = parse_packet(id, false);
+  if (!packet || !packet.m_length)
+    return;
+
+  auto idx = packet.m_id.idx();
+  auto itr = m_probe_streams.find(idx);
+
+  if (itr == m_probe_streams.end()) {
+    itr = m_probe_streams.emplace(idx, mpeg_ps_probe_stream_t{}).first;
+    itr->second.m_id = packet.m_id;
+    m_probe_stream_order.push_back(idx);
+  }
+
+  itr->second.m_packets.push_back({ m_in->getFilePointer(), packet.m_length, packet.m_pts, packet.m_dts });
+}
+
+mpeg_ps_packet_c
+mpeg_ps_reader_c::read_probe_packet(mpeg_ps_id_t id) {
+  mpeg_ps_packet_c packet{id};
+
+  auto itr = m_probe_streams.find(id.idx());
+  if ((itr == m_probe_streams.end()) || (itr->second.m_next_packet >= itr->second.m_packets.size()))
+    return packet;
+
+  auto &probe_packet   = itr->second.m_packets[itr->second.m_next_packet++];
+  packet.m_pts         = probe_packet.m_pts;
+  packet.m_dts         = probe_packet.m_dts;
+  packet.m_length      = probe_packet.m_length;
+  packet.m_full_length = probe_packet.m_length;
+
   try {
-    mpeg_ps_id_t new_id;
-    while (find_next_packet(new_id, max_file_pos)) {
-      if (id.id == new_id.id)
-        return true;
-      m_in->skip(m_in->read_uint16_be());
-    }
-  } catch(...) {
+    m_in->setFilePointer(probe_packet.m_position);
+    packet.m_buffer = memory_c::alloc(packet.m_length);
+    packet.m_valid  = m_in->read(packet.m_buffer, packet.m_length) == packet.m_length;
+
+  } catch (mtx::mm_io::exception &) {
   }
-  return false;
+
+  return packet;
 }
 
 bool
@@ -1178,7 +1193,7 @@ mpeg_ps_reader_c::resync_stream(uint32_t &header) {
   try {
     while (1) {
       header <<= 8;
-      header  |= m_in->read_uint8();
+      header  |= m_in->fast_read_uint8();
       if (mtx::mpeg::is_start_code(header))
         break;
     }
@@ -1320,12 +1335,12 @@ mpeg_ps_reader_c::read(generic_packetizer_c *requested_ptzr,
       if (track->skip_packet_data_bytes) {
         auto bytes_to_skip = std::min(packet.m_length, track->skip_packet_data_bytes);
         packet.m_length   -= bytes_to_skip;
-        m_in->skip(bytes_to_skip);
+        m_in->fast_skip(bytes_to_skip);
       }
 
       if (0 < track->buffer_size) {
         if (((track->buffer_usage + packet.m_length) > track->buffer_size)) {
-          auto new_packet = std::make_shared<packet_t>(memory_c::borrow(track->buffer, track->buffer_usage));
+          auto new_packet = packet_t::create(memory_c::borrow(track->buffer, track->buffer_usage));
 
           if (!track->multiple_timestamps_packet_extension->empty()) {
             new_packet->extensions.push_back(packet_extension_cptr(track->multiple_timestamps_packet_extension));
@@ -1356,7 +1371,7 @@ mpeg_ps_reader_c::read(generic_packetizer_c *requested_ptzr,
           return finish();
         }
 
-        ptzr(track->ptzr).process(std::make_shared<packet_t>(buf, timestamp));
+        ptzr(track->ptzr).process(packet_t::create(buf, timestamp));
       }
 
       return FILE_STATUS_MOREDATA;
@@ -1377,7 +1392,7 @@ mpeg_ps_reader_c::finish() {
 
   for (auto &track : tracks)
     if (0 < track->buffer_usage)
-      ptzr(track->ptzr).process(std::make_shared<packet_t>(memory_c::clone(track->buffer, track->buffer_usage)));
+      ptzr(track->ptzr).process(packet_t::create(memory_c::clone(track->buffer, track->buffer_usage)));
 
   file_done = true;
 
@@ -176,6 +176,21 @@ struct mpeg_ps_track_t {
 };
 using mpeg_ps_track_ptr = std::shared_ptr<mpeg_ps_track_t>;
 
+// A PES packet found while scanning the probe range in read_headers().
+// Only the position & the length of its payload are kept; the payload
+// itself is read when the stream's type is probed.
+struct mpeg_ps_probe_packet_t {
+  uint64_t m_position{};
+  unsigned int m_length{};
+  int64_t m_pts{-1}, m_dts{-1};
+};
+
+struct mpeg_ps_probe_stream_t {
+  mpeg_ps_id_t m_id;
+  std::vector<mpeg_ps_probe_packet_t> m_packets;
+  std::size_t m_next_packet{};
+};
+
 inline bool
 operator <(mpeg_ps_track_ptr const &a,
            mpeg_ps_track_ptr const &b) {
@@ -198,6 +213,9 @@ private:
 
   uint64_t m_probe_range{};
 
+  std::unordered_map<unsigned int, mpeg_ps_probe_stream_t> m_probe_streams;
+  std::vector<unsigned int> m_probe_stream_order;
+
   debugging_option_c
       m_debug_timestamps{"mpeg_ps|mpeg_ps_timestamps"}
     , m_debug_headers{   "mpeg_ps|mpeg_ps_headers"}
@@ -221,7 +239,6 @@ public:
   virtual bool read_timestamp(int c, int64_t &timestamp);
   virtual mpeg_ps_packet_c parse_packet(mpeg_ps_id_t id, bool read_data = true);
   virtual bool find_next_packet(mpeg_ps_id_t &id, int64_t max_file_pos = -1);
-  virtual bool find_next_packet_for_id(mpeg_ps_id_t id, int64_t max_file_pos = -1);
 
   virtual void parse_program_stream_map();
 
@@ -240,6 +257,8 @@ private:
   virtual void new_stream_a_pcm(mpeg_ps_id_t id, unsigned char *buf, unsigned int length, mpeg_ps_track_ptr &track);
   virtual void new_stream_a_truehd(mpeg_ps_id_t id, unsigned char *buf, unsigned int length, mpeg_ps_track_ptr &track);
   virtual bool resync_stream(uint32_t &header);
+  void add_probe_packet(mpeg_ps_id_t id);
+  mpeg_ps_packet_c read_probe_packet(mpeg_ps_id_t id);
   virtual file_status_e finish();
   void sort_tracks();
   void calculate_global_timestamp_offset();
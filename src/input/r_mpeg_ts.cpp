@@ -153,7 +153,7 @@ track_c::send_to_packetizer() {
                          pid, pes_payload_size_to_read, pes_payload_read->get_size() - bytes_to_skip, timestamp_to_use, timestamp_to_check, m_timestamp, m_previous_timestamp, f.m_stream_timestamp, min, max, f.m_timestamp_restriction_min_seen, ptzr, use_packet));
 
   if (use_packet) {
-    process(std::make_shared<packet_t>(memory_c::clone(pes_payload_read->get_buffer() + bytes_to_skip, pes_payload_read->get_size() - bytes_to_skip), timestamp_to_use.to_ns(-1)));
+    process(packet_t::create(memory_c::clone(pes_payload_read->get_buffer() + bytes_to_skip, pes_payload_read->get_size() - bytes_to_skip), timestamp_to_use.to_ns(-1)));
 
     f.m_packet_sent_to_packetizer = true;
   }
@@ -2318,7 +2318,9 @@ reader_c::create_ac3_audio_packetizer(track_ptr const &track) {
 
 void
 reader_c::create_pcm_audio_packetizer(track_ptr const &track) {
-  track->ptzr = add_packetizer(new pcm_packetizer_c(this, m_ti, track->a_sample_rate, track->a_channels, track->a_bits_per_sample, pcm_packetizer_c::big_endian_integer));
+  // The Blu-ray PCM converter already converts the samples to little endian.
+  auto format = track->converter ? pcm_packetizer_c::little_endian_integer : pcm_packetizer_c::big_endian_integer;
+  track->ptzr = add_packetizer(new pcm_packetizer_c(this, m_ti, track->a_sample_rate, track->a_channels, track->a_bits_per_sample, format));
 
   if (track->converter)
     track->converter->set_packetizer(&ptzr(track->ptzr));
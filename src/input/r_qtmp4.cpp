@@ -168,11 +168,11 @@ bool
 qtmp4_reader_c::probe_file() {
   while (true) {
     uint64_t atom_pos  = m_in->getFilePointer();
-    uint64_t atom_size = m_in->read_uint32_be();
+    uint64_t atom_size = m_in->fast_read_uint32_be();
     fourcc_c atom(*m_in);
 
     if (1 == atom_size)
-      atom_size = m_in->read_uint64_be();
+      atom_size = m_in->fast_read_uint64_be();
 
     if (   (atom == "moov")
         || (atom == "ftyp")
@@ -444,7 +444,7 @@ qtmp4_reader_c::handle_cmov_atom(qt_atom_t parent,
 void
 qtmp4_reader_c::handle_cmvd_atom(qt_atom_t atom,
                                  int level) {
-  uint32_t moov_size = m_in->read_uint32_be();
+  uint32_t moov_size = m_in->fast_read_uint32_be();
   mxdebug_if(m_debug_headers, fmt::format("{0}Uncompressed size: {1}\n", space((level + 1) * 2 + 1), moov_size));
 
   if (m_compression_algorithm != "zlib")
@@ -503,10 +503,10 @@ void
 qtmp4_reader_c::handle_ctts_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  auto version = m_in->read_uint8();
-  m_in->skip(3);                // version & flags
+  auto version = m_in->fast_read_uint8();
+  m_in->fast_skip(3);                // version & flags
 
-  auto count = m_in->read_uint32_be();
+  auto count = m_in->fast_read_uint32_be();
   mxdebug_if(m_debug_headers, fmt::format("{0}Frame offset table v{2}: {1} raw entries\n", space(level * 2 + 1), count, static_cast<unsigned int>(version)));
 
   dmx.raw_frame_offset_table.reserve(dmx.raw_frame_offset_table.size() + count);
@@ -515,8 +515,8 @@ qtmp4_reader_c::handle_ctts_atom(qtmp4_demuxer_c &dmx,
   for (i = 0; i < count; ++i) {
     qt_frame_offset_t frame_offset;
 
-    frame_offset.count  = m_in->read_uint32_be();
-    frame_offset.offset = mtx::math::to_signed(m_in->read_uint32_be());
+    frame_offset.count  = m_in->fast_read_uint32_be();
+    frame_offset.offset = mtx::math::to_signed(m_in->fast_read_uint32_be());
     dmx.raw_frame_offset_table.push_back(frame_offset);
   }
 
@@ -533,16 +533,16 @@ void
 qtmp4_reader_c::handle_sgpd_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  auto version = m_in->read_uint8();
-  m_in->skip(3);                // flags
+  auto version = m_in->fast_read_uint8();
+  m_in->fast_skip(3);                // flags
 
   auto grouping_type              = fourcc_c{m_in};
-  auto default_description_length = version == 1 ? m_in->read_uint32_be() : uint32_t{};
+  auto default_description_length = version == 1 ? m_in->fast_read_uint32_be() : uint32_t{};
 
   if (version >= 2)
-    m_in->skip(4);              // default_sample_description_index
+    m_in->fast_skip(4);              // default_sample_description_index
 
-  auto count = m_in->read_uint32_be();
+  auto count = m_in->fast_read_uint32_be();
 
   mxdebug_if(m_debug_headers, fmt::format("{0}Sample group description table: version {1}, type '{2}', {3} raw entries\n", space(level * 2 + 2), static_cast<unsigned int>(version), grouping_type, count));
 
@@ -553,9 +553,9 @@ qtmp4_reader_c::handle_sgpd_atom(qtmp4_demuxer_c &dmx,
 
   for (auto idx = 0u; idx < count; ++idx) {
     if ((version == 1) && (default_description_length == 0))
-      m_in->skip(4);            // description_length
+      m_in->fast_skip(4);            // description_length
 
-    auto byte                      = m_in->read_uint8();
+    auto byte                      = m_in->fast_read_uint8();
     auto num_leading_samples_known = (byte & 0x80) == 0x80;
     auto num_leading_samples       = static_cast<unsigned int>(byte & 0x7f);
 
@@ -575,15 +575,15 @@ void
 qtmp4_reader_c::handle_sbgp_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  auto version = m_in->read_uint8();
-  m_in->skip(3);                // flags
+  auto version = m_in->fast_read_uint8();
+  m_in->fast_skip(3);                // flags
 
   auto grouping_type = fourcc_c{m_in};
 
   if (version == 1)
-    m_in->skip(4);              // grouping_type_parameter
+    m_in->fast_skip(4);              // grouping_type_parameter
 
-  auto count = m_in->read_uint32_be();
+  auto count = m_in->fast_read_uint32_be();
 
   mxdebug_if(m_debug_headers, fmt::format("{0}Sample to group table: version {1}, type '{2}', {3} raw entries\n", space(level * 2 + 2), static_cast<unsigned int>(version), grouping_type, count));
 
@@ -591,8 +591,8 @@ qtmp4_reader_c::handle_sbgp_atom(qtmp4_demuxer_c &dmx,
   table.reserve(table.size() + count);
 
   for (auto idx = 0u; idx < count; ++idx) {
-    auto sample_count            = m_in->read_uint32_be();
-    auto group_description_index = m_in->read_uint32_be();
+    auto sample_count            = m_in->fast_read_uint32_be();
+    auto group_description_index = m_in->fast_read_uint32_be();
 
     table.emplace_back(sample_count, group_description_index);
   }
@@ -609,7 +609,7 @@ qtmp4_reader_c::handle_sbgp_atom(qtmp4_demuxer_c &dmx,
 void
 qtmp4_reader_c::handle_dcom_atom(qt_atom_t,
                                  int level) {
-  m_compression_algorithm = fourcc_c{m_in->read_uint32_be()};
+  m_compression_algorithm = fourcc_c{m_in->fast_read_uint32_be()};
   mxdebug_if(m_debug_headers, fmt::format("{0}Compression algorithm: {1}\n", space(level * 2 + 1), m_compression_algorithm));
 }
 
@@ -645,7 +645,7 @@ qtmp4_reader_c::handle_mdhd_atom(qtmp4_demuxer_c &dmx,
   if (1 > atom.size)
     print_atom_too_small_error("mdhd", atom, sizeof(mdhd_atom_t));
 
-  int version = m_in->read_uint8();
+  int version = m_in->fast_read_uint8();
 
   if (0 == version) {
     mdhd_atom_t mdhd;
@@ -749,14 +749,14 @@ qtmp4_reader_c::handle_mvex_atom(qt_atom_t parent,
 void
 qtmp4_reader_c::handle_trex_atom(qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);            // Version, flags
+  m_in->fast_skip(1 + 3);            // Version, flags
 
-  auto track_id                  = m_in->read_uint32_be();
+  auto track_id                  = m_in->fast_read_uint32_be();
   auto &defaults                 = m_track_defaults[track_id];
-  defaults.sample_description_id = m_in->read_uint32_be();
-  defaults.sample_duration       = m_in->read_uint32_be();
-  defaults.sample_size           = m_in->read_uint32_be();
-  defaults.sample_flags          = m_in->read_uint32_be();
+  defaults.sample_description_id = m_in->fast_read_uint32_be();
+  defaults.sample_duration       = m_in->fast_read_uint32_be();
+  defaults.sample_size           = m_in->fast_read_uint32_be();
+  defaults.sample_flags          = m_in->fast_read_uint32_be();
 
   mxdebug_if(m_debug_headers, fmt::format("{0}Sample defaults for track ID {1}: description idx {2} duration {3} size {4} flags {5}\n",
                          space(level * 2 + 1), track_id, defaults.sample_description_id, defaults.sample_duration, defaults.sample_size, defaults.sample_flags));
@@ -799,10 +799,10 @@ qtmp4_reader_c::handle_traf_atom(qt_atom_t parent,
 void
 qtmp4_reader_c::handle_tfhd_atom(qt_atom_t,
                                  int level) {
-  m_in->skip(1);                // Version
+  m_in->fast_skip(1);                // Version
 
-  auto flags     = m_in->read_uint24_be();
-  auto track_id  = m_in->read_uint32_be();
+  auto flags     = m_in->fast_read_uint24_be();
+  auto track_id  = m_in->fast_read_uint32_be();
   auto track_itr = std::find_if(m_demuxers.begin(), m_demuxers.end(), [track_id](qtmp4_demuxer_cptr const &dmx) { return dmx->container_id == track_id; });
 
   if (!track_id || !mtx::includes(m_track_defaults, track_id) || (m_demuxers.end() == track_itr)) {
@@ -821,13 +821,13 @@ qtmp4_reader_c::handle_tfhd_atom(qt_atom_t,
   fragment.track_id              = track_id;
   fragment.moof_offset           = m_moof_offset;
   fragment.implicit_offset       = m_fragment_implicit_offset;
-  fragment.base_data_offset      = flags & QTMP4_TFHD_BASE_DATA_OFFSET      ? m_in->read_uint64_be()
+  fragment.base_data_offset      = flags & QTMP4_TFHD_BASE_DATA_OFFSET      ? m_in->fast_read_uint64_be()
                                  : flags & QTMP4_TFHD_DEFAULT_BASE_IS_MOOF  ? fragment.moof_offset
                                  :                                            fragment.implicit_offset;
-  fragment.sample_description_id = flags & QTMP4_TFHD_SAMPLE_DESCRIPTION_ID ? m_in->read_uint32_be() : defaults.sample_description_id;
-  fragment.sample_duration       = flags & QTMP4_TFHD_DEFAULT_DURATION      ? m_in->read_uint32_be() : defaults.sample_duration;
-  fragment.sample_size           = flags & QTMP4_TFHD_DEFAULT_SIZE          ? m_in->read_uint32_be() : defaults.sample_size;
-  fragment.sample_flags          = flags & QTMP4_TFHD_DEFAULT_FLAGS         ? m_in->read_uint32_be() : defaults.sample_flags;
+  fragment.sample_description_id = flags & QTMP4_TFHD_SAMPLE_DESCRIPTION_ID ? m_in->fast_read_uint32_be() : defaults.sample_description_id;
+  fragment.sample_duration       = flags & QTMP4_TFHD_DEFAULT_DURATION      ? m_in->fast_read_uint32_be() : defaults.sample_duration;
+  fragment.sample_size           = flags & QTMP4_TFHD_DEFAULT_SIZE          ? m_in->fast_read_uint32_be() : defaults.sample_size;
+  fragment.sample_flags          = flags & QTMP4_TFHD_DEFAULT_FLAGS         ? m_in->fast_read_uint32_be() : defaults.sample_flags;
 
   m_fragment           = &fragment;
   m_track_for_fragment = &track;
@@ -846,16 +846,16 @@ qtmp4_reader_c::handle_trun_atom(qt_atom_t,
     return;
   }
 
-  m_in->skip(1);                // Version
-  auto flags   = m_in->read_uint24_be();
-  auto entries = m_in->read_uint32_be();
+  m_in->fast_skip(1);                // Version
+  auto flags   = m_in->fast_read_uint24_be();
+  auto entries = m_in->fast_read_uint32_be();
   auto &track  = *m_track_for_fragment;
 
   if (track.raw_frame_offset_table.empty() && !track.sample_table.empty())
     track.raw_frame_offset_table.emplace_back(track.sample_table.size(), 0);
 
-  auto data_offset        = flags & QTMP4_TRUN_DATA_OFFSET ? m_in->read_uint32_be() : 0;
-  auto first_sample_flags = flags & QTMP4_TRUN_FIRST_SAMPLE_FLAGS ? m_in->read_uint32_be() : m_fragment->sample_flags;
+  auto data_offset        = flags & QTMP4_TRUN_DATA_OFFSET ? m_in->fast_read_uint32_be() : 0;
+  auto first_sample_flags = flags & QTMP4_TRUN_FIRST_SAMPLE_FLAGS ? m_in->fast_read_uint32_be() : m_fragment->sample_flags;
   auto offset             = m_fragment->base_data_offset + data_offset;
 
   auto calc_reserve_size  = [entries](auto current_size) {
@@ -878,10 +878,10 @@ qtmp4_reader_c::handle_trun_atom(qt_atom_t,
   }
 
   for (auto idx = 0u; idx < entries; ++idx) {
-    auto sample_duration = flags & QTMP4_TRUN_SAMPLE_DURATION   ? m_in->read_uint32_be() : m_fragment->sample_duration;
-    auto sample_size     = flags & QTMP4_TRUN_SAMPLE_SIZE       ? m_in->read_uint32_be() : m_fragment->sample_size;
-    auto sample_flags    = flags & QTMP4_TRUN_SAMPLE_FLAGS      ? m_in->read_uint32_be() : idx > 0 ? m_fragment->sample_flags : first_sample_flags;
-    auto ctts_duration   = flags & QTMP4_TRUN_SAMPLE_CTS_OFFSET ? m_in->read_uint32_be() : 0;
+    auto sample_duration = flags & QTMP4_TRUN_SAMPLE_DURATION   ? m_in->fast_read_uint32_be() : m_fragment->sample_duration;
+    auto sample_size     = flags & QTMP4_TRUN_SAMPLE_SIZE       ? m_in->fast_read_uint32_be() : m_fragment->sample_size;
+    auto sample_flags    = flags & QTMP4_TRUN_SAMPLE_FLAGS      ? m_in->fast_read_uint32_be() : idx > 0 ? m_fragment->sample_flags : first_sample_flags;
+    auto ctts_duration   = flags & QTMP4_TRUN_SAMPLE_CTS_OFFSET ? m_in->fast_read_uint32_be() : 0;
     auto keyframe        = !track.is_video()                    ? true                   : !(sample_flags & (QTMP4_FRAG_SAMPLE_FLAG_IS_NON_SYNC | QTMP4_FRAG_SAMPLE_FLAG_DEPENDS_YES));
 
     track.durmap_table.emplace_back(1, sample_duration);
@@ -967,9 +967,9 @@ qtmp4_reader_c::handle_chpl_atom(qt_atom_t,
   if (m_ti.m_no_chapters || m_chapters)
     return;
 
-  m_in->skip(1 + 3 + 4);          // Version, flags, zero
+  m_in->fast_skip(1 + 3 + 4);          // Version, flags, zero
 
-  int count = m_in->read_uint8();
+  int count = m_in->fast_read_uint8();
   mxdebug_if(m_debug_chapters, fmt::format("{0}Chapter list: {1} entries\n", space(level * 2 + 1), count));
 
   if (0 == count)
@@ -981,8 +981,8 @@ qtmp4_reader_c::handle_chpl_atom(qt_atom_t,
 
   int i;
   for (i = 0; i < count; ++i) {
-    uint64_t timestamp = m_in->read_uint64_be() * 100;
-    memory_cptr buf   = memory_c::alloc(m_in->read_uint8() + 1);
+    uint64_t timestamp = m_in->fast_read_uint64_be() * 100;
+    memory_cptr buf   = memory_c::alloc(m_in->fast_read_uint8() + 1);
     memset(buf->get_buffer(), 0, buf->get_size());
 
     if (m_in->read(buf->get_buffer(), buf->get_size() - 1) != (buf->get_size() - 1))
@@ -998,7 +998,7 @@ qtmp4_reader_c::handle_chpl_atom(qt_atom_t,
 void
 qtmp4_reader_c::handle_meta_atom(qt_atom_t parent,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
+  m_in->fast_skip(1 + 3);        // version & flags
 
   process_atom(parent, level, [&](qt_atom_t const &atom) {
     if (atom.fourcc == "ilst")
@@ -1027,7 +1027,7 @@ qtmp4_reader_c::read_string_atom(qt_atom_t atom,
   std::string string;
   size_t length = atom.size - atom.hsize - num_skipped;
 
-  m_in->skip(num_skipped);
+  m_in->fast_skip(num_skipped);
   m_in->read(string, length);
 
   return string;
@@ -1067,11 +1067,11 @@ qtmp4_reader_c::handle_covr_atom(qt_atom_t parent,
       return;
 
     try {
-      auto type = m_in->read_uint32_be();
+      auto type = m_in->fast_read_uint32_be();
       if (!mtx::included_in<int>(type, mtx::mp4::ATOM_DATA_TYPE_BMP, mtx::mp4::ATOM_DATA_TYPE_JPEG, mtx::mp4::ATOM_DATA_TYPE_PNG))
         return;
 
-      m_in->skip(4);
+      m_in->fast_skip(4);
 
       data_size -= 8;
 
@@ -1235,15 +1235,15 @@ void
 qtmp4_reader_c::handle_stco_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   mxdebug_if(m_debug_headers, fmt::format("{0}Chunk offset table: {1} entries\n", space(level * 2 + 1), count));
 
   dmx.chunk_table.reserve(dmx.chunk_table.size() + count);
 
   for (auto i = 0u; i < count; ++i)
-    dmx.chunk_table.emplace_back(0, m_in->read_uint32_be());
+    dmx.chunk_table.emplace_back(0, m_in->fast_read_uint32_be());
 
   if (!m_debug_tables)
     return;
@@ -1258,15 +1258,15 @@ void
 qtmp4_reader_c::handle_co64_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   mxdebug_if(m_debug_headers, fmt::format("{0}64bit chunk offset table: {1} entries\n", space(level * 2 + 1), count));
 
   dmx.chunk_table.reserve(dmx.chunk_table.size() + count);
 
   for (auto i = 0u; i < count; ++i)
-    dmx.chunk_table.emplace_back(0, m_in->read_uint64_be());
+    dmx.chunk_table.emplace_back(0, m_in->fast_read_uint64_be());
 
   if (!m_debug_tables)
     return;
@@ -1281,8 +1281,8 @@ void
 qtmp4_reader_c::handle_stsc_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
   size_t i;
 
   dmx.chunkmap_table.reserve(dmx.chunkmap_table.size() + count);
@@ -1290,9 +1290,9 @@ qtmp4_reader_c::handle_stsc_atom(qtmp4_demuxer_c &dmx,
   for (i = 0; i < count; ++i) {
     qt_chunkmap_t chunkmap;
 
-    chunkmap.first_chunk           = m_in->read_uint32_be() - 1;
-    chunkmap.samples_per_chunk     = m_in->read_uint32_be();
-    chunkmap.sample_description_id = m_in->read_uint32_be();
+    chunkmap.first_chunk           = m_in->fast_read_uint32_be() - 1;
+    chunkmap.samples_per_chunk     = m_in->fast_read_uint32_be();
+    chunkmap.sample_description_id = m_in->fast_read_uint32_be();
     dmx.chunkmap_table.push_back(chunkmap);
   }
 
@@ -1311,13 +1311,13 @@ void
 qtmp4_reader_c::handle_stsd_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   size_t i;
   for (i = 0; i < count; ++i) {
     int64_t pos   = m_in->getFilePointer();
-    uint32_t size = m_in->read_uint32_be();
+    uint32_t size = m_in->fast_read_uint32_be();
 
     if (4 > size)
       mxerror(fmt::format(Y("Quicktime/MP4 reader: The 'size' field is too small in the stream description atom for track ID {0}.\n"), dmx.id));
@@ -1339,14 +1339,14 @@ void
 qtmp4_reader_c::handle_stss_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   dmx.keyframe_table.reserve(dmx.keyframe_table.size() + count);
 
   size_t i;
   for (i = 0; i < count; ++i)
-    dmx.keyframe_table.push_back(m_in->read_uint32_be());
+    dmx.keyframe_table.push_back(m_in->fast_read_uint32_be());
 
   std::sort(dmx.keyframe_table.begin(), dmx.keyframe_table.end());
 
@@ -1364,9 +1364,9 @@ void
 qtmp4_reader_c::handle_stsz_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t sample_size = m_in->read_uint32_be();
-  uint32_t count       = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t sample_size = m_in->fast_read_uint32_be();
+  uint32_t count       = m_in->fast_read_uint32_be();
 
   if (0 == sample_size) {
     dmx.sample_table.reserve(dmx.sample_table.size() + count);
@@ -1375,7 +1375,7 @@ qtmp4_reader_c::handle_stsz_atom(qtmp4_demuxer_c &dmx,
     for (i = 0; i < count; ++i) {
       qt_sample_t sample;
 
-      sample.size = m_in->read_uint32_be();
+      sample.size = m_in->fast_read_uint32_be();
 
       // This is a sanity check against damaged samples. I have one of
       // those in which one sample was suppposed to be > 2GB big.
@@ -1403,8 +1403,8 @@ void
 qtmp4_reader_c::handle_sttd_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   dmx.durmap_table.reserve(dmx.durmap_table.size() + count);
 
@@ -1412,8 +1412,8 @@ qtmp4_reader_c::handle_sttd_atom(qtmp4_demuxer_c &dmx,
   for (i = 0; i < count; ++i) {
     qt_durmap_t durmap;
 
-    durmap.number   = m_in->read_uint32_be();
-    durmap.duration = m_in->read_uint32_be();
+    durmap.number   = m_in->fast_read_uint32_be();
+    durmap.duration = m_in->fast_read_uint32_be();
     dmx.durmap_table.push_back(durmap);
   }
 
@@ -1431,8 +1431,8 @@ void
 qtmp4_reader_c::handle_stts_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  m_in->skip(1 + 3);        // version & flags
-  uint32_t count = m_in->read_uint32_be();
+  m_in->fast_skip(1 + 3);        // version & flags
+  uint32_t count = m_in->fast_read_uint32_be();
 
   dmx.durmap_table.reserve(dmx.durmap_table.size() + count);
 
@@ -1440,8 +1440,8 @@ qtmp4_reader_c::handle_stts_atom(qtmp4_demuxer_c &dmx,
   for (i = 0; i < count; ++i) {
     qt_durmap_t durmap;
 
-    durmap.number   = m_in->read_uint32_be();
-    durmap.duration = m_in->read_uint32_be();
+    durmap.number   = m_in->fast_read_uint32_be();
+    durmap.duration = m_in->fast_read_uint32_be();
     dmx.durmap_table.push_back(durmap);
   }
 
@@ -1469,9 +1469,9 @@ void
 qtmp4_reader_c::handle_elst_atom(qtmp4_demuxer_c &dmx,
                                  qt_atom_t,
                                  int level) {
-  uint8_t version = m_in->read_uint8();
-  m_in->skip(3);                // flags
-  uint32_t count  = m_in->read_uint32_be();
+  uint8_t version = m_in->fast_read_uint8();
+  m_in->fast_skip(3);                // flags
+  uint32_t count  = m_in->fast_read_uint32_be();
   dmx.editlist_table.resize(count);
 
   size_t i;
@@ -1479,14 +1479,14 @@ qtmp4_reader_c::handle_elst_atom(qtmp4_demuxer_c &dmx,
     auto &editlist = dmx.editlist_table[i];
 
     if (1 == version) {
-      editlist.segment_duration = m_in->read_uint64_be();
-      editlist.media_time       = static_cast<int64_t>(m_in->read_uint64_be());
+      editlist.segment_duration = m_in->fast_read_uint64_be();
+      editlist.media_time       = static_cast<int64_t>(m_in->fast_read_uint64_be());
     } else {
-      editlist.segment_duration = m_in->read_uint32_be();
-      editlist.media_time       = static_cast<int32_t>(m_in->read_uint32_be());
+      editlist.segment_duration = m_in->fast_read_uint32_be();
+      editlist.media_time       = static_cast<int32_t>(m_in->fast_read_uint32_be());
     }
-    editlist.media_rate_integer  = m_in->read_uint16_be();
-    editlist.media_rate_fraction = m_in->read_uint16_be();
+    editlist.media_rate_integer  = m_in->fast_read_uint16_be();
+    editlist.media_rate_fraction = m_in->fast_read_uint16_be();
   }
 
   mxdebug_if(m_debug_headers, fmt::format("{0}Edit list table: {1} entries\n", space(level * 2 + 1), count));
@@ -1507,19 +1507,19 @@ qtmp4_reader_c::handle_tkhd_atom(qtmp4_demuxer_c &dmx,
   if (atom.size < 1)
     print_atom_too_small_error("tkhd", atom, 1);
 
-  auto version       = m_in->read_uint8();
+  auto version       = m_in->fast_read_uint8();
   auto expected_size = 4u + 2 * (version == 1 ? 8 : 4) + 4 + 4 + (version == 1 ? 8 : 4) + 2 * 4 + 3 * 2 + 2 + 9 * 4 + 2 * 4;
 
   if (atom.size < expected_size)
     print_atom_too_small_error("tkhd", atom, expected_size);
 
-  auto flags = m_in->read_uint24_be();
+  auto flags = m_in->fast_read_uint24_be();
 
-  m_in->skip(2 * (version == 1 ? 8 : 4)); // creation_time, modification_time
+  m_in->fast_skip(2 * (version == 1 ? 8 : 4)); // creation_time, modification_time
 
-  dmx.container_id = m_in->read_uint32_be();
+  dmx.container_id = m_in->fast_read_uint32_be();
 
-  m_in->skip(4                        // reserved
+  m_in->fast_skip(4                        // reserved
              + (version == 1 ? 8 : 4) // duration
              + 2 * 4                  // reserved
              + 3 * 2                  // layer, alternate_group, volume
@@ -1527,8 +1527,8 @@ qtmp4_reader_c::handle_tkhd_atom(qtmp4_demuxer_c &dmx,
              + 9 * 4);                // matrix
 
   dmx.m_enabled            = (flags & QTMP4_TKHD_FLAG_ENABLED) == QTMP4_TKHD_FLAG_ENABLED;
-  dmx.v_display_width_flt  = m_in->read_uint32_be();
-  dmx.v_display_height_flt = m_in->read_uint32_be();
+  dmx.v_display_width_flt  = m_in->fast_read_uint32_be();
+  dmx.v_display_height_flt = m_in->fast_read_uint32_be();
   dmx.v_width              = dmx.v_display_width_flt  >> 16;
   dmx.v_height             = dmx.v_display_height_flt >> 16;
 
@@ -1547,7 +1547,7 @@ qtmp4_reader_c::handle_tref_atom(qtmp4_demuxer_c &/* dmx */,
 
     std::vector<uint32_t> track_ids;
     for (auto idx = (atom.size - 4) / 8; 0 < idx; --idx)
-      track_ids.push_back(m_in->read_uint32_be());
+      track_ids.push_back(m_in->fast_read_uint32_be());
 
     if (atom.fourcc == "chap")
       for (auto track_id : track_ids)
@@ -1632,7 +1632,7 @@ qtmp4_reader_c::read(generic_packetizer_c *packetizer,
   }
 
   auto duration = dmx.m_use_frame_rate_for_duration ? *dmx.m_use_frame_rate_for_duration : index.duration;
-  ptzr(dmx.ptzr).process(std::make_shared<packet_t>(buffer, index.timestamp, duration, index.is_keyframe ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+  ptzr(dmx.ptzr).process(packet_t::create(buffer, index.timestamp, duration, index.is_keyframe ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
   ++dmx.pos;
 
   m_bytes_processed += index.size;
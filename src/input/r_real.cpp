@@ -82,7 +82,7 @@ static int64_t
 mm_io_file_read(void *file,
                 void *buffer,
                 int64_t bytes) {
-  return !file ? -1 : static_cast<mm_io_c *>(file)->read(buffer, bytes);
+  return !file ? -1 : static_cast<mm_io_c *>(file)->fast_read(buffer, bytes);
 }
 
 static int64_t
@@ -506,7 +506,7 @@ real_reader_c::deliver_audio_frames(real_demuxer_cptr dmx,
     rv_segment_cptr segment = dmx->segments[i];
     mxdebug_if(s_debug, fmt::format("'{0}' track {1}: delivering audio length {2} timestamp {3} flags 0x{4:08x} duration {5}\n", m_ti.m_fname, dmx->track->id, segment->data->get_size(), dmx->last_timestamp, segment->flags, duration));
 
-    ptzr(dmx->ptzr).process(std::make_shared<packet_t>(segment->data, dmx->last_timestamp, duration, (segment->flags & RMFF_FRAME_FLAG_KEYFRAME) == RMFF_FRAME_FLAG_KEYFRAME ? -1 : dmx->ref_timestamp));
+    ptzr(dmx->ptzr).process(packet_t::create(segment->data, dmx->last_timestamp, duration, (segment->flags & RMFF_FRAME_FLAG_KEYFRAME) == RMFF_FRAME_FLAG_KEYFRAME ? -1 : dmx->ref_timestamp));
     if ((segment->flags & 2) == 2)
       dmx->ref_timestamp = dmx->last_timestamp;
   }
@@ -548,7 +548,7 @@ real_reader_c::deliver_aac_frames(real_demuxer_cptr dmx,
   int data_idx = 2 + num_sub_packets * 2;
   for (i = 0; i < num_sub_packets; i++) {
     int sub_length = get_uint16_be(&chunk[2 + i * 2]);
-    ptzr(dmx->ptzr).process(std::make_shared<packet_t>(memory_c::borrow(&chunk[data_idx], sub_length)));
+    ptzr(dmx->ptzr).process(packet_t::create(memory_c::borrow(&chunk[data_idx], sub_length)));
     data_idx += sub_length;
   }
 }
@@ -592,11 +592,11 @@ real_reader_c::assemble_video_packet(real_demuxer_cptr dmx,
     if (!dmx->rv_dimensions)
       set_dimensions(dmx, assembled->data, assembled->size);
 
-    auto packet = std::make_shared<packet_t>(memory_c::take_ownership(assembled->data, assembled->size),
-                                             (int64_t)assembled->timecode * 1000000,
-                                             0,
-                                             (assembled->flags & RMFF_FRAME_FLAG_KEYFRAME) == RMFF_FRAME_FLAG_KEYFRAME ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC,
-                                             VFT_NOBFRAME);
+    auto packet = packet_t::create(memory_c::take_ownership(assembled->data, assembled->size),
+                                   (int64_t)assembled->timecode * 1000000,
+                                   0,
+                                   (assembled->flags & RMFF_FRAME_FLAG_KEYFRAME) == RMFF_FRAME_FLAG_KEYFRAME ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC,
+                                   VFT_NOBFRAME);
     ptzr(dmx->ptzr).process(packet);
 
     assembled->allocated_by_rmff = 0;
@@ -401,7 +401,7 @@ vobsub_reader_c::deliver_packet(unsigned char *buf,
   }
 
   if (duration.valid())
-    packetizer->process(std::make_shared<packet_t>(memory_c::take_ownership(buf, size), timestamp, duration.to_ns()));
+    packetizer->process(packet_t::create(memory_c::take_ownership(buf, size), timestamp, duration.to_ns()));
   else
     safefree(buf);
 
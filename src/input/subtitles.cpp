@@ -13,15 +13,15 @@
 
 #include "common/common_pch.h"
 
-#include <QRegularExpression>
+#include <charconv>
 
 #include "common/endian.h"
 #include "common/mime.h"
 #include "common/mm_proxy_io.h"
 #include "common/mm_text_io.h"
-#include "common/qt.h"
 #include "common/strings/formatting.h"
 #include "common/strings/parsing.h"
+#include "common/strings/scanner.h"
 #include "common/strings/utf8.h"
 #include "input/subtitles.h"
 #include "merge/file_status.h"
@@ -92,7 +92,7 @@ subtitles_c::process(generic_packetizer_c *p) {
   if (empty() || (entries.end() == current))
     return;
 
-  packet_cptr packet(new packet_t(memory_c::borrow(current->subs), current->start, current->end - current->start));
+  auto packet = packet_t::create(memory_c::borrow(current->subs), current->start, current->end - current->start);
   packet->extensions.push_back(packet_extension_cptr(new subtitle_number_packet_extension_c(current->number)));
   p->process(packet);
   ++current;
@@ -100,10 +100,157 @@ subtitles_c::process(generic_packetizer_c *p) {
 
 // ------------------------------------------------------------
 
-#define SRT_RE_VALUE          "\\s*(-?)\\s*(\\d+)"
-#define SRT_RE_TIMESTAMP      SRT_RE_VALUE ":" SRT_RE_VALUE ":" SRT_RE_VALUE "(?:[,\\.:]" SRT_RE_VALUE ")?"
-#define SRT_RE_TIMESTAMP_LINE "^" SRT_RE_TIMESTAMP "\\s*[\\-\\s]+>\\s*" SRT_RE_TIMESTAMP "\\s*"
-#define SRT_RE_COORDINATES    "([XY]\\d+:\\d+\\s*){4}\\s*$"
+namespace {
+
+// SRT timestamp lines are parsed leniently. Each of the values may be
+// preceded by white space & a minus sign, e.g. "00:00:01,000 -->
+// 00: 00:02.5". Everything following the end timestamp is ignored.
+
+struct srt_value_t {
+  bool negative{};
+  std::string_view digits;
+};
+
+struct srt_timestamp_t {
+  srt_value_t hours, minutes, seconds, fraction;
+};
+
+bool
+scan_srt_value(mtx::string::scanner_c &scanner,
+               srt_value_t &value) {
+  auto position = scanner.get_position();
+
+  scanner.skip_spaces();
+  value.negative = scanner.skip('-');
+  scanner.skip_spaces();
+  value.digits   = scanner.digits();
+
+  if (!value.digits.empty())
+    return true;
+
+  scanner.set_position(position);
+  value = {};
+
+  return false;
+}
+
+bool
+scan_srt_timestamp(mtx::string::scanner_c &scanner,
+                   srt_timestamp_t &timestamp) {
+  if (   !scan_srt_value(scanner, timestamp.hours)   || !scanner.skip(':')
+      || !scan_srt_value(scanner, timestamp.minutes) || !scanner.skip(':')
+      || !scan_srt_value(scanner, timestamp.seconds))
+    return false;
+
+  // The fractional part is optional.
+  auto position = scanner.get_position();
+
+  if (!scanner.skip_any_of(",.:") || !scan_srt_value(scanner, timestamp.fraction))
+    scanner.set_position(position);
+
+  return true;
+}
+
+int64_t
+srt_timestamp_to_ns(srt_timestamp_t const &timestamp) {
+  // Values too big to be represented are treated as 0.
+  auto to_number = [](std::string_view digits) {
+    int64_t value{};
+    std::from_chars(digits.data(), digits.data() + digits.size(), value);
+    return value;
+  };
+
+  // Only nanosecond precision is kept of the fractional part.
+  auto fraction = std::string{timestamp.fraction.digits.substr(0, 9)};
+  fraction.resize(9, '0');
+
+  auto value    = (to_number(timestamp.hours.digits) * 60 * 60 + to_number(timestamp.minutes.digits) * 60 + to_number(timestamp.seconds.digits)) * 1'000'000'000ll + to_number(fraction);
+  auto negative = timestamp.hours.negative ^ timestamp.minutes.negative ^ timestamp.seconds.negative ^ timestamp.fraction.negative;
+
+  return negative ? -value : value;
+}
+
+std::optional<std::pair<int64_t, int64_t>>
+parse_srt_timestamp_line(std::string_view line) {
+  mtx::string::scanner_c scanner{line};
+  srt_timestamp_t start, end;
+
+  if (!scan_srt_timestamp(scanner, start))
+    return {};
+
+  // Any combination of white space & dashes followed by '>'.
+  if (!scanner.skip_while([](char c) { return (c == '-') || mtx::string::is_ascii_space(c); }).size() || !scanner.skip('>'))
+    return {};
+
+  if (!scan_srt_timestamp(scanner, end))
+    return {};
+
+  return std::make_pair(srt_timestamp_to_ns(start), srt_timestamp_to_ns(end));
+}
+
+bool
+is_srt_number_line(std::string_view line) {
+  return !line.empty() && std::all_of(line.begin(), line.end(), mtx::string::is_ascii_digit);
+}
+
+// Four coordinates like "X1:123 X2:456 Y1:12 Y2:34" at the end of the
+// line.
+bool
+has_srt_coordinates(std::string_view line) {
+  for (auto idx = line.find_first_of("XY"); idx != std::string_view::npos; idx = line.find_first_of("XY", idx + 1)) {
+    mtx::string::scanner_c scanner{line.substr(idx)};
+    auto num_found = 0;
+
+    while (   (num_found < 4)
+           && scanner.skip_any_of("XY")
+           && !scanner.digits().empty()
+           && scanner.skip(':')
+           && !scanner.digits().empty()) {
+      scanner.skip_spaces();
+      ++num_found;
+    }
+
+    if (num_found != 4)
+      continue;
+
+    scanner.skip_spaces();
+    if (scanner.at_end())
+      return true;
+  }
+
+  return false;
+}
+
+// Section headers like "[V4+ Styles]" at the start of a line, ignoring
+// case. A space in the name matches any amount of white space.
+bool
+is_ssa_section_header(std::string_view line,
+                      std::string_view name) {
+  mtx::string::scanner_c scanner{line};
+
+  scanner.skip_spaces();
+  if (!scanner.skip('['))
+    return false;
+
+  for (auto idx = 0u; idx < name.size(); ++idx) {
+    auto ok = name[idx] == ' ' ? scanner.skip_spaces() > 0 : scanner.skip_istring(name.substr(idx, 1));
+    if (!ok)
+      return false;
+  }
+
+  return scanner.skip(']');
+}
+
+bool
+is_ssa_comment_or_empty_line(std::string_view line) {
+  mtx::string::scanner_c scanner{line};
+
+  scanner.skip_spaces();
+
+  return scanner.at_end() || scanner.skip_any_of("!;");
+}
+
+} // anonymous namespace
 
 bool
 srt_parser_c::probe(mm_text_io_c &io) {
@@ -120,8 +267,7 @@ srt_parser_c::probe(mm_text_io_c &io) {
       return false;
 
     s = io.getline(100);
-    QRegularExpression timestamp_re{SRT_RE_TIMESTAMP_LINE};
-    if (!Q(s).contains(timestamp_re))
+    if (!parse_srt_timestamp_line(s))
       return false;
 
     s = io.getline();
@@ -145,10 +291,6 @@ srt_parser_c::srt_parser_c(mm_text_io_cptr const &io,
 
 void
 srt_parser_c::parse() {
-  QRegularExpression timestamp_re{SRT_RE_TIMESTAMP_LINE};
-  QRegularExpression number_re{"^\\d+$"};
-  QRegularExpression coordinates_re{SRT_RE_COORDINATES};
-
   int64_t start                  = 0;
   int64_t end                    = 0;
   int64_t previous_start         = 0;
@@ -186,7 +328,7 @@ srt_parser_c::parse() {
     }
 
     if (STATE_INITIAL == state) {
-      if (!Q(s).contains(number_re)) {
+      if (!is_srt_number_line(s)) {
         mxwarn_tid(m_file_name, m_track_id, fmt::format(Y("Error in line {0}: expected subtitle number and found some text.\n"), line_number));
         break;
       }
@@ -194,39 +336,13 @@ srt_parser_c::parse() {
       mtx::string::parse_number(s, subtitle_number);
 
     } else if (STATE_TIME == state) {
-      auto matches = timestamp_re.match(Q(s));
-      if (!matches.hasMatch()) {
+      auto timestamps = parse_srt_timestamp_line(s);
+      if (!timestamps) {
         mxwarn_tid(m_file_name, m_track_id, fmt::format(Y("Error in line {0}: expected a SRT timestamp line but found something else. Aborting this file.\n"), line_number));
         break;
       }
 
-      int64_t s_h = 0, s_min = 0, s_sec = 0, s_ns = 0, e_h = 0, e_min = 0, e_sec = 0, e_ns = 0;
-
-      //      1       2         3    4          5   6                  7   8
-      // "\\s*(-?)\\s*(\\d+):\\s(-?)*(\\d+):\\s*(-?)(\\d+)(?:[,\\.]\\s*(-?)(\\d+))?"
-
-      mtx::string::parse_number(to_utf8(matches.captured( 2)), s_h);
-      mtx::string::parse_number(to_utf8(matches.captured( 4)), s_min);
-      mtx::string::parse_number(to_utf8(matches.captured( 6)), s_sec);
-      mtx::string::parse_number(to_utf8(matches.captured(10)), e_h);
-      mtx::string::parse_number(to_utf8(matches.captured(12)), e_min);
-      mtx::string::parse_number(to_utf8(matches.captured(14)), e_sec);
-
-      std::string s_rest = to_utf8(matches.captured( 8));
-      std::string e_rest = to_utf8(matches.captured(16));
-
-      auto neg_calculator = [&matches](auto start_idx) -> auto {
-        int64_t neg = 1;
-        for (auto idx = 0; idx < 4; ++idx)
-          if (matches.captured(start_idx + (idx * 2)) == Q("-"))
-            neg *= -1;
-        return neg;
-      };
-
-      int64_t s_neg = neg_calculator(1);
-      int64_t e_neg = neg_calculator(9);
-
-      if (Q(s).contains(coordinates_re) && !m_coordinates_warning_shown) {
+      if (!m_coordinates_warning_shown && has_srt_coordinates(s)) {
         mxwarn_tid(m_file_name, m_track_id,
                    Y("This file contains coordinates in the timestamp lines. "
                      "Such coordinates are not supported by the Matroska SRT subtitle format. "
@@ -238,22 +354,9 @@ srt_parser_c::parse() {
       if (!subtitles.empty())
         add_maybe(start, end, timestamp_number, subtitles);
 
-      while (s_rest.length() < 9)
-        s_rest += "0";
-      if (s_rest.length() > 9)
-        s_rest.erase(9);
-
-      while (e_rest.length() < 9)
-        e_rest += "0";
-      if (e_rest.length() > 9)
-        e_rest.erase(9);
-
-      mtx::string::parse_number(s_rest, s_ns);
-      mtx::string::parse_number(e_rest, e_ns);
-
-      // Calculate the start and end time in ns precision for the following entry.
-      start  = ((s_h * 60 * 60 + s_min * 60 + s_sec) * 1'000'000'000ll + s_ns) * s_neg;
-      end    = ((e_h * 60 * 60 + e_min * 60 + e_sec) * 1'000'000'000ll + e_ns) * e_neg;
+      // The start and end time in ns precision for the following entry.
+      start = timestamps->first;
+      end   = timestamps->second;
 
       if (0 > start) {
         mxwarn_tid(m_file_name, m_track_id,
@@ -284,7 +387,7 @@ srt_parser_c::parse() {
         subtitles += "\n";
       subtitles += s;
 
-    } else if (Q(s).contains(number_re)) {
+    } else if (is_srt_number_line(s)) {
       state = STATE_TIME;
       mtx::string::parse_number(s, subtitle_number);
 
@@ -305,10 +408,6 @@ srt_parser_c::parse() {
 
 bool
 ssa_parser_c::probe(mm_text_io_c &io) {
-  QRegularExpression script_info_re{"^\\s*\\[script\\s+info\\]",   QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression styles_re{     "^\\s*\\[V4\\+?\\s+Styles\\]", QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression comment_re{    "^\\s*$|^\\s*[!;]",            QRegularExpression::CaseInsensitiveOption};
-
   try {
     int line_number = 0;
     io.setFilePointer(0);
@@ -321,13 +420,14 @@ ssa_parser_c::probe(mm_text_io_c &io) {
       if (100 < line_number)
         return false;
 
-      auto qline = Q(line);
       // Skip comments and empty lines.
-      if (qline.contains(comment_re))
+      if (is_ssa_comment_or_empty_line(line))
         continue;
 
       // This is the line mkvmerge is looking for: positive match.
-      if (qline.contains(script_info_re) || qline.contains(styles_re))
+      if (   is_ssa_section_header(line, "Script Info")
+          || is_ssa_section_header(line, "V4+ Styles")
+          || is_ssa_section_header(line, "V4 Styles"))
         return true;
 
       // Neither a wanted line nor an empty one/a comment: negative result.
@@ -353,13 +453,6 @@ ssa_parser_c::ssa_parser_c(generic_reader_c &reader,
 
 void
 ssa_parser_c::parse() {
-  QRegularExpression sec_styles_ass_re{"^\\s*\\[V4\\+\\s+Styles\\]", QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression sec_styles_re{    "^\\s*\\[V4\\s+Styles\\]",    QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression sec_info_re{      "^\\s*\\[Script\\s+Info\\]",  QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression sec_events_re{    "^\\s*\\[Events\\]",          QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression sec_graphics_re{  "^\\s*\\[Graphics\\]",        QRegularExpression::CaseInsensitiveOption};
-  QRegularExpression sec_fonts_re{     "^\\s*\\[Fonts\\]",           QRegularExpression::CaseInsensitiveOption};
-
   int num                        = 0;
   ssa_section_e section          = SSA_SECTION_NONE;
   ssa_section_e previous_section = SSA_SECTION_NONE;
@@ -375,31 +468,30 @@ ssa_parser_c::parse() {
       break;
 
     line               = recode(line);
-    auto qline         = Q(line);
     bool add_to_global = true;
 
     // A normal line. Let's see if this file is ASS and not SSA.
     if (!strcasecmp(line.c_str(), "ScriptType: v4.00+"))
       m_is_ass = true;
 
-    else if (qline.contains(sec_styles_ass_re)) {
+    else if (is_ssa_section_header(line, "V4+ Styles")) {
       m_is_ass = true;
       section  = SSA_SECTION_V4STYLES;
 
-    } else if (qline.contains(sec_styles_re))
+    } else if (is_ssa_section_header(line, "V4 Styles"))
       section = SSA_SECTION_V4STYLES;
 
-    else if (qline.contains(sec_info_re))
+    else if (is_ssa_section_header(line, "Script Info"))
       section = SSA_SECTION_INFO;
 
-    else if (qline.contains(sec_events_re))
+    else if (is_ssa_section_header(line, "Events"))
       section = SSA_SECTION_EVENTS;
 
-    else if (qline.contains(sec_graphics_re)) {
+    else if (is_ssa_section_header(line, "Graphics")) {
       section       = SSA_SECTION_GRAPHICS;
       add_to_global = false;
 
-    } else if (qline.contains(sec_fonts_re)) {
+    } else if (is_ssa_section_header(line, "Fonts")) {
       section       = SSA_SECTION_FONTS;
       add_to_global = false;
 
@@ -0,0 +1,458 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   additional destination files
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <ebml/EbmlHead.h>
+#include <ebml/EbmlSubHead.h>
+#include <ebml/EbmlVoid.h>
+#include <matroska/KaxBlock.h>
+#include <matroska/KaxBlockData.h>
+#include <matroska/KaxContentEncoding.h>
+#include <matroska/KaxInfo.h>
+#include <matroska/KaxInfoData.h>
+#include <matroska/KaxSeekHead.h>
+#include <matroska/KaxSegment.h>
+#include <matroska/KaxTrackEntryData.h>
+#include <matroska/KaxTracks.h>
+
+#include "common/bitvalue.h"
+#include "common/container.h"
+#include "common/doc_type_version_handler.h"
+#include "common/ebml.h"
+#include "common/hacks.h"
+#include "common/mm_write_buffer_io.h"
+#include "common/webm.h"
+#include "merge/additional_output.h"
+#include "merge/cluster_helper.h"
+#include "merge/filelist.h"
+#include "merge/generic_packetizer.h"
+#include "merge/libmatroska_extensions.h"
+#include "merge/webm.h"
+
+using namespace libmatroska;
+
+std::vector<additional_output_cptr> g_additional_outputs;
+
+additional_output_c::additional_output_c(std::string file_name,
+                                         std::vector<track_order_t> track_ids)
+  : m_file_name{std::move(file_name)}
+  , m_track_ids{std::move(track_ids)}
+  , m_webm{is_webm_file_name(m_file_name)}
+{
+}
+
+additional_output_c::~additional_output_c() {
+  // Only reached with an open file if an error occurred; see
+  // cleanup().
+  auto wb_out = dynamic_cast<mm_write_buffer_io_c *>(m_out.get());
+  if (wb_out)
+    wb_out->discard_buffer();
+}
+
+std::string const &
+additional_output_c::get_file_name()
+  const {
+  return m_file_name;
+}
+
+void
+additional_output_c::verify() {
+  if (g_cluster_helper->splitting())
+    mxerror(Y("Additional destination files cannot be combined with splitting.\n"));
+
+  for (auto const &file : g_files)
+    if (file->name == m_file_name)
+      mxerror(fmt::format("{0} {1}\n",
+                          fmt::format(Y("The name of the destination file '{0}' and of one of the source files is the same."), m_file_name),
+                          Y("This would cause mkvmerge to overwrite one of your source files.")));
+
+  for (auto const &id : m_track_ids) {
+    auto ptzr = std::find_if(g_packetizers.begin(), g_packetizers.end(), [&id](auto const &p) {
+      return (p.file == id.file_id) && (p.packetizer->m_ti.m_id == id.track_id);
+    });
+
+    if (ptzr == g_packetizers.end())
+      mxerror(fmt::format(Y("The track {0}:{1} requested for the additional destination file '{2}' is not written to the main destination file.\n"), id.file_id, id.track_id, m_file_name));
+
+    if (m_webm && !ptzr->packetizer->is_compatible_with(OC_WEBM))
+      mxerror(fmt::format(Y("The codec type '{0}' cannot be used in a WebM compliant file.\n"), ptzr->packetizer->get_format_name()));
+
+    m_packetizers.push_back(ptzr->packetizer);
+  }
+
+  mxdebug_if(m_debug, fmt::format("{0}: {1} track(s), WebM: {2}\n", m_file_name, m_packetizers.size(), m_webm));
+}
+
+void
+additional_output_c::open(KaxInfo const &main_info) {
+  // Track numbers are only known once the main file's headers have
+  // been rendered. Packetizers of appended files share them with the
+  // packetizers they're appended to.
+  for (auto ptzr : m_packetizers) {
+    m_track_numbers.insert(ptzr->get_track_num());
+
+    if ((-1 == m_video_track_number) && (track_video == ptzr->get_track_type()))
+      m_video_track_number = ptzr->get_track_num();
+  }
+
+  try {
+    m_out = mm_write_buffer_io_c::open(m_file_name, 20 * 1024 * 1024);
+  } catch (mtx::mm_io::exception &ex) {
+    mxerror(fmt::format(Y("The file '{0}' could not be opened for writing: {1}.\n"), m_file_name, ex));
+  }
+
+  if (verbose)
+    mxinfo(fmt::format(Y("The file '{0}' has been opened for writing.\n"), m_file_name));
+
+  m_doc_type_version_handler = std::make_unique<mtx::doc_type_version_handler_c>();
+
+  render_headers(main_info);
+}
+
+std::unique_ptr<KaxTracks>
+additional_output_c::create_tracks()
+  const {
+  auto tracks = std::make_unique<KaxTracks>();
+
+  for (auto ptzr : m_packetizers) {
+    auto entry = static_cast<KaxTrackEntry *>(ptzr->get_track_entry()->Clone());
+
+    if (m_webm) {
+      if (FindChild<KaxContentEncodings>(*entry))
+        mxerror(fmt::format(Y("The track {0} from the file '{1}' uses compression which cannot be used in the WebM compliant file '{2}'.\n"), ptzr->m_ti.m_id, ptzr->m_ti.m_fname, m_file_name));
+
+      DeleteChildren<KaxMaxBlockAdditionID>(*entry);
+    }
+
+    tracks->PushElement(*entry);
+  }
+
+  return tracks;
+}
+
+void
+additional_output_c::render_headers(KaxInfo const &main_info) {
+  EbmlHead head;
+
+  GetChild<EDocType           >(head).SetValue(m_webm ? "webm" : "matroska");
+  GetChild<EDocTypeVersion    >(head).SetValue(1);
+  GetChild<EDocTypeReadVersion>(head).SetValue(1);
+
+  head.Render(*m_out, true);
+
+  m_segment = std::make_unique<KaxSegment>();
+  m_segment->WriteHead(*m_out, 8);
+
+  // Only the segment info, the track headers & the cues are indexed.
+  m_seek_head      = std::make_unique<KaxSeekHead>();
+  m_seek_head_void = std::make_unique<EbmlVoid>();
+  m_seek_head_void->SetSize(256);
+  m_seek_head_void->Render(*m_out);
+
+  // The segment info is the main file's minus everything that only
+  // makes sense for a single file such as the segment UID & linking
+  // information.
+  m_info = std::make_unique<KaxInfo>();
+
+  for (auto child : main_info)
+    if (   Is<KaxTimecodeScale>(child)
+        || Is<KaxMuxingApp>(child)
+        || Is<KaxWritingApp>(child)
+        || Is<KaxDateUTC>(child)
+        || Is<KaxTitle>(child))
+      m_info->PushElement(*child->Clone());
+
+  m_duration = new KaxDuration;
+  m_duration->SetPrecision(EbmlFloat::FLOAT_64);
+  m_duration->SetValue(0.0);
+  m_info->PushElement(*m_duration);
+
+  if (!m_webm) {
+    mtx::bits::value_c segment_uid(128);
+
+    if (mtx::hacks::is_engaged(mtx::hacks::NO_VARIABLE_DATA))
+      segment_uid.zero_content();
+    else
+      segment_uid.generate_random();
+
+    GetChild<KaxSegmentUID>(*m_info).CopyBuffer(segment_uid.data(), 128 / 8);
+  }
+
+  m_doc_type_version_handler->render(*m_info, *m_out, true);
+  m_seek_head->IndexThis(*m_info, *m_segment);
+
+  m_tracks = create_tracks();
+
+  m_tracks->UpdateSize(true);
+  int64_t full_header_size = m_tracks->ElementSize(true);
+  m_tracks->UpdateSize(false);
+
+  m_doc_type_version_handler->render(*m_tracks, *m_out);
+  m_seek_head->IndexThis(*m_tracks, *m_segment);
+
+  // Reserve some space for header changes by the packetizers just like
+  // in the main file.
+  render_void(1024 + full_header_size - m_tracks->ElementSize(false));
+  m_tracks_end_position = m_out->getFilePointer();
+}
+
+void
+additional_output_c::render_void(int64_t size) {
+  if (!size)
+    return;
+
+  EbmlVoid void_element;
+  auto actual_size = size;
+
+  void_element.SetSize(size);
+  void_element.UpdateSize();
+
+  while (static_cast<int64_t>(void_element.ElementSize()) > size)
+    void_element.SetSize(--actual_size);
+
+  if (static_cast<int64_t>(void_element.ElementSize()) < size)
+    void_element.SetSizeLength(size - actual_size - 1);
+
+  void_element.Render(*m_out);
+}
+
+void
+additional_output_c::rerender_track_headers() {
+  if (!m_out || m_track_headers_too_big)
+    return;
+
+  auto tracks = create_tracks();
+  tracks->UpdateSize(false);
+
+  auto tracks_position = m_tracks->GetElementPosition();
+  auto available_size  = static_cast<int64_t>(m_tracks_end_position - tracks_position);
+  auto new_size        = static_cast<int64_t>(tracks->ElementSize());
+
+  // The main file moves already written data if needed. Additional
+  // files only use the space reserved after the track headers; an
+  // EBML void element occupies at least two bytes.
+  if ((new_size > available_size) || ((available_size - new_size) == 1)) {
+    mxwarn(fmt::format(Y("The track headers in the additional destination file '{0}' could not be updated as they've grown too much.\n"), m_file_name));
+    m_track_headers_too_big = true;
+    return;
+  }
+
+  m_out->save_pos(tracks_position);
+  m_doc_type_version_handler->render(*tracks, *m_out);
+  render_void(available_size - new_size);
+  m_out->restore_pos();
+
+  m_tracks = std::move(tracks);
+}
+
+void
+additional_output_c::add_packet(packet_cptr const &packet) {
+  if (!m_out || !mtx::includes(m_track_numbers, packet->source->get_track_num()))
+    return;
+
+  if (!m_packets.empty() && is_cluster_full(*packet))
+    render_cluster();
+
+  m_packets.push_back(packet);
+  m_cluster_content_size += packet->data->get_size();
+
+  if ((-1 == m_min_timestamp_in_cluster) || (packet->assigned_timestamp < m_min_timestamp_in_cluster))
+    m_min_timestamp_in_cluster = packet->assigned_timestamp;
+  m_max_timestamp_in_cluster = std::max(packet->assigned_timestamp, m_max_timestamp_in_cluster);
+}
+
+bool
+additional_output_c::is_cluster_full(packet_t const &packet)
+  const {
+  auto min_timestamp      = std::min(packet.assigned_timestamp, m_min_timestamp_in_cluster);
+  auto max_timestamp      = std::max(packet.assigned_timestamp, m_max_timestamp_in_cluster);
+  auto is_video_key_frame = (packet.source->get_track_num() == m_video_track_number) && packet.is_key_frame();
+
+  // Block timestamps are stored as 16-bit offsets to the cluster's
+  // timestamp, the lowest one in the cluster.
+  return (static_cast<int64_t>((max_timestamp - min_timestamp) / g_timestamp_scale) > std::numeric_limits<int16_t>::max())
+      || ((packet.assigned_timestamp - m_packets.front()->assigned_timestamp) > g_max_ns_per_cluster)
+      || (m_packets.size()                                                    >= static_cast<size_t>(g_max_blocks_per_cluster))
+      || (m_cluster_content_size                                              > 1500000)
+      || (is_video_key_frame && (packet.assigned_timestamp > m_min_timestamp_in_cluster));
+}
+
+bool
+additional_output_c::add_to_cues_maybe(packet_t const &packet) {
+  if (!g_write_cues)
+    return false;
+
+  auto &source      = *packet.source;
+  auto strategy     = source.get_cue_creation();
+  auto key_frame    = packet.is_key_frame();
+  auto track_number = source.get_track_num();
+
+  // Same rules as for the main file; see
+  // cluster_helper_c::add_to_cues_maybe().
+  auto add = ((CUE_STRATEGY_IFRAMES == strategy) && key_frame)
+          || !!packet.codec_state
+          || (CUE_STRATEGY_ALL == strategy);
+
+  if (   !add
+      && (CUE_STRATEGY_SPARSE == strategy)
+      && (track_audio         == source.get_track_type())
+      && (-1                  == m_video_track_number)
+      && key_frame) {
+    auto itr = m_last_cue_timestamps.find(track_number);
+    add      = (itr == m_last_cue_timestamps.end()) || ((packet.assigned_timestamp - itr->second) >= 500'000'000);
+  }
+
+  if (add)
+    m_last_cue_timestamps[track_number] = packet.assigned_timestamp;
+
+  return add;
+}
+
+void
+additional_output_c::render_cluster() {
+  if (m_packets.empty())
+    return;
+
+  // Each frame is put into its own block; the main file's lacing
+  // decisions depend on its own cluster boundaries.
+  auto use_simple_block = !mtx::hacks::is_engaged(mtx::hacks::NO_SIMPLE_BLOCKS);
+  auto cluster          = std::make_unique<kax_cluster_c>();
+  std::vector<kax_block_blob_cptr> blobs;
+  std::vector<std::size_t> cue_indexes;
+  kax_cues_with_cleanup_c cues;
+
+  cues.SetGlobalTimecodeScale(g_timestamp_scale);
+  cluster->SetParent(*m_segment);
+
+  m_timestamp_offset = std::accumulate(m_packets.begin(), m_packets.end(), m_timestamp_offset, [](int64_t a, packet_cptr const &p) { return std::min(a, p->assigned_timestamp); });
+
+  for (auto idx = 0u; idx < m_packets.size(); ++idx) {
+    auto &pack         = *m_packets[idx];
+    auto &track_entry  = static_cast<KaxTrackEntry &>(*pack.source->get_track_entry());
+    auto set_duration  = pack.has_duration() && (pack.duration_mandatory || g_use_durations);
+    auto use_group     = !use_simple_block
+                      || set_duration
+                      || !pack.data_adds.empty()
+                      || pack.codec_state
+                      || pack.has_discard_padding();
+
+    blobs.emplace_back(std::make_shared<kax_block_blob_c>(use_group ? BLOCK_BLOB_NO_SIMPLE : BLOCK_BLOB_ALWAYS_SIMPLE));
+    auto &blob = *blobs.back();
+
+    cluster->AddBlockBlob(&blob);
+    blob.SetParent(*cluster);
+
+    auto data_buffer = new DataBuffer(static_cast<binary *>(pack.data->get_buffer()), pack.data->get_size());
+
+    blob.add_frame_auto(track_entry, pack.assigned_timestamp - m_timestamp_offset, *data_buffer, LACING_NONE,
+                        pack.has_bref() ? pack.bref - m_timestamp_offset : -1,
+                        pack.has_fref() ? pack.fref - m_timestamp_offset : -1,
+                        pack.key_flag, pack.discardable_flag);
+
+    if (set_duration)
+      blob.set_block_duration(round_timestamp_scale(pack.get_unmodified_duration()));
+
+    if (pack.codec_state) {
+      auto &group = static_cast<KaxBlockGroup &>(blob);
+      auto cstate = new KaxCodecState;
+      group.PushElement(*cstate);
+      cstate->CopyBuffer(pack.codec_state->get_buffer(), pack.codec_state->get_size());
+    }
+
+    if (!pack.data_adds.empty() && blob.replace_simple_by_group()) {
+      auto &additions = AddEmptyChild<KaxBlockAdditions>(static_cast<KaxBlockGroup &>(blob));
+
+      for (auto add_idx = 0u; add_idx < pack.data_adds.size(); ++add_idx) {
+        auto &block_more = AddEmptyChild<KaxBlockMore>(additions);
+        GetChild<KaxBlockAddID     >(block_more).SetValue(add_idx + 1);
+        GetChild<KaxBlockAdditional>(block_more).CopyBuffer(pack.data_adds[add_idx]->get_buffer(), pack.data_adds[add_idx]->get_size());
+      }
+    }
+
+    if (pack.has_discard_padding())
+      GetChild<KaxDiscardPadding>(static_cast<KaxBlockGroup &>(blob)).SetValue(pack.discard_padding.to_ns());
+
+    if (add_to_cues_maybe(pack))
+      cue_indexes.push_back(idx);
+
+    if ((-1 == m_min_timestamp_in_file) || (pack.assigned_timestamp < m_min_timestamp_in_file))
+      m_min_timestamp_in_file = pack.assigned_timestamp;
+    m_max_timestamp_and_duration = std::max(pack.assigned_timestamp + pack.get_duration(), m_max_timestamp_and_duration);
+  }
+
+  cluster->SetPreviousTimecode(m_min_timestamp_in_cluster - m_timestamp_offset - 1, static_cast<int64_t>(g_timestamp_scale));
+  cluster->set_min_timestamp(m_min_timestamp_in_cluster - m_timestamp_offset);
+  cluster->set_max_timestamp(m_max_timestamp_in_cluster - m_timestamp_offset);
+
+  cluster->Render(*m_out, cues);
+  m_doc_type_version_handler->account(*cluster);
+
+  auto cluster_position = m_segment->GetRelativePosition(cluster->GetElementPosition());
+  auto data_start       = cluster->GetElementPosition() + cluster->HeadSize();
+
+  for (auto idx : cue_indexes) {
+    auto &pack           = *m_packets[idx];
+    auto &blob           = *blobs[idx];
+    auto block_position  = blob.IsSimpleBlock() ? static_cast<KaxSimpleBlock &>(blob).GetElementPosition() : static_cast<KaxBlockGroup &>(blob).GetElementPosition();
+
+    m_cues.add(cue_point_t{ static_cast<uint64_t>(pack.assigned_timestamp - m_timestamp_offset), pack.source->wants_cue_duration() ? static_cast<uint64_t>(pack.get_duration()) : 0,
+                            cluster_position, static_cast<uint32_t>(pack.source->get_track_num()), static_cast<uint32_t>(block_position - data_start) });
+  }
+
+  cluster->delete_non_blocks();
+
+  mxdebug_if(m_debug, fmt::format("{0}: cluster with {1} block(s) at {2}\n", m_file_name, m_packets.size(), cluster_position));
+
+  m_packets.clear();
+  m_cluster_content_size     =  0;
+  m_min_timestamp_in_cluster = -1;
+  m_max_timestamp_in_cluster = -1;
+}
+
+void
+additional_output_c::finish() {
+  if (!m_out)
+    return;
+
+  render_cluster();
+  rerender_track_headers();
+
+  if (g_write_cues)
+    m_cues.write(*m_out, *m_seek_head, *m_segment, *m_doc_type_version_handler);
+
+  auto duration = m_max_timestamp_and_duration - std::max<int64_t>(m_min_timestamp_in_file, 0);
+
+  m_out->save_pos(m_duration->GetElementPosition());
+  m_duration->SetValue(std::llround(static_cast<double>(duration) / g_timestamp_scale));
+  m_doc_type_version_handler->render(*m_duration, *m_out);
+  m_out->restore_pos();
+
+  if ((m_seek_head->ListSize() > 0) && !mtx::hacks::is_engaged(mtx::hacks::NO_META_SEEK)) {
+    m_seek_head->UpdateSize();
+    if (m_seek_head_void->ReplaceWith(*m_seek_head, *m_out, true) == INVALID_FILEPOS_T)
+      mxwarn(fmt::format(Y("This should REALLY not have happened. The space reserved for the first meta seek element was too small. Size needed: {0}. {1}\n"),
+                         m_seek_head->ElementSize(), BUGMSG));
+  }
+
+  int64_t final_file_size = m_out->getFilePointer();
+  if (m_segment->ForceSize(final_file_size - m_segment->GetElementPosition() - m_segment->HeadSize()))
+    m_segment->OverwriteHead(*m_out);
+
+  auto result = m_doc_type_version_handler->update_ebml_head(*m_out);
+  if (!mtx::included_in(result, mtx::doc_type_version_handler_c::update_result_e::ok_updated, mtx::doc_type_version_handler_c::update_result_e::ok_no_update_needed))
+    mxwarn(fmt::format("{0}\n", Y("Updating the 'document type version' or 'document type read version' header fields failed.")));
+
+  m_out->close();
+  m_out.reset();
+}
@@ -0,0 +1,94 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for additional destination files
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include "merge/cues.h"
+#include "merge/output_control.h"
+
+namespace libebml {
+  class EbmlVoid;
+}
+
+namespace libmatroska {
+  class KaxDuration;
+}
+
+class kax_cluster_c;
+
+// An additional destination file receives a subset of the tracks
+// written to the main destination file. It is fed with the very same
+// packets the cluster helper renders into the main file so that the
+// source files only have to be read & parsed once no matter how many
+// destination files are created.
+//
+// Each additional file contains the segment information, the track
+// headers, the clusters & the cues for its tracks. Chapters, tags &
+// attachments are only written to the main destination file.
+class additional_output_c {
+protected:
+  std::string m_file_name;
+  std::vector<track_order_t> m_track_ids;
+  std::vector<generic_packetizer_c *> m_packetizers;
+  std::unordered_set<int> m_track_numbers;
+  int m_video_track_number{-1};
+  bool m_webm{};
+
+  mm_io_cptr m_out;
+  std::unique_ptr<mtx::doc_type_version_handler_c> m_doc_type_version_handler;
+  std::unique_ptr<libmatroska::KaxSegment> m_segment;
+  std::unique_ptr<libmatroska::KaxSeekHead> m_seek_head;
+  std::unique_ptr<libebml::EbmlVoid> m_seek_head_void;
+  std::unique_ptr<libmatroska::KaxInfo> m_info;
+  libmatroska::KaxDuration *m_duration{};
+  std::unique_ptr<libmatroska::KaxTracks> m_tracks;
+  uint64_t m_tracks_end_position{};
+  cues_c m_cues;
+
+  std::vector<packet_cptr> m_packets;
+  int64_t m_cluster_content_size{}, m_min_timestamp_in_cluster{-1}, m_max_timestamp_in_cluster{-1};
+  int64_t m_timestamp_offset{}, m_min_timestamp_in_file{-1}, m_max_timestamp_and_duration{};
+  std::unordered_map<int, int64_t> m_last_cue_timestamps;
+  bool m_track_headers_too_big{};
+
+  debugging_option_c m_debug{"additional_output"};
+
+public:
+  additional_output_c(std::string file_name, std::vector<track_order_t> track_ids);
+  ~additional_output_c();
+
+  std::string const &get_file_name() const;
+
+  // Maps the file & track IDs to the packetizers of the main
+  // destination file. Must be called once all packetizers have been
+  // created.
+  void verify();
+
+  void open(libmatroska::KaxInfo const &main_info);
+  void add_packet(packet_cptr const &packet);
+  void rerender_track_headers();
+  void finish();
+
+protected:
+  std::unique_ptr<libmatroska::KaxTracks> create_tracks() const;
+  void render_headers(libmatroska::KaxInfo const &main_info);
+  void render_void(int64_t size);
+  bool is_cluster_full(packet_t const &packet) const;
+  void render_cluster();
+  bool add_to_cues_maybe(packet_t const &packet);
+};
+using additional_output_cptr = std::shared_ptr<additional_output_c>;
+
+extern std::vector<additional_output_cptr> g_additional_outputs;
@@ -18,9 +18,11 @@
 #include "common/doc_type_version_handler.h"
 #include "common/ebml.h"
 #include "common/hacks.h"
+#include "common/kax_flat_cluster.h"
 #include "common/strings/formatting.h"
 #include "common/tags/tags.h"
 #include "common/translation.h"
+#include "merge/additional_output.h"
 #include "merge/cluster_helper.h"
 #include "merge/cues.h"
 #include "merge/generic_packetizer.h"
@@ -167,13 +169,10 @@ cluster_helper_c::split_if_necessary(packet_cptr &packet) {
           && g_video_packetizer))
     return;
 
-  auto &current_split_point = m->split_points[m->current_split_point_idx];
-  bool split_now = false;
+  int64_t additional_size = 0;
 
   // Maybe we want to start a new file now.
-  if (split_point_c::size == current_split_point.m_type) {
-    int64_t additional_size = 0;
-
+  if (split_point_c::size == m->split_points[m->current_split_point_idx].m_type) {
     if (!m->packets.empty())
       // Cluster + Cluster timestamp: roughly 21 bytes. Add all frame sizes & their overheaders, too.
       additional_size = 21 + std::accumulate(m->packets.begin(), m->packets.end(), 0, [](size_t size, const packet_cptr &p) { return size + p->data->get_size() + (p->is_key_frame() ? 10 : p->is_p_frame() ? 13 : 16); });
@@ -183,28 +182,35 @@ cluster_helper_c::split_if_necessary(packet_cptr &packet) {
     mxdebug_if(m->debug_splitting,
                fmt::format("cluster_helper split decision: header_overhead: {0}, additional_size: {1}, bytes_in_file: {2}, sum: {3}\n",
                            m->header_overhead, additional_size, m->bytes_in_file, m->header_overhead + additional_size + m->bytes_in_file));
-    if ((m->header_overhead + additional_size + m->bytes_in_file) >= current_split_point.m_point)
-      split_now = true;
+  }
+
+  if (is_split_point_reached(packet->assigned_timestamp, additional_size, m->frame_field_number))
+    split(packet);
+}
 
-  } else if (   (split_point_c::duration == current_split_point.m_type)
-             && (0 <= m->first_timestamp_in_file)
-                && (timestamp_c::ns(packet->assigned_timestamp - m->first_timestamp_in_file - current_split_point.m_point) > timestamp_c::ms(-1)))
-    split_now = true;
+bool
+cluster_helper_c::is_split_point_reached(int64_t timestamp,
+                                         int64_t additional_size,
+                                         int64_t frame_field_number)
+  const {
+  auto &current_split_point = m->split_points[m->current_split_point_idx];
 
-  else if (   (   (split_point_c::timestamp == current_split_point.m_type)
-               || (split_point_c::parts     == current_split_point.m_type))
-           && (timestamp_c::ns(packet->assigned_timestamp - current_split_point.m_point) > timestamp_c::ms(-1)))
-    split_now = true;
+  if (split_point_c::size == current_split_point.m_type)
+    return (m->header_overhead + additional_size + m->bytes_in_file) >= current_split_point.m_point;
 
-  else if (   (   (split_point_c::frame_field       == current_split_point.m_type)
-               || (split_point_c::parts_frame_field == current_split_point.m_type))
-           && (m->frame_field_number >= current_split_point.m_point))
-    split_now = true;
+  if (split_point_c::duration == current_split_point.m_type)
+    return (0 <= m->first_timestamp_in_file)
+        && (timestamp_c::ns(timestamp - m->first_timestamp_in_file - current_split_point.m_point) > timestamp_c::ms(-1));
 
-  if (!split_now)
-    return;
+  if (   (split_point_c::timestamp == current_split_point.m_type)
+      || (split_point_c::parts     == current_split_point.m_type))
+    return timestamp_c::ns(timestamp - current_split_point.m_point) > timestamp_c::ms(-1);
+
+  if (   (split_point_c::frame_field       == current_split_point.m_type)
+      || (split_point_c::parts_frame_field == current_split_point.m_type))
+    return frame_field_number >= current_split_point.m_point;
 
-  split(packet);
+  return false;
 }
 
 void
@@ -567,6 +573,9 @@ cluster_helper_c::render() {
     pack->account(m->track_statistics[ source->get_uid() ], timestamp_offset);
 
     source->after_packet_rendered(*pack);
+
+    for (auto const &output : g_additional_outputs)
+      output->add_packet(pack);
   }
 
   mtx::at_scope_exit_c cleanup([this]() {
@@ -603,16 +612,220 @@ cluster_helper_c::render() {
   return 1;
 }
 
+// Writes a cluster read from a Matroska source file to the output
+// without re-creating its blocks. Only the cluster's timestamp is
+// rewritten; blocks of tracks that aren't copied are left out. This
+// only works if the cluster's content would end up unchanged in the
+// output anyway, e.g. if no split point is reached within it. If
+// false is returned nothing has been written & the caller has to
+// process the cluster's blocks the usual way.
+bool
+cluster_helper_c::copy_cluster(kax_flat_cluster_c const &cluster,
+                               std::unordered_map<uint64_t, generic_packetizer_c *> const &packetizers) {
+  if (   !cluster.is_raw()
+      || !m->out
+      || (chapter_generation_mode_e::none != m->chapter_generation_mode)
+      || (!discarding() && (0 > m->first_timestamp_in_file)))
+    return false;
+
+  auto frame_duration_for = [](kax_flat_cluster_c::block_t const &block, generic_packetizer_c const &ptzr) -> int64_t {
+    auto default_duration = std::max<int64_t>(ptzr.get_track_default_duration(), 0);
+    if (block.m_simple || !block.m_duration)
+      return default_duration;
+    return *block.m_duration / std::max<std::size_t>(block.m_num_frames, 1);
+  };
+
+  // Clusters are created & rendered lazily; make sure all frames
+  // queued so far end up in the file before the copied cluster.
+  if (!m->packets.empty()) {
+    render();
+    prepare_new_cluster();
+  }
+
+  if ((-1 == m->header_overhead) && splitting())
+    m->header_overhead = m->out->getFilePointer() + g_tags_size;
+
+  auto scale            = static_cast<int64_t>(g_timestamp_scale);
+  auto timestamp_offset = m->timestamp_offset + get_discarded_duration();
+  auto timestamp_shift  = (timestamp_offset + scale - 1) / scale;
+
+  if (   (0 > timestamp_offset)
+      || (static_cast<int64_t>(cluster.get_timestamp()) < timestamp_shift))
+    return false;
+
+  // First pass: check whether or not the cluster can be copied as-is.
+  auto &blocks            = cluster.get_blocks();
+  auto check_splitting    = splitting() && (m->current_split_point_idx < m->split_points.size()) && (g_file_num <= g_split_max_num_files);
+  auto additional_size    = static_cast<int64_t>(21 + cluster.get_size() + 18 * (m->num_cue_elements + blocks.size()));
+  auto frame_field_number = m->frame_field_number;
+  auto use_simple_blocks  = !mtx::hacks::is_engaged(mtx::hacks::NO_SIMPLE_BLOCKS);
+  auto has_simple_blocks  = false;
+  uint64_t blocks_size    = 0;
+
+  for (auto const &block : blocks) {
+    auto ptzr_itr = packetizers.find(block.m_track_number);
+    if (ptzr_itr == packetizers.end())
+      return false;
+
+    auto ptzr = ptzr_itr->second;
+    if (!ptzr)
+      continue;
+
+    if (   !block.m_num_frames
+        || block.m_codec_state.m_data
+        || block.m_discard_padding
+        || (block.m_simple && !use_simple_blocks))
+      return false;
+
+    auto additions = cluster.get_additions(block);
+    for (auto idx = 0u; idx < block.m_num_additions; ++idx)
+      if (additions[idx].m_id != (idx + 1))
+        return false;
+
+    auto key_frame      = block.m_simple ? block.m_key : block.m_references.empty();
+    auto relevant       = key_frame && (!g_video_packetizer || (ptzr->get_track_type() == track_video));
+    auto frame_duration = frame_duration_for(block, *ptzr);
+
+    for (auto idx = 0u; idx < block.m_num_frames; ++idx) {
+      auto timestamp = round_timestamp_scale(block.m_timestamp + idx * frame_duration);
+      if (timestamp < timestamp_offset)
+        return false;
+
+      if (check_splitting && relevant && is_split_point_reached(timestamp, additional_size, frame_field_number))
+        return false;
+
+      if (g_video_packetizer == ptzr)
+        ++frame_field_number;
+    }
+
+    blocks_size       += block.m_element_size;
+    has_simple_blocks |= block.m_simple;
+  }
+
+  // Second pass: write the cluster & account for its frames.
+  auto discarding        = this->discarding();
+  auto write_cluster     = !discarding && blocks_size;
+  auto cluster_timestamp = cluster.get_timestamp() - timestamp_shift;
+  auto cluster_position  = m->out->getFilePointer();
+  auto relative_position = uint64_t{};
+
+  if (write_cluster) {
+    // ClusterTimestamp: ID 0xe7, size & the value in as few bytes as possible
+    unsigned char timestamp_element[10];
+    auto num_bytes = 1u;
+    while ((num_bytes < 8) && (cluster_timestamp >> (num_bytes * 8)))
+      ++num_bytes;
+
+    timestamp_element[0] = 0xe7;
+    timestamp_element[1] = 0x80 | num_bytes;
+    for (auto idx = 0u; idx < num_bytes; ++idx)
+      timestamp_element[2 + idx] = (cluster_timestamp >> ((num_bytes - idx - 1) * 8)) & 0xff;
+
+    relative_position = 2 + num_bytes;
+
+    write_ebml_element_head(*m->out, EBML_ID(KaxCluster), relative_position + blocks_size);
+    m->out->write(timestamp_element, relative_position);
+  }
+
+  for (auto const &block : blocks) {
+    auto ptzr = packetizers.find(block.m_track_number)->second;
+    if (!ptzr)
+      continue;
+
+    auto key_frame      = block.m_simple ? block.m_key : block.m_references.empty();
+    auto frame_duration = frame_duration_for(block, *ptzr);
+    auto duration       = round_timestamp_scale(frame_duration);
+    auto additions      = cluster.get_additions(block);
+    auto additions_size = uint64_t{};
+
+    for (auto idx = 0u; idx < block.m_num_additions; ++idx)
+      additions_size += additions[idx].m_size;
+
+    if (write_cluster) {
+      m->out->write(cluster.get_raw_element(block), block.m_element_size);
+
+      if (g_write_cues && add_to_cues_maybe(*ptzr, block.m_timestamp, key_frame, false))
+        cues_c::get().add(cue_point_t{ static_cast<uint64_t>(block.m_timestamp - timestamp_shift * scale), ptzr->wants_cue_duration() ? static_cast<uint64_t>(duration) : 0,
+                                       g_kax_segment->GetRelativePosition(cluster_position), static_cast<uint32_t>(ptzr->get_track_num()), static_cast<uint32_t>(relative_position) });
+
+      relative_position += block.m_element_size;
+    }
+
+    for (auto idx = 0u; idx < block.m_num_frames; ++idx) {
+      auto unmodified_timestamp = block.m_timestamp + idx * frame_duration;
+      auto timestamp            = round_timestamp_scale(unmodified_timestamp);
+
+      if (g_video_packetizer == ptzr) {
+        m->max_video_timestamp_rendered = std::max(timestamp + duration, m->max_video_timestamp_rendered);
+        ++m->frame_field_number;
+      }
+
+      if (discarding) {
+        if (-1 == m->first_discarded_timestamp)
+          m->first_discarded_timestamp = timestamp;
+        m->last_discarded_timestamp_and_duration = std::max(m->last_discarded_timestamp_and_duration, timestamp + duration);
+
+      } else {
+        if (-1 == m->first_timestamp_in_part)
+          m->first_timestamp_in_part = timestamp;
+
+        m->min_timestamp_in_file      = std::min(timestamp_c::ns(timestamp), m->min_timestamp_in_file.value_or_max());
+        m->max_timestamp_in_file      = std::max(timestamp,                  m->max_timestamp_in_file);
+        m->max_timestamp_and_duration = std::max(timestamp + duration,       m->max_timestamp_and_duration);
+
+        m->track_statistics[ptzr->get_uid()].account(timestamp - timestamp_offset, duration, cluster.get_frame(block, idx).m_size + additions_size);
+      }
+
+      ptzr->account_stream_copied_frame(unmodified_timestamp, frame_duration);
+    }
+  }
+
+  if (write_cluster) {
+    if (has_simple_blocks) {
+      static KaxSimpleBlock s_simple_block;
+      g_doc_type_version_handler->account(s_simple_block, true);
+    }
+
+    m->bytes_in_file       += m->out->getFilePointer() - cluster_position;
+    m->previous_cluster_ts  = cluster_timestamp * scale;
+
+    if (g_kax_sh_cues) {
+      static unsigned char const s_cluster_id[] = { 0x1f, 0x43, 0xb6, 0x75 };
+      auto &seek = AddEmptyChild<KaxSeek>(*g_kax_sh_cues);
+      GetChild<KaxSeekID>(seek).CopyBuffer(s_cluster_id, sizeof(s_cluster_id));
+      GetChild<KaxSeekPosition>(seek).SetValue(g_kax_segment->GetRelativePosition(cluster_position));
+    }
+  }
+
+  mxdebug_if(m->debug_rendering,
+             fmt::format("copy_cluster: source timestamp {0} position {1} size {2}: written {3} cluster timestamp {4} discarding {5}\n",
+                         cluster.get_timestamp(), cluster.get_position(), cluster.get_size(), write_cluster, cluster_timestamp, discarding));
+
+  m->min_timestamp_in_cluster = -1;
+  m->max_timestamp_in_cluster = -1;
+
+  prepare_new_cluster();
+
+  return true;
+}
+
 bool
 cluster_helper_c::add_to_cues_maybe(packet_cptr &pack) {
-  auto &source  = *pack->source;
+  return add_to_cues_maybe(*pack->source, pack->assigned_timestamp, pack->is_key_frame(), !!pack->codec_state);
+}
+
+bool
+cluster_helper_c::add_to_cues_maybe(generic_packetizer_c &source,
+                                    int64_t timestamp,
+                                    bool key_frame,
+                                    bool has_codec_state) {
   auto strategy = source.get_cue_creation();
 
   // Update the cues (index table) either if cue entries for I frames were requested and this is an I frame...
-  bool add = (CUE_STRATEGY_IFRAMES == strategy) && pack->is_key_frame();
+  bool add = (CUE_STRATEGY_IFRAMES == strategy) && key_frame;
 
   // ... or if a codec state change is present ...
-  add = add || !!pack->codec_state;
+  add = add || has_codec_state;
 
   // ... or if the user requested entries for all frames ...
   add = add || (CUE_STRATEGY_ALL == strategy);
@@ -623,14 +836,14 @@ cluster_helper_c::add_to_cues_maybe(packet_cptr &pack) {
   add = add || (   (CUE_STRATEGY_SPARSE == strategy)
                 && (track_audio         == source.get_track_type())
                 && !g_video_packetizer
-                && pack->is_key_frame()
+                && key_frame
                 && (   (0 > source.get_last_cue_timestamp())
-                    || ((pack->assigned_timestamp - source.get_last_cue_timestamp()) >= 500'000'000)));
+                    || ((timestamp - source.get_last_cue_timestamp()) >= 500'000'000)));
 
   if (!add)
     return false;
 
-  source.set_last_cue_timestamp(pack->assigned_timestamp);
+  source.set_last_cue_timestamp(timestamp);
 
   ++m->num_cue_elements;
   g_cue_writing_requested = 1;
@@ -28,6 +28,7 @@
 #include "merge/libmatroska_extensions.h"
 
 class generic_packetizer_c;
+class kax_flat_cluster_c;
 class render_groups_c;
 class packet_t;
 using packet_cptr = std::shared_ptr<packet_t>;
@@ -52,6 +53,7 @@ public:
   void prepare_new_cluster();
   libmatroska::KaxCluster *get_cluster();
   void add_packet(packet_cptr packet);
+  bool copy_cluster(kax_flat_cluster_c const &cluster, std::unordered_map<uint64_t, generic_packetizer_c *> const &packetizers);
   int64_t get_timestamp();
   int render();
   int get_cluster_content_size();
@@ -90,11 +92,13 @@ private:
   void render_before_adding_if_necessary(packet_cptr &packet);
   void render_after_adding_if_necessary(packet_cptr &packet);
   void split_if_necessary(packet_cptr &packet);
+  bool is_split_point_reached(int64_t timestamp, int64_t additional_size, int64_t frame_field_number) const;
   void generate_chapters_if_necessary(packet_cptr const &packet);
   void generate_one_chapter(timestamp_c const &timestamp);
   void split(packet_cptr &packet);
 
   bool add_to_cues_maybe(packet_cptr &pack);
+  bool add_to_cues_maybe(generic_packetizer_c &source, int64_t timestamp, bool key_frame, bool has_codec_state);
 };
 
 extern std::unique_ptr<cluster_helper_c> g_cluster_helper;
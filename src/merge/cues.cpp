@@ -74,10 +74,35 @@ cues_c::add(KaxCuePoint &point) {
   }
 }
 
+// Adds a cue point whose duration & relative position are already
+// known, e.g. for clusters that have been copied from the source file.
+void
+cues_c::add(cue_point_t const &point) {
+  m_points.push_back(point);
+
+  if (m_no_cue_duration)
+    m_points.back().duration = 0;
+  if (m_no_cue_relative_position)
+    m_points.back().relative_position = 0;
+
+  m_num_cue_points_postprocessed = m_points.size();
+}
+
 void
 cues_c::write(mm_io_c &out,
               KaxSeekHead &seek_head) {
-  if (!m_points.size() || !g_cue_writing_requested)
+  if (!g_cue_writing_requested)
+    return;
+
+  write(out, seek_head, *g_kax_segment, *g_doc_type_version_handler);
+}
+
+void
+cues_c::write(mm_io_c &out,
+              KaxSeekHead &seek_head,
+              KaxSegment &segment,
+              mtx::doc_type_version_handler_c &doc_type_version_handler) {
+  if (!m_points.size())
     return;
 
   // auto start = mtx::sys::get_current_time_millis();
@@ -95,7 +120,7 @@ cues_c::write(mm_io_c &out,
   out.restore_pos();
 
   // Write meta seek information if it is not disabled.
-  seek_head.IndexThis(cues_dummy, *g_kax_segment);
+  seek_head.IndexThis(cues_dummy, segment);
 
   // Forcefully write the correct head and copy its content from the
   // temporary storage location.
@@ -121,7 +146,7 @@ cues_c::write(mm_io_c &out,
     if (point.duration)
       GetChild<KaxCueDuration>(positions).SetValue(round_timestamp_scale(point.duration) / g_timestamp_scale);
 
-    g_doc_type_version_handler->render(kc_point, out);
+    doc_type_version_handler.render(kc_point, out);
   }
 
   m_points.clear();
@@ -19,6 +19,14 @@
 #include <matroska/KaxCuesData.h>
 #include <matroska/KaxSeekHead.h>
 
+namespace libmatroska {
+  class KaxSegment;
+}
+
+namespace mtx {
+class doc_type_version_handler_c;
+}
+
 using id_timestamp_t = std::pair<uint64_t, uint64_t>;
 
 struct cue_point_t {
@@ -47,7 +55,9 @@ public:
 
   void add(libmatroska::KaxCues &cues);
   void add(libmatroska::KaxCuePoint &point);
+  void add(cue_point_t const &point);
   void write(mm_io_c &out, libmatroska::KaxSeekHead &seek_head);
+  void write(mm_io_c &out, libmatroska::KaxSeekHead &seek_head, libmatroska::KaxSegment &segment, mtx::doc_type_version_handler_c &doc_type_version_handler);
   void postprocess_cues(libmatroska::KaxCues &cues, libmatroska::KaxCluster &cluster);
   void set_duration_for_id_timestamp(uint64_t id, uint64_t timestamp, uint64_t duration);
   void adjust_positions(uint64_t old_position, uint64_t delta);
@@ -30,6 +30,7 @@
 #include "common/ebml.h"
 #include "common/hacks.h"
 #include "common/strings/formatting.h"
+#include "common/thread_pool.h"
 #include "common/unique_numbers.h"
 #include "common/xml/ebml_tags_converter.h"
 #include "merge/cluster_helper.h"
@@ -37,6 +38,7 @@
 #include "merge/generic_packetizer.h"
 #include "merge/generic_reader.h"
 #include "merge/output_control.h"
+#include "merge/packet_spill_file.h"
 #include "merge/webm.h"
 
 using namespace libmatroska;
@@ -67,6 +69,7 @@ static std::unordered_map<std::string, bool> s_experimental_status_warning_shown
 std::vector<generic_packetizer_c *> ptzrs_in_header_order;
 
 int generic_packetizer_c::ms_track_number = 0;
+int64_t generic_packetizer_c::ms_queued_bytes_in_memory = 0;
 
 generic_packetizer_c::generic_packetizer_c(generic_reader_c *reader,
                                            track_info_c &ti)
@@ -169,6 +172,11 @@ generic_packetizer_c::generic_packetizer_c(generic_reader_c *reader,
   else if (mtx::includes(m_ti.m_compression_list, -1))
     m_ti.m_compression = m_ti.m_compression_list[-1];
 
+  if (mtx::includes(m_ti.m_compression_parameters_list, m_ti.m_id))
+    m_ti.m_compression_parameters = m_ti.m_compression_parameters_list[m_ti.m_id];
+  else if (mtx::includes(m_ti.m_compression_parameters_list, -1))
+    m_ti.m_compression_parameters = m_ti.m_compression_parameters_list[-1];
+
   // Let's see if the user has specified a name for this track.
   if (mtx::includes(m_ti.m_track_names, m_ti.m_id))
     m_ti.m_track_name = m_ti.m_track_names[m_ti.m_id];
@@ -1309,7 +1317,7 @@ generic_packetizer_c::set_headers() {
     GetChild<KaxContentEncodingType >(c_encoding).SetValue(0); // It's a compression.
     GetChild<KaxContentEncodingScope>(c_encoding).SetValue(1); // Only the frame contents have been compresed.
 
-    m_compressor = compressor_c::create(m_hcompression);
+    m_compressor = compressor_c::create(m_hcompression, m_ti.m_compression_parameters);
     m_compressor->set_track_headers(c_encoding);
   }
 
@@ -1365,6 +1373,11 @@ generic_packetizer_c::compress_packet(packet_t &packet) {
     return;
   }
 
+  if (m_compressor->is_thread_safe() && !mtx::hacks::is_engaged(mtx::hacks::NO_PARALLEL_COMPRESSION)) {
+    compress_packet_in_background(packet);
+    return;
+  }
+
   try {
     packet.data = m_compressor->compress(packet.data);
     size_t i;
@@ -1376,10 +1389,90 @@ generic_packetizer_c::compress_packet(packet_t &packet) {
   }
 }
 
+void
+generic_packetizer_c::compress_packet_in_background(packet_t &packet) {
+  auto compressor = m_compressor;
+  auto data       = packet.data;
+  auto data_adds  = packet.data_adds;
+
+  auto job        = [compressor, data, data_adds]() {
+    compressed_data_t result;
+
+    result.m_data = compressor->compress(data);
+    for (auto const &data_add : data_adds)
+      result.m_data_adds.emplace_back(compressor->compress(data_add));
+
+    return result;
+  };
+
+  m_pending_compressions.push_back({ &packet, mtx::thread_pool_c::global().submit(std::move(job)) });
+}
+
+void
+generic_packetizer_c::finish_background_compression(packet_t &packet) {
+  if (m_pending_compressions.empty() || (m_pending_compressions.front().first != &packet))
+    return;
+
+  auto result = std::move(m_pending_compressions.front().second);
+  m_pending_compressions.pop_front();
+
+  try {
+    auto compressed = result.get();
+
+    packet.data      = compressed.m_data;
+    packet.data_adds = compressed.m_data_adds;
+
+  } catch (mtx::compression_x &e) {
+    mxerror_tid(m_ti.m_fname, m_ti.m_id, fmt::format(Y("Compression failed: {0}\n"), e.error()));
+  }
+}
+
 void
 generic_packetizer_c::account_enqueued_bytes(packet_t &packet,
                                              int64_t factor) {
-  m_enqueued_bytes += packet.calculate_uncompressed_size() * factor;
+  auto num_bytes = static_cast<int64_t>(packet.calculate_uncompressed_size()) * factor;
+
+  m_enqueued_bytes          += num_bytes;
+  ms_queued_bytes_in_memory += num_bytes;
+}
+
+// Packets are output in the order they're queued in. The packet
+// queued last is therefore the one needed last, and its payload is
+// moved to the spill file while too much data is kept in memory.
+// Payloads of compressed tracks are kept as the compression may still
+// be running in the background.
+void
+generic_packetizer_c::spill_packet_data_maybe(packet_t &packet) {
+  if (   !g_max_queued_bytes_in_memory
+      || (ms_queued_bytes_in_memory <= g_max_queued_bytes_in_memory)
+      || m_compressor
+      || !packet.data
+      || !packet.data->get_size())
+    return;
+
+  auto position = packet_spill_file_c::get().spill(*packet.data);
+  if (!position)
+    return;
+
+  auto num_bytes      = static_cast<int64_t>(packet.data->get_size());
+  packet.spilled_data = std::make_pair(*position, static_cast<uint64_t>(num_bytes));
+  packet.data.reset();
+
+  m_spilled_bytes           += num_bytes;
+  ms_queued_bytes_in_memory -= num_bytes;
+}
+
+void
+generic_packetizer_c::restore_spilled_packet_data(packet_t &packet) {
+  if (!packet.spilled_data)
+    return;
+
+  auto [position, num_bytes] = *packet.spilled_data;
+  packet.data                = packet_spill_file_c::get().restore(position, num_bytes);
+  packet.spilled_data.reset();
+
+  m_spilled_bytes           -= num_bytes;
+  ms_queued_bytes_in_memory += num_bytes;
 }
 
 void
@@ -1478,6 +1571,8 @@ generic_packetizer_c::add_packet2(packet_cptr const &pack) {
   after_packet_timestamped(*pack);
 
   compress_packet(*pack);
+
+  spill_packet_data_maybe(*pack);
 }
 
 void
@@ -1495,6 +1590,9 @@ generic_packetizer_c::get_packet() {
   packet_cptr pack = m_packet_queue.front();
   m_packet_queue.pop_front();
 
+  restore_spilled_packet_data(*pack);
+  finish_background_compression(*pack);
+
   pack->output_order_timestamp = timestamp_c::ns(pack->assigned_timestamp - std::max(m_codec_delay.to_ns(0), m_seek_pre_roll.to_ns(0)));
 
   account_enqueued_bytes(*pack, -1);
@@ -1573,7 +1671,7 @@ generic_packetizer_c::apply_factory_short_queueing(packet_cptr_di &p_start) {
 
 struct packet_sorter_t {
   int m_index;
-  static std::deque<packet_cptr> *m_packet_queue;
+  static packet_queue_t *m_packet_queue;
 
   packet_sorter_t(int index)
     : m_index(index)
@@ -1585,7 +1683,7 @@ struct packet_sorter_t {
   }
 };
 
-std::deque<packet_cptr> *packet_sorter_t::m_packet_queue = nullptr;
+packet_queue_t *packet_sorter_t::m_packet_queue = nullptr;
 
 void
 generic_packetizer_c::apply_factory_full_queueing(packet_cptr_di &p_start) {
@@ -1665,7 +1763,7 @@ generic_packetizer_c::connect(generic_packetizer_c *src,
   m_htrack_default_duration     = src->m_htrack_default_duration;
   m_huid                        = src->m_huid;
   m_hcompression                = src->m_hcompression;
-  m_compressor                  = compressor_c::create(m_hcompression);
+  m_compressor                  = compressor_c::create(m_hcompression, src->m_ti.m_compression_parameters);
   m_last_cue_timestamp          = src->m_last_cue_timestamp;
   m_timestamp_factory           = src->m_timestamp_factory;
   m_correction_timestamp_offset = 0;
@@ -1716,10 +1814,55 @@ generic_packetizer_c::is_compatible_with(output_compatibility_e compatibility) {
   return OC_MATROSKA == compatibility;
 }
 
+// Whether or not frames can be written to the output file exactly
+// as they're stored in the source file, bypassing this packetizer
+// altogether. Only the packetizer's own modifications are taken into
+// account here; the reader must check whether or not the frames
+// themselves need to be modified.
+bool
+generic_packetizer_c::is_stream_copy_possible()
+  const {
+  return !m_timestamp_factory
+      && (1 == m_ti.m_tcsync.factor)
+      && !m_ti.m_tcsync.displacement
+      && !m_ti.m_reset_timestamps
+      && !m_compressor
+      && (-1 == m_htrack_max_add_block_ids)
+      && !m_connected_to
+      && !m_connected_successor
+      && !m_correction_timestamp_offset
+      && !m_append_timestamp_offset;
+}
+
+// Updates the state normally updated when a packet passes through
+// the packetizer for a frame that has been copied to the output file
+// directly.
+void
+generic_packetizer_c::account_stream_copied_frame(int64_t timestamp,
+                                                  int64_t duration) {
+  ++m_num_packets;
+
+  if (!m_reader->m_ptzr_first_packet)
+    m_reader->m_ptzr_first_packet = this;
+
+  m_safety_last_timestamp        = timestamp;
+  m_safety_last_duration         = duration;
+  m_max_timestamp_seen           = std::max(m_max_timestamp_seen, timestamp + duration);
+  m_reader->m_max_timestamp_seen = std::max(m_max_timestamp_seen, m_reader->m_max_timestamp_seen);
+}
+
 void
 generic_packetizer_c::discard_queued_packets() {
+  for (auto const &packet : m_packet_queue)
+    if (packet->spilled_data)
+      packet_spill_file_c::get().forget(packet->spilled_data->first);
+
+  ms_queued_bytes_in_memory -= get_queued_bytes_in_memory();
+
   m_packet_queue.clear();
+  m_pending_compressions.clear();
   m_enqueued_bytes = 0;
+  m_spilled_bytes  = 0;
 }
 
 bool
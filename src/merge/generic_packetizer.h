@@ -15,9 +15,10 @@
 
 #include "common/common_pch.h"
 
-#include <deque>
+#include <future>
 
 #include "common/option_with_source.h"
+#include "common/ring_buffer.h"
 #include "common/timestamp.h"
 #include "common/translation.h"
 #include "merge/block_addition_mapping.h"
@@ -46,7 +47,8 @@ enum split_result_e {
   CAN_SPLIT_NO_UNSUPPORTED,
 };
 
-using packet_cptr_di = std::deque<packet_cptr>::iterator;
+using packet_queue_t = mtx::ring_buffer_c<packet_cptr>;
+using packet_cptr_di = packet_queue_t::iterator;
 
 class generic_packetizer_c {
 public:
@@ -60,10 +62,10 @@ public:
 
 protected:
   int m_num_packets;
-  std::deque<packet_cptr> m_packet_queue, m_deferred_packets;
+  packet_queue_t m_packet_queue, m_deferred_packets;
   int m_next_packet_wo_assigned_timestamp;
 
-  int64_t m_free_refs, m_next_free_refs, m_enqueued_bytes;
+  int64_t m_free_refs, m_next_free_refs, m_enqueued_bytes, m_spilled_bytes{};
   int64_t m_safety_last_timestamp, m_safety_last_duration;
 
   libmatroska::KaxTrackEntry *m_track_entry;
@@ -91,6 +93,14 @@ protected:
   compression_method_e m_hcompression;
   compressor_ptr m_compressor;
 
+  // Compression jobs running on the global thread pool, in the same
+  // order as the corresponding packets in m_packet_queue.
+  struct compressed_data_t {
+    memory_cptr m_data;
+    packet_t::data_adds_t m_data_adds;
+  };
+  mtx::ring_buffer_c<std::pair<packet_t *, std::future<compressed_data_t>>> m_pending_compressions;
+
   timestamp_factory_cptr m_timestamp_factory;
   timestamp_factory_application_e m_timestamp_factory_application_mode;
 
@@ -105,6 +115,7 @@ protected:
 
 protected:                      // static
   static int ms_track_number;
+  static int64_t ms_queued_bytes_in_memory;
 
 public:
   track_info_c m_ti;
@@ -138,6 +149,12 @@ public:
   inline int64_t get_queued_bytes() const {
     return m_enqueued_bytes;
   }
+  inline int64_t get_queued_bytes_in_memory() const {
+    return m_enqueued_bytes - m_spilled_bytes;
+  }
+  static int64_t get_total_queued_bytes_in_memory() {
+    return ms_queued_bytes_in_memory;
+  }
 
   inline void set_free_refs(int64_t free_refs) {
     m_free_refs      = m_next_free_refs;
@@ -288,6 +305,9 @@ public:
 
   virtual bool is_compatible_with(output_compatibility_e compatibility);
 
+  virtual bool is_stream_copy_possible() const;
+  virtual void account_stream_copied_frame(int64_t timestamp, int64_t duration);
+
   int64_t create_track_number();
 
   virtual void prevent_lacing();
@@ -312,7 +332,11 @@ protected:
   virtual void show_experimental_status_version(std::string const &codec_id);
 
   virtual void compress_packet(packet_t &packet);
+  virtual void compress_packet_in_background(packet_t &packet);
+  virtual void finish_background_compression(packet_t &packet);
   virtual void account_enqueued_bytes(packet_t &packet, int64_t factor);
+  virtual void spill_packet_data_maybe(packet_t &packet);
+  virtual void restore_spilled_packet_data(packet_t &packet);
 
   virtual void apply_block_addition_mappings();
 };
@@ -111,6 +111,12 @@ public:
   virtual bool is_simple_subtitle_container() {
     return false;
   }
+  // Copies the next chunk of the source file to the output file
+  // directly if the reader supports it & nothing needs to be
+  // modified. Returns true if data was consumed that way.
+  virtual bool copy_next_cluster() {
+    return false;
+  }
 
   virtual file_status_e flush_packetizer(int num);
   virtual file_status_e flush_packetizer(generic_packetizer_c *packetizer);
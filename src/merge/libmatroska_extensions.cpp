@@ -16,6 +16,9 @@
 
 #include <cassert>
 
+#include "common/ebml.h"
+#include "common/mm_file_io.h"
+#include "common/mm_io_x.h"
 #include "merge/libmatroska_extensions.h"
 
 using namespace libmatroska;
@@ -181,3 +184,60 @@ kax_cues_with_cleanup_c::~kax_cues_with_cleanup_c() {
   // non-eempty. We don't care about that assertion.
   myTempReferences.clear();
 }
+
+kax_attachment_file_data_c::kax_attachment_file_data_c(attachment_cptr const &attachment)
+  : KaxFileData{}
+  , m_attachment{attachment}
+{
+  SetSize_(m_attachment->get_size());
+  SetValueIsSet();
+}
+
+void
+kax_attachment_file_data_c::replace_in(libmatroska::KaxAttached &attached,
+                                       attachment_cptr const &attachment) {
+  DeleteChildren<libmatroska::KaxFileData>(attached);
+  attached.PushElement(*new kax_attachment_file_data_c{attachment});
+}
+
+filepos_t
+kax_attachment_file_data_c::UpdateSize(bool,
+                                       bool) {
+  SetSize_(m_attachment->get_size());
+  return GetSize();
+}
+
+filepos_t
+kax_attachment_file_data_c::RenderData(libebml::IOCallback &output,
+                                       bool,
+                                       bool) {
+  if (m_attachment->data) {
+    output.writeFully(m_attachment->data->get_buffer(), m_attachment->data->get_size());
+    return m_attachment->data->get_size();
+  }
+
+  static auto const s_chunk_size = 1024u * 1024u;
+
+  try {
+    mm_file_io_c in{m_attachment->data_file_name};
+    in.setFilePointer(m_attachment->data_position);
+
+    auto buffer    = memory_c::alloc(std::min<uint64_t>(s_chunk_size, m_attachment->data_size));
+    auto remaining = m_attachment->data_size;
+
+    while (remaining) {
+      auto to_copy = std::min<uint64_t>(remaining, buffer->get_size());
+
+      if (in.read(buffer->get_buffer(), to_copy) != to_copy)
+        throw mtx::mm_io::end_of_file_x{};
+
+      output.writeFully(buffer->get_buffer(), to_copy);
+      remaining -= to_copy;
+    }
+
+  } catch (mtx::mm_io::exception &) {
+    mxerror(fmt::format(Y("The attachment '{0}' could not be read.\n"), m_attachment->name));
+  }
+
+  return m_attachment->data_size;
+}
@@ -17,11 +17,14 @@
 #include "common/common_pch.h"
 
 #include <ebml/EbmlVersion.h>
+#include <matroska/KaxAttached.h>
 #include <matroska/KaxBlock.h>
 #include <matroska/KaxBlockData.h>
 #include <matroska/KaxCluster.h>
 #include <matroska/KaxSeekHead.h>
 
+#include "common/attachment.h"
+
 class kax_cluster_c: public libmatroska::KaxCluster {
 public:
   kax_cluster_c(): libmatroska::KaxCluster() {
@@ -95,3 +98,26 @@ public:
   kax_cues_with_cleanup_c();
   virtual ~kax_cues_with_cleanup_c();
 };
+
+// Renders the content of an attachment without a copy of it being
+// held by the element. Content that isn't in memory is copied from
+// the file it's located in in small chunks.
+class kax_attachment_file_data_c: public libmatroska::KaxFileData {
+protected:
+  attachment_cptr m_attachment;
+
+public:
+  kax_attachment_file_data_c(attachment_cptr const &attachment);
+
+  attachment_cptr const &get_attachment() const {
+    return m_attachment;
+  }
+
+  virtual filepos_t UpdateSize(bool bSaveDefault, bool bForceRender);
+  virtual filepos_t RenderData(libebml::IOCallback &output, bool bForceRender, bool bSaveDefault);
+
+public:
+  // libebml adds an empty FileData to each new attachment as the
+  // element is mandatory. It must be replaced, not supplemented.
+  static void replace_in(libmatroska::KaxAttached &attached, attachment_cptr const &attachment);
+};
@@ -48,6 +48,7 @@
 #include "common/ebml.h"
 #include "common/file_types.h"
 #include "common/fs_sys_helpers.h"
+#include "common/hacks.h"
 #include "common/iso639.h"
 #include "common/kax_analyzer.h"
 #include "common/list_utils.h"
@@ -65,6 +66,7 @@
 #include "common/webm.h"
 #include "common/xml/ebml_segmentinfo_converter.h"
 #include "common/xml/ebml_tags_converter.h"
+#include "merge/additional_output.h"
 #include "merge/cluster_helper.h"
 #include "merge/filelist.h"
 #include "merge/generic_reader.h"
@@ -127,11 +129,19 @@ set_usage() {
                   "                           A comma separated list of both file IDs\n"
                   "                           and track IDs that controls the order of the\n"
                   "                           tracks in the destination file.\n");
+  usage_text += Y("  --additional-output <FileID1:TID1,FileID2:TID2,...=file name>\n"
+                  "                           Write the listed tracks to an additional\n"
+                  "                           destination file as well. The source files\n"
+                  "                           are only read once for all destination files.\n");
   usage_text += Y("  --cluster-length <n[ms]> Put at most n data blocks into each cluster.\n"
                   "                           If the number is postfixed with 'ms' then\n"
                   "                           put at most n milliseconds of data into each\n"
                   "                           cluster.\n");
   usage_text += Y("  --clusters-in-meta-seek  Write meta seek data for clusters.\n");
+  usage_text += Y("  --max-queued-data <d[K,M,G]>\n"
+                  "                           Keep at most d bytes (KB, MB, GB) of data queued\n"
+                  "                           for writing in memory and store the rest in a\n"
+                  "                           temporary file.\n");
   usage_text += Y("  --timestamp-scale <n>    Force the timestamp scale factor to n.\n");
   usage_text += Y("  --enable-durations       Enable block durations for all blocks.\n");
   usage_text += Y("  --no-cues                Do not write the cue data (the index).\n");
@@ -368,9 +378,10 @@ set_usage() {
                   "                           read as for the conversion to UTF-8.\n");
   usage_text +=   "\n";
   usage_text += Y(" Options that only apply to VobSub subtitle tracks:\n");
-  usage_text += Y("  --compression <TID:method>\n"
+  usage_text += Y("  --compression <TID:method[,level=n][,dictionary=file]>\n"
                   "                           Sets the compression method used for the\n"
-                  "                           specified track ('none' or 'zlib').\n");
+                  "                           specified track ('none' or 'zlib'; 'zstd' & 'lz4'\n"
+                  "                           require '--engage allow_nonstandard_compression').\n");
   usage_text +=   "\n\n";
   usage_text += Y(" Other options:\n");
   usage_text += Y("  -i, --identify <file>    Print information about the source file.\n");
@@ -1161,29 +1172,11 @@ parse_arg_split_size(const std::string &arg) {
   if (balg::istarts_with(s, "size:"))
     s.erase(0, strlen("size:"));
 
-  if (s.empty())
-    mxerror(fmt::format(err_msg, arg));
-
-  // Size in bytes/KB/MB/GB
-  char mod         = tolower(s[s.length() - 1]);
-  int64_t modifier = 1;
-  if ('k' == mod)
-    modifier = 1024;
-  else if ('m' == mod)
-    modifier = 1024 * 1024;
-  else if ('g' == mod)
-    modifier = 1024 * 1024 * 1024;
-  else if (!isdigit(mod))
-    mxerror(fmt::format(err_msg, arg));
-
-  if (1 != modifier)
-    s.erase(s.size() - 1);
-
   int64_t split_after = 0;
-  if (!mtx::string::parse_number(s, split_after))
+  if (!mtx::string::parse_size_number_with_unit(s, split_after))
     mxerror(fmt::format(err_msg, arg));
 
-  g_cluster_helper->add_split_point(split_point_c(split_after * modifier, split_point_c::size, false));
+  g_cluster_helper->add_split_point(split_point_c(split_after, split_point_c::size, false));
 }
 
 /** \brief Parse the \c --split argument
@@ -1314,6 +1307,9 @@ parse_arg_cues(const std::string &s,
 /** \brief Parse the \c --compression argument
 
    The argument must have the form \c TID:compression, e.g. \c 0:zlib.
+   It can be followed by comma-separated parameters,
+   e.g. \c 0:zstd,level=19,dictionary=subs.dict. As file names may
+   contain commas, the dictionary must be the last parameter.
 */
 static void
 parse_arg_compression(const std::string &s,
@@ -1331,29 +1327,78 @@ parse_arg_compression(const std::string &s,
   if (parts[1].size() == 0)
     mxerror(fmt::format(Y("Invalid compression option specified in '--compression {0}'.\n"), s));
 
+  auto method_and_parameters = mtx::string::split(parts[1], ",", 2);
+  auto method                = balg::to_lower_copy(method_and_parameters[0]);
+  auto remaining_parameters  = method_and_parameters.size() > 1 ? method_and_parameters[1] : ""s;
+
   std::vector<std::string> available_compression_methods;
   available_compression_methods.push_back("none");
   available_compression_methods.push_back("zlib");
+  if (compressor_c::is_available(COMPRESSION_ZSTD))
+    available_compression_methods.push_back("zstd");
+  if (compressor_c::is_available(COMPRESSION_LZ4))
+    available_compression_methods.push_back("lz4");
   available_compression_methods.push_back("mpeg4_p2");
   available_compression_methods.push_back("analyze_header_removal");
 
   ti.m_compression_list[id] = COMPRESSION_UNSPECIFIED;
-  balg::to_lower(parts[1]);
 
-  if (parts[1] == "zlib")
+  if (method == "zlib")
     ti.m_compression_list[id] = COMPRESSION_ZLIB;
 
-  if (parts[1] == "none")
+  if ((method == "zstd") && compressor_c::is_available(COMPRESSION_ZSTD))
+    ti.m_compression_list[id] = COMPRESSION_ZSTD;
+
+  if ((method == "lz4") && compressor_c::is_available(COMPRESSION_LZ4))
+    ti.m_compression_list[id] = COMPRESSION_LZ4;
+
+  if (method == "none")
     ti.m_compression_list[id] = COMPRESSION_NONE;
 
-  if ((parts[1] == "mpeg4_p2") || (parts[1] == "mpeg4p2"))
+  if ((method == "mpeg4_p2") || (method == "mpeg4p2"))
     ti.m_compression_list[id] = COMPRESSION_MPEG4_P2;
 
-  if (parts[1] == "analyze_header_removal")
+  if (method == "analyze_header_removal")
       ti.m_compression_list[id] = COMPRESSION_ANALYZE_HEADER_REMOVAL;
 
   if (ti.m_compression_list[id] == COMPRESSION_UNSPECIFIED)
     mxerror(fmt::format(Y("'{0}' is an unsupported argument for --compression. Available compression methods are: {1}\n"), s, mtx::string::join(available_compression_methods, ", ")));
+
+  if (   compressor_c::is_nonstandard(ti.m_compression_list[id])
+      && !mtx::hacks::is_engaged(mtx::hacks::ALLOW_NONSTANDARD_COMPRESSION))
+    mxerror(fmt::format(Y("The compression method '{0}' is not part of the Matroska specification, and files using it can only be read by MKVToolNix. "
+                          "If you want to use it anyway, add '--engage allow_nonstandard_compression'.\n"),
+                        method));
+
+  compression_parameters_t parameters;
+
+  while (!remaining_parameters.empty()) {
+    auto name_and_value = mtx::string::split(remaining_parameters, "=", 2);
+    auto name           = balg::to_lower_copy(name_and_value[0]);
+
+    if (name_and_value.size() != 2)
+      mxerror(fmt::format(Y("Invalid compression parameter '{0}' in '--compression {1}'.\n"), name, s));
+
+    if (name == "dictionary") {
+      try {
+        parameters.m_dictionary = mm_file_io_c::slurp(name_and_value[1]);
+      } catch (mtx::mm_io::exception &ex) {
+        mxerror(fmt::format(Y("The dictionary file '{0}' could not be read: {1}\n"), name_and_value[1], ex));
+      }
+      break;
+    }
+
+    auto value_and_rest  = mtx::string::split(name_and_value[1], ",", 2);
+    remaining_parameters = value_and_rest.size() > 1 ? value_and_rest[1] : ""s;
+    int level            = 0;
+
+    if ((name == "level") && mtx::string::parse_number(value_and_rest[0], level))
+      parameters.m_level = level;
+    else
+      mxerror(fmt::format(Y("Invalid compression parameter '{0}' in '--compression {1}'.\n"), name, s));
+  }
+
+  ti.m_compression_parameters_list[id] = parameters;
 }
 
 static std::tuple<int64_t, std::string>
@@ -1492,6 +1537,45 @@ parse_arg_track_order(const std::string &s) {
   }
 }
 
+/** \brief Parse the argument for \c --additional-output
+
+   The argument consists of a comma separated list of file ID & track
+   ID pairs, an equal sign and the name of the additional destination
+   file.
+*/
+static void
+parse_arg_additional_output(std::string const &s) {
+  auto equals_pos = s.find('=');
+  if ((std::string::npos == equals_pos) || (0 == equals_pos) || ((equals_pos + 1) == s.size()))
+    mxerror(fmt::format(Y("Invalid format in '--additional-output {0}'.\n"), s));
+
+  std::vector<track_order_t> track_ids;
+
+  auto parts = mtx::string::split(s.substr(0, equals_pos), ",");
+  mtx::string::strip(parts);
+
+  for (auto const &part : parts) {
+    auto pair = mtx::string::split(part, ":");
+    track_order_t id;
+
+    if (   (pair.size() != 2)
+        || !mtx::string::parse_number(pair[0], id.file_id)
+        || !mtx::string::parse_number(pair[1], id.track_id))
+      mxerror(fmt::format(Y("'{0}' is not a valid pair of file ID and track ID in '--additional-output {1}'.\n"), part, s));
+
+    if (std::find_if(track_ids.begin(), track_ids.end(), [&id](auto const &ref) { return (ref.file_id == id.file_id) && (ref.track_id == id.track_id); }) == track_ids.end())
+      track_ids.push_back(id);
+  }
+
+  auto file_name = s.substr(equals_pos + 1);
+
+  if (   (file_name == g_outfile)
+      || std::any_of(g_additional_outputs.begin(), g_additional_outputs.end(), [&file_name](auto const &output) { return output->get_file_name() == file_name; }))
+    mxerror(fmt::format(Y("The file name '{0}' is used for more than one destination file.\n"), file_name));
+
+  g_additional_outputs.emplace_back(std::make_shared<additional_output_c>(file_name, track_ids));
+}
+
 /** \brief Parse the argument for \c --append-to
 
    The argument must be a comma separated list. Each of the list's items
@@ -1725,6 +1809,12 @@ parse_arg_cluster_length(std::string arg) {
   }
 }
 
+static void
+parse_arg_max_queued_data(std::string const &arg) {
+  if (!mtx::string::parse_size_number_with_unit(arg, g_max_queued_bytes_in_memory))
+    mxerror(fmt::format(Y("Invalid size in '--max-queued-data {0}'.\n"), arg));
+}
+
 static void
 parse_arg_attach_file(attachment_cptr const &attachment,
                       const std::string &arg,
@@ -1748,14 +1838,16 @@ parse_arg_attach_file(attachment_cptr const &attachment,
   if (attachment->mime_type.empty())
     attachment->mime_type  = guess_mime_type_and_report(arg);
 
+  // The content is copied from the file when it's written to the
+  // destination file.
   try {
     mm_io_cptr io = mm_file_io_c::open(attachment->name);
 
     if (0 == io->get_size())
       mxerror(fmt::format(Y("The size of attachment '{0}' is 0.\n"), attachment->name));
 
-    attachment->data = memory_c::alloc(io->get_size());
-    io->read(attachment->data->get_buffer(), attachment->data->get_size());
+    attachment->data_file_name = attachment->name;
+    attachment->data_size      = io->get_size();
 
   } catch (...) {
     mxerror(fmt::format(Y("The attachment '{0}' could not be read.\n"), attachment->name));
@@ -2362,6 +2454,13 @@ parse_args(std::vector<std::string> args) {
       parse_arg_cluster_length(*next_arg);
       sit++;
 
+    } else if (this_arg == "--max-queued-data") {
+      if (!next_arg)
+        mxerror(Y("'--max-queued-data' lacks the size.\n"));
+
+      parse_arg_max_queued_data(*next_arg);
+      sit++;
+
     } else if (this_arg == "--no-cues")
       g_write_cues = false;
 
@@ -2880,6 +2979,13 @@ parse_args(std::vector<std::string> args) {
       ti->m_all_ext_timestamps[tid] = string;
       sit++;
 
+    } else if (this_arg == "--additional-output") {
+      if (!next_arg || next_arg->empty())
+        mxerror(fmt::format(Y("'{0}' lacks its argument.\n"), this_arg));
+
+      parse_arg_additional_output(*next_arg);
+      sit++;
+
     } else if (this_arg == "--track-order") {
       if (!next_arg)
         mxerror(fmt::format(Y("'{0}' lacks its argument.\n"), this_arg));
@@ -3173,6 +3279,10 @@ main(int argc,
     check_append_mapping();
     check_split_support();
     g_cluster_helper->verify_and_report_chapter_generation_parameters();
+
+    for (auto const &output : g_additional_outputs)
+      output->verify();
+
     calc_attachment_sizes();
     calc_max_chapter_size();
   }
@@ -73,11 +73,13 @@
 #include "common/translation.h"
 #include "common/unique_numbers.h"
 #include "common/version.h"
+#include "merge/additional_output.h"
 #include "merge/cluster_helper.h"
 #include "merge/cues.h"
 #include "merge/filelist.h"
 #include "merge/generic_packetizer.h"
 #include "merge/generic_reader.h"
+#include "merge/libmatroska_extensions.h"
 #include "merge/output_control.h"
 #include "merge/webm.h"
 
@@ -112,6 +114,7 @@ std::string g_outfile;
 int64_t g_file_sizes                                          = 0;
 int g_max_blocks_per_cluster                                  = 65535;
 int64_t g_max_ns_per_cluster                                  = 5000000000ll;
+int64_t g_max_queued_bytes_in_memory                          = 0;
 bool g_write_cues                                             = true;
 bool g_cue_writing_requested                                  = false;
 generic_packetizer_c *g_video_packetizer                      = nullptr;
@@ -177,6 +180,7 @@ static std::unique_ptr<KaxTags> s_kax_tags;
 static mtx::chapters::kax_cptr s_chapters_in_this_file;
 
 static std::unique_ptr<KaxAttachments> s_kax_as;
+static std::vector<std::pair<attachment_cptr, uint64_t>> s_attachment_positions;
 
 static std::unique_ptr<EbmlVoid> s_kax_sh_void;
 static std::unique_ptr<EbmlVoid> s_kax_chapters_void;
@@ -399,7 +403,7 @@ add_attachment(attachment_cptr const &attachment) {
           ||
           (   (ex_attachment->name             == attachment->name)
            && (ex_attachment->description      == attachment->description)
-           && (ex_attachment->data->get_size() == attachment->data->get_size())
+           && (ex_attachment->get_size()       == attachment->get_size())
            && (ex_attachment->source_file      != attachment->source_file)
            && !attachment->source_file.empty()))
         return attachment->id;
@@ -851,6 +855,9 @@ rerender_track_headers() {
 
   shrink_void_and_rerender_track_headers(new_void_size);
 
+  for (auto const &output : g_additional_outputs)
+    output->rerender_track_headers();
+
   mxdebug_if(s_debug_rerender_track_headers,
              fmt::format("[rerender] track_headers:   position_before {0} file_size_before {1} (diff {2}) position_after {3} file_size_after {4} (diff {5}) void now at {6} size {7}\n",
                          position_before, file_size_before, file_size_before - position_before, s_out->getFilePointer(), s_out->get_size(), s_out->get_size() - s_out->getFilePointer(),
@@ -868,7 +875,7 @@ render_attachments(mm_io_c &out) {
   auto kax_a = static_cast<KaxAttached *>(nullptr);
 
   for (auto &attachment_p : g_attachments) {
-    auto attch = *attachment_p;
+    auto const &attch = *attachment_p;
 
     if ((1 == g_file_num) || attch.to_all_files) {
       kax_a = !kax_a ? &GetChild<KaxAttached>(*s_kax_as) : &GetNextChild<KaxAttached>(*s_kax_as, *kax_a);
@@ -889,7 +896,8 @@ render_attachments(mm_io_c &out) {
       GetChild<KaxFileName>(kax_a).SetValueUTF8(name);
       GetChild<KaxFileUID >(kax_a).SetValue(attch.id);
 
-      GetChild<KaxFileData>(*kax_a).CopyBuffer(attch.data->get_buffer(), attch.data->get_size());
+      // The content is copied to the file while rendering.
+      kax_attachment_file_data_c::replace_in(*kax_a, attachment_p);
     }
   }
 
@@ -1146,9 +1154,9 @@ void
 calc_attachment_sizes() {
   // Calculate the size of all attachments for split control.
   for (auto &att : g_attachments) {
-    g_attachment_sizes_first += att->data->get_size();
+    g_attachment_sizes_first += att->get_size();
     if (att->to_all_files)
-      g_attachment_sizes_others += att->data->get_size();
+      g_attachment_sizes_others += att->get_size();
   }
 }
 
@@ -1386,6 +1394,10 @@ create_next_output_file() {
 
   run_after_file_created_packetizer_hooks();
 
+  if (1 == g_file_num)
+    for (auto const &output : g_additional_outputs)
+      output->open(*s_kax_infos);
+
   ++g_file_num;
 }
 
@@ -1560,7 +1572,7 @@ set_track_statistics_tags(KaxTags *tags) {
   return tags;
 }
 
-static void
+static std::filesystem::path
 insert_chapter_name_in_output_file_name(std::filesystem::path const &original_file_name,
                                         std::string const &chapter_name) {
 #if defined(SYS_WINDOWS)
@@ -1571,7 +1583,7 @@ insert_chapter_name_in_output_file_name(std::filesystem::path const &original_fi
 
   // When splitting replace %c in file names with current chapter name.
   if (!g_cluster_helper->split_mode_produces_many_files())
-    return;
+    return original_file_name;
 
   // auto chapter_name  = get_current_chapter_name();
   auto cleaned_chapter_name = Q(chapter_name).replace(s_invalid_char_re, "-");
@@ -1580,7 +1592,7 @@ insert_chapter_name_in_output_file_name(std::filesystem::path const &original_fi
   mxdebug_if(s_debug_splitting_chapters, fmt::format("insert_chapter_name_in_output_file_name: cleaned name {0} old {1} new {2}\n", to_utf8(cleaned_chapter_name), original_file_name.u8string(), new_file_name.u8string()));
 
   if (original_file_name == new_file_name)
-    return;
+    return original_file_name;
 
   try {
     std::filesystem::rename(original_file_name, new_file_name);
@@ -1588,6 +1600,41 @@ insert_chapter_name_in_output_file_name(std::filesystem::path const &original_fi
   } catch (std::filesystem::filesystem_error &) {
     mxerror(fmt::format(Y("The file '{0}' could not be renamed to '{1}'.\n"), original_file_name.u8string(), new_file_name.u8string()));
   }
+
+  return new_file_name;
+}
+
+static void
+remember_attachment_positions() {
+  s_attachment_positions.clear();
+
+  for (auto attached : *s_kax_as) {
+    if (!dynamic_cast<KaxAttached *>(attached))
+      continue;
+
+    for (auto child : static_cast<KaxAttached &>(*attached)) {
+      auto data = dynamic_cast<kax_attachment_file_data_c *>(child);
+      if (data)
+        s_attachment_positions.emplace_back(data->get_attachment(), data->GetElementPosition() + data->HeadSize());
+    }
+  }
+}
+
+/** \brief Use a finished destination file as the source of attachments
+
+   Attachments written to all files are copied from the previous file
+   when the next one is created. That way their content doesn't have
+   to be kept in memory, and attachments read from the source files
+   don't have to be located again.
+*/
+static void
+switch_attachment_sources_to(std::filesystem::path const &file_name) {
+  for (auto const &[attachment, position] : s_attachment_positions) {
+    attachment->data_size      = attachment->get_size();
+    attachment->data_file_name = file_name.u8string();
+    attachment->data_position  = position;
+    attachment->data.reset();
+  }
 }
 
 /** \brief Finishes and closes the current file
@@ -1610,6 +1657,10 @@ finish_file(bool last_file,
 
   run_before_file_finished_packetizer_hooks();
 
+  if (last_file)
+    for (auto const &output : g_additional_outputs)
+      output->finish();
+
   bool do_output = verbose && !dynamic_cast<mm_null_io_c *>(s_out.get());
   if (do_output)
     mxinfo("\n");
@@ -1734,6 +1785,7 @@ finish_file(bool last_file,
 
   if (s_kax_as) {
     g_kax_sh_main->IndexThis(*s_kax_as, *g_kax_segment);
+    remember_attachment_positions();
     s_kax_as.reset();
   }
 
@@ -1752,6 +1804,7 @@ finish_file(bool last_file,
   update_ebml_head();
 
   auto original_file_name = mtx::fs::to_path(s_out->get_file_name());
+  auto discarded          = !!dynamic_cast<mm_null_io_c *>(s_out.get());
 
   s_out.reset();
 
@@ -1763,7 +1816,11 @@ finish_file(bool last_file,
   s_head.reset();
   g_doc_type_version_handler.reset();
 
-  insert_chapter_name_in_output_file_name(original_file_name, first_chapter_name);
+  auto final_file_name = insert_chapter_name_in_output_file_name(original_file_name, first_chapter_name);
+
+  if (!discarded)
+    switch_attachment_sources_to(final_file_name);
+  s_attachment_positions.clear();
 }
 
 void
@@ -2141,6 +2198,30 @@ select_winning_packetizer() {
   return winner;
 }
 
+// Whole clusters can only be copied if nothing's pending: each
+// packetizer must have handed all of its packets over to the cluster
+// helper already.
+static bool
+copy_next_cluster_maybe() {
+  static auto s_copy_clusters = (1 == g_files.size())
+                             && !s_appending_files
+                             && g_additional_outputs.empty()
+                             && !mtx::hacks::is_engaged(mtx::hacks::NO_CLUSTER_COPY)
+                             && !mtx::hacks::is_engaged(mtx::hacks::LACING_XIPH)
+                             && !mtx::hacks::is_engaged(mtx::hacks::LACING_EBML);
+
+  if (!s_copy_clusters)
+    return false;
+
+  for (auto &ptzr : g_packetizers)
+    if (   ptzr.pack
+        || (FILE_STATUS_MOREDATA != ptzr.status)
+        || ptzr.packetizer->packet_available())
+      return false;
+
+  return g_files[0]->reader->copy_next_cluster();
+}
+
 static void
 discard_queued_packets() {
   for (auto &ptzr : g_packetizers)
@@ -2159,6 +2240,16 @@ void
 main_loop() {
   // Let's go!
   while (1) {
+    // Step 0: Copy whole clusters from the source file if possible.
+    if (copy_next_cluster_maybe()) {
+      add_split_points_from_remainig_chapter_numbers();
+
+      if (1 <= verbose)
+        display_progress();
+
+      continue;
+    }
+
     // Step 1: Make sure a packet is available for each output
     // as long we haven't already processed the last one.
     pull_packetizers_for_packets();
@@ -2233,6 +2324,7 @@ cleanup() {
   }
 
   g_cluster_helper.reset();
+  g_additional_outputs.clear();
 
   destroy_readers();
   g_attachments.clear();
@@ -2241,6 +2333,7 @@ cleanup() {
   g_tags_from_cue_chapters.reset();
   g_kax_chapters.reset();
   s_kax_as.reset();
+  s_attachment_positions.clear();
   g_kax_info_chap.reset();
   g_forced_seguids.clear();
   g_kax_tracks.reset();
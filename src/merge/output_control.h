@@ -170,6 +170,7 @@ extern int g_file_num;
 extern int64_t g_file_sizes;
 
 extern int64_t g_max_ns_per_cluster;
+extern int64_t g_max_queued_bytes_in_memory;
 extern int g_max_blocks_per_cluster;
 
 extern int g_split_max_num_files;
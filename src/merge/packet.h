@@ -15,6 +15,9 @@
 
 #include "common/common_pch.h"
 
+#include <boost/container/small_vector.hpp>
+
+#include "common/recycling_allocator.h"
 #include "common/timestamp.h"
 
 namespace libmatroska {
@@ -45,9 +48,18 @@ public:
 };
 using packet_extension_cptr = std::shared_ptr<packet_extension_c>;
 
+struct packet_t;
+using packet_cptr = std::shared_ptr<packet_t>;
+
 struct packet_t {
+  // Most packets carry neither block additions nor extensions, and
+  // the rest mostly one of each. Storing those inline avoids two
+  // heap allocations per packet.
+  using data_adds_t  = boost::container::small_vector<memory_cptr, 1>;
+  using extensions_t = boost::container::small_vector<packet_extension_cptr, 1>;
+
   memory_cptr data;
-  std::vector<memory_cptr> data_adds;
+  data_adds_t data_adds;
   memory_cptr codec_state;
 
   libmatroska::KaxBlockBlob *group;
@@ -58,12 +70,15 @@ struct packet_t {
   int64_t timestamp_before_factory;
   int64_t unmodified_assigned_timestamp, unmodified_duration;
   std::optional<uint64_t> uncompressed_size;
+  // Position & size of the payload in the spill file if it has been
+  // moved there while the packet is queued.
+  std::optional<std::pair<uint64_t, uint64_t>> spilled_data;
   timestamp_c discard_padding, output_order_timestamp;
   bool duration_mandatory, superseeded, gap_following, factory_applied;
   std::optional<bool> key_flag, discardable_flag;
   generic_packetizer_c *source;
 
-  std::vector<packet_extension_cptr> extensions;
+  extensions_t extensions;
 
   packet_t()
     : group{}
@@ -227,5 +242,14 @@ struct packet_t {
 
   void account(track_statistics_c &statistics, int64_t timestamp_offset);
   uint64_t calculate_uncompressed_size();
+
+  // Packets are created & destroyed at a very high rate. Allocating
+  // them through a recycling allocator means the combined block for
+  // the object & its shared pointer control block is reused instead
+  // of going through the heap each time.
+  template<typename... Args>
+  static packet_cptr
+  create(Args &&... args) {
+    return std::allocate_shared<packet_t>(mtx::mem::recycling_allocator_t<packet_t>{}, std::forward<Args>(args)...);
+  }
 };
-using packet_cptr = std::shared_ptr<packet_t>;
@@ -0,0 +1,108 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   the temporary file holding queued packet data
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <QDir>
+#include <QTemporaryFile>
+
+#include "common/qt.h"
+#include "merge/packet_spill_file.h"
+
+packet_spill_file_c::packet_spill_file_c()
+  : m_file{new QTemporaryFile{QDir::temp().filePath(Q("mkvmerge-queued-data-XXXXXX"))}}
+{
+}
+
+packet_spill_file_c::~packet_spill_file_c() { // NOLINT(modernize-use-equals-default) due to QTemporaryFile being an incomplete type in the header
+}
+
+// Payloads are mostly restored in the order they've been spilled
+// in. Free space at the start of the file is therefore used first,
+// then the gap following the payload written last and only then the
+// file is extended.
+uint64_t
+packet_spill_file_c::find_free_position(uint64_t size)
+  const {
+  if (m_spilled.empty() || (m_spilled.begin()->first >= size))
+    return 0;
+
+  auto next = m_spilled.lower_bound(m_write_position);
+  if ((next != m_spilled.end()) && ((m_write_position + size) <= next->first))
+    return m_write_position;
+
+  auto last = m_spilled.rbegin();
+  return last->first + last->second;
+}
+
+void
+packet_spill_file_c::disable(std::string const &reason) {
+  mxwarn(fmt::format(Y("The temporary file for queued data '{0}' cannot be written to (reason: {1}). Queued data will be kept in memory.\n"), to_utf8(m_file->fileName()), reason));
+  m_failed = true;
+}
+
+std::optional<uint64_t>
+packet_spill_file_c::spill(memory_c const &data) {
+  if (m_failed)
+    return {};
+
+  if (!m_file->isOpen() && !m_file->open()) {
+    disable(to_utf8(m_file->errorString()));
+    return {};
+  }
+
+  auto size     = static_cast<uint64_t>(data.get_size());
+  auto position = find_free_position(size);
+
+  if (   !m_file->seek(position)
+      || (m_file->write(reinterpret_cast<char const *>(data.get_buffer()), size) != static_cast<qint64>(size))) {
+    disable(to_utf8(m_file->errorString()));
+    return {};
+  }
+
+  m_spilled[position] = size;
+  m_write_position    = position + size;
+
+  return position;
+}
+
+memory_cptr
+packet_spill_file_c::restore(uint64_t position,
+                             uint64_t size) {
+  auto data = memory_c::alloc(size);
+
+  if (   !m_file->seek(position)
+      || (m_file->read(reinterpret_cast<char *>(data->get_buffer()), size) != static_cast<qint64>(size)))
+    mxerror(fmt::format(Y("Error reading from the temporary file for queued data '{0}' (reason: {1}).\n"), to_utf8(m_file->fileName()), to_utf8(m_file->errorString())));
+
+  forget(position);
+
+  return data;
+}
+
+void
+packet_spill_file_c::forget(uint64_t position) {
+  m_spilled.erase(position);
+}
+
+uint64_t
+packet_spill_file_c::get_num_spilled()
+  const {
+  return m_spilled.size();
+}
+
+packet_spill_file_c &
+packet_spill_file_c::get() {
+  static packet_spill_file_c s_spill_file;
+  return s_spill_file;
+}
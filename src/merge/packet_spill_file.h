@@ -0,0 +1,51 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for the temporary file holding queued packet data
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+class QTemporaryFile;
+
+// The payloads of packets queued in packetizers are moved into this
+// temporary file while the amount of queued data kept in memory
+// exceeds the limit set with '--max-queued-data'. The space of
+// payloads that have been restored or forgotten is reused. If the
+// file cannot be written to, the payloads are kept in memory.
+class packet_spill_file_c {
+protected:
+  std::unique_ptr<QTemporaryFile> m_file;
+  // Position → size of all payloads currently stored in the file
+  std::map<uint64_t, uint64_t> m_spilled;
+  uint64_t m_write_position{};
+  bool m_failed{};
+
+public:
+  packet_spill_file_c();
+  ~packet_spill_file_c();
+
+  // Returns the position the data has been written to or nothing if
+  // writing failed.
+  std::optional<uint64_t> spill(memory_c const &data);
+  memory_cptr restore(uint64_t position, uint64_t size);
+  void forget(uint64_t position);
+
+  uint64_t get_num_spilled() const;
+
+protected:
+  uint64_t find_free_position(uint64_t size) const;
+  void disable(std::string const &reason);
+
+public:
+  static packet_spill_file_c &get();
+};
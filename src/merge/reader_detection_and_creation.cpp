@@ -14,6 +14,7 @@
 
 #include <typeinfo>
 
+#include "common/hacks.h"
 #include "common/mm_file_io.h"
 #include "common/mm_mpls_multi_file_io.h"
 #include "common/mm_proxy_io.h"
@@ -398,13 +399,47 @@ probe_file_format(filelist_t &file) {
   return {};
 }
 
+// Appended files are often many parts of the same recording, e.g. M2TS
+// clips or camera chunks. While the headers of one file are parsed,
+// the operating system is asked to read the beginnings of the next few
+// appended files into its cache so that their readers don't have to
+// wait for the disk.
+static void
+read_ahead_appended_files(std::size_t current_idx,
+                          std::size_t &num_hinted) {
+  static debugging_option_c s_debug{"append|appended_file_read_ahead"};
+
+  // The minimum probe range of the MPEG TS & PS readers
+  static auto const s_read_ahead_size   = 10 * 1024 * 1024;
+  static auto const s_num_files_to_hint = 4u;
+
+  for (; (num_hinted < g_files.size()) && (num_hinted <= (current_idx + s_num_files_to_hint)); ++num_hinted) {
+    auto const &file = *g_files[num_hinted];
+
+    if ((num_hinted <= current_idx) || !file.appending || file.is_playlist)
+      continue;
+
+    mxdebug_if(s_debug, fmt::format("reading ahead {0}\n", file.name));
+
+    mm_file_io_c::read_ahead(file.all_names.empty() ? file.name : file.all_names.front(), s_read_ahead_size);
+  }
+}
+
 void
 read_file_headers() {
   static auto s_debug_timestamp_restrictions = debugging_option_c{"timestamp_restrictions"};
 
   g_file_sizes = 0;
 
-  for (auto &file : g_files) {
+  auto read_ahead = !mtx::hacks::is_engaged(mtx::hacks::NO_APPENDED_FILE_READ_AHEAD);
+  auto num_hinted = std::size_t{};
+
+  for (auto file_idx = 0u; file_idx < g_files.size(); ++file_idx) {
+    auto &file = g_files[file_idx];
+
+    if (read_ahead)
+      read_ahead_appended_files(file_idx, num_hinted);
+
     try {
       file->reader->m_appending = file->appending;
       file->reader->set_track_info(*file->ti);
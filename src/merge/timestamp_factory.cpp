@@ -14,14 +14,12 @@
 
 #include "common/common_pch.h"
 
-#include <QRegularExpression>
-
 #include "common/mm_file_io.h"
 #include "common/mm_proxy_io.h"
 #include "common/mm_text_io.h"
-#include "common/qt.h"
 #include "common/strings/formatting.h"
 #include "common/strings/parsing.h"
+#include "common/strings/scanner.h"
 #include "merge/timestamp_factory.h"
 
 timestamp_factory_cptr
@@ -42,13 +40,18 @@ timestamp_factory_c::create(std::string const &file_name,
   int version = -1;
   bool ok     = in->getline2(line);
   if (ok) {
-    auto format_line_re = QRegularExpression{"^# *time(?:code|stamp) *format v(\\d+).*"};
-    auto matches        = format_line_re.match(Q(line));
-
-    if (matches.hasMatch())
-      ok = mtx::string::parse_number(to_utf8(matches.captured(1)), version);
-    else
-      ok = false;
+    // "# timestamp format v2" or "# timecode format v2"; spaces are
+    // optional.
+    mtx::string::scanner_c scanner{line};
+    auto skip_spaces = [&scanner]() { scanner.skip_while([](char c) { return c == ' '; }); return true; };
+
+    ok =    scanner.skip('#')
+         && skip_spaces()
+         && scanner.skip_string("time")
+         && (scanner.skip_string("code") || scanner.skip_string("stamp"))
+         && skip_spaces()
+         && scanner.skip_string("format v")
+         && mtx::string::parse_number(std::string{scanner.digits()}, version);
   }
 
   if (!ok)
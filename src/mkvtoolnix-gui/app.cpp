@@ -256,11 +256,11 @@ void
 App::initializeIso639Languages() {
   auto &cfg = Util::Settings::get();
 
-  s_iso639Languages.reserve(mtx::iso639::g_languages.size());
-  s_iso639_2Languages.reserve(mtx::iso639::g_languages.size());
+  s_iso639Languages.reserve(mtx::iso639::languages().size());
+  s_iso639_2Languages.reserve(mtx::iso639::languages().size());
   s_commonIso639Languages.reserve(cfg.m_oftenUsedLanguages.size());
 
-  for (auto const &language : mtx::iso639::g_languages) {
+  for (auto const &language : mtx::iso639::languages()) {
     auto languageCode  = Q(language.alpha_3_code);
     auto languageCodes = language.alpha_2_code.empty() ? languageCode : Q("%1; %2").arg(Q(language.alpha_2_code)).arg(languageCode);
     auto description   = Q("%1 (%2)").arg(Q(gettext(language.english_name.c_str()))).arg(languageCodes);
@@ -284,10 +284,10 @@ void
 App::initializeRegions() {
   auto &cfg = Util::Settings::get();
 
-  s_regions.reserve(mtx::iso3166::g_regions.size());
-  s_commonRegions.reserve(mtx::iso3166::g_regions.size());
+  s_regions.reserve(mtx::iso3166::regions().size());
+  s_commonRegions.reserve(mtx::iso3166::regions().size());
 
-  for (auto const &region : mtx::iso3166::g_regions) {
+  for (auto const &region : mtx::iso3166::regions()) {
     auto countryCode = !region.alpha_2_code.empty() ? Q(region.alpha_2_code).toLower() : Q(fmt::format("{0:03}", region.number));
     auto description = formatRegionDescription(region);
     auto isCommon    = cfg.m_oftenUsedRegions.indexOf(countryCode) != -1;
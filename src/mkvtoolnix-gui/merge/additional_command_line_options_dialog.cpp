@@ -51,6 +51,11 @@ AdditionalCommandLineOptionsDialog::AdditionalCommandLineOptionsDialog(QWidget *
         QY("The downside is that multiplexing will take longer as mkvmerge will wait until all data has been written to the storage before exiting."),
         QY("See issues #2469 and #2480 on the MKVToolNix bug tracker for in-depth discussions on the pros and cons.") });
 
+  add(Q("--max-queued-data"), true, global,
+      { QY("This option needs an additional argument 'd'."),
+        QY("Tells mkvmerge to keep at most 'd' bytes of data read from the source files but not written to the destination file yet in memory."),
+        QY("The rest is stored in a temporary file. The size can be followed by 'k', 'm' or 'g' indicating kilobytes, megabytes or gigabytes.") });
+
   add(Q("--no-cues"), false, global,
       { QY("Tells mkvmerge not to create and write the cue data which can be compared to an index in an AVI."),
         QY("Matroska files can be played back without the cue data, but seeking will probably be imprecise and slower."),
@@ -4,11 +4,16 @@
 #include <QDebug>
 #include <QDir>
 #include <QFile>
+#include <QHash>
 #include <QMutex>
 #include <QMutexLocker>
 #include <QRegularExpression>
+#include <QThreadPool>
 #include <QTimer>
+#include <QtConcurrent>
 
+#include "common/bluray/mpls.h"
+#include "common/mm_file_io.h"
 #include "common/qt.h"
 #include "common/timestamp.h"
 #include "mkvtoolnix-gui/merge/file_identification_thread.h"
@@ -239,28 +244,90 @@ FileIdentificationWorker::scanPlaylists(QFileInfoList const &files) {
 
   Q_EMIT playlistScanStarted(numFiles);
 
-  QVector<SourceFilePtr> identifiedPlaylists;
+  // First pass: parse the playlists directly. Playlists that are too
+  // short are dropped right away, and playlists referencing exactly
+  // the same content as an earlier one (common on discs with
+  // obfuscated playlists) are not identified on their own but re-use
+  // the earlier one's result.
   auto minimumPlaylistDuration = timestamp_c::s(Util::Settings::get().m_minimumPlaylistDuration);
+  auto numSkipped              = 0;
+  QVector<int> duplicateOf(numFiles, -1), toIdentify;
+  QHash<QString, int> firstBySignature;
 
   for (auto idx = 0; idx < numFiles; ++idx) {
-    Util::FileIdentifier identifier{files[idx].filePath()};
-    if (identifier.identify()) {
-      auto file = identifier.file();
-      if (timestamp_c::ns(file->m_playlistDuration) >= minimumPlaylistDuration)
-        identifiedPlaylists << file;
+    auto info = playlistSignature(files[idx].filePath());
+
+    if (info && (info->first < minimumPlaylistDuration)) {
+      ++numSkipped;
+      continue;
+    }
+
+    if (info) {
+      auto existing = firstBySignature.constFind(info->second);
+      if (existing != firstBySignature.constEnd()) {
+        duplicateOf[idx] = existing.value();
+        ++numSkipped;
+        continue;
+      }
+
+      firstBySignature.insert(info->second, idx);
+    }
+
+    toIdentify << idx;
+  }
 
-    } else
-      qDebug() << "the error of my ways" << identifier.errorTitle() << identifier.errorText();
+  qDebug() << "FileIdentificationWorker::scanPlaylists: playlists to identify:" << toIdentify.count() << "skipped:" << numSkipped;
+
+  Q_EMIT playlistScanProgressChanged(numSkipped);
+
+  // Second pass: run the remaining identifications in parallel.
+  QThreadPool pool;
+  pool.setMaxThreadCount(std::max(QThread::idealThreadCount(), 1));
+
+  QVector<SourceFilePtr> identified(numFiles);
+  QVector<QFuture<void>> futures;
+
+  for (auto idx : toIdentify)
+    futures << QtConcurrent::run(&pool, [p, &files, &identified, idx]() {
+      if (p->m_abortPlaylistScan)
+        return;
+
+      Util::FileIdentifier identifier{files[idx].filePath()};
+      if (identifier.identify())
+        identified[idx] = identifier.file();
+      else
+        qDebug() << "FileIdentificationWorker::scanPlaylists: identification failed for" << files[idx].filePath() << identifier.errorTitle() << identifier.errorText();
+    });
+
+  for (auto idx = 0, numFutures = futures.count(); idx < numFutures; ++idx) {
+    futures[idx].waitForFinished();
 
     if (p->m_abortPlaylistScan) {
       qDebug() << "FileIdentificationWorker::scanPlaylists: scan aborted";
 
+      pool.waitForDone();
+
       Q_EMIT playlistScanFinished();
 
       return Result::Continue;
     }
 
-    Q_EMIT playlistScanProgressChanged(idx + 1);
+    Q_EMIT playlistScanProgressChanged(numSkipped + idx + 1);
+  }
+
+  QVector<SourceFilePtr> identifiedPlaylists;
+
+  for (auto idx = 0; idx < numFiles; ++idx) {
+    auto file = duplicateOf[idx] >= 0 ? identified[duplicateOf[idx]] : identified[idx];
+    if (!file || (timestamp_c::ns(file->m_playlistDuration) < minimumPlaylistDuration))
+      continue;
+
+    if (duplicateOf[idx] >= 0) {
+      file             = std::make_shared<SourceFile>(*file);
+      file->m_fileName = files[idx].filePath();
+    }
+
+    identifiedPlaylists << file;
   }
 
   Q_EMIT playlistScanProgressChanged(numFiles);
@@ -278,6 +345,47 @@ FileIdentificationWorker::scanPlaylists(QFileInfoList const &files) {
   return Result::Wait;
 }
 
+std::optional<std::pair<timestamp_c, QString>>
+FileIdentificationWorker::playlistSignature(QString const &fileName) {
+  try {
+    mm_file_io_c in{to_utf8(fileName)};
+    mtx::bluray::mpls::parser_c parser;
+
+    if (!parser.parse(in))
+      return {};
+
+    auto &playlist = parser.get_playlist();
+    std::string signature;
+
+    auto addStreams = [&signature](std::vector<mtx::bluray::mpls::stream_t> const &streams) {
+      for (auto const &stream : streams)
+        signature += fmt::format("s{0}:{1}:{2};", stream.pid, static_cast<unsigned int>(stream.coding_type), stream.language.format());
+    };
+
+    for (auto const &item : playlist.items) {
+      signature += fmt::format("i{0}:{1}:{2}:{3};", item.clip_id, item.codec_id, item.in_time.to_ns(), item.out_time.to_ns());
+      addStreams(item.stn.video_streams);
+      addStreams(item.stn.audio_streams);
+      addStreams(item.stn.pg_streams);
+    }
+
+    for (auto const &sub_path : playlist.sub_paths)
+      for (auto const &item : sub_path.items)
+        signature += fmt::format("p{0}:{1}:{2};", item.clpi_file_name, item.in_time.to_ns(), item.out_time.to_ns());
+
+    for (auto const &chapter : parser.get_chapters()) {
+      signature += fmt::format("c{0};", chapter.timestamp.to_ns());
+      for (auto const &name : chapter.names)
+        signature += fmt::format("n{0}:{1};", name.language.format(), name.name);
+    }
+
+    return std::make_pair(playlist.duration, Q(signature));
+
+  } catch (...) {
+    return {};
+  }
+}
+
 FileIdentificationWorker::Result
 FileIdentificationWorker::identifyThisFile(QString const &fileName) {
   qDebug() << "FileIdentificationWorker::identifyThisFile: starting for" << fileName;
@@ -6,6 +6,7 @@
 #include <QStringList>
 #include <QThread>
 
+#include "common/timestamp.h"
 #include "mkvtoolnix-gui/merge/file_identification_pack.h"
 #include "mkvtoolnix-gui/merge/source_file.h"
 
@@ -66,6 +67,8 @@ protected:
   Result identifyThisFile(QString const &fileName);
 
   Result scanPlaylists(QFileInfoList const &fileNames);
+
+  static std::optional<std::pair<timestamp_c, QString>> playlistSignature(QString const &fileName);
 };
 
 class FileIdentificationThread : public QThread {
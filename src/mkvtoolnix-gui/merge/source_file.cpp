@@ -440,7 +440,7 @@ SourceFile::deriveLanguageFromFileName() {
       return mtx::bcp47::language_c::parse(to_utf8(Q(languageOpt->alpha_3_code)));
     }
 
-    for (auto const &languageElt : mtx::iso639::g_languages) {
+    for (auto const &languageElt : mtx::iso639::languages()) {
       if (!cfg.m_recognizedTrackLanguagesInFileNames.contains(Q(languageElt.alpha_3_code)))
         continue;
 
@@ -33,10 +33,7 @@ Cache::currentVersionString() {
 
 MtxQRecursiveMutex &
 Cache::cacheDirMutex() {
-  static std::unique_ptr<MtxQRecursiveMutex> s_mutex;
-
-  if (!s_mutex)
-    s_mutex.reset(new MtxQRecursiveMutex{MTX_QT_RECURSIVE_MUTEX_INIT});
+  static auto s_mutex = std::make_unique<MtxQRecursiveMutex>(MTX_QT_RECURSIVE_MUTEX_INIT);
 
   return *s_mutex;
 }
@@ -364,7 +364,7 @@ void
 LanguageDialog::setupExtendedSubtagComboBox() {
   auto &comboBox = *p_func()->ui->cbExtendedSubtag;
 
-  setupComboBoxFromList(comboBox, mtx::iana::language_subtag_registry::g_extlangs, [](auto const &subtag) {
+  setupComboBoxFromList(comboBox, mtx::iana::language_subtag_registry::extlangs(), [](auto const &subtag) {
     return std::make_pair(Q(subtag.description), Q(subtag.code));
   });
 
@@ -376,7 +376,7 @@ void
 LanguageDialog::setupScriptComboBox() {
   auto &comboBox = *p_func()->ui->cbScript;
 
-  setupComboBoxFromList(comboBox, mtx::iso15924::g_scripts, [](auto const &script) {
+  setupComboBoxFromList(comboBox, mtx::iso15924::scripts(), [](auto const &script) {
     return std::make_pair(Q(script.english_name), Q(script.code));
   });
 
@@ -386,7 +386,7 @@ LanguageDialog::setupScriptComboBox() {
 
 void
 LanguageDialog::setupVariantComboBox(QComboBox &comboBox) {
-  setupComboBoxFromList(comboBox, mtx::iana::language_subtag_registry::g_variants, [](auto const &variant) {
+  setupComboBoxFromList(comboBox, mtx::iana::language_subtag_registry::variants(), [](auto const &variant) {
     return std::make_pair(Q(variant.description), Q(variant.code));
   });
 
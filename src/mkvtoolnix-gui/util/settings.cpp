@@ -658,7 +658,7 @@ Settings::setDefaults(std::optional<QVariant> enableMuxingTracksByTheseTypes) {
       m_oftenUsedCharacterSets << Q(characterSet);
 
   if (m_recognizedTrackLanguagesInFileNames.isEmpty())
-    for (auto const &language : mtx::iso639::g_languages)
+    for (auto const &language : mtx::iso639::languages())
       if (!language.alpha_2_code.empty())
         m_recognizedTrackLanguagesInFileNames << Q(language.alpha_3_code);
 
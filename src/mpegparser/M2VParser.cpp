@@ -22,29 +22,28 @@
 
 #include "common/common_pch.h"
 #include "common/memory.h"
+#include "common/mpeg.h"
 #include "common/output.h"
+#include "common/recycling_allocator.h"
 #include "M2VParser.h"
 
 constexpr auto BUFF_SIZE = 2 * 1024 * 1024;
 
-MPEGFrame::MPEGFrame(binary *n_data, uint32_t n_size, bool n_bCopy):
-  size(n_size), bCopy(n_bCopy) {
+MPEGFrame::MPEGFrame(memory_cptr const &n_data):
+  data(n_data) {
 
-  if(bCopy) {
-    data = (binary *)safemalloc(size);
-    memcpy(data, n_data, size);
-  } else {
-    data = n_data;
-  }
   refs[0]        = -1;
   refs[1]        = -1;
-  seqHdrData     = nullptr;
-  seqHdrDataSize = 0;
 }
 
-MPEGFrame::~MPEGFrame(){
-  safefree(data);
-  safefree(seqHdrData);
+void *MPEGFrame::operator new(std::size_t size){
+  assert(size == sizeof(MPEGFrame));
+  return mtx::mem::block_free_list_c<sizeof(MPEGFrame), alignof(MPEGFrame)>::get().acquire();
+}
+
+void MPEGFrame::operator delete(void *ptr){
+  if(ptr)
+    mtx::mem::block_free_list_c<sizeof(MPEGFrame), alignof(MPEGFrame)>::get().release(ptr);
 }
 
 void M2VParser::SetEOS(){
@@ -94,11 +93,11 @@ int32_t M2VParser::WriteData(binary* data, uint32_t dataSize){
 void M2VParser::DumpQueues(){
   while(!chunks.empty()){
     delete chunks.front();
-    chunks.erase(chunks.begin());
+    chunks.pop_front();
   }
   while(!buffers.empty()){
     delete buffers.front();
-    buffers.pop();
+    buffers.pop_front();
   }
 }
 
@@ -135,16 +134,17 @@ int32_t M2VParser::InitParser(){
   for (int i = 0, numChunks = chunks.size(); i < numChunks; i++){
     chunk = chunks[i];
     if(chunk->GetType() == MPEG_VIDEO_SEQUENCE_START_CODE){
-      //Copy the header for later, we must copy because the actual chunk will be deleted in a bit
-      binary * hdrData = new binary[chunk->GetSize()];
-      memcpy(hdrData, chunk->GetPointer(), chunk->GetSize());
-      seqHdrChunk = new MPEGChunk(hdrData, chunk->GetSize()); //Save this for adding as private data...
+      //Keep the header for later; the actual chunk will be deleted in a bit, but its data is shared
+      seqHdrChunk = new MPEGChunk(chunk->GetMemory()); //Save this for adding as private data...
       ParseSequenceHeader(chunk, m_seqHdr);
 
       //Look for sequence extension to identify mpeg2
       binary* pData = chunk->GetPointer();
       for (int j = 3, chunkSize = chunk->GetSize() - 4; j < chunkSize; j++){
-        if(pData[j] == 0x00 && pData[j+1] == 0x00 && pData[j+2] == 0x01 && pData[j+3] == 0xb5 && ((pData[j+4] & 0xF0) == 0x10)){
+        j += mtx::mpeg::find_start_code(pData + j, chunkSize + 3 - j);
+        if(j >= chunkSize)
+          break;
+        if(pData[j+3] == 0xb5 && ((pData[j+4] & 0xF0) == 0x10)){
           mpegVersion = 2;
           break;
         }
@@ -193,7 +193,7 @@ void M2VParser::FlushWaitQueue(){
     delete frame;
   while (!buffers.empty()) {
     delete buffers.front();
-    buffers.pop();
+    buffers.pop_front();
   }
 
   waitQueue.clear();
@@ -261,27 +261,24 @@ M2VParser::TimestampWaitingFrames() {
   std::sort(waitQueue.begin(), waitQueue.end(), [](MPEGFrame *a, MPEGFrame *b) { return a->decodingOrder < b->decodingOrder; });
 
   for (auto const &frame : waitQueue)
-    buffers.push(frame);
+    buffers.push_back(frame);
   waitQueue.clear();
 }
 
 int32_t M2VParser::PrepareFrame(MPEGChunk* chunk, MediaTime timestamp, MPEG2PictureHeader picHdr, MPEGChunk* secondField){
   MPEGFrame* outBuf;
-  bool bCopy = true;
-  binary* pData = chunk->GetPointer();
-  uint32_t dataLen = chunk->GetSize();
+  bool addSeqHdr = seqHdrChunk && keepSeqHdrsInBitstream && (MPEG2_I_FRAME == picHdr.frameType);
+  memory_cptr frameData;
 
-  if ((seqHdrChunk && keepSeqHdrsInBitstream &&
-       (MPEG2_I_FRAME == picHdr.frameType)) || gopChunk || secondField) {
+  if (addSeqHdr || gopChunk || secondField) {
     uint32_t pos = 0;
-    bCopy = false;
-    dataLen +=
+    uint32_t dataLen = chunk->GetSize() +
       (secondField ? secondField->GetSize() : 0) +
-      (seqHdrChunk && keepSeqHdrsInBitstream && (MPEG2_I_FRAME == picHdr.frameType) ? seqHdrChunk->GetSize() : 0) +
-      (gopChunk ? gopChunk->GetSize() : 0);
-    pData = (binary *)safemalloc(dataLen);
-    if (seqHdrChunk && keepSeqHdrsInBitstream &&
-        (MPEG2_I_FRAME == picHdr.frameType)) {
+      (addSeqHdr   ? seqHdrChunk->GetSize() : 0) +
+      (gopChunk    ? gopChunk->GetSize()    : 0);
+    frameData = memory_c::alloc(dataLen);
+    binary* pData = frameData->get_buffer();
+    if (addSeqHdr) {
       memcpy(pData, seqHdrChunk->GetPointer(), seqHdrChunk->GetSize());
       pos += seqHdrChunk->GetSize();
       delete seqHdrChunk;
@@ -297,17 +294,17 @@ int32_t M2VParser::PrepareFrame(MPEGChunk* chunk, MediaTime timestamp, MPEG2Pict
     pos += chunk->GetSize();
     if (secondField)
       memcpy(pData + pos, secondField->GetPointer(), secondField->GetSize());
-  }
 
-  outBuf = new MPEGFrame(pData, dataLen, bCopy);
+  } else
+    // The picture is all there is; hand over the chunk's data without copying it.
+    frameData = chunk->GetMemory();
+
+  outBuf = new MPEGFrame(frameData);
   outBuf->frameNumber = frameCounter++;
 
   if (seqHdrChunk && !keepSeqHdrsInBitstream &&
       (MPEG2_I_FRAME == picHdr.frameType)) {
-    outBuf->seqHdrData = (binary *)safemalloc(seqHdrChunk->GetSize());
-    outBuf->seqHdrDataSize = seqHdrChunk->GetSize();
-    memcpy(outBuf->seqHdrData, seqHdrChunk->GetPointer(),
-           outBuf->seqHdrDataSize);
+    outBuf->seqHdrData = seqHdrChunk->GetMemory();
     delete seqHdrChunk;
     seqHdrChunk = nullptr;
   }
@@ -388,7 +385,7 @@ int32_t M2VParser::FillQueues(){
 
       }
 
-      chunks.erase(chunks.begin());
+      chunks.pop_front();
       if (chunks.empty())
         return -1;
       chunk = chunks.front();
@@ -401,7 +398,7 @@ int32_t M2VParser::FillQueues(){
     MPEGChunk* secondField = nullptr;
     if (picHdr.pictureStructure != MPEG2_PICTURE_TYPE_FRAME) {
       if (!firstField) {
-        chunks.erase(chunks.begin());
+        chunks.pop_front();
         if (chunks.empty()) {
           firstField = chunk; // 1. keep the first field in the parser context
           return -1;
@@ -444,7 +441,7 @@ int32_t M2VParser::FillQueues(){
         PrepareFrame(chunk, myTime, picHdr, secondField);
     }
     frameNum++;
-    chunks.erase(chunks.begin());
+    chunks.pop_front();
     delete chunk;
     if (secondField)
       delete secondField;
@@ -463,7 +460,7 @@ MPEGFrame* M2VParser::ReadFrame(){
     return nullptr; // OOPS!
   }
   MPEGFrame* frame = buffers.front();
-  buffers.pop();
+  buffers.pop_front();
   return frame;
 }
 
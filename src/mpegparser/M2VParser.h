@@ -24,8 +24,8 @@
 
 #include "common/common_pch.h"
 
+#include "common/ring_buffer.h"
 #include "MPEGVideoBuffer.h"
-#include <queue>
 
 enum MPEG2ParserState_e {
   MPV_PARSER_STATE_FRAME,
@@ -58,28 +58,29 @@ public:
 
 class MPEGFrame {
 public:
-  binary *data;
-  uint32_t size;
-  binary *seqHdrData;
-  uint32_t seqHdrDataSize;
+  memory_cptr data;
+  memory_cptr seqHdrData;
   MediaTime duration;
   char frameType;
   MediaTime timestamp; // before stamping: sequence number; after stamping: real timestamp
   unsigned int decodingOrder;
   MediaTime refs[2];
   MPEGFrameRef tmpRefs[2];
-  bool bCopy;
   uint64_t frameNumber;
 
-  MPEGFrame(binary* data, uint32_t size, bool bCopy);
-  ~MPEGFrame();
+  MPEGFrame(memory_cptr const &data);
+
+  // Frames are created & destroyed for each picture; re-use the
+  // objects' storage.
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr);
 };
 
 class M2VParser {
 private:
-  std::vector<MPEGChunk*> chunks; //Hold the chunks until we can order them
+  mtx::ring_buffer_c<MPEGChunk*> chunks; //Hold the chunks until we can order them
   std::vector<MPEGFrame*> waitQueue; //Holds unstamped buffers until we can stamp them.
-  std::queue<MPEGFrame*> buffers; //Holds stamped buffers until they are requested.
+  mtx::ring_buffer_c<MPEGFrame*> buffers; //Holds stamped buffers until they are requested.
   std::unordered_map<uint64_t, uint64_t> frameTimestamps;
   uint64_t frameCounter;
   MediaTime previousTimestamp;
@@ -22,6 +22,8 @@
 
 #include "common/common_pch.h"
 
+#include "common/mpeg.h"
+#include "common/recycling_allocator.h"
 #include "MPEGVideoBuffer.h"
 #include <cstring>
 
@@ -36,50 +38,59 @@ MPEG2PictureHeader::MPEG2PictureHeader() {
   memset(this, 0, sizeof(*this));
 }
 
+void *MPEGChunk::operator new(std::size_t size){
+  assert(size == sizeof(MPEGChunk));
+  return mtx::mem::block_free_list_c<sizeof(MPEGChunk), alignof(MPEGChunk)>::get().acquire();
+}
+
+void MPEGChunk::operator delete(void *ptr){
+  if(ptr)
+    mtx::mem::block_free_list_c<sizeof(MPEGChunk), alignof(MPEGChunk)>::get().release(ptr);
+}
+
 int32_t MPEGVideoBuffer::FindStartCode(uint32_t startPos){
-  //How many bytes can we look through?
-  uint32_t window = myBuffer->GetLength() - startPos;
+  binary* data = &myBuffer[readPos];
+  uint32_t length = GetLength();
+  uint32_t pos = startPos;
 
-  if(window < 4) //Make sure we have enough bytes to search.
-    return -1;
+  while((pos + 4) <= length){
+    pos += mtx::mpeg::find_start_code(data + pos, length - pos);
+    if((pos + 4) > length)
+      break;
 
-  for(int i = startPos, endPos = startPos + window - 3; i < endPos; i++){
-    CircBuffer& buf = *myBuffer;
-    binary a,b,c,d;
-    a = buf[i];
-    b = buf[i+1];
-    c = buf[i+2];
-    d = buf[i+3];
-    if((a == 0x00) && (b == 0x00) && (c == 0x01)){
-      switch(d){
-        case MPEG_VIDEO_SEQUENCE_START_CODE:
-        case MPEG_VIDEO_GOP_START_CODE:
-        case MPEG_VIDEO_PICTURE_START_CODE:
-          return i;  //Return our position if we found
-          //one of the codes we want
-
-      }
+    switch(data[pos + 3]){
+      case MPEG_VIDEO_SEQUENCE_START_CODE:
+      case MPEG_VIDEO_GOP_START_CODE:
+      case MPEG_VIDEO_PICTURE_START_CODE:
+        return pos;  //Return our position if we found
+        //one of the codes we want
     }
+
+    pos += 3;
   }
 
-  //If we get here we have no _wanted_ start code found.
+  //If we get here we have no _wanted_ start code found. The last three
+  //bytes may be the beginning of one, though; continue from there
+  //once more data has arrived.
+  searchPos = std::max<uint32_t>(startPos, length >= 3 ? length - 3 : 0);
   return -1;
 }
 
 void MPEGVideoBuffer::UpdateState(){
-  assert(myBuffer);
   int32_t test = 0;
-  if(myBuffer->GetLength() == 0){
+  if(GetLength() == 0){
     state = MPEG2_BUFFER_STATE_EMPTY;
     return;
   }
   if(chunkStart == -1){
-    test = FindStartCode(0);
-    if(test != -1)  //We found a new startcode
+    test = FindStartCode(searchPos);
+    if(test != -1){  //We found a new startcode
       chunkStart = test;
+      searchPos = chunkStart + 4;
+    }
   }
-  if(chunkEnd == -1){
-    test = FindStartCode(chunkStart+4);
+  if(chunkStart != -1 && chunkEnd == -1){
+    test = FindStartCode(std::max<uint32_t>(searchPos, chunkStart + 4));
     if(test != -1)  //We found a new startcode
       chunkEnd = test;
   }
@@ -92,37 +103,62 @@ void MPEGVideoBuffer::UpdateState(){
 }
 
 MPEGChunk * MPEGVideoBuffer::ReadChunk(){
-  MPEGChunk* myChunk = nullptr;
-  if(state == MPEG2_BUFFER_STATE_CHUNK_READY){
-    assert(chunkStart < chunkEnd && chunkStart != -1 && chunkEnd != -1);
-    if(chunkStart != 0){ //we have to skip some bytes
-      myBuffer->Skip(chunkStart);
-    }
-    uint32_t chunkLength = chunkEnd - chunkStart;
-    binary* chunkData = new binary[chunkLength];
-    myBuffer->Read(chunkData, chunkLength);
-    chunkStart = 0; //we read up to the next start code
-    chunkEnd = -1;
-    UpdateState();
-    myChunk = new MPEGChunk(chunkData, chunkLength);
-    return myChunk;
-  }else{
+  if(state != MPEG2_BUFFER_STATE_CHUNK_READY)
     return nullptr;
+
+  assert(chunkStart < chunkEnd && chunkStart != -1 && chunkEnd != -1);
+  uint32_t chunkLength = chunkEnd - chunkStart;
+  auto chunk = new MPEGChunk(memory_c::clone(&myBuffer[readPos + chunkStart], chunkLength));
+  readPos += chunkEnd;
+  if(readPos == writePos){
+    readPos = 0;
+    writePos = 0;
   }
+  chunkStart = 0; //we read up to the next start code
+  chunkEnd = -1;
+  searchPos = 4;
+  UpdateState();
+  return chunk;
 }
 
 void MPEGVideoBuffer::ForceFinal(){
   if(state == MPEG2_BUFFER_STATE_NEED_MORE_DATA){
     chunkStart = 0;
-    chunkEnd = chunkStart + myBuffer->GetLength();
+    chunkEnd = chunkStart + GetLength();
     UpdateState();
   }
 }
 
 int32_t MPEGVideoBuffer::Feed(binary* data, uint32_t numBytes){
-  uint32_t res = myBuffer->Write(data, numBytes);
+  if(numBytes > static_cast<uint32_t>(GetFreeBufferSpace()))
+    return -1;
+
+  if((writePos + numBytes) > myBuffer.size()){
+    //Move the unread data to the front. Usually that's only the
+    //beginning of the current chunk.
+    std::memmove(&myBuffer[0], &myBuffer[readPos], GetLength());
+    writePos -= readPos;
+    readPos = 0;
+  }
+
+  std::memcpy(&myBuffer[writePos], data, numBytes);
+  writePos += numBytes;
   UpdateState();
-  return res;
+  return 0;
+}
+
+// Returns the first extension start code of the given type in [pos,
+// end) that is followed by at least minSize - 4 bytes.
+static binary *FindExtension(binary *pos, binary *end, binary extType, uint32_t minSize){
+  while((pos + minSize) <= end){
+    pos += mtx::mpeg::find_start_code(pos, end - pos);
+    if((pos + minSize) > end)
+      break;
+    if((pos[3] == MPEG_VIDEO_EXT_START_CODE) && ((pos[4] & 0xF0) == extType))
+      return pos;
+    pos += 3;
+  }
+  return nullptr;
 }
 
 void ParseSequenceHeader(MPEGChunk* chunk, MPEG2SequenceHeader & hdr){
@@ -180,16 +216,10 @@ void ParseSequenceHeader(MPEGChunk* chunk, MPEG2SequenceHeader & hdr){
 
   //Seek to extension
   hdr.progressiveSequence = 0;
-  while(pos < (chunk->GetPointer() + chunk->GetSize() - 6)){
-    if((pos[0] == 0x00) && (pos[1] == 0x00) && (pos[2] == 0x01) && (pos[3] == MPEG_VIDEO_EXT_START_CODE)){
-      if((pos[4] & 0xF0) == 0x10){ // Sequence extension
-        hdr.profileLevelIndication = ((pos[4] & 0x0F) << 4) | ((pos[5] & 0xF0) >> 4);
-        hdr.progressiveSequence = (pos[5] & 0x08) >> 3;
-        pos+=6;
-        break;
-      }
-    }
-    pos++;
+  pos = FindExtension(pos, chunk->GetPointer() + chunk->GetSize(), 0x10, 6); // Sequence extension
+  if(pos){
+    hdr.profileLevelIndication = ((pos[4] & 0x0F) << 4) | ((pos[5] & 0xF0) >> 4);
+    hdr.progressiveSequence = (pos[5] & 0x08) >> 3;
   }
 }
 
@@ -226,7 +256,6 @@ bool ParsePictureHeader(MPEGChunk* chunk, MPEG2PictureHeader & hdr){
     return false;
 
   binary* pos = chunk->GetPointer();
-  int havePicExt = 0;
   uint32_t temp = 0;
   pos+=4;
   temp = (((uint32_t)pos[0]) << 8) | (pos[1] & 0xC0);
@@ -236,17 +265,8 @@ bool ParsePictureHeader(MPEGChunk* chunk, MPEG2PictureHeader & hdr){
   hdr.frameType = (uint8_t) temp;
 
   //Seek to extension
-  while(pos < (chunk->GetPointer() + chunk->GetSize() - 4)){
-    if((pos[0] == 0x00) && (pos[1] == 0x00) && (pos[2] == 0x01) && (pos[3] == MPEG_VIDEO_EXT_START_CODE)){
-      if((pos[4] & 0xF0) == 0x80){ //Picture coding extension
-        //printf("Found a picture_coding_extension\n");
-        havePicExt = 1;
-        break;
-      }
-    }
-    pos++;
-  }
-  if(!havePicExt){
+  pos = FindExtension(pos, chunk->GetPointer() + chunk->GetSize(), 0x80, 9); //Picture coding extension
+  if(!pos){
     hdr.pictureStructure = MPEG2_PICTURE_TYPE_FRAME;
     hdr.repeatFirstField = 0;
     hdr.topFieldFirst = 1;
@@ -27,7 +27,6 @@
 #include "common/math_fwd.h"
 
 #include "Types.h"
-#include "CircBuffer.h"
 
 constexpr auto MPEG_VIDEO_PICTURE_START_CODE  = 0x00;
 constexpr auto MPEG_VIDEO_SEQUENCE_START_CODE = 0xb3;
@@ -85,22 +84,16 @@ struct MPEG2PictureHeader {
 
 class MPEGChunk{
 private:
-  binary * data;
-  uint32_t size;
+  memory_cptr data;
   uint8_t type;
 public:
-  MPEGChunk(binary* n_data, uint32_t n_size):
-    data(n_data), size(n_size) {
+  MPEGChunk(memory_cptr const &n_data):
+    data(n_data) {
 
     assert(data);
-    assert(4 <= size);
+    assert(4 <= data->get_size());
 
-    type = data[3];
-  }
-
-  ~MPEGChunk(){
-    if(data)
-      delete [] data;
+    type = data->get_buffer()[3];
   }
 
   inline uint8_t GetType() const {
@@ -108,54 +101,70 @@ public:
   }
 
   inline uint32_t GetSize() const{
-    return size;
+    return data->get_size();
   }
 
   binary & operator[](unsigned int i){
-    return data[i];
+    return data->get_buffer()[i];
   }
 
   binary & at(unsigned int i) {
-    return data[i];
+    return data->get_buffer()[i];
   }
 
   inline binary * GetPointer(){
+    return data->get_buffer();
+  }
+
+  inline memory_cptr const &GetMemory() const {
     return data;
   }
+
+  // Chunks are created & destroyed for each start code; re-use the
+  // objects' storage.
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr);
 };
 
 void ParseSequenceHeader(MPEGChunk* chunk, MPEG2SequenceHeader & hdr);
 bool ParsePictureHeader(MPEGChunk* chunk, MPEG2PictureHeader & hdr);
 bool ParseGOPHeader(MPEGChunk* chunk, MPEG2GOPHeader & hdr);
 
+// Collects the data fed to it in a linear window & splits it into
+// chunks at sequence, GOP & picture start codes. The search for the
+// next start code continues where the previous one stopped instead of
+// starting over with each call to Feed().
 class MPEGVideoBuffer{
 private:
-  CircBuffer * myBuffer;
+  std::vector<binary> myBuffer;
+  std::size_t readPos{}, writePos{}, searchPos{};
   MPEG2BufferState_e state;
   int32_t chunkStart;
   int32_t chunkEnd;
   void UpdateState();
   int32_t FindStartCode(uint32_t startPos = 0);
+
+  uint32_t GetLength() const {
+    return writePos - readPos;
+  }
+
 public:
-  MPEGVideoBuffer(uint32_t size){
-    myBuffer = new CircBuffer(size);
+  MPEGVideoBuffer(uint32_t size)
+    : myBuffer(size)
+  {
     state = MPEG2_BUFFER_STATE_EMPTY;
     chunkStart = -1;
     chunkEnd = -1;
   }
 
-  ~MPEGVideoBuffer(){
-    delete myBuffer;
-  }
-
   inline MPEG2BufferState_e GetState() const { return state; }
 
   int32_t GetFreeBufferSpace(){
-    return (myBuffer->buf_capacity - myBuffer->bytes_in_buf);
+    return myBuffer.size() - GetLength();
   }
 
   void SetEndOfData(){
-    chunkEnd = myBuffer->GetLength() - 1;
+    chunkEnd = GetLength() - 1;
   }
 
   void ForceFinal();  //prepares the remaining data as a chunk
@@ -16,6 +16,8 @@
 
 #include "common/common_pch.h"
 
+#include <deque>
+
 #include "common/byte_buffer.h"
 #include "common/dts.h"
 #include "merge/generic_packetizer.h"
@@ -167,8 +167,8 @@ hevc_video_packetizer_c::flush_frames() {
     if (diff_to_default_duration < p.source_timestamp_resolution)
       duration = m_htrack_default_duration;
 
-    add_packet(std::make_shared<packet_t>(frame.m_data, frame.m_start, duration,
-                                           frame.is_key_frame() ? -1 : frame.m_start + frame.m_ref1,
-                                          !frame.is_b_frame()   ? -1 : frame.m_start + frame.m_ref2));
+    add_packet(packet_t::create(frame.m_data, frame.m_start, duration,
+                                 frame.is_key_frame() ? -1 : frame.m_start + frame.m_ref1,
+                                !frame.is_b_frame()   ? -1 : frame.m_start + frame.m_ref2));
   }
 }
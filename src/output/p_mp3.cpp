@@ -191,7 +191,7 @@ mp3_packetizer_c::flush_packets() {
 
   while ((mp3_packet = get_mp3_packet(&mp3header))) {
     auto new_timestamp = m_timestamp_calculator.get_next_timestamp(m_samples_per_frame);
-    auto packet        = std::make_shared<packet_t>(mp3_packet, new_timestamp.to_ns(), m_packet_duration);
+    auto packet        = packet_t::create(mp3_packet, new_timestamp.to_ns(), m_packet_duration);
 
     packet->add_extensions(m_packet_extensions);
     packet->discard_padding = m_discard_padding.get_next().value_or(timestamp_c{});
@@ -232,14 +232,13 @@ mpeg1_2_video_packetizer_c::process_unframed(packet_cptr const &packet) {
       if (!frame)
         break;
 
-      packet_cptr new_packet  = packet_cptr(new packet_t(memory_c::take_ownership(frame->data, frame->size), frame->timestamp, frame->duration, frame->refs[0], frame->refs[1]));
+      auto new_packet = packet_t::create(frame->data, frame->timestamp, frame->duration, frame->refs[0], frame->refs[1]);
 
       remove_stuffing_bytes_and_handle_sequence_headers(new_packet);
 
       generic_video_packetizer_c::process_impl(new_packet);
 
-      frame->data = nullptr;
-      state       = m_parser.GetState();
+      state = m_parser.GetState();
     }
   } while (0 < new_bytes);
 }
@@ -248,7 +247,7 @@ void
 mpeg1_2_video_packetizer_c::flush_impl() {
   m_parser.SetEOS();
   auto empty = ""s;
-  generic_packetizer_c::process(std::make_shared<packet_t>(memory_c::borrow(empty)));
+  generic_packetizer_c::process(packet_t::create(memory_c::borrow(empty)));
 }
 
 void
@@ -102,7 +102,7 @@ pcm_packetizer_c::process_impl(packet_cptr const &packet) {
 void
 pcm_packetizer_c::flush_packets() {
   while (m_buffer.get_size() >= m_packet_size) {
-    auto packet = std::make_shared<packet_t>(memory_c::clone(m_buffer.get_buffer(), m_packet_size), m_samples_output * m_s2ts, m_samples_per_packet * m_s2ts);
+    auto packet = packet_t::create(memory_c::clone(m_buffer.get_buffer(), m_packet_size), m_samples_output * m_s2ts, m_samples_per_packet * m_s2ts);
 
     byte_swap_data(*packet->data);
 
@@ -163,7 +163,7 @@ pcm_packetizer_c::flush_impl() {
     return;
 
   int64_t samples_here = size_to_samples(size);
-  auto packet          = std::make_shared<packet_t>(memory_c::clone(m_buffer.get_buffer(), size), m_samples_output * m_s2ts, samples_here * m_s2ts);
+  auto packet          = packet_t::create(memory_c::clone(m_buffer.get_buffer(), size), m_samples_output * m_s2ts, samples_here * m_s2ts);
 
   byte_swap_data(*packet->data);
 
@@ -0,0 +1,154 @@
+/*
+   mkvpropedit -- utility for editing properties of existing Matroska files
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/mm_file_io.h"
+#include "common/mm_io_x.h"
+#include "common/mm_text_io.h"
+#include "common/strings/editing.h"
+#include "common/unique_numbers.h"
+#include "propedit/batch.h"
+#include "propedit/globals.h"
+
+namespace mtx::propedit {
+
+namespace {
+
+nlohmann::json
+to_json_array(std::vector<std::string> const &messages) {
+  auto result = nlohmann::json::array();
+
+  for (auto const &message : messages)
+    result.push_back(message);
+
+  return result;
+}
+
+batch_job_t
+job_from_json(nlohmann::json const &json) {
+  if (!json.is_object())
+    throw std::domain_error{Y("Each batch job must be a JSON object")};
+
+  auto file_name = json.find("file_name");
+  if ((file_name == json.end()) || !file_name->is_string() || file_name->get<std::string>().empty())
+    throw std::domain_error{Y("Each batch job must contain the name of the file to modify as a JSON string in 'file_name'")};
+
+  batch_job_t job;
+  job.m_file_name = file_name->get<std::string>();
+
+  auto arguments = json.find("arguments");
+  if (arguments == json.end())
+    return job;
+
+  if (!arguments->is_array())
+    throw std::domain_error{Y("The 'arguments' of a batch job must be a JSON array consisting solely of JSON strings")};
+
+  for (auto const &argument : *arguments) {
+    if (!argument.is_string())
+      throw std::domain_error{Y("The 'arguments' of a batch job must be a JSON array consisting solely of JSON strings")};
+
+    job.m_arguments.emplace_back(argument.get<std::string>());
+  }
+
+  return job;
+}
+
+} // anonymous namespace
+
+nlohmann::json
+batch_result_t::to_json()
+  const {
+  return {
+    { "file_name", m_file_name                },
+    { "success",   m_success                  },
+    { "modified",  m_modified                 },
+    { "warnings",  to_json_array(m_warnings)  },
+    { "errors",    to_json_array(m_errors)    },
+  };
+}
+
+std::vector<batch_job_t>
+parse_batch_jobs(std::string const &content) {
+  std::vector<batch_job_t> jobs;
+
+  auto first_char = content.find_first_not_of(" \t\r\n");
+  if (first_char == std::string::npos)
+    return jobs;
+
+  if (content[first_char] == '[') {
+    auto doc = mtx::json::parse(content);
+
+    for (auto const &json : doc)
+      jobs.emplace_back(job_from_json(json));
+
+    return jobs;
+  }
+
+  auto line_number = 0u;
+
+  for (auto const &line : mtx::string::split(content, "\n")) {
+    ++line_number;
+
+    if (line.find_first_not_of(" \t\r") == std::string::npos)
+      continue;
+
+    try {
+      jobs.emplace_back(job_from_json(mtx::json::parse(line)));
+
+    } catch (std::exception const &ex) {
+      throw std::domain_error{fmt::format(Y("line {0}: {1}"), line_number, ex.what())};
+    }
+  }
+
+  return jobs;
+}
+
+std::vector<batch_job_t>
+read_batch_jobs(std::string const &file_name) {
+  std::string buffer;
+
+  try {
+    auto io = std::make_shared<mm_text_io_c>(std::make_shared<mm_file_io_c>(file_name));
+    io->read(buffer, io->get_size());
+
+  } catch (mtx::mm_io::exception &ex) {
+    mxerror(fmt::format(Y("The file '{0}' could not be opened for reading: {1}.\n"), file_name, ex));
+  }
+
+  try {
+    return parse_batch_jobs(buffer);
+
+  } catch (std::exception const &ex) {
+    mxerror(fmt::format(Y("The batch job file '{0}' contains an error: {1}.\n"), file_name, ex.what()));
+  }
+
+  return {};
+}
+
+batch_global_state_c::batch_global_state_c()
+  : m_normalization_mode{mtx::bcp47::language_c::get_normalization_mode()}
+  , m_language_ietf_disabled{mtx::bcp47::language_c::is_disabled()}
+  , m_use_legacy_font_mime_types{g_use_legacy_font_mime_types}
+{
+}
+
+void
+batch_global_state_c::restore()
+  const {
+  mtx::bcp47::language_c::set_normalization_mode(m_normalization_mode);
+  mtx::bcp47::language_c::set_disabled(m_language_ietf_disabled);
+  g_use_legacy_font_mime_types = m_use_legacy_font_mime_types;
+
+  g_track_uid_changes.clear();
+  clear_list_of_unique_numbers(UNIQUE_ALL_IDS);
+}
+
+} // namespace mtx::propedit
@@ -0,0 +1,55 @@
+/*
+   mkvpropedit -- utility for editing properties of existing Matroska files
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include "common/bcp47.h"
+#include "common/json.h"
+
+namespace mtx::propedit {
+
+// One entry of a batch job file: the file to modify and the
+// command line arguments describing the modifications, e.g.
+// { "file_name": "a.mkv", "arguments": [ "--edit", "info", "--set", "title=A" ] }
+struct batch_job_t {
+  std::string m_file_name;
+  std::vector<std::string> m_arguments;
+};
+
+struct batch_result_t {
+  std::string m_file_name;
+  bool m_success{}, m_modified{};
+  std::vector<std::string> m_warnings, m_errors;
+
+  nlohmann::json to_json() const;
+};
+
+// Process-wide settings that the options of one job may change and
+// that would otherwise carry over to all following jobs. They're
+// captured before the first job and restored before each job.
+class batch_global_state_c {
+protected:
+  mtx::bcp47::normalization_mode_e m_normalization_mode;
+  bool m_language_ietf_disabled, m_use_legacy_font_mime_types;
+
+public:
+  batch_global_state_c();
+
+  void restore() const;
+};
+
+// Accepts either a JSON array of job objects or one job object per
+// line (NDJSON). Throws std::exception on invalid content.
+std::vector<batch_job_t> parse_batch_jobs(std::string const &content);
+std::vector<batch_job_t> read_batch_jobs(std::string const &file_name);
+
+} // namespace mtx::propedit
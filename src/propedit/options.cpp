@@ -30,6 +30,12 @@ options_c::options_c()
 
 void
 options_c::validate() {
+  if (!m_batch_file_name.empty()) {
+    if (!m_file_name.empty() || has_changes())
+      mxerror(Y("The option '--batch' cannot be combined with a file name or with any action as those are read from the batch job file.\n"));
+    return;
+  }
+
   if (m_file_name.empty())
     mxerror(Y("No file name given.\n"));
 
@@ -131,6 +137,14 @@ options_c::set_file_name(const std::string &file_name) {
   m_file_name = file_name;
 }
 
+void
+options_c::set_batch_file_name(const std::string &file_name) {
+  if (!m_batch_file_name.empty())
+    mxerror(fmt::format(Y("More than one batch job file has been given ('{0}' and '{1}').\n"), m_batch_file_name, file_name));
+
+  m_batch_file_name = file_name;
+}
+
 void
 options_c::set_parse_mode(const std::string &parse_mode) {
   if (parse_mode == "full")
@@ -20,7 +20,7 @@
 
 class options_c {
 public:
-  std::string m_file_name, m_chapter_charset;
+  std::string m_file_name, m_chapter_charset, m_batch_file_name;
   std::vector<target_cptr> m_targets;
   bool m_show_progress;
   kax_analyzer_c::parse_mode_e m_parse_mode;
@@ -37,6 +37,7 @@ public:
   void add_attachment_command(attachment_target_c::command_e command, std::string const &spec, attachment_target_c::options_t const &options);
   void add_delete_track_statistics_tags(tag_target_c::tag_operation_mode_e operation_mode);
   void set_file_name(const std::string &file_name);
+  void set_batch_file_name(const std::string &file_name);
   void set_parse_mode(const std::string &parse_mode);
   void dump_info() const;
   bool has_changes() const;
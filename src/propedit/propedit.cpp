@@ -15,11 +15,14 @@
 #include <matroska/KaxTags.h>
 #include <matroska/KaxTracks.h>
 
+#include "common/at_scope_exit.h"
 #include "common/command_line.h"
 #include "common/list_utils.h"
 #include "common/mm_io_x.h"
+#include "common/strings/editing.h"
 #include "common/unique_numbers.h"
 #include "common/version.h"
+#include "propedit/batch.h"
 #include "propedit/globals.h"
 #include "propedit/propedit_cli_parser.h"
 
@@ -77,6 +80,29 @@ has_content_been_modified(options_cptr const &options) {
   return mtx::any(options->m_targets, [](target_cptr const &t) { return t->has_content_been_modified(); });
 }
 
+// Elements which are removed or which still fit into the space they
+// occupy are written first. That way elements which have to be
+// relocated because they've grown can use the space freed by the
+// others instead of taking away space the others could have stayed in.
+static bool
+fits_into_current_space(kax_analyzer_c &analyzer,
+                        target_c &target) {
+  auto &l1_element = *target.get_level1_element();
+
+  if (!l1_element.ListSize())
+    return true;
+
+  int64_t current_size = 0;
+  analyzer.with_elements(EbmlId(l1_element), [&current_size](kax_analyzer_data_c const &data) {
+    current_size = std::max(current_size, data.m_size);
+  });
+
+  auto write_defaults = target.write_elements_set_to_default_value();
+  l1_element.UpdateSize(write_defaults, true);
+
+  return static_cast<int64_t>(l1_element.ElementSize(write_defaults)) <= current_size;
+}
+
 static void
 write_changes(options_cptr &options,
               kax_analyzer_c *analyzer) {
@@ -87,24 +113,32 @@ write_changes(options_cptr &options,
   ids_to_write.push_back(KaxChapters::ClassInfos.GlobalId);
   ids_to_write.push_back(KaxAttachments::ClassInfos.GlobalId);
 
+  std::vector<target_c *> targets_to_write;
+
   for (auto &id_to_write : ids_to_write) {
     for (auto &target : options->m_targets) {
       if (!target->get_level1_element())
         continue;
 
-      EbmlMaster &l1_element = *target->get_level1_element();
-
-      if (id_to_write != l1_element.Generic().GlobalId)
+      if (id_to_write != target->get_level1_element()->Generic().GlobalId)
         continue;
 
-      auto result = l1_element.ListSize() ? analyzer->update_element(&l1_element, target->write_elements_set_to_default_value(), target->add_mandatory_elements_if_missing())
-                  :                         analyzer->remove_elements(EbmlId(l1_element));
-      if (kax_analyzer_c::uer_success != result)
-        display_update_element_result(l1_element.Generic(), result);
+      targets_to_write.push_back(target.get());
 
       break;
     }
   }
+
+  std::stable_partition(targets_to_write.begin(), targets_to_write.end(), [analyzer](target_c *target) { return fits_into_current_space(*analyzer, *target); });
+
+  for (auto target : targets_to_write) {
+    EbmlMaster &l1_element = *target->get_level1_element();
+
+    auto result = l1_element.ListSize() ? analyzer->update_element(&l1_element, target->write_elements_set_to_default_value(), target->add_mandatory_elements_if_missing())
+                :                         analyzer->remove_elements(EbmlId(l1_element));
+    if (kax_analyzer_c::uer_success != result)
+      display_update_element_result(l1_element.Generic(), result);
+  }
 }
 
 static void
@@ -120,7 +154,7 @@ update_ebml_head(mm_io_c &file) {
   mxwarn(fmt::format("{0} {1}\n", Y("Updating the 'document type version' or 'document type read version' header fields failed."), details));
 }
 
-static void
+static bool
 run(options_cptr &options) {
   g_doc_type_version_handler.reset(new mtx::doc_type_version_handler_c);
 
@@ -183,10 +217,87 @@ run(options_cptr &options) {
 
     mxinfo(Y("Done.\n"));
 
-  } else
-    mxinfo(Y("No changes were made.\n"));
+    return true;
+  }
 
-  mxexit();
+  mxinfo(Y("No changes were made.\n"));
+
+  return false;
+}
+
+// Thrown by the message handlers installed in batch mode in order to
+// abort the current job instead of the whole process.
+struct batch_job_aborted_x {};
+
+static mtx::propedit::batch_result_t
+run_batch_job(mtx::propedit::batch_job_t const &job,
+              mtx::propedit::batch_global_state_c const &global_state) {
+  mtx::propedit::batch_result_t result;
+  result.m_file_name = job.m_file_name;
+
+  auto previous_warning_handler = set_mxmsg_handler(MXMSG_WARNING, [&result](unsigned int, std::string const &message) {
+    result.m_warnings.emplace_back(mtx::string::chomp(message));
+    if (mtx::cli::g_abort_on_warnings)
+      throw batch_job_aborted_x{};
+  });
+
+  // Some errors are reported from within "catch (...)" blocks which
+  // swallow the exception. The job has failed nonetheless.
+  auto previous_error_handler = set_mxmsg_handler(MXMSG_ERROR, [&result](unsigned int, std::string const &message) {
+    result.m_errors.emplace_back(mtx::string::chomp(message));
+    throw batch_job_aborted_x{};
+  });
+
+  mtx::at_scope_exit_c restore_handlers([&previous_warning_handler, &previous_error_handler]() {
+    set_mxmsg_handler(MXMSG_WARNING, previous_warning_handler);
+    set_mxmsg_handler(MXMSG_ERROR,   previous_error_handler);
+  });
+
+  global_state.restore();
+
+  try {
+    auto args = job.m_arguments;
+    args.emplace_back(job.m_file_name);
+
+    auto options      = propedit_cli_parser_c{args, true}.run();
+    result.m_modified = run(options);
+
+  } catch (batch_job_aborted_x const &) {
+  } catch (std::exception const &ex) {
+    result.m_errors.emplace_back(ex.what());
+  }
+
+  result.m_success = result.m_errors.empty();
+
+  return result;
+}
+
+static void
+run_batch(std::string const &file_name) {
+  auto jobs            = mtx::propedit::read_batch_jobs(file_name);
+  auto num_failed      = 0u;
+  auto warnings_issued = false;
+
+  mtx::propedit::batch_global_state_c global_state;
+
+  // Only the per-file results are output.
+  auto previous_info_handler = set_mxmsg_handler(MXMSG_INFO, [](unsigned int, std::string const &) {});
+  mtx::at_scope_exit_c restore_info_handler([&previous_info_handler]() { set_mxmsg_handler(MXMSG_INFO, previous_info_handler); });
+
+  for (auto const &job : jobs) {
+    auto result = run_batch_job(job, global_state);
+
+    if (!result.m_success)
+      ++num_failed;
+    if (!result.m_warnings.empty())
+      warnings_issued = true;
+
+    // Written directly so that the results aren't suppressed by '--quiet'.
+    g_mm_stdio->puts(fmt::format("{0}\n", mtx::json::dump(result.to_json(), -1)));
+    g_mm_stdio->flush();
+  }
+
+  mxexit(num_failed ? 2 : warnings_issued ? 1 : 0);
 }
 
 static
@@ -212,7 +323,10 @@ main(int argc,
     options->dump_info();
   }
 
-  run(options);
+  if (!options->m_batch_file_name.empty())
+    run_batch(options->m_batch_file_name);
+  else
+    run(options);
 
   mxexit();
 }
@@ -16,6 +16,7 @@
 #include <QRegularExpression>
 
 #include "common/bcp47.h"
+#include "common/container.h"
 #include "common/ebml.h"
 #include "common/list_utils.h"
 #include "common/qt.h"
@@ -25,11 +26,14 @@
 #include "propedit/globals.h"
 #include "propedit/propedit_cli_parser.h"
 
-propedit_cli_parser_c::propedit_cli_parser_c(const std::vector<std::string> &args)
+propedit_cli_parser_c::propedit_cli_parser_c(const std::vector<std::string> &args,
+                                             bool batch_job)
   : mtx::cli::parser_c{args}
   , m_options(options_cptr(new options_c))
   , m_target(m_options->add_track_or_segmentinfo_target("segment_info"))
+  , m_batch_job{batch_job}
 {
+  m_no_common_cli_args = batch_job;
 }
 
 void
@@ -210,6 +214,11 @@ propedit_cli_parser_c::set_file_name() {
   m_options->set_file_name(m_current_arg);
 }
 
+void
+propedit_cli_parser_c::set_batch_file_name() {
+  m_options->set_batch_file_name(m_next_arg);
+}
+
 void
 propedit_cli_parser_c::disable_language_ietf() {
   mtx::bcp47::language_c::disable();
@@ -238,11 +247,13 @@ propedit_cli_parser_c::enable_legacy_font_mime_types() {
 void
 propedit_cli_parser_c::init_parser() {
   add_information(YT("mkvpropedit [options] <file> <actions>"));
+  add_information(YT("mkvpropedit [options] --batch <jobs-file>"));
 
   add_section_header(YT("Options"));
   add_option("l|list-property-names",         std::bind(&propedit_cli_parser_c::list_property_names,           this), YT("List all valid property names and exit"));
   add_option("p|parse-mode=<mode>",           std::bind(&propedit_cli_parser_c::set_parse_mode,                this), YT("Sets the Matroska parser mode to 'fast' (default) or 'full'"));
   add_option("enable-legacy-font-mime-types", std::bind(&propedit_cli_parser_c::enable_legacy_font_mime_types, this), YT("Use legacy font MIME types when adding new attachments or replacing existing ones"));
+  add_option("batch=<file>",                  std::bind(&propedit_cli_parser_c::set_batch_file_name,           this), YT("Process all files and actions listed in the JSON batch job file 'file' and report one JSON result per file (see man page for syntax)"));
 
   add_section_header(YT("Actions for handling properties"));
   add_option("e|edit=<selector>",  std::bind(&propedit_cli_parser_c::add_target, this), YT("Sets the Matroska file section that all following add/set/delete actions operate on (see below and man page for syntax)"));
@@ -309,10 +320,31 @@ propedit_cli_parser_c::validate() {
               "without a following '--add-attachment', '--replace-attachment' or '--update-attachment' option.\n"));
 }
 
+void
+propedit_cli_parser_c::reject_process_wide_options() {
+  static std::vector<std::string> const s_process_wide_options{
+    "-v", "--verbose", "-q", "--quiet", "-h", "-?", "--help", "-V", "--version", "-l", "--list-property-names", "--batch",
+    "--ui-language", "--command-line-charset", "--output-charset", "-r", "--redirect-output", "--flush-on-close", "--abort-on-warnings",
+    "--debug", "--engage", "--gui-mode",
+  };
+
+  for (auto arg = m_args.cbegin(), end = m_args.cend(); arg != end; ++arg) {
+    if (mtx::includes(s_process_wide_options, *arg))
+      mxerror(fmt::format(Y("The option '{0}' cannot be used in batch jobs.\n"), *arg));
+
+    auto option = m_option_map.find(*arg);
+    if ((option != m_option_map.end()) && option->second.m_needs_arg && ((arg + 1) != end))
+      ++arg;
+  }
+}
+
 options_cptr
 propedit_cli_parser_c::run() {
   init_parser();
 
+  if (m_batch_job)
+    reject_process_wide_options();
+
   parse_args();
   validate();
 
@@ -21,15 +21,19 @@ protected:
   options_cptr m_options;
   target_cptr m_target;
   attachment_target_c::options_t m_attachment;
+  bool m_batch_job;
 
 public:
-  propedit_cli_parser_c(const std::vector<std::string> &args);
+  // For batch jobs options affecting the whole process such as
+  // '--quiet' or '--ui-language' are rejected.
+  propedit_cli_parser_c(const std::vector<std::string> &args, bool batch_job = false);
 
   options_cptr run();
 
 protected:
   void init_parser();
   void validate();
+  void reject_process_wide_options();
 
   void add_target();
   void add_change();
@@ -38,6 +42,7 @@ protected:
   void set_chapter_charset();
   void set_parse_mode();
   void set_file_name();
+  void set_batch_file_name();
   void disable_language_ietf();
   void enable_legacy_font_mime_types();
   void set_language_ietf_normalization_mode();
@@ -0,0 +1,98 @@
+#include "common/common_pch.h"
+
+#include "common/avc_hevc/parameter_set_cache.h"
+#include "common/checksums/base.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+using cache_c = mtx::avc_hevc::parameter_set_cache_c<int>;
+
+memory_cptr
+nalu(std::vector<unsigned char> const &bytes) {
+  return memory_c::clone(bytes.data(), bytes.size());
+}
+
+TEST(ParameterSetCache, Hit) {
+  cache_c cache;
+  auto raw    = nalu({ 0x42, 0x01, 0x01, 0x60 });
+  auto parsed = nalu({ 0x42, 0x01, 0x01 });
+
+  cache.add(*raw, 1, parsed, 4711);
+
+  auto entry = cache.find(*nalu({ 0x42, 0x01, 0x01, 0x60 }), 1);
+
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(4711, entry->m_info);
+  EXPECT_EQ(1u, entry->m_context);
+  EXPECT_EQ(parsed.get(), entry->m_parsed.get());
+  EXPECT_TRUE(*entry->m_raw == *raw);
+
+  // The cache keeps its own copy of the NALU.
+  raw->get_buffer()[3] = 0x61;
+  EXPECT_NE(nullptr, cache.find(*nalu({ 0x42, 0x01, 0x01, 0x60 }), 1));
+}
+
+TEST(ParameterSetCache, Miss) {
+  cache_c cache;
+
+  EXPECT_EQ(nullptr, cache.find(*nalu({ 0x42, 0x01, 0x01, 0x60 }), 0));
+
+  cache.add(*nalu({ 0x42, 0x01, 0x01, 0x60 }), 0, {}, 1);
+
+  EXPECT_EQ(nullptr, cache.find(*nalu({ 0x42, 0x01, 0x01, 0x61 }), 0));
+  EXPECT_EQ(nullptr, cache.find(*nalu({ 0x42, 0x01, 0x01 }),       0));
+  EXPECT_EQ(nullptr, cache.find(*nalu({ 0x42, 0x01, 0x01, 0x60, 0x00 }), 0));
+}
+
+TEST(ParameterSetCache, HashCollisionWithDifferentContent) {
+  // Same length and same Adler-32 checksum, but different bytes.
+  auto first  = nalu({ 0x42, 0x02, 0x42 });
+  auto second = nalu({ 0x43, 0x00, 0x43 });
+
+  ASSERT_EQ(mtx::checksum::calculate_as_uint(mtx::checksum::algorithm_e::adler32, *first),
+            mtx::checksum::calculate_as_uint(mtx::checksum::algorithm_e::adler32, *second));
+
+  cache_c cache;
+  cache.add(*first, 0, {}, 1);
+
+  EXPECT_EQ(nullptr, cache.find(*second, 0));
+
+  cache.add(*second, 0, {}, 2);
+
+  auto entry = cache.find(*second, 0);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(2, entry->m_info);
+
+  EXPECT_EQ(nullptr, cache.find(*first, 0));
+}
+
+TEST(ParameterSetCache, ContextMismatch) {
+  cache_c cache;
+  auto raw = nalu({ 0x42, 0x01, 0x01, 0x60 });
+
+  cache.add(*raw, 0, {}, 1);
+
+  EXPECT_EQ(nullptr, cache.find(*raw, 1));
+  ASSERT_NE(nullptr, cache.find(*raw, 0));
+
+  // Entries whose parsing depends on state outside the context, e.g.
+  // HEVC SPS on the VPS list, are dropped by clearing the cache when
+  // that state changes.
+  cache.clear();
+
+  EXPECT_EQ(nullptr, cache.find(*raw, 0));
+}
+
+TEST(ParameterSetCache, SizeIsBounded) {
+  cache_c cache;
+
+  for (auto idx = 0; idx < 65; ++idx)
+    cache.add(*nalu({ 0x42, static_cast<unsigned char>(idx) }), 0, {}, idx);
+
+  EXPECT_EQ(nullptr, cache.find(*nalu({ 0x42, 0x00 }), 0));
+  EXPECT_NE(nullptr, cache.find(*nalu({ 0x42, 64 }), 0));
+}
+
+}
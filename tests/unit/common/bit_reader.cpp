@@ -1,7 +1,9 @@
 #include "common/common_pch.h"
 
 #include "common/bit_reader.h"
+#include "common/bit_writer.h"
 #include "common/endian.h"
+#include "common/mpeg.h"
 
 #include "tests/unit/init.h"
 
@@ -385,4 +387,149 @@ TEST(BitReader, RBSPMode5) {
   EXPECT_EQ(0x6e, b.get_bits(8));
 }
 
+TEST(BitReader, RBSPModeTrailingEmulationPreventionByte) {
+  unsigned char value[4] = { 0x08, 0x00, 0x00, 0x03 };
+  auto b = mtx::bits::reader_c{value, 4};
+  b.enable_rbsp_mode();
+
+  EXPECT_EQ(0,    b.get_bit_position());
+  EXPECT_EQ(32,   b.get_remaining_bits());
+  EXPECT_EQ(0x08, b.get_bits(8));
+  EXPECT_EQ(8,    b.get_bit_position());
+  EXPECT_EQ(0x00, b.get_bits(12));
+  EXPECT_EQ(20,   b.get_bit_position());
+  EXPECT_EQ(12,   b.get_remaining_bits());
+  EXPECT_EQ(0x00, b.get_bits(4));
+  EXPECT_EQ(32,   b.get_bit_position());
+  EXPECT_EQ(0,    b.get_remaining_bits());
+  EXPECT_THROW(b.get_bits(1), mtx::mm_io::end_of_file_x);
+}
+
+
+uint64_t
+reference_bits(std::vector<unsigned char> const &data,
+               std::size_t position,
+               std::size_t n) {
+  uint64_t value{};
+
+  for (auto idx = position; idx < position + n; ++idx)
+    value = (value << 1) | ((data[idx / 8] >> (7 - idx % 8)) & 1);
+
+  return value;
+}
+
+std::vector<unsigned char>
+pseudo_random_data(std::size_t size) {
+  std::vector<unsigned char> data(size);
+  uint32_t state = 0x12345678;
+
+  for (auto &byte : data) {
+    state = state * 1664525 + 1013904223;
+    byte  = state >> 24;
+  }
+
+  return data;
+}
+
+TEST(BitReader, GetBitsAcrossCacheRefills) {
+  auto data = pseudo_random_data(200);
+  auto b    = mtx::bits::reader_c{data.data(), data.size()};
+
+  std::size_t position = 0, n = 1;
+
+  while ((position + n) <= data.size() * 8) {
+    ASSERT_EQ(reference_bits(data, position, n), b.peek_bits(n)) << position << " " << n;
+    ASSERT_EQ(reference_bits(data, position, n), b.get_bits(n))  << position << " " << n;
+
+    position += n;
+    n         = n % 64 + 1;
+
+    ASSERT_EQ(static_cast<int>(position), b.get_bit_position());
+  }
+
+  EXPECT_THROW(b.get_bits(n), mtx::mm_io::end_of_file_x);
+  EXPECT_TRUE(b.eof());
+}
+
+TEST(BitReader, GetUnsignedGolombLongCodes) {
+  std::vector<uint64_t> const values{ 0, 1, 2, 1000, 1ull << 20, (1ull << 31) - 1, 5, (1ull << 31) + 12345 };
+  mtx::bits::writer_c w;
+
+  for (auto value : values) {
+    auto num_bits = mtx::math::int_log2(value + 1) + 1;
+    w.put_bits(num_bits - 1, 0);
+    w.put_bits(num_bits, value + 1);
+  }
+
+  auto buffer = w.get_buffer();
+  auto b      = mtx::bits::reader_c{*buffer};
+
+  for (auto value : values)
+    EXPECT_EQ(value, b.get_unsigned_golomb());
+}
+
+TEST(BitReader, RBSPModeMatchesUnescapedData) {
+  auto data = pseudo_random_data(300);
+
+  // Sprinkle emulation prevention sequences, some of them directly
+  // following each other.
+  for (auto pos : { 0u, 3u, 6u, 20u, 40u, 43u, 46u, 49u, 100u, 101u, 150u, 205u, 297u }) {
+    data[pos]     = 0x00;
+    data[pos + 1] = 0x00;
+    data[pos + 2] = 0x03;
+  }
+
+  auto unescaped = mtx::mpeg::nalu_to_rbsp(memory_c::clone(data.data(), data.size()));
+  std::vector<unsigned char> rbsp(unescaped->get_buffer(), unescaped->get_buffer() + unescaped->get_size());
+
+  for (auto first_n : { 1u, 7u, 8u, 57u }) {
+    auto b = mtx::bits::reader_c{data.data(), data.size()};
+    b.enable_rbsp_mode();
+
+    std::size_t position = 0, n = first_n;
+
+    while ((position + n) <= rbsp.size() * 8) {
+      ASSERT_EQ(reference_bits(rbsp, position, n), b.get_bits(n)) << first_n << " " << position << " " << n;
+
+      position += n;
+      n         = n % 64 + 1;
+    }
+
+    EXPECT_THROW(b.get_bits(n), mtx::mm_io::end_of_file_x);
+    EXPECT_EQ(static_cast<int>(data.size() * 8), b.get_bit_position());
+  }
+}
+
+TEST(BitReader, RBSPModeSkipBitsMatchesUnescapedData) {
+  auto data = pseudo_random_data(400);
+
+  // Long runs without emulation prevention sequences as well as
+  // sequences close to each other.
+  for (auto pos : { 2u, 5u, 30u, 33u, 36u, 200u, 300u, 303u, 390u }) {
+    data[pos]     = 0x00;
+    data[pos + 1] = 0x00;
+    data[pos + 2] = 0x03;
+  }
+
+  auto unescaped = mtx::mpeg::nalu_to_rbsp(memory_c::clone(data.data(), data.size()));
+  std::vector<unsigned char> rbsp(unescaped->get_buffer(), unescaped->get_buffer() + unescaped->get_size());
+
+  for (auto to_skip : { 3u, 16u, 61u, 100u, 509u }) {
+    auto b = mtx::bits::reader_c{data.data(), data.size()};
+    b.enable_rbsp_mode();
+
+    std::size_t position = 0;
+
+    while ((position + to_skip + 5) <= rbsp.size() * 8) {
+      b.skip_bits(to_skip);
+      position += to_skip;
+
+      ASSERT_EQ(reference_bits(rbsp, position, 5), b.get_bits(5)) << to_skip << " " << position;
+      position += 5;
+    }
+
+    EXPECT_THROW(b.skip_bits(rbsp.size() * 8 - position + 1), mtx::mm_io::end_of_file_x);
+  }
+}
+
 }
@@ -0,0 +1,82 @@
+#include "common/common_pch.h"
+
+#include "common/bswap.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+std::vector<unsigned char>
+make_data(std::size_t size) {
+  std::vector<unsigned char> data(size);
+  for (auto idx = 0u; idx < size; ++idx)
+    data[idx] = (idx * 37 + 11) & 0xff;
+
+  return data;
+}
+
+TEST(Bswap, SwapBuffer) {
+  for (auto word_length : { 2u, 3u, 4u, 5u, 8u }) {
+    // Covers the vectorized main loops as well as the tails.
+    for (auto num_words : { 0u, 1u, 5u, 16u, 33u, 100u }) {
+      auto src = make_data(word_length * num_words);
+      std::vector<unsigned char> expected(src.size()), dst(src.size());
+
+      for (auto idx = 0u; idx < src.size(); ++idx)
+        expected[idx] = src[(idx / word_length) * word_length + word_length - 1 - idx % word_length];
+
+      mtx::bytes::swap_buffer(src.data(), dst.data(), src.size(), word_length);
+      EXPECT_EQ(expected, dst) << word_length << " " << num_words;
+
+      mtx::bytes::swap_buffer(src.data(), src.data(), src.size(), word_length);
+      EXPECT_EQ(expected, src) << word_length << " " << num_words;
+    }
+  }
+
+  unsigned char buffer[3]{};
+  EXPECT_THROW(mtx::bytes::swap_buffer(buffer, buffer, 3, 2), std::invalid_argument);
+}
+
+TEST(Bswap, PcmFrameShuffler) {
+  struct layout_t {
+    std::size_t bytes_per_sample, num_src_channels;
+    std::vector<std::size_t> map;
+  };
+
+  std::vector<layout_t> const layouts{
+    { 2, 6, { 0, 1, 2, 5, 3, 4 } },
+    { 2, 8, { 0, 1, 2, 4, 5, 3, 6 } },
+    { 3, 6, { 0, 1, 2, 5, 3, 4 } },
+    { 3, 8, { 0, 1, 2, 7, 4, 5, 3, 6 } },
+    { 4, 8, { 0, 1, 2, 7, 4, 5, 3, 6 } },
+    { 3, 2, { 0 } },
+    { 8, 6, { 5, 4, 3, 2, 1, 0 } },
+  };
+
+  for (auto const &layout : layouts) {
+    for (auto swap_bytes : { false, true }) {
+      mtx::bytes::pcm_frame_shuffler_c shuffler{layout.bytes_per_sample, layout.num_src_channels, layout.map, swap_bytes};
+
+      auto bps        = layout.bytes_per_sample;
+      auto num_frames = 50u;
+      auto src        = make_data(shuffler.get_src_frame_size() * num_frames + 1); // incomplete trailing frame
+      std::vector<unsigned char> expected;
+
+      for (auto frame = 0u; frame < num_frames; ++frame)
+        for (auto channel : layout.map)
+          for (auto byte = 0u; byte < bps; ++byte)
+            expected.push_back(src[frame * shuffler.get_src_frame_size() + channel * bps + (swap_bytes ? bps - 1 - byte : byte)]);
+
+      std::vector<unsigned char> dst(src.size());
+      ASSERT_EQ(expected.size(), shuffler.shuffle(src.data(), dst.data(), src.size()));
+      dst.resize(expected.size());
+      EXPECT_EQ(expected, dst) << bps << " " << layout.num_src_channels << " " << swap_bytes;
+
+      ASSERT_EQ(expected.size(), shuffler.shuffle(src.data(), src.data(), src.size()));
+      src.resize(expected.size());
+      EXPECT_EQ(expected, src) << bps << " " << layout.num_src_channels << " " << swap_bytes << " (in place)";
+    }
+  }
+}
+
+}
@@ -0,0 +1,115 @@
+#include "common/common_pch.h"
+
+#include "common/compression.h"
+#include "common/endian.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+memory_cptr
+sample_data() {
+  std::string text;
+  for (auto idx = 0; idx < 200; ++idx)
+    text += fmt::format("{0}\n00:00:{1:02},000 --> 00:00:{1:02},500\nThis is subtitle number {0}.\n\n", idx, idx % 60);
+
+  return memory_c::clone(text);
+}
+
+void
+test_round_trip(compression_method_e method,
+                compression_parameters_t const &parameters = {}) {
+  auto compressor = compressor_c::create(method, parameters);
+  ASSERT_TRUE(!!compressor);
+
+  auto raw          = sample_data();
+  auto compressed   = compressor->compress(raw);
+  auto decompressed = compressor->decompress(compressed);
+
+  EXPECT_LT(compressed->get_size(), raw->get_size());
+  EXPECT_TRUE(*raw == *decompressed);
+
+  // Empty frames must survive as well.
+  auto empty = memory_c::alloc(0);
+  EXPECT_EQ(0u, compressor->decompress(compressor->compress(empty))->get_size());
+}
+
+TEST(Compression, ZlibRoundTrip) {
+  test_round_trip(COMPRESSION_ZLIB);
+  test_round_trip(COMPRESSION_ZLIB, { 1, {} });
+}
+
+TEST(Compression, NonstandardMethods) {
+  EXPECT_FALSE(compressor_c::is_nonstandard(COMPRESSION_ZLIB));
+  EXPECT_FALSE(compressor_c::is_nonstandard(COMPRESSION_HEADER_REMOVAL));
+  EXPECT_TRUE(compressor_c::is_nonstandard(COMPRESSION_ZSTD));
+  EXPECT_TRUE(compressor_c::is_nonstandard(COMPRESSION_LZ4));
+}
+
+#if defined(HAVE_ZSTD)
+TEST(Compression, ZstdRoundTrip) {
+  test_round_trip(COMPRESSION_ZSTD);
+  test_round_trip(COMPRESSION_ZSTD, { 19, {} });
+  test_round_trip(COMPRESSION_ZSTD, { {}, memory_c::clone("This is subtitle number 00:00:00,000 --> 00:00:00,500\n"s) });
+}
+
+TEST(Compression, ZstdDictionaryIsRequired) {
+  auto dictionary = memory_c::clone("This is subtitle number 00:00:00,000 --> 00:00:00,500\n"s);
+  auto compressor = compressor_c::create(COMPRESSION_ZSTD, { {}, dictionary });
+  auto compressed = compressor->compress(sample_data());
+
+  EXPECT_ANY_THROW(compressor_c::create(COMPRESSION_ZSTD)->decompress(compressed));
+}
+
+TEST(Compression, ZstdBogusContentSize) {
+  // Single-segment frame claiming 1 TiB of content, followed by a raw
+  // block containing a single byte.
+  unsigned char frame[] = { 0x28, 0xb5, 0x2f, 0xfd, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 'a' };
+
+  EXPECT_ANY_THROW(compressor_c::create(COMPRESSION_ZSTD)->decompress(memory_c::clone(frame, sizeof(frame))));
+}
+
+TEST(Compression, ZstdUnknownContentSize) {
+  // Frames without a content size are decompressed in chunks: one raw
+  // block containing a single byte, marked as the last one or not.
+  unsigned char complete[]  = { 0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x00, 0x09, 0x00, 0x00, 'a' };
+  unsigned char truncated[] = { 0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x00, 0x08, 0x00, 0x00, 'a' };
+  auto compressor           = compressor_c::create(COMPRESSION_ZSTD);
+
+  EXPECT_EQ("a"s, compressor->decompress(memory_c::clone(complete, sizeof(complete)))->to_string());
+  EXPECT_ANY_THROW(compressor->decompress(memory_c::clone(truncated, sizeof(truncated))));
+}
+#endif
+
+#if defined(HAVE_LZ4)
+TEST(Compression, Lz4RoundTrip) {
+  test_round_trip(COMPRESSION_LZ4);
+  test_round_trip(COMPRESSION_LZ4, { 1, {} });
+  test_round_trip(COMPRESSION_LZ4, { 1,  memory_c::clone("This is subtitle number 00:00:00,000 --> 00:00:00,500\n"s) });
+  test_round_trip(COMPRESSION_LZ4, { 12, memory_c::clone("This is subtitle number 00:00:00,000 --> 00:00:00,500\n"s) });
+}
+
+TEST(Compression, Lz4TruncatedData) {
+  auto compressor = compressor_c::create(COMPRESSION_LZ4);
+  auto compressed = compressor->compress(sample_data());
+
+  compressed->resize(compressed->get_size() / 2);
+
+  EXPECT_ANY_THROW(compressor->decompress(compressed));
+  EXPECT_ANY_THROW(compressor->decompress(memory_c::alloc(2)));
+}
+
+TEST(Compression, Lz4BogusRawSize) {
+  auto compressor = compressor_c::create(COMPRESSION_LZ4);
+  auto compressed = compressor->compress(sample_data());
+
+  // More than 255 times the compressed size
+  put_uint32_be(compressed->get_buffer(), (compressed->get_size() - 4) * 255 + 1);
+  EXPECT_ANY_THROW(compressor->decompress(compressed));
+
+  put_uint32_be(compressed->get_buffer(), 0xffffffff);
+  EXPECT_ANY_THROW(compressor->decompress(compressed));
+}
+#endif
+
+}
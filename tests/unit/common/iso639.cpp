@@ -0,0 +1,51 @@
+#include "common/common_pch.h"
+
+#include "common/iso639.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+using namespace mtx::iso639;
+
+TEST(ISO639, LookUpByCode) {
+  auto language = look_up("ger");
+
+  ASSERT_TRUE(language.has_value());
+  EXPECT_EQ("ger"s, language->alpha_3_code);
+  EXPECT_EQ("de"s,  language->alpha_2_code);
+  EXPECT_EQ("deu"s, language->terminology_abbrev);
+  EXPECT_TRUE(language->is_part_of_iso639_2);
+
+  EXPECT_EQ("ger"s, look_up("de")->alpha_3_code);
+  EXPECT_EQ("ger"s, look_up("deu")->alpha_3_code);
+  EXPECT_EQ("kud"s, look_up("kud")->alpha_3_code);
+  EXPECT_EQ("qaa"s, look_up("qaa")->alpha_3_code);
+}
+
+TEST(ISO639, LookUpDeprecatedCodes) {
+  EXPECT_EQ("he"s,  look_up("iw")->alpha_2_code);
+  EXPECT_EQ("srp"s, look_up("scc")->alpha_3_code);
+}
+
+TEST(ISO639, LookUpFailures) {
+  EXPECT_FALSE(look_up("").has_value());
+  EXPECT_FALSE(look_up("zzzz").has_value());
+  EXPECT_FALSE(look_up("GER").has_value());
+  EXPECT_FALSE(look_up("German").has_value());
+}
+
+TEST(ISO639, LookUpByName) {
+  EXPECT_EQ("ger"s, look_up("german", true)->alpha_3_code);
+  EXPECT_FALSE(look_up("Klingonish", true).has_value());
+}
+
+TEST(ISO639, AllLanguages) {
+  auto const &all = languages();
+
+  ASSERT_FALSE(all.empty());
+  EXPECT_EQ(&all, &languages());
+  EXPECT_TRUE(std::find_if(all.begin(), all.end(), [](auto const &language) { return language.alpha_3_code == "eng"; }) != all.end());
+}
+
+}
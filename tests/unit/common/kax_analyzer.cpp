@@ -0,0 +1,68 @@
+#include "common/common_pch.h"
+
+#include <matroska/KaxTracks.h>
+
+#include "common/construct.h"
+#include "common/ebml.h"
+#include "common/kax_analyzer.h"
+
+#include "tests/unit/init.h"
+#include "tests/unit/util.h"
+
+namespace {
+
+using namespace mtx::construct;
+using namespace libmatroska;
+
+// Four bytes ID, one byte coded size, five bytes content (two bytes
+// ID, one byte coded size, two bytes value for the track UID).
+ebml_master_cptr
+create_tracks() {
+  auto tracks = ebml_master_cptr{ cons<KaxTracks>(new KaxTrackUID, 4711u) };
+  tracks->UpdateSize(true, true);
+
+  return tracks;
+}
+
+TEST(KaxAnalyzer, FitElementIntoSpace) {
+  auto tracks = create_tracks();
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 10));
+  EXPECT_EQ(10u, tracks->ElementSize(true));
+
+  tracks = create_tracks();
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 12));
+  EXPECT_EQ(10u, tracks->ElementSize(true));
+
+  tracks = create_tracks();
+  EXPECT_FALSE(kax_analyzer_c::fit_element_into(*tracks, 9));
+  EXPECT_EQ(10u, tracks->ElementSize(true));
+}
+
+TEST(KaxAnalyzer, FitElementIntoSpaceLeavingOneByte) {
+  auto tracks = create_tracks();
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 11));
+  EXPECT_EQ(11u, tracks->ElementSize(true));
+  EXPECT_EQ(2, tracks->GetSizeLength());
+}
+
+TEST(KaxAnalyzer, FitElementIntoSpaceShorteningSizeField) {
+  auto tracks = create_tracks();
+  tracks->SetSizeLength(8);
+  EXPECT_EQ(17u, tracks->ElementSize(true));
+
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 17));
+  EXPECT_EQ(17u, tracks->ElementSize(true));
+
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 12));
+  EXPECT_EQ(10u, tracks->ElementSize(true));
+
+  tracks->SetSizeLength(8);
+  EXPECT_TRUE(kax_analyzer_c::fit_element_into(*tracks, 11));
+  EXPECT_EQ(11u, tracks->ElementSize(true));
+
+  tracks->SetSizeLength(8);
+  EXPECT_FALSE(kax_analyzer_c::fit_element_into(*tracks, 9));
+  EXPECT_EQ(17u, tracks->ElementSize(true));
+}
+
+}
@@ -0,0 +1,169 @@
+#include "common/common_pch.h"
+
+#include "common/kax_flat_cluster.h"
+#include "common/mm_mem_io.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+unsigned char const s_cluster[] = {
+  0x1f, 0x43, 0xb6, 0x75, 0xad,                   // Cluster, size 45
+  0xe7, 0x81, 0x64,                               //   Timestamp 100
+  0xa3, 0x8b,                                     //   SimpleBlock, size 11
+  0x81, 0x00, 0x05, 0x82, 0x01, 0x03,             //     track 1, +5, key, Xiph lacing, 2 frames, first 3 bytes
+  'a', 'b', 'c', 'd', 'e',
+  0xa0, 0x9b,                                     //   BlockGroup, size 27
+  0xa1, 0x87,                                     //     Block, size 7
+  0x82, 0x00, 0x0a, 0x00, 'x', 'y', 'z',          //       track 2, +10
+  0x9b, 0x81, 0x03,                               //     BlockDuration 3
+  0xfb, 0x81, 0xfe,                               //     ReferenceBlock -2
+  0x75, 0xa1, 0x89,                               //     BlockAdditions, size 9
+  0xa6, 0x87,                                     //       BlockMore, size 7
+  0xee, 0x81, 0x04,                               //         BlockAddID 4
+  0xa5, 0x82, 'q', 'r',                           //         BlockAdditional
+};
+
+TEST(KaxFlatCluster, ReadSimpleBlocksAndBlockGroups) {
+  mm_mem_io_c in{s_cluster, sizeof(s_cluster)};
+  kax_flat_cluster_c cluster;
+
+  ASSERT_TRUE(cluster.read(in, sizeof(s_cluster)));
+
+  EXPECT_EQ(sizeof(s_cluster), in.getFilePointer());
+  EXPECT_EQ(0u,                cluster.get_position());
+  EXPECT_EQ(sizeof(s_cluster), cluster.get_size());
+  EXPECT_EQ(100u,              cluster.get_timestamp());
+
+  auto &blocks = cluster.get_blocks();
+  ASSERT_EQ(2u, blocks.size());
+
+  auto &simple = blocks[0];
+  EXPECT_TRUE(simple.m_simple);
+  EXPECT_TRUE(simple.m_key);
+  EXPECT_FALSE(simple.m_discardable);
+  EXPECT_EQ(1u,         simple.m_track_number);
+  EXPECT_EQ(105000000,  simple.m_timestamp);
+  EXPECT_FALSE(simple.m_duration.has_value());
+  ASSERT_EQ(2u,         simple.m_num_frames);
+  EXPECT_EQ(3u,         cluster.get_frame(simple, 0).m_size);
+  EXPECT_EQ(2u,         cluster.get_frame(simple, 1).m_size);
+  EXPECT_EQ(16u,        cluster.get_frame(simple, 0).m_position);
+  EXPECT_EQ(19u,        cluster.get_frame(simple, 1).m_position);
+  EXPECT_EQ("abc"s,     cluster.borrow_frame(simple, 0)->to_string());
+  EXPECT_EQ("de"s,      cluster.borrow_frame(simple, 1)->to_string());
+  EXPECT_EQ(nullptr,    cluster.get_additions(simple));
+
+  auto &group = blocks[1];
+  EXPECT_FALSE(group.m_simple);
+  EXPECT_EQ(2u,         group.m_track_number);
+  EXPECT_EQ(110000000,  group.m_timestamp);
+  ASSERT_TRUE(group.m_duration.has_value());
+  EXPECT_EQ(3000000u,   *group.m_duration);
+  ASSERT_EQ(1u,         group.m_references.size());
+  EXPECT_EQ(-2,         group.m_references[0]);
+  ASSERT_EQ(1u,         group.m_num_frames);
+  EXPECT_EQ("xyz"s,     cluster.borrow_frame(group, 0)->to_string());
+  ASSERT_EQ(1u,         group.m_num_additions);
+  EXPECT_EQ(4u,         cluster.get_additions(group)[0].m_id);
+  EXPECT_EQ(2u,         cluster.get_additions(group)[0].m_size);
+  EXPECT_EQ('q',        cluster.get_additions(group)[0].m_data[0]);
+}
+
+TEST(KaxFlatCluster, RawElements) {
+  mm_mem_io_c in{s_cluster, sizeof(s_cluster)};
+  kax_flat_cluster_c cluster;
+
+  EXPECT_FALSE(cluster.is_raw());
+  ASSERT_TRUE(cluster.read(in, sizeof(s_cluster)));
+  ASSERT_TRUE(cluster.is_raw());
+
+  auto &blocks = cluster.get_blocks();
+
+  EXPECT_EQ(8u,  blocks[0].m_position);
+  EXPECT_EQ(13u, blocks[0].m_element_size);
+  EXPECT_EQ(0,   std::memcmp(cluster.get_raw_element(blocks[0]), &s_cluster[8],  13));
+
+  EXPECT_EQ(21u, blocks[1].m_position);
+  EXPECT_EQ(29u, blocks[1].m_element_size);
+  EXPECT_EQ(0,   std::memcmp(cluster.get_raw_element(blocks[1]), &s_cluster[21], 29));
+
+  cluster.clear();
+  EXPECT_FALSE(cluster.is_raw());
+}
+
+TEST(KaxFlatCluster, TimestampScale) {
+  mm_mem_io_c in{s_cluster, sizeof(s_cluster)};
+  kax_flat_cluster_c cluster;
+
+  cluster.set_timestamp_scale(1000);
+
+  ASSERT_TRUE(cluster.read(in, sizeof(s_cluster)));
+  EXPECT_EQ(105000, cluster.get_blocks()[0].m_timestamp);
+  EXPECT_EQ(3000u,  *cluster.get_blocks()[1].m_duration);
+}
+
+TEST(KaxFlatCluster, RejectsWhatItCannotParse) {
+  unsigned char unknown_size[] = { 0x1f, 0x43, 0xb6, 0x75, 0xff, 0xe7, 0x81, 0x00 };
+  unsigned char cues[]         = { 0x1c, 0x53, 0xbb, 0x6b, 0x80 };
+  unsigned char too_big[]      = { 0x1f, 0x43, 0xb6, 0x75, 0x18, 0x00, 0x00, 0x01 }; // size MAX_BODY_SIZE + 1
+  kax_flat_cluster_c cluster;
+
+  mm_mem_io_c in1{unknown_size, sizeof(unknown_size)};
+  EXPECT_FALSE(cluster.read(in1, sizeof(unknown_size)));
+  EXPECT_EQ(0u, in1.getFilePointer());
+
+  mm_mem_io_c in2{cues, sizeof(cues)};
+  EXPECT_FALSE(cluster.read(in2, sizeof(cues)));
+  EXPECT_EQ(0u, in2.getFilePointer());
+
+  // Truncated
+  mm_mem_io_c in3{s_cluster, sizeof(s_cluster)};
+  EXPECT_FALSE(cluster.read(in3, sizeof(s_cluster) - 1));
+  EXPECT_EQ(0u, in3.getFilePointer());
+
+  mm_mem_io_c in4{too_big, sizeof(too_big)};
+  EXPECT_FALSE(cluster.read(in4, std::numeric_limits<uint32_t>::max()));
+  EXPECT_EQ(0u, in4.getFilePointer());
+}
+
+TEST(KaxFlatCluster, RejectsOverflowingEbmlLaceSizes) {
+  auto put_vint8 = [](std::vector<unsigned char> &buffer, uint64_t value) {
+    buffer.push_back(0x01);
+    for (auto shift = 48; shift >= 0; shift -= 8)
+      buffer.push_back((value >> shift) & 0xff);
+  };
+
+  auto put_size2 = [](std::vector<unsigned char> &buffer, std::size_t size) {
+    buffer.push_back(0x40 | (size >> 8));
+    buffer.push_back(size & 0xff);
+  };
+
+  // 256 frames. Each laced size is far bigger than the block, but
+  // they add up to exactly 2^64 and would therefore wrap around to 0.
+  auto const bias = (uint64_t{1} << 55) - 1;
+  std::vector<unsigned char> block{ 0x81, 0x00, 0x00, 0x86, 0xff }; // track 1, +0, key, EBML lacing, 256 frames
+
+  put_vint8(block, 0x00fffffffffffffeull);
+  put_vint8(block, bias + 0x0001010101010103ull);
+  for (auto idx = 0; idx < 252; ++idx)
+    put_vint8(block, bias);
+  put_vint8(block, bias + 0x0001010101010104ull);
+  block.insert(block.end(), { 'a', 'b', 'c', 'd' });
+
+  std::vector<unsigned char> body{ 0xe7, 0x81, 0x00, 0xa3 };      // Timestamp 0, SimpleBlock
+  put_size2(body, block.size());
+  body.insert(body.end(), block.begin(), block.end());
+
+  std::vector<unsigned char> data{ 0x1f, 0x43, 0xb6, 0x75 };      // Cluster
+  put_size2(data, body.size());
+  data.insert(data.end(), body.begin(), body.end());
+
+  mm_mem_io_c in{data.data(), data.size()};
+  kax_flat_cluster_c cluster;
+
+  EXPECT_FALSE(cluster.read(in, data.size()));
+  EXPECT_EQ(0u, in.getFilePointer());
+}
+
+}
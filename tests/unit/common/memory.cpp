@@ -2,6 +2,7 @@
 
 #include "common/endian.h"
 #include "common/memory.h"
+#include "common/memory_pool.h"
 
 #include "tests/unit/init.h"
 
@@ -268,4 +269,55 @@ TEST(Memory, OperatorBrackets) {
   ASSERT_EQ('o', buffer3[4]);
 }
 
+TEST(Memory, PoolRecyclesBuffers) {
+  mtx::mem::pool::trim();
+
+  auto before = mtx::mem::pool::statistics();
+  auto buffer = memory_c::alloc(1000);
+  auto ptr    = buffer->get_buffer();
+
+  buffer.reset();
+
+  auto middle = mtx::mem::pool::statistics();
+
+  EXPECT_EQ(before.m_releases + 1, middle.m_releases);
+  EXPECT_EQ(before.m_retained_bytes + 1024, middle.m_retained_bytes);
+
+  buffer = memory_c::alloc(600);
+
+  auto after = mtx::mem::pool::statistics();
+
+  EXPECT_EQ(ptr,                 buffer->get_buffer());
+  EXPECT_EQ(middle.m_hits + 1,   after.m_hits);
+  EXPECT_EQ(before.m_retained_bytes, after.m_retained_bytes);
+}
+
+TEST(Memory, PoolResizeWithinCapacity) {
+  auto buffer = memory_c::clone("0123456789");
+  auto ptr    = buffer->get_buffer();
+
+  buffer->resize(60);
+  EXPECT_EQ(ptr, buffer->get_buffer());
+  EXPECT_EQ(60,  buffer->get_size());
+  EXPECT_EQ(0,   std::memcmp(buffer->get_buffer(), "0123456789", 10));
+
+  buffer->resize(5000);
+  EXPECT_EQ(5000, buffer->get_size());
+  EXPECT_EQ(0,    std::memcmp(buffer->get_buffer(), "0123456789", 10));
+
+  buffer->set_offset(2);
+  buffer->resize(3);
+  EXPECT_EQ(3, buffer->get_size());
+  EXPECT_EQ(0, std::memcmp(buffer->get_buffer(), "234", 3));
+}
+
+TEST(Memory, PoolUnpooledSizes) {
+  auto before = mtx::mem::pool::statistics();
+  auto buffer = memory_c::alloc(4 * 1024 * 1024);
+  auto after  = mtx::mem::pool::statistics();
+
+  EXPECT_EQ(before.m_unpooled + 1, after.m_unpooled);
+  EXPECT_EQ(4 * 1024 * 1024,       buffer->get_size());
+}
+
 }
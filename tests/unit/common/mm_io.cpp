@@ -2,6 +2,9 @@
 
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
+#include "common/mm_mem_io.h"
+#include "common/mm_multi_file_io.h"
+#include "common/mm_read_buffer_io.h"
 
 #include "tests/unit/init.h"
 #include "tests/unit/util.h"
@@ -17,4 +20,67 @@ TEST(MmIo, Slurp) {
   ASSERT_THROW(mm_file_io_c::slurp("doesnotexist"), mtx::mm_io::exception);
 }
 
+TEST(MmIo, FastPathReads) {
+  unsigned char data[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d };
+  auto in              = std::make_shared<mm_read_buffer_io_c>(std::make_shared<mm_mem_io_c>(data, sizeof(data)), 4);
+
+  EXPECT_EQ(0x01u,       in->fast_read_uint8());
+  EXPECT_EQ(0x0203u,     in->fast_read_uint16_be());
+  EXPECT_EQ(0x04050607u, in->fast_read_uint32_be());
+  EXPECT_EQ(7u,          in->getFilePointer());
+
+  in->fast_skip(1);
+  EXPECT_EQ(0x0a09u,     in->fast_read_uint16_le());
+
+  ASSERT_NE(nullptr,     in->peek(3));
+  EXPECT_EQ(0x0b,        in->peek(3)[0]);
+  EXPECT_EQ(10u,         in->getFilePointer());
+
+  in->consume(2);
+  EXPECT_EQ(nullptr,     in->peek(2));
+  EXPECT_EQ(0x0d,        in->fast_read_uint8());
+  EXPECT_THROW(in->fast_read_uint8(), mtx::mm_io::end_of_file_x);
+
+  in->setFilePointer(2);
+  EXPECT_EQ(0x030405u,   in->fast_read_uint24_be());
+  EXPECT_EQ(nullptr,     in->peek(5));
 }
+
+TEST(MmIo, FastPathReadsUnbuffered) {
+  unsigned char data[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+  mm_mem_io_c in{data, sizeof(data)};
+
+  EXPECT_EQ(nullptr,     in.peek(1));
+  EXPECT_EQ(0x0102u,     in.fast_read_uint16_be());
+  in.fast_skip(1);
+  EXPECT_EQ(0x0405u,     in.fast_read_uint16_be());
+  EXPECT_THROW(in.fast_read_uint8(), mtx::mm_io::end_of_file_x);
+}
+
+TEST(MmIo, MultiFileReadsAcrossBoundaries) {
+  std::vector<std::filesystem::path> file_names(12, "tests/unit/data/text/chunky_bacon.txt");
+  mm_multi_file_io_c in{file_names, "chunky_bacon.txt"};
+
+  std::string expected;
+  for (auto idx = 0u; idx < file_names.size(); ++idx)
+    expected += "Chunky Bacon\n";
+
+  std::string content(expected.size(), ' ');
+  EXPECT_EQ(expected.size(), in.read(content.data(), content.size()));
+  EXPECT_EQ(expected,        content);
+  EXPECT_TRUE(in.eof());
+
+  // Seeking backwards across several boundaries
+  std::string part(20, ' ');
+  in.setFilePointer(10);
+  EXPECT_EQ(20u,              in.read(part.data(), part.size()));
+  EXPECT_EQ(expected.substr(10, 20), part);
+  EXPECT_EQ(30u,              in.getFilePointer());
+
+  in.setFilePointer(-5, libebml::seek_end);
+  EXPECT_EQ(5u,               in.read(part.data(), part.size()));
+  EXPECT_EQ("acon\n"s,        part.substr(0, 5));
+}
+
+}
+
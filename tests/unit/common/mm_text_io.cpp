@@ -55,4 +55,43 @@ TEST(MmTextIo, BomUtf32Be) {
   EXPECT_EQ("world"s, in.getline());
 }
 
+TEST(MmTextIo, LinesSpanningReadWindows) {
+  std::string text;
+  for (auto idx = 0; idx < 3; ++idx)
+    text += std::string(50'000 + idx, 'a' + idx) + "\xc3\xa9\r\n";
+
+  mm_text_io_c in{std::make_shared<mm_mem_io_c>(reinterpret_cast<unsigned char const *>(text.data()), text.size())};
+
+  for (auto idx = 0; idx < 3; ++idx)
+    EXPECT_EQ(std::string(50'000 + idx, 'a' + idx) + "\xc3\xa9", in.getline());
+
+  EXPECT_EQ(text.size(), in.getFilePointer());
+  EXPECT_TRUE(in.eof());
+}
+
+TEST(MmTextIo, SeekingWithinReadWindow) {
+  unsigned char const text[20] = { 0xff, 0xfe, 'a', 0, 'b', 0, '\r', 0, '\n', 0, 'c', 0, 'd', 0, 0xe9, 0, '\n', 0, 'e', 0 };
+  mm_text_io_c in{std::make_shared<mm_mem_io_c>(text, 20)};
+
+  EXPECT_EQ("ab"s, in.getline());
+  EXPECT_EQ(10u,   in.getFilePointer());
+  EXPECT_EQ("cd"s, in.getline(2));
+  EXPECT_EQ(14u,   in.getFilePointer());
+
+  in.setFilePointer(6);
+  EXPECT_EQ(""s,   in.getline());
+  EXPECT_EQ("cd\xc3\xa9"s, in.getline());
+
+  in.setFilePointer(0);
+  EXPECT_EQ(2u,    in.getFilePointer());
+  EXPECT_EQ("ab"s, in.getline());
+}
+
+TEST(MmTextIo, InvalidUtf8) {
+  unsigned char const text[9] = { 0xef, 0xbb, 0xbf, 'a', 'b', 0xff, 'c', '\n', 'd' };
+  mm_text_io_c in{std::make_shared<mm_mem_io_c>(text, 9)};
+
+  EXPECT_THROW(in.getline(), mtx::mm_io::text::invalid_utf8_char_x);
+}
+
 }
@@ -0,0 +1,21 @@
+#include "common/common_pch.h"
+
+#include "common/mpeg.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(Mpeg, FindStartCode) {
+  unsigned char const data[] = { 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x00, 0x01, 0x00, 0x00 };
+
+  EXPECT_EQ(4u,  mtx::mpeg::find_start_code(data,      sizeof(data)));
+  EXPECT_EQ(8u,  mtx::mpeg::find_start_code(data + 5,  sizeof(data) - 5) + 5);
+  EXPECT_EQ(0u,  mtx::mpeg::find_start_code(data + 8,  sizeof(data) - 8));
+  EXPECT_EQ(4u,  mtx::mpeg::find_start_code(data + 9,  4));
+  EXPECT_EQ(2u,  mtx::mpeg::find_start_code(data,      2));
+  EXPECT_EQ(0u,  mtx::mpeg::find_start_code(data,      0));
+  EXPECT_EQ(6u,  mtx::mpeg::find_start_code(data,      6));
+}
+
+}
@@ -0,0 +1,79 @@
+#include "common/common_pch.h"
+
+#include "common/ring_buffer.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(RingBuffer, PushAndPop) {
+  mtx::ring_buffer_c<int> rb;
+
+  EXPECT_TRUE(rb.empty());
+
+  for (auto idx = 0; idx < 20; ++idx)
+    rb.push_back(idx);
+
+  EXPECT_EQ(20u, rb.size());
+  EXPECT_EQ(0,   rb.front());
+  EXPECT_EQ(19,  rb.back());
+
+  for (auto idx = 0; idx < 15; ++idx)
+    rb.pop_front();
+
+  EXPECT_EQ(5u, rb.size());
+  EXPECT_EQ(15, rb.front());
+  EXPECT_EQ(19, rb.back());
+}
+
+TEST(RingBuffer, WrapAroundAndGrow) {
+  mtx::ring_buffer_c<int> rb;
+
+  for (auto idx = 0; idx < 16; ++idx)
+    rb.push_back(idx);
+
+  auto capacity = rb.capacity();
+
+  // Wrap around without growing.
+  for (auto idx = 16; idx < 40; ++idx) {
+    rb.pop_front();
+    rb.push_back(idx);
+  }
+
+  EXPECT_EQ(capacity, rb.capacity());
+  EXPECT_EQ(24,       rb.front());
+  EXPECT_EQ(39,       rb.back());
+
+  // Grow while wrapped around.
+  for (auto idx = 40; idx < 50; ++idx)
+    rb.push_back(idx);
+
+  EXPECT_LT(capacity, rb.capacity());
+  ASSERT_EQ(26u,      rb.size());
+
+  for (auto idx = 0u; idx < rb.size(); ++idx)
+    EXPECT_EQ(static_cast<int>(24 + idx), rb[idx]);
+}
+
+TEST(RingBuffer, Iterators) {
+  mtx::ring_buffer_c<int> rb;
+
+  for (auto value : { 5, 3, 1, 4, 2 })
+    rb.push_back(value);
+  rb.pop_front();
+
+  EXPECT_EQ(4, std::distance(rb.begin(), rb.end()));
+  EXPECT_EQ(1, *(rb.begin() + 1));
+  EXPECT_EQ(2, rb.end()[-1]);
+
+  std::sort(rb.begin(), rb.end());
+
+  std::vector<int> values{rb.begin(), rb.end()};
+  EXPECT_EQ((std::vector<int>{ 1, 2, 3, 4 }), values);
+
+  rb.clear();
+  EXPECT_TRUE(rb.empty());
+  EXPECT_TRUE(rb.begin() == rb.end());
+}
+
+}
@@ -408,5 +408,38 @@ TEST(StringParsing, ParseFloatingPointNumberAsRationalInvalid) {
   EXPECT_FALSE(mtx::string::parse_floating_point_number_as_rational("12345.-123"s, value));
 }
 
+TEST(StringParsing, ParseSizeNumberWithUnitValid) {
+  int64_t value;
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("0"s, value));
+  EXPECT_EQ(0ll, value);
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("12345"s, value));
+  EXPECT_EQ(12345ll, value);
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("12k"s, value));
+  EXPECT_EQ(12ll * 1024, value);
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("12M"s, value));
+  EXPECT_EQ(12ll * 1024 * 1024, value);
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("12g"s, value));
+  EXPECT_EQ(12ll * 1024 * 1024 * 1024, value);
+
+  EXPECT_TRUE(mtx::string::parse_size_number_with_unit("8589934591G"s, value));
+  EXPECT_EQ(8589934591ll * 1024 * 1024 * 1024, value);
+}
+
+TEST(StringParsing, ParseSizeNumberWithUnitInvalid) {
+  int64_t value;
+
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit(""s,            value));
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit("k"s,           value));
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit("-12k"s,        value));
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit("12t"s,         value));
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit("12kk"s,        value));
+  EXPECT_FALSE(mtx::string::parse_size_number_with_unit("8589934592G"s, value));
+}
+
 
 }
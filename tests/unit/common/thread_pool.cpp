@@ -0,0 +1,37 @@
+#include "common/common_pch.h"
+
+#include "common/thread_pool.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(ThreadPool, RunsAllTasks) {
+  mtx::thread_pool_c pool{4};
+  std::atomic<int> sum{};
+  std::vector<std::future<int>> results;
+
+  EXPECT_EQ(4u, pool.get_num_threads());
+
+  for (auto idx = 0; idx < 1000; ++idx)
+    results.emplace_back(pool.submit([idx, &sum]() { sum += idx; return idx * 2; }));
+
+  auto total = 0;
+  for (auto &result : results)
+    total += result.get();
+
+  pool.wait_for_idle();
+
+  EXPECT_EQ(999000, total);
+  EXPECT_EQ(499500, sum.load());
+}
+
+TEST(ThreadPool, PropagatesExceptions) {
+  mtx::thread_pool_c pool{2};
+
+  auto result = pool.submit([]() -> int { throw std::runtime_error{"failure"}; });
+
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+}
@@ -0,0 +1,61 @@
+#include "common/common_pch.h"
+
+#include "common/webvtt.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+using namespace mtx::webvtt;
+
+parser_c::cue_cptr
+parse_single_cue(std::string const &text) {
+  parser_c parser;
+
+  parser.add_joined_lines("WEBVTT\n\n"s + text);
+  parser.flush();
+
+  return parser.cue_available() ? parser.get_cue() : parser_c::cue_cptr{};
+}
+
+TEST(WebVTT, TimestampLine) {
+  auto cue = parse_single_cue("00:00:01.000 --> 00:00:02.500\nHello\n\n");
+
+  ASSERT_TRUE(!!cue);
+  EXPECT_EQ(timestamp_c::ms(1000), cue->m_start);
+  EXPECT_EQ(timestamp_c::ms(1500), cue->m_duration);
+  EXPECT_EQ("Hello"s, cue->m_content->to_string());
+  EXPECT_FALSE(!!cue->m_addition);
+
+  cue = parse_single_cue("01:02:03.004 --> 01:02:04.005\nHello\n\n");
+
+  ASSERT_TRUE(!!cue);
+  EXPECT_EQ(timestamp_c::ms(((1 * 60 + 2) * 60 + 3) * 1000 + 4), cue->m_start);
+  EXPECT_EQ(timestamp_c::ms(1001),                               cue->m_duration);
+}
+
+TEST(WebVTT, SettingsListAndLabel) {
+  auto cue = parse_single_cue("label\n00:01.000 --> 00:02.000 align:start line:0\nHello\n\n");
+
+  ASSERT_TRUE(!!cue);
+  EXPECT_EQ(timestamp_c::ms(1000), cue->m_start);
+  ASSERT_TRUE(!!cue->m_addition);
+  EXPECT_EQ("align:start line:0\nlabel\n"s, cue->m_addition->to_string());
+}
+
+TEST(WebVTT, InvalidTimestampLines) {
+  EXPECT_FALSE(!!parse_single_cue("00:01.000-->00:02.000\nHello\n\n"));
+  EXPECT_FALSE(!!parse_single_cue("00:01.00 --> 00:02.000\nHello\n\n"));
+  EXPECT_FALSE(!!parse_single_cue("00:01.000 -> 00:02.000\nHello\n\n"));
+  EXPECT_FALSE(!!parse_single_cue("00:01.000 --> 00:02.000x\nHello\n\n"));
+}
+
+TEST(WebVTT, AdjustEmbeddedTimestamps) {
+  auto offset = timestamp_c::s(10);
+
+  EXPECT_EQ("no timestamps"s,                                   parser_c::adjust_embedded_timestamps("no timestamps", offset));
+  EXPECT_EQ("a <00:00:11.500>b <c>d"s,                          parser_c::adjust_embedded_timestamps("a <00:01.500>b <c>d", offset));
+  EXPECT_EQ("<01:00:10.000><00:00:12.000> <00:01.5>"s,          parser_c::adjust_embedded_timestamps("<01:00:00.000><00:02.000> <00:01.5>", offset));
+}
+
+}
@@ -0,0 +1,73 @@
+#include "common/common_pch.h"
+
+#include <ebml/EbmlStream.h>
+#include <matroska/KaxAttachments.h>
+
+#include "common/ebml.h"
+#include "common/mm_mem_io.h"
+#include "merge/libmatroska_extensions.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+using namespace libmatroska;
+
+void
+add_attachment(KaxAttachments &attachments,
+               KaxAttached *&attached,
+               std::string const &name,
+               std::string const &content) {
+  auto attachment  = std::make_shared<attachment_t>();
+  attachment->data = memory_c::clone(content);
+
+  attached = !attached ? &GetChild<KaxAttached>(attachments) : &GetNextChild<KaxAttached>(attachments, *attached);
+
+  GetChild<KaxFileName>(attached).SetValueUTF8(name);
+  GetChild<KaxMimeType>(attached).SetValue("text/plain");
+  GetChild<KaxFileUID >(attached).SetValue(name.size());
+
+  kax_attachment_file_data_c::replace_in(*attached, attachment);
+}
+
+TEST(KaxAttachmentFileData, ExactlyOneFileDataPerAttachment) {
+  KaxAttachments attachments;
+  KaxAttached *attached{};
+
+  add_attachment(attachments, attached, "a.txt",  "Hello world");
+  add_attachment(attachments, attached, "bb.txt", "Second attachment");
+
+  mm_mem_io_c out{nullptr, 0, 1000};
+  attachments.Render(out);
+  out.setFilePointer(0);
+
+  libebml::EbmlStream stream{out};
+  std::unique_ptr<libebml::EbmlElement> element{stream.FindNextID(EBML_INFO(KaxAttachments), 0xFFFFFFFFL)};
+  ASSERT_TRUE(!!element);
+
+  libebml::EbmlElement *l1{};
+  int upper_lvl_el{};
+  element->Read(stream, EBML_CONTEXT(element.get()), upper_lvl_el, l1, true);
+  delete l1;
+
+  auto &read_attachments = static_cast<KaxAttachments &>(*element);
+  std::vector<std::string> contents;
+
+  ASSERT_EQ(2u, read_attachments.ListSize());
+
+  for (auto const &child : read_attachments) {
+    auto read_attached = dynamic_cast<KaxAttached *>(child);
+    ASSERT_TRUE(!!read_attached);
+
+    auto num_file_data = std::count_if(read_attached->begin(), read_attached->end(), [](auto *grandchild) { return Is<KaxFileData>(grandchild); });
+    EXPECT_EQ(1, num_file_data);
+
+    auto file_data = FindChild<KaxFileData>(*read_attached);
+    ASSERT_TRUE(!!file_data);
+    contents.emplace_back(reinterpret_cast<char const *>(file_data->GetBuffer()), file_data->GetSize());
+  }
+
+  EXPECT_EQ((std::vector<std::string>{ "Hello world", "Second attachment" }), contents);
+}
+
+}
@@ -0,0 +1,64 @@
+#include "common/common_pch.h"
+
+#include "merge/packet_spill_file.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(PacketSpillFile, SpillAndRestore) {
+  packet_spill_file_c file;
+
+  auto first  = memory_c::clone("Hello world"s);
+  auto second = memory_c::clone("Spilled data"s);
+
+  auto first_position  = file.spill(*first);
+  auto second_position = file.spill(*second);
+
+  ASSERT_TRUE(first_position.has_value());
+  ASSERT_TRUE(second_position.has_value());
+  EXPECT_EQ(0u,  *first_position);
+  EXPECT_EQ(11u, *second_position);
+  EXPECT_EQ(2u,  file.get_num_spilled());
+
+  EXPECT_EQ("Spilled data"s, file.restore(*second_position, second->get_size())->to_string());
+  EXPECT_EQ("Hello world"s,  file.restore(*first_position,  first->get_size())->to_string());
+  EXPECT_EQ(0u,              file.get_num_spilled());
+}
+
+TEST(PacketSpillFile, ReusesSpaceOnceEmpty) {
+  packet_spill_file_c file;
+
+  auto data = memory_c::clone("Hello world"s);
+
+  file.forget(*file.spill(*data));
+
+  EXPECT_EQ(0u,  file.get_num_spilled());
+  EXPECT_EQ(0u,  *file.spill(*data));
+  EXPECT_EQ(11u, *file.spill(*data));
+}
+
+TEST(PacketSpillFile, ReusesSpaceOfRestoredData) {
+  packet_spill_file_c file;
+
+  auto large = memory_c::clone("Hello world"s);
+  auto small = memory_c::clone("Hello"s);
+
+  EXPECT_EQ(0u,  *file.spill(*large));
+  EXPECT_EQ(11u, *file.spill(*large));
+
+  EXPECT_EQ("Hello world"s, file.restore(0, 11)->to_string());
+
+  // Start of the file, the gap after it and then the end of the file.
+  EXPECT_EQ(0u,  *file.spill(*small));
+  EXPECT_EQ(5u,  *file.spill(*small));
+  EXPECT_EQ(22u, *file.spill(*small));
+
+  file.forget(11);
+
+  EXPECT_EQ(27u,      *file.spill(*large));
+  EXPECT_EQ("Hello"s, file.restore(22, 5)->to_string());
+  EXPECT_EQ(3u,       file.get_num_spilled());
+}
+
+}
@@ -0,0 +1,95 @@
+#include "common/common_pch.h"
+
+#include "propedit/batch.h"
+#include "propedit/propedit_cli_parser.h"
+
+#include "tests/unit/init.h"
+#include "tests/unit/util.h"
+
+using namespace mtx::propedit;
+
+namespace {
+
+TEST(PropeditBatch, JsonArray) {
+  auto jobs = parse_batch_jobs(R"([
+    { "file_name": "a.mkv", "arguments": [ "--edit", "info", "--set", "title=A" ] },
+    { "file_name": "b.mkv" }
+  ])");
+
+  ASSERT_EQ(2u, jobs.size());
+  EXPECT_EQ("a.mkv"s, jobs[0].m_file_name);
+  EXPECT_EQ((std::vector<std::string>{ "--edit", "info", "--set", "title=A" }), jobs[0].m_arguments);
+  EXPECT_EQ("b.mkv"s, jobs[1].m_file_name);
+  EXPECT_TRUE(jobs[1].m_arguments.empty());
+}
+
+TEST(PropeditBatch, OneJobPerLine) {
+  auto jobs = parse_batch_jobs("{ \"file_name\": \"a.mkv\", \"arguments\": [ \"--tags\", \"all:\" ] }\r\n"
+                               "\n"
+                               "  \n"
+                               "{ \"file_name\": \"b.mkv\", \"arguments\": [] }");
+
+  ASSERT_EQ(2u, jobs.size());
+  EXPECT_EQ("a.mkv"s, jobs[0].m_file_name);
+  EXPECT_EQ((std::vector<std::string>{ "--tags", "all:" }), jobs[0].m_arguments);
+  EXPECT_EQ("b.mkv"s, jobs[1].m_file_name);
+}
+
+TEST(PropeditBatch, Empty) {
+  EXPECT_TRUE(parse_batch_jobs("").empty());
+  EXPECT_TRUE(parse_batch_jobs(" \r\n\n").empty());
+  EXPECT_TRUE(parse_batch_jobs("[]").empty());
+}
+
+TEST(PropeditBatch, InvalidJobs) {
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"file_name\": \"a.mkv\" }"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ \"a.mkv\" ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"arguments\": [] } ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"file_name\": \"\" } ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"file_name\": 42 } ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"file_name\": \"a.mkv\", \"arguments\": \"--tags\" } ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("[ { \"file_name\": \"a.mkv\", \"arguments\": [ 1 ] } ]"));
+  EXPECT_ANY_THROW(parse_batch_jobs("{ \"file_name\": \"a.mkv\" }\n{ \"file_name\": "));
+}
+
+TEST(PropeditBatch, ResultToJson) {
+  batch_result_t result;
+  result.m_file_name = "a.mkv";
+  result.m_success   = false;
+  result.m_modified  = true;
+  result.m_errors.emplace_back("oh no");
+
+  EXPECT_EQ(R"({"errors":["oh no"],"file_name":"a.mkv","modified":true,"success":false,"warnings":[]})"s, mtx::json::dump(result.to_json(), -1));
+}
+
+TEST(PropeditBatch, GlobalStateIsRestoredForEachJob) {
+  using namespace mtx::bcp47;
+
+  language_c::set_disabled(false);
+  language_c::set_normalization_mode(normalization_mode_e::canonical);
+
+  batch_global_state_c global_state;
+
+  auto run_job = [&global_state](std::vector<std::string> const &args) {
+    global_state.restore();
+    propedit_cli_parser_c{args, true}.run();
+  };
+
+  run_job({ "--disable-language-ietf", "--normalize-language-ietf", "off", "--edit", "info", "--set", "title=A", "a.mkv" });
+  EXPECT_TRUE(language_c::is_disabled());
+  EXPECT_EQ(normalization_mode_e::none, language_c::get_normalization_mode());
+
+  run_job({ "--edit", "info", "--set", "title=B", "b.mkv" });
+  EXPECT_FALSE(language_c::is_disabled());
+  EXPECT_EQ(normalization_mode_e::canonical, language_c::get_normalization_mode());
+}
+
+TEST(PropeditBatch, ProcessWideOptionsAreRejected) {
+  EXPECT_THROW(propedit_cli_parser_c({ "--quiet",                 "--edit", "info", "--set", "title=A", "a.mkv" }, true).run(), mtxut::mxerror_x);
+  EXPECT_THROW(propedit_cli_parser_c({ "--ui-language", "en_US",  "--edit", "info", "--set", "title=A", "a.mkv" }, true).run(), mtxut::mxerror_x);
+
+  // Option arguments aren't mistaken for options.
+  EXPECT_NO_THROW(propedit_cli_parser_c({ "--chapter-charset", "--quiet", "--edit", "info", "--set", "title=A", "a.mkv" }, true).run());
+}
+
+}